@@ -32,8 +32,7 @@ macro(os_set_flags)
         set(CMAKE_C_FLAGS   "${CMAKE_C_FLAGS}   -mstrict-align -ftree-vectorize")
         set(CMAKE_CXX_FLAGS "${CMAKE_CXX_FLAGS} -mstrict-align -ftree-vectorize")
     else()
-        set(CMAKE_C_FLAGS   "${CMAKE_C_FLAGS}   -mssse3")
-        set(CMAKE_CXX_FLAGS "${CMAKE_CXX_FLAGS} -mssse3")
+        # x86: SSSE3 and AVX2 are only used by the SIMD kernels, picked at runtime (see src/CMakeLists.txt)
         set(LRS_TRY_USE_AVX true)
     endif(${MACHINE} MATCHES "arm64-*" OR ${MACHINE} MATCHES "aarch64-*")
 
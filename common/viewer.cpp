@@ -789,6 +789,9 @@ namespace rs2
         _hidden_options.emplace(RS2_OPTION_STREAM_FORMAT_FILTER);
         _hidden_options.emplace(RS2_OPTION_STREAM_INDEX_FILTER);
         _hidden_options.emplace(RS2_OPTION_FRAMES_QUEUE_SIZE);
+        _hidden_options.emplace(RS2_OPTION_FRAMES_QUEUE_POLICY);
+        _hidden_options.emplace(RS2_OPTION_FRAMES_QUEUE_MEMORY_LIMIT);
+        _hidden_options.emplace(RS2_OPTION_MOTION_BLOCK_SIZE);
         _hidden_options.emplace(RS2_OPTION_NOISE_ESTIMATION);
         _hidden_options.emplace(RS2_OPTION_REGION_OF_INTEREST);
     }
@@ -43,6 +43,8 @@ rs2_context* rs2_create_context(int api_version, rs2_error** error);
 *             raw: leave all formats from camera as they are
 *         options-update-interval: 1000 - (uint32_t) time interval in milliseconds for option value change notifications
 *             (see rs2_set_options_changed_callback)
+*         options-update-intervals: {} - per-option intervals overriding options-update-interval, e.g. { "Exposure": 200 };
+*             an interval of 0 means the option is updated only when it is set
 * \param[out] error  If non-null, receives any error that occurs during this call, otherwise, errors are ignored.
 * \return            Context object
 */
@@ -254,6 +254,16 @@ rs2_pixel* rs2_get_frame_texture_coordinates(const rs2_frame* frame, rs2_error**
 */
 int rs2_get_frame_points_count(const rs2_frame* frame, rs2_error** error);
 
+/**
+* When called on a motion block frame (RS2_EXTENSION_MOTION_BLOCK_FRAME), returns the number of motion samples in it.
+* The frame data holds the timestamps of all the samples (double, milliseconds, in the frame's timestamp domain),
+* followed by all their X values, then all their Y values and all their Z values (float)
+* \param[in] frame       Motion block frame
+* \param[out] error      If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+* \return                Number of motion samples
+*/
+int rs2_get_motion_block_size(const rs2_frame* frame, rs2_error** error);
+
 /**
 * Returns the stream profile that was used to start the stream of this frame
 * \param[in] frame       frame reference, owned by the user
@@ -37,6 +37,18 @@ typedef enum rs2_recording_mode
     RS2_RECORDING_MODE_COUNT
 } rs2_recording_mode;
 
+/**
+ * SIMD instruction sets that format conversions and processing blocks may use, in increasing order. Kernels are
+ * compiled for each, and the one to use is picked at runtime according to the CPU.
+ */
+typedef enum rs2_simd_level
+{
+    RS2_SIMD_LEVEL_GENERIC, /* plain C++, or whatever the build targets by default (e.g. NEON on ARM) */
+    RS2_SIMD_LEVEL_SSSE3,
+    RS2_SIMD_LEVEL_AVX2,
+    RS2_SIMD_LEVEL_COUNT
+} rs2_simd_level;
+
 /** \brief All the parameters required to define a video stream. */
 typedef struct rs2_video_stream
 {
@@ -586,6 +598,23 @@ rs2_raw_data_buffer* rs2_terminal_parse_response(rs2_terminal_parser* terminal_p
     const void* response, unsigned int size_of_response, rs2_error** error);
 
 
+/**
+* \brief Get the highest SIMD instruction set that format conversions and processing blocks use
+* \param[out] error  If non-null, receives any error that occurs during this call, otherwise, errors are ignored.
+* \return           By default, the highest level both the CPU and the library build support; may be limited by the
+*                   LRS_SIMD_LEVEL environment variable ("generic", "ssse3" or "avx2") or rs2_set_simd_level()
+*/
+rs2_simd_level rs2_get_simd_level(rs2_error** error);
+
+/**
+* \brief Limit the SIMD instruction sets that format conversions and processing blocks use, e.g. to compare them in
+*        testing. Affects conversions right away; processing blocks created afterwards (align, pointcloud).
+* \param[in] level   The highest level to use; more than the CPU supports is limited to what it does
+* \param[out] error  If non-null, receives any error that occurs during this call, otherwise, errors are ignored.
+* \return           The level now in effect
+*/
+rs2_simd_level rs2_set_simd_level(rs2_simd_level level, rs2_error** error);
+
 #ifdef __cplusplus
 }
 #endif
@@ -126,6 +126,17 @@ extern "C" {
         RS2_OPTION_GYRO_SENSITIVITY,/**< Control of the gyro sensitivity level, see rs2_gyro_sensitivity for values */
         RS2_OPTION_REGION_OF_INTEREST,/**< The rectangular area used from the streaming profile */
         RS2_OPTION_ROTATION,/**Rotates frames*/
+        RS2_OPTION_FRAMES_QUEUE_POLICY, /**< What happens when frames are not released or handled fast enough, see rs2_frames_queue_policy for values */
+        RS2_OPTION_FRAMES_QUEUE_MEMORY_LIMIT, /**< With RS2_FRAMES_QUEUE_POLICY_MEMORY_LIMIT, the megabytes of frames the user is allowed to keep per stream */
+        RS2_OPTION_MOTION_BLOCK_SIZE, /**< Number of motion samples delivered together in each motion block frame (see RS2_EXTENSION_MOTION_BLOCK_FRAME); 1 to deliver single motion frames. Takes effect on the next start */
+        RS2_OPTION_MOTION_THREAD_PRIORITY, /**< Scheduling priority of the thread motion samples are delivered from: 0 - normal, 1 - high, 2 - real-time (may require privileges) */
+        RS2_OPTION_MOTION_THREAD_AFFINITY, /**< The CPU to run the thread motion samples are delivered from, or -1 to let it run on any */
+        RS2_OPTION_FILTER_HALF_RESOLUTION_HISTORY, /**< Temporal filter: keep the history of valid frames per pair of pixels rather than per pixel, halving its memory traffic */
+        RS2_OPTION_AUTO_EXPOSURE_SUBSAMPLING, /**< Auto-exposure computed on the host: its histogram takes every Nth pixel of every Nth row of the ROI */
+        RS2_OPTION_AUTO_EXPOSURE_SKIP_UNAPPLIED, /**< Auto-exposure computed on the host: do not analyze frames taken before the last exposure it set was applied, per their actual exposure metadata */
+        RS2_OPTION_RESIZE_WIDTH, /**< Resizing color converter: width of the output, up to the input's, or 0 to divide the input's by the filter magnitude; with only one of width and height set, the other keeps the aspect ratio */
+        RS2_OPTION_RESIZE_HEIGHT, /**< Resizing color converter: height of the output, up to the input's, or 0 to divide the input's by the filter magnitude; with only one of width and height set, the other keeps the aspect ratio */
+        RS2_OPTION_RESIZE_FILTER, /**< Resizing color converter: 0 averages the input pixels each output pixel covers (box), 1 interpolates between the nearest four (bilinear) */
         RS2_OPTION_COUNT /**< Number of enumeration values. Not a valid input: intended to be used in for-loops. */
     } rs2_option;
 
@@ -304,6 +315,19 @@ extern "C" {
     } rs2_gyro_sensitivity;
     const char * rs2_gyro_sensitivity_to_string( rs2_gyro_sensitivity mode );
 
+    /** \brief values for RS2_OPTION_FRAMES_QUEUE_POLICY option: what to do with a new frame when the user did not
+    * release (or handle) earlier frames of the same stream in time. Either way, dropped frames are reported through
+    * RS2_NOTIFICATION_CATEGORY_FRAMES_DROPPED notifications. */
+    typedef enum rs2_frames_queue_policy
+    {
+        RS2_FRAMES_QUEUE_POLICY_DROP_NEWEST = 0,   /**< Drop new frames while the user holds RS2_OPTION_FRAMES_QUEUE_SIZE frames (the default) */
+        RS2_FRAMES_QUEUE_POLICY_KEEP_LATEST = 1,   /**< Frames are handed to the callback from a separate thread; while it is busy, only the latest frame is kept waiting, and older ones are dropped. Meant for visualisation and other latest-value consumers */
+        RS2_FRAMES_QUEUE_POLICY_BLOCK = 2,         /**< The producer waits (up to 100 ms per frame) for the user to release a frame rather than dropping the new one. Only for software sensors and processing blocks, where the producer is the user's own thread (for a processing block, whichever thread invokes it); other sensors reject it, as their frames arrive on a backend thread that must not wait */
+        RS2_FRAMES_QUEUE_POLICY_MEMORY_LIMIT = 3,  /**< Like DROP_NEWEST, but the limit is RS2_OPTION_FRAMES_QUEUE_MEMORY_LIMIT megabytes of frame data rather than a number of frames. Frames whose data was provided by the user (e.g., in a software device) are still limited by number */
+        RS2_FRAMES_QUEUE_POLICY_COUNT              /**< Number of enumeration values. Not a valid input: intended to be used in for-loops. */
+    } rs2_frames_queue_policy;
+    const char * rs2_frames_queue_policy_to_string( rs2_frames_queue_policy policy );
+
     /**
     * check if an option is read-only
     * \param[in] options  the options container
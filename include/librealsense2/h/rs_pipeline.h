@@ -218,6 +218,18 @@ extern "C" {
     */
     rs2_pipeline_profile* rs2_pipeline_get_active_profile(rs2_pipeline* pipe, rs2_error ** error);
 
+    /**
+    * Return the frame counters of the streams going through the pipeline, and those of the sensors streaming them, as
+    * JSON text:
+    *     { "streams": { "Depth": { "received": 300, "synced": 300, "delivered": 299, ... } }, "sensors": { ... } }
+    * Unlike \c get_active_profile(), this can be called at any time, including while another thread waits for frames.
+    *
+    * \param[in] pipe    a pointer to an instance of the pipeline
+    * \param[out] error  if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+    * \return            JSON text in a rs2_raw_data_buffer, which should be released by rs2_delete_raw_data
+    */
+    const rs2_raw_data_buffer* rs2_get_pipeline_statistics(rs2_pipeline* pipe, rs2_error ** error);
+
     /**
     * Retrieve the device used by the pipeline.
     * The device class provides the application access to control camera additional settings -
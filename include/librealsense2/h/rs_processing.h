@@ -66,6 +66,17 @@ rs2_processing_block* rs2_create_yuy_decoder(rs2_error** error);
 */
 rs2_processing_block* rs2_create_y411_decoder(rs2_error** error);
 
+/**
+* Creates a processing block that converts YUYV, UYVY, M420 and Y411 color frames to RGB at a lower resolution, in one
+* pass, without the full-resolution RGB frame in between. The output is the input divided by
+* RS2_OPTION_FILTER_MAGNITUDE (2 by default), or RS2_OPTION_RESIZE_WIDTH x RS2_OPTION_RESIZE_HEIGHT, with the filter
+* RS2_OPTION_RESIZE_FILTER selects (box by default, or bilinear).
+* \param[in] target_format  RS2_FORMAT_RGB8, RS2_FORMAT_BGR8, RS2_FORMAT_RGBA8 or RS2_FORMAT_BGRA8; Y411 is only
+*                           converted to RS2_FORMAT_RGB8
+* \param[out] error         if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+rs2_processing_block* rs2_create_resizing_color_converter(rs2_format target_format, rs2_error** error);
+
 /**
 * Creates depth thresholding processing block
 * By controlling min and max options on the block, one could filter out depth values
@@ -81,6 +92,22 @@ rs2_processing_block* rs2_create_threshold(rs2_error** error);
 */
 rs2_processing_block* rs2_create_units_transform(rs2_error** error);
 
+/**
+* Creates a processing block that compresses Z16 depth frames into RS2_FORMAT_Z16RVL frames, using run-length and
+* variable-length coding (RVL). The result keeps the width and height of the depth, but its data is the (smaller)
+* encoded buffer.
+* \param[in] trim_bits  number of least-significant bits to drop from each depth value before encoding (0-8): 0 is
+*                       lossless; more compresses better, with an error of up to half the trimmed range
+* \param[out] error     if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+rs2_processing_block* rs2_create_rvl_encoder_block(int trim_bits, rs2_error** error);
+
+/**
+* Creates a processing block that decompresses RS2_FORMAT_Z16RVL frames back into Z16 depth frames
+* \param[out] error  if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+rs2_processing_block* rs2_create_rvl_decoder_block(rs2_error** error);
+
 /**
 * This method creates new custom processing block. This lets the users pass frames between module boundaries for processing
 * This is an infrastructure function aimed at middleware developers, and also used by provided blocks such as sync, colorizer, etc..
@@ -71,6 +71,18 @@ void rs2_record_device_resume(const rs2_device* device, rs2_error** error);
 */
 const char* rs2_record_device_filename(const rs2_device* device, rs2_error** error);
 
+/**
+* Sets whether depth (Z16) frames are compressed with RVL (run-length, variable-length coding) as they are written.
+* This is done per frame, and can be combined with (or used instead of) whole-file compression. Playback decodes the
+* frames back to Z16.
+* \param[in]  device     A recording device
+* \param[in]  enabled    Non-zero to compress depth frames written from now on
+* \param[in]  trim_bits  Number of least-significant bits to drop from each depth value (0-8): 0 is lossless; more
+*                        compresses better, with an error of up to half the trimmed range
+* \param[out] error      If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_record_device_set_depth_codec(const rs2_device* device, int enabled, int trim_bits, rs2_error** error);
+
 /**
 * Creates a playback device to play the content of the given file
 * \param[in]  file      Path to the file to play
@@ -103,6 +115,28 @@ unsigned long long int rs2_playback_get_duration(const rs2_device* device, rs2_e
  */
 void rs2_playback_seek(const rs2_device* device, long long int time, rs2_error** error);
 
+/**
+ * Set the playback to a specific frame of one of the recorded streams
+ * Frames are numbered by their order in the file, starting at 0. This does not read through the file, so it takes
+ * about the same time wherever the frame is.
+ * Frames are found by their timestamp: of several frames of the stream with the same timestamp, playback resumes from
+ * the first, whichever of them is asked for.
+ * \param[in] device       A playback device
+ * \param[in] profile      The stream, as one of the profiles of the playback device sensors
+ * \param[in] frame_index  The index of the frame, in [0, rs2_playback_get_frame_count)
+ * \param[out] error       If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+ */
+void rs2_playback_seek_to_frame(const rs2_device* device, const rs2_stream_profile* profile, unsigned long long int frame_index, rs2_error** error);
+
+/**
+ * Gets the number of frames recorded for one of the streams in the file
+ * \param[in] device     A playback device
+ * \param[in] profile    The stream, as one of the profiles of the playback device sensors
+ * \param[out] error     If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+ * \return Number of frames of the stream in the file
+ */
+unsigned long long int rs2_playback_get_frame_count(const rs2_device* device, const rs2_stream_profile* profile, rs2_error** error);
+
 /**
  * Gets the current position of the playback in the file in terms of time. Units are expressed in nanoseconds
  * \param[in] device     A playback device
@@ -150,6 +184,43 @@ void rs2_playback_device_set_real_time(const rs2_device* device, int real_time,
  */
 int rs2_playback_device_is_real_time(const rs2_device* device, rs2_error** error);
 
+/**
+ * Set how much of the file the playback reads ahead, in the background
+ *
+ * Recordings are stored in chunks, which may be compressed. Reading and decompressing the chunks that come next on
+ * worker threads, while the current one is played, lets non real time playback go as fast as the disk allows.
+ * By default, playback does not read ahead, except in max-throughput mode (see rs2_playback_device_set_max_throughput),
+ * where playback devices read ahead on one pool of worker threads they share. Setting the read-ahead gives the device
+ * worker threads of its own, in any mode.
+ * \param[in] device     A playback device
+ * \param[in] chunks     The number of chunks to keep ready ahead of playback; 0 disables reading ahead
+ * \param[in] threads    The number of worker threads to read and decompress chunks on
+ * \param[out] error     If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+ */
+void rs2_playback_device_set_read_ahead(const rs2_device* device, int chunks, int threads, rs2_error** error);
+
+/**
+ * Play the file as a batch source, as fast as the frames are consumed
+ *
+ * Turns real time off. Rather than waiting for each frame's callback to finish before reading the next frame, the
+ * playback reads (and decodes) ahead into a queue per stream, and the streams are delivered in parallel, each from its
+ * own queue. The playback waits only when a queue is full: no frames are dropped, and a pipeline gets synchronized
+ * frame sets as fast as it is polled. Unless rs2_playback_device_set_read_ahead was called, the file is also read
+ * ahead, on worker threads shared by all playback devices.
+ * \param[in] device     A playback device
+ * \param[in] queue_size The number of frames (0 to 16) to queue per stream; 0 goes back to delivering one frame at a time
+ * \param[out] error     If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+ */
+void rs2_playback_device_set_max_throughput(const rs2_device* device, int queue_size, rs2_error** error);
+
+/**
+ * The rate at which the playback delivered frames (of all streams) since it last started
+ * \param[in] device     A playback device
+ * \param[out] error     If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+ * \return Frames per second; 0 before any frame was delivered
+ */
+float rs2_playback_device_get_throughput(const rs2_device* device, rs2_error** error);
+
 /**
  * Register to receive callback from playback device upon its status changes
  *
@@ -95,6 +95,7 @@ typedef enum rs2_format
     RS2_FORMAT_Y16I            , /**< 12-bit per pixel interleaved. 12-bit left, 12-bit right. */
     RS2_FORMAT_M420            , /**< 24-bit for every pixel: y for each pixel, and u,v data for every four pixels - packed as 2 lines of y, 1 line of u,v */
     RS2_FORMAT_COMBINED_MOTION , /**< Combined motion data, as in the combined_motion structure */
+    RS2_FORMAT_Z16RVL          , /**< RVL-compressed (run-length, variable-length) 16-bit depth values; lossless unless trimmed. See rs2_create_rvl_encoder_block. */
     RS2_FORMAT_COUNT             /**< Number of enumeration values. Not a valid input: intended to be used in for-loops. */
 } rs2_format;
 const char* rs2_format_to_string(rs2_format format);
@@ -539,6 +540,18 @@ int rs2_get_recommended_processing_blocks_count(const rs2_processing_block_list*
 */
 void rs2_delete_recommended_processing_blocks(rs2_processing_block_list* list);
 
+/**
+* Returns the frame counters of the sensor's streams and, for sensors that watch their options for changes, how often
+* the options were polled, as JSON text:
+*     { "streams": { "Depth": { "received": 300, "delivered": 298, "dropped": { "archive-full": 2 }, "archive": {...} } },
+*       "options": { "updates": 30, "queries": 240, "changes": 3 } }
+* Counting goes on for the lifetime of the sensor, and this can be called at any time, including while streaming.
+* \param[in] sensor        input sensor
+* \param[out] error        if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+* \return                  JSON text in a rs2_raw_data_buffer, which should be released by rs2_delete_raw_data
+*/
+const rs2_raw_data_buffer* rs2_get_sensor_statistics(const rs2_sensor* sensor, rs2_error** error);
+
 /**
 * Imports a localization map from file to tm2 tracking device
 * \param[in]  sensor        TM2 position-tracking sensor
@@ -932,6 +932,52 @@ namespace rs2
         }
     };
 
+    class motion_block_frame : public frame
+    {
+    public:
+        /**
+        * Extends the frame class with access to the samples of a motion block frame, which holds several consecutive
+        * samples of a motion stream (see RS2_OPTION_MOTION_BLOCK_SIZE)
+        * \param[in] frame - existing frame instance
+        */
+        motion_block_frame( const frame & f )
+            : frame( f )
+        {
+            rs2_error * e = nullptr;
+            if( ! f || ( rs2_is_frame_extendable_to( f.get(), RS2_EXTENSION_MOTION_BLOCK_FRAME, &e ) == 0 && ! e ) )
+            {
+                reset();
+            }
+            error::handle( e );
+            if( *this )
+            {
+                _size = rs2_get_motion_block_size( get(), &e );
+                error::handle( e );
+            }
+        }
+        /**
+        * \return the number of samples in the block
+        */
+        size_t size() const { return _size; }
+        /**
+        * \return the timestamps of all the samples, in milliseconds
+        */
+        const double * get_timestamps() const { return static_cast< const double * >( get_data() ); }
+        /**
+        * \return the X values of all the samples; the Y and Z values follow, each in a similar array
+        */
+        const float * get_x() const { return reinterpret_cast< const float * >( get_timestamps() + _size ); }
+        const float * get_y() const { return get_x() + _size; }
+        const float * get_z() const { return get_y() + _size; }
+        /**
+        * \return the motion data of one sample, as motion_frame::get_motion_data() would
+        */
+        rs2_vector get_motion_data( size_t i ) const { return rs2_vector{ get_x()[i], get_y()[i], get_z()[i] }; }
+
+    private:
+        size_t _size = 0;
+    };
+
     class pose_frame : public frame
     {
     public:
@@ -591,6 +591,33 @@ namespace rs2
             return pipeline_profile(p);
         }
 
+        /**
+        * Return the frame counters of the streams going through the pipeline, and those of the sensors streaming them.
+        * This can be called at any time, including while another thread waits for frames.
+        *
+        * \return  JSON text; see rs2_get_pipeline_statistics
+        */
+        std::string get_statistics() const
+        {
+            std::string results;
+
+            rs2_error* e = nullptr;
+            std::shared_ptr<const rs2_raw_data_buffer> json_data(
+                rs2_get_pipeline_statistics(_pipeline.get(), &e),
+                rs2_delete_raw_data);
+            error::handle(e);
+
+            auto size = rs2_get_raw_data_size(json_data.get(), &e);
+            error::handle(e);
+
+            auto start = rs2_get_raw_data(json_data.get(), &e);
+            error::handle(e);
+
+            results.insert(results.begin(), start, start + size);
+
+            return results;
+        }
+
         operator std::shared_ptr<rs2_pipeline>() const
         {
             return _pipeline;
@@ -552,6 +552,38 @@ namespace rs2
             return block;
         }
     };
+
+    class resizing_color_converter : public filter
+    {
+    public:
+        /**
+        * Creates a processing block that converts YUYV, UYVY, M420 and Y411 color frames to RGB at a lower resolution,
+        * in one pass, without the full-resolution RGB frame in between: the input divided by RS2_OPTION_FILTER_MAGNITUDE,
+        * or RS2_OPTION_RESIZE_WIDTH x RS2_OPTION_RESIZE_HEIGHT, with a box or bilinear RS2_OPTION_RESIZE_FILTER.
+        * \param[in] target_format  RGB8, BGR8, RGBA8 or BGRA8 (only RGB8 from Y411)
+        * \param[in] magnitude      the scale to divide the input's width and height by
+        */
+        resizing_color_converter(rs2_format target_format = RS2_FORMAT_RGB8, float magnitude = 2.f)
+            : filter(init(target_format), 1)
+        {
+            set_option(RS2_OPTION_FILTER_MAGNITUDE, magnitude);
+        }
+
+    protected:
+        resizing_color_converter(std::shared_ptr<rs2_processing_block> block) : filter(block, 1) {}
+
+    private:
+        static std::shared_ptr<rs2_processing_block> init(rs2_format target_format)
+        {
+            rs2_error* e = nullptr;
+            auto block = std::shared_ptr<rs2_processing_block>(
+                rs2_create_resizing_color_converter(target_format, &e),
+                rs2_delete_processing_block);
+            error::handle(e);
+
+            return block;
+        }
+    };
   class threshold_filter : public filter
     {
     public:
@@ -617,6 +649,53 @@ namespace rs2
         }
     };
 
+    class rvl_encoder : public filter
+    {
+    public:
+        /**
+        * Creates a processing block that compresses Z16 depth into RVL (RS2_FORMAT_Z16RVL) frames
+        * \param[in] trim_bits  least-significant bits dropped from each depth value (0-8); 0 is lossless
+        */
+        rvl_encoder( int trim_bits = 0 ) : filter( init( trim_bits ), 1 ) {}
+
+    protected:
+        rvl_encoder( std::shared_ptr< rs2_processing_block > block ) : filter( block, 1 ) {}
+
+    private:
+        std::shared_ptr< rs2_processing_block > init( int trim_bits )
+        {
+            rs2_error * e = nullptr;
+            auto block = std::shared_ptr< rs2_processing_block >( rs2_create_rvl_encoder_block( trim_bits, &e ),
+                                                                  rs2_delete_processing_block );
+            error::handle( e );
+
+            return block;
+        }
+    };
+
+    class rvl_decoder : public filter
+    {
+    public:
+        /**
+        * Creates a processing block that decompresses RVL (RS2_FORMAT_Z16RVL) frames back into Z16 depth
+        */
+        rvl_decoder() : filter( init(), 1 ) {}
+
+    protected:
+        rvl_decoder( std::shared_ptr< rs2_processing_block > block ) : filter( block, 1 ) {}
+
+    private:
+        std::shared_ptr< rs2_processing_block > init()
+        {
+            rs2_error * e = nullptr;
+            auto block = std::shared_ptr< rs2_processing_block >( rs2_create_rvl_decoder_block( &e ),
+                                                                  rs2_delete_processing_block );
+            error::handle( e );
+
+            return block;
+        }
+    };
+
     class asynchronous_syncer : public processing_block
     {
     public:
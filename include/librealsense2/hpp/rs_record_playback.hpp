@@ -96,6 +96,32 @@ namespace rs2
             error::handle(e);
         }
 
+        /**
+        * Sets the playback to a specific frame of one of the recorded streams
+        * Of several frames of the stream with the same timestamp, playback resumes from the first
+        * \param[in] profile      The stream, as one of the profiles of the playback device sensors
+        * \param[in] frame_index  The index of the frame in the file, starting at 0
+        */
+        void seek_to_frame(const stream_profile& profile, uint64_t frame_index)
+        {
+            rs2_error* e = nullptr;
+            rs2_playback_seek_to_frame(_dev.get(), profile.get(), frame_index, &e);
+            error::handle(e);
+        }
+
+        /**
+        * Retrieves the number of frames recorded for one of the streams in the file
+        * \param[in] profile  The stream, as one of the profiles of the playback device sensors
+        * \return Number of frames of the stream in the file
+        */
+        uint64_t get_frame_count(const stream_profile& profile) const
+        {
+            rs2_error* e = nullptr;
+            uint64_t count = rs2_playback_get_frame_count(_dev.get(), profile.get(), &e);
+            error::handle(e);
+            return count;
+        }
+
         /**
         * Indicates if playback is in real time mode or non real time
         * \return True iff playback is in real time mode
@@ -108,6 +134,43 @@ namespace rs2
             return real_time;
         }
 
+        /**
+        * Set how much of the file the playback reads (and decompresses) ahead, in the background; by default, none
+        * except in max-throughput mode
+        * \param[in] chunks   The number of chunks to keep ready ahead of playback; 0 disables reading ahead
+        * \param[in] threads  The number of worker threads to read and decompress chunks on
+        */
+        void set_read_ahead(int chunks, int threads) const
+        {
+            rs2_error* e = nullptr;
+            rs2_playback_device_set_read_ahead(_dev.get(), chunks, threads, &e);
+            error::handle(e);
+        }
+
+        /**
+        * Play the file as a batch source, as fast as the frames are consumed: turns real time off, reads ahead into a
+        * queue per stream, and delivers the streams in parallel.
+        * \param[in] queue_size  The number of frames (0 to 16) to queue per stream; 0 goes back to delivering one frame at a time
+        */
+        void set_max_throughput(int queue_size) const
+        {
+            rs2_error* e = nullptr;
+            rs2_playback_device_set_max_throughput(_dev.get(), queue_size, &e);
+            error::handle(e);
+        }
+
+        /**
+        * The rate at which the playback delivered frames (of all streams) since it last started
+        * \return Frames per second
+        */
+        float get_throughput() const
+        {
+            rs2_error* e = nullptr;
+            float fps = rs2_playback_device_get_throughput(_dev.get(), &e);
+            error::handle(e);
+            return fps;
+        }
+
         /**
         * Set the playback to work in real time or non real time
         *
@@ -266,6 +329,18 @@ namespace rs2
             error::handle(e);
             return filename;
         }
+
+        /**
+        * Compress depth (Z16) frames with RVL as they are written; playback decodes them back to Z16
+        * \param[in] enabled    Whether to compress depth frames written from now on
+        * \param[in] trim_bits  Least-significant bits to drop from each depth value (0-8); 0 is lossless
+        */
+        void set_depth_codec(bool enabled, int trim_bits = 0)
+        {
+            rs2_error* e = nullptr;
+            rs2_record_device_set_depth_codec(_dev.get(), enabled, trim_bits, &e);
+            error::handle(e);
+        }
     protected:
         explicit recorder(std::shared_ptr<rs2_device> dev) : device(dev)
         {
@@ -295,6 +295,32 @@ namespace rs2
             return results;
         }
 
+        /**
+        * get the frame counters of the sensor's streams: how many frames were received, dropped (and why), delivered...
+        * and how often its options were polled for changes
+        * \return   JSON text; see rs2_get_sensor_statistics
+        */
+        std::string get_statistics() const
+        {
+            std::string results;
+
+            rs2_error* e = nullptr;
+            std::shared_ptr<const rs2_raw_data_buffer> json_data(
+                rs2_get_sensor_statistics(_sensor.get(), &e),
+                rs2_delete_raw_data);
+            error::handle(e);
+
+            auto size = rs2_get_raw_data_size(json_data.get(), &e);
+            error::handle(e);
+
+            auto start = rs2_get_raw_data(json_data.get(), &e);
+            error::handle(e);
+
+            results.insert(results.begin(), start, start + size);
+
+            return results;
+        }
+
         sensor& operator=(const std::shared_ptr<rs2_sensor> other)
         {
             options::operator=(other);
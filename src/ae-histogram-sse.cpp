@@ -0,0 +1,82 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "ae-histogram.h"
+
+#ifdef RS2_USE_X86_SIMD  // compiled for SSSE3
+#include <tmmintrin.h> // For SSSE3 intrinsics
+
+namespace librealsense
+{
+    namespace
+    {
+        const int SUB_HISTOGRAMS = 4;
+
+        // 8 pixels, from the bytes of a 64-bit value, each to the next sub-histogram
+        inline void count8(uint64_t pixels, uint32_t (*sub)[256])
+        {
+            ++sub[0][pixels & 0xff];
+            ++sub[1][(pixels >> 8) & 0xff];
+            ++sub[2][(pixels >> 16) & 0xff];
+            ++sub[3][(pixels >> 24) & 0xff];
+            ++sub[0][(pixels >> 32) & 0xff];
+            ++sub[1][(pixels >> 40) & 0xff];
+            ++sub[2][(pixels >> 48) & 0xff];
+            ++sub[3][pixels >> 56];
+        }
+
+        inline uint64_t low64(__m128i v)
+        {
+            uint64_t x;
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(&x), v);
+            return x;
+        }
+    }
+
+    void ae_histogram_sse(const uint8_t* data, int stride, int x_begin, int x_end, int y_begin, int y_end, int step,
+                          int h[256])
+    {
+        // Other steps gain nothing from loading 16 pixels at once
+        if (step != 1 && step != 2 && step != 4)
+        {
+            ae_histogram_generic(data, stride, x_begin, x_end, y_begin, y_end, step, h);
+            return;
+        }
+
+        // The pixels we take out of each 16, packed to the low bytes
+        const __m128i pack = step == 1 ? _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15)
+                           : step == 2 ? _mm_setr_epi8(0, 2, 4, 6, 8, 10, 12, 14, -1, -1, -1, -1, -1, -1, -1, -1)
+                                       : _mm_setr_epi8(0, 4, 8, 12, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+        const int per_load = 16 / step;
+
+        uint32_t sub[SUB_HISTOGRAMS][256] = {};
+        for (int y = y_begin; y < y_end; y += step)
+        {
+            const uint8_t* row = data + y * stride;
+            int x = x_begin;
+            for (; x + 16 <= x_end; x += 16)
+            {
+                __m128i v = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(row + x)), pack);
+                if (per_load == 4)
+                {
+                    uint32_t pixels = uint32_t(_mm_cvtsi128_si32(v));
+                    ++sub[0][pixels & 0xff];
+                    ++sub[1][(pixels >> 8) & 0xff];
+                    ++sub[2][(pixels >> 16) & 0xff];
+                    ++sub[3][pixels >> 24];
+                    continue;
+                }
+                count8(low64(v), sub);
+                if (per_load == 16)
+                    count8(low64(_mm_srli_si128(v, 8)), sub);
+            }
+            for (; x < x_end; x += step)
+                ++sub[0][row[x]];
+        }
+
+        for (int i = 0; i < 256; ++i)
+            h[i] = int(sub[0][i] + sub[1][i] + sub[2][i] + sub[3][i]);
+    }
+}
+
+#endif
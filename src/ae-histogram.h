@@ -0,0 +1,26 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <cstdint>
+
+
+namespace librealsense
+{
+    // The auto-exposure histogram of 8-bit pixels: columns [x_begin, x_end) of rows [y_begin, y_end), taking every
+    // 'step'th pixel of every 'step'th row, starting with the first. h[256] is filled, not added to.
+    // Counts go to several sub-histograms, merged at the end, so runs of equal pixels do not wait on each other's
+    // increments.
+    void ae_histogram_generic( const uint8_t * data, int stride, int x_begin, int x_end, int y_begin, int y_end, int step,
+                               int h[256] );
+
+#ifdef RS2_USE_X86_SIMD
+    void ae_histogram_sse( const uint8_t * data, int stride, int x_begin, int x_end, int y_begin, int y_end, int step,
+                           int h[256] );
+#endif
+
+    // With the best kernel for the current SIMD level
+    void ae_histogram( const uint8_t * data, int stride, int x_begin, int x_end, int y_begin, int y_end, int step,
+                       int h[256] );
+}
@@ -2,7 +2,10 @@
 // Copyright(c) 2015 Intel Corporation. All Rights Reserved.
 
 #include "algo.h"
+#include "ae-histogram.h"
+#include "target-ncc.h"
 #include "option.h"
+#include "simd-dispatch.h"
 #include "core/video-frame.h"
 
 using namespace librealsense;
@@ -27,6 +30,16 @@ float auto_exposure_state::get_auto_exposure_step() const
     return step;
 }
 
+unsigned auto_exposure_state::get_auto_exposure_subsampling() const
+{
+    return subsampling;
+}
+
+bool auto_exposure_state::get_skip_unapplied_exposure() const
+{
+    return skip_unapplied_exposure;
+}
+
 void auto_exposure_state::set_enable_auto_exposure(bool value)
 {
     is_auto_exposure = value;
@@ -47,11 +60,23 @@ void auto_exposure_state::set_auto_exposure_step(float value)
     step = value;
 }
 
+void auto_exposure_state::set_auto_exposure_subsampling(unsigned value)
+{
+    subsampling = value;
+}
+
+void auto_exposure_state::set_skip_unapplied_exposure(bool value)
+{
+    skip_unapplied_exposure = value;
+}
+
 auto_exposure_mechanism::auto_exposure_mechanism(option& gain_option, option& exposure_option, const auto_exposure_state& auto_exposure_state)
     : _gain_option(gain_option), _exposure_option(exposure_option),
       _auto_exposure_algo(auto_exposure_state),
       _keep_alive(true), _data_queue(queue_size), _frames_counter(0),
-      _skip_frames(auto_exposure_state.skip_frames)
+      _skip_frames(auto_exposure_state.skip_frames),
+      _skip_unapplied_exposure(auto_exposure_state.get_skip_unapplied_exposure()),
+      _requested_exposure(0), _exposure_pending(false), _frames_waiting_for_exposure(0)
 {
     _exposure_thread = std::make_shared<std::thread>(
                 [this]()
@@ -81,9 +106,19 @@ auto_exposure_mechanism::auto_exposure_mechanism(option& gain_option, option& ex
                 double values[2] = {};
 
                 rs2_metadata_type actual_exposure_md;
-                values[0] = frame->find_metadata( RS2_FRAME_METADATA_ACTUAL_EXPOSURE, &actual_exposure_md )
-                              ? static_cast< double >( actual_exposure_md )
-                              : _exposure_option.query();
+                bool const has_actual_exposure = frame->find_metadata( RS2_FRAME_METADATA_ACTUAL_EXPOSURE, &actual_exposure_md );
+
+                // Frames taken before the exposure we set would only ask for the same change again
+                if( _exposure_pending && _skip_unapplied_exposure && has_actual_exposure )
+                {
+                    if( std::fabs( actual_exposure_md - _requested_exposure ) > 1
+                        && ++_frames_waiting_for_exposure < max_frames_waiting_for_exposure )
+                        continue;
+                    _exposure_pending = false;
+                }
+
+                values[0] = has_actual_exposure ? static_cast< double >( actual_exposure_md )
+                                                : _exposure_option.query();
                 rs2_metadata_type gain_level_md;
                 values[1] = frame->find_metadata( RS2_FRAME_METADATA_GAIN_LEVEL, &gain_level_md )
                               ? static_cast< double >( gain_level_md )
@@ -108,6 +143,9 @@ auto_exposure_mechanism::auto_exposure_mechanism(option& gain_option, option& ex
                             value = 1;
 
                         _exposure_option.set(value);
+                        _requested_exposure = value;
+                        _exposure_pending = true;
+                        _frames_waiting_for_exposure = 0;
                     }
 
                     if (modify_gain)
@@ -143,6 +181,7 @@ void auto_exposure_mechanism::update_auto_exposure_state(const auto_exposure_sta
 {
     std::lock_guard<std::mutex> lk(_queue_mtx);
     _skip_frames = auto_exposure_state.skip_frames;
+    _skip_unapplied_exposure = auto_exposure_state.get_skip_unapplied_exposure();
     _auto_exposure_algo.update_options(auto_exposure_state);
 }
 
@@ -248,14 +287,25 @@ bool auto_exposure_algorithm::analyze_image(const frame_interface* image)
         number_of_pixels = width * height;
     }
 
+    int step;
+    {
+        std::lock_guard< std::recursive_mutex > lock( state_mutex );
+        step = std::max( 1, int( state.get_auto_exposure_subsampling() ) );
+    }
+    if (step > 1)
+    {
+        // The pixels sampled, as if the whole ROI were
+        number_of_pixels = ((image_roi.max_x - image_roi.min_x + step) / step) * ((image_roi.max_y - image_roi.min_y + step) / step);
+    }
+
     std::vector<int> H(256);
     auto total_weight = number_of_pixels;
 
     auto cols = frame->get_width();
-    im_hist((uint8_t*)frame->get_frame_data(), image_roi, frame->get_bpp() / 8 * cols, &H[0]);
+    im_hist((uint8_t*)frame->get_frame_data(), image_roi, frame->get_bpp() / 8 * cols, step, &H[0]);
 
     histogram_metric score = {};
-    histogram_score(H, total_weight, score);
+    histogram_score(H, total_weight, step, score);
     // int EffectiveDynamicRange = (score.highlight_limit - score.shadow_limit);
     ///
     float s1 = (score.main_mean - 128.0f) / 255.0f;
@@ -305,17 +355,84 @@ void auto_exposure_algorithm::update_roi(const region_of_interest& ae_roi)
     is_roi_initialized = true;
 }
 
-void auto_exposure_algorithm::im_hist(const uint8_t* data, const region_of_interest& image_roi, const int rowStep, int h[])
+void auto_exposure_algorithm::im_hist(const uint8_t* data, const region_of_interest& image_roi, const int rowStep, const int step, int h[])
 {
-    std::lock_guard<std::recursive_mutex> lock(state_mutex);
+    // The last row and column of the ROI have always been left out
+    ae_histogram(data, rowStep, image_roi.min_x, image_roi.max_x, image_roi.min_y, image_roi.max_y, step, h);
+}
+
+void librealsense::ae_histogram_generic(const uint8_t* data, int stride, int x_begin, int x_end, int y_begin, int y_end,
+                                        int step, int h[256])
+{
+    uint32_t sub[4][256] = {};
+    for (int y = y_begin; y < y_end; y += step)
+    {
+        const uint8_t* row = data + y * stride;
+        int x = x_begin;
+        for (; x + 3 * step < x_end; x += 4 * step)
+        {
+            ++sub[0][row[x]];
+            ++sub[1][row[x + step]];
+            ++sub[2][row[x + 2 * step]];
+            ++sub[3][row[x + 3 * step]];
+        }
+        for (; x < x_end; x += step)
+            ++sub[0][row[x]];
+    }
 
     for (int i = 0; i < 256; ++i)
-        h[i] = 0;
+        h[i] = int(sub[0][i] + sub[1][i] + sub[2][i] + sub[3][i]);
+}
+
+void librealsense::ae_histogram(const uint8_t* data, int stride, int x_begin, int x_end, int y_begin, int y_end, int step,
+                                int h[256])
+{
+    typedef void (*histogram_fn)(const uint8_t*, int, int, int, int, int, int, int*);
+    static simd_kernel< histogram_fn > const kernel = simd_kernel< histogram_fn >(ae_histogram_generic)
+#ifdef RS2_USE_X86_SIMD
+        .add(RS2_SIMD_LEVEL_SSSE3, ae_histogram_sse)
+#endif
+        ;
+    kernel.get()(data, stride, x_begin, x_end, y_begin, y_end, step, h);
+}
+
+void librealsense::target_correlate_row_generic(const double* const* planes, int stride, int step, const double* templ,
+                                                int tsize, double* out, int n)
+{
+    for (int q = 0; q < n; ++q)
+        out[q] = 0;
+
+    // Along the row innermost, which compilers vectorize; each sum still takes its terms in order
+    for (int m = 0; m < tsize; ++m)
+    {
+        const double* t = templ + m * tsize;
+        int r = 0, o = m * stride;
+        for (int k = 0; k < tsize; ++k)
+        {
+            const double w = t[k];
+            const double* src = planes[r] + o;
+            for (int q = 0; q < n; ++q)
+                out[q] += w * src[q];
+            if (++r == step)
+            {
+                r = 0;
+                ++o;
+            }
+        }
+    }
+}
 
-    const uint8_t* rowData = data + (image_roi.min_y * rowStep);
-    for (int i = image_roi.min_y; i < image_roi.max_y; ++i, rowData += rowStep)
-        for (int j = image_roi.min_x; j < image_roi.max_x; j+=state.sample_rate)
-            ++h[rowData[j]];
+void librealsense::target_correlate_row(const double* const* planes, int stride, int step, const double* templ,
+                                        int tsize, double* out, int n)
+{
+    typedef void (*correlate_fn)(const double* const*, int, int, const double*, int, double*, int);
+    static simd_kernel< correlate_fn > const kernel = simd_kernel< correlate_fn >(target_correlate_row_generic)
+#ifdef RS2_USE_X86_SIMD
+        .add(RS2_SIMD_LEVEL_SSSE3, target_correlate_row_sse)
+        .add(RS2_SIMD_LEVEL_AVX2, target_correlate_row_avx2)
+#endif
+        ;
+    kernel.get()(planes, stride, step, templ, tsize, out, n);
 }
 
 void auto_exposure_algorithm::increase_exposure_target(float mult, float& target_exposure)
@@ -475,8 +592,12 @@ float auto_exposure_algorithm::gain_to_value(float gain, rounding_mode_type roun
 }
 
 template <typename T> inline T sqr(const T& x) { return (x*x); }
-void auto_exposure_algorithm::histogram_score(std::vector<int>& h, const int total_weight, histogram_metric& score)
+void auto_exposure_algorithm::histogram_score(std::vector<int>& h, const int total_weight, const int step, histogram_metric& score)
 {
+    // The noise limits are counts of pixels: of fewer, when subsampled
+    const int under_exposure_noise_limit = this->under_exposure_noise_limit / (step * step);
+    const int over_exposure_noise_limit = this->over_exposure_noise_limit / (step * step);
+
     score.under_exposure_count = 0;
     score.over_exposure_count = 0;
 
@@ -572,8 +693,10 @@ void auto_exposure_algorithm::histogram_score(std::vector<int>& h, const int tot
     }
 }
 
-rect_gaussian_dots_target_calculator::rect_gaussian_dots_target_calculator(int width, int height, int roi_start_x, int roi_start_y, int roi_width, int roi_height)
-    : _full_width(width), _full_height(height), _roi_start_x(roi_start_x), _roi_start_y(roi_start_y), _width(roi_width), _height(roi_height)
+rect_gaussian_dots_target_calculator::rect_gaussian_dots_target_calculator(int width, int height, int roi_start_x, int roi_start_y, int roi_width, int roi_height,
+                                                                           int search_step)
+    : _full_width(width), _full_height(height), _roi_start_x(roi_start_x), _roi_start_y(roi_start_y), _width(roi_width), _height(roi_height),
+      _search_step(std::max(1, search_step))
 {
     _wt = _width - _tsize;
     _ht = _height - _tsize;
@@ -582,12 +705,25 @@ rect_gaussian_dots_target_calculator::rect_gaussian_dots_target_calculator(int w
     _hwidth = _width >> 1;
     _hheight = _height >> 1;
 
-    _imgt.resize(_tsize2);
     _img.resize(_size);
     _ncc.resize(_size);
     memset(_ncc.data(), 0, _size * sizeof(double));
 
     _buf.resize(_patch_size);
+
+    for (double t : _template)
+        _tsum += t;
+
+    _col_sums.resize(_width);
+    _col_sums2.resize(_width);
+    _prefix_sums.resize(_width + 1);
+    _prefix_sums2.resize(_width + 1);
+    _correlation.resize(std::max(0, _wt));
+    if (_search_step > 1)
+    {
+        _plane_width = (_width + _search_step - 1) / _search_step;
+        _planes.resize(_search_step * _height * _plane_width);
+    }
 }
 
 rect_gaussian_dots_target_calculator::~rect_gaussian_dots_target_calculator()
@@ -600,7 +736,7 @@ bool rect_gaussian_dots_target_calculator::calculate(const uint8_t* img, float*
     if (target_dims_size < 4)
         return ret;
 
-    normalize(img);
+    copy_roi(img);
     calculate_ncc();
 
     if (find_corners())
@@ -624,7 +760,7 @@ bool rect_gaussian_dots_target_calculator::calculate(const uint8_t* img, float*
     return ret;
 }
 
-void rect_gaussian_dots_target_calculator::normalize(const uint8_t* img)
+void rect_gaussian_dots_target_calculator::copy_roi(const uint8_t* img)
 {
     uint8_t min_val = 255;
     uint8_t max_val = 0;
@@ -647,104 +783,168 @@ void rect_gaussian_dots_target_calculator::normalize(const uint8_t* img)
         p += jumper;
     }
 
+    // A flat ROI leaves the previous one
     if (max_val > min_val)
     {
-        double factor = 1.0 / (max_val - min_val);
-
-        p = img;
         double* q = _img.data();
         p = img + _roi_start_y * _full_width + _roi_start_x;
         for (int j = 0; j < _height; ++j)
         {
             for (int i = 0; i < _width; ++i)
-                *q++ = 1.0f - (*p++ - min_val) * factor;
+                *q++ = *p++;
 
             p += jumper;
         }
+
+        for (int r = 0; r < _search_step && _search_step > 1; ++r)
+        {
+            double* plane = _planes.data() + r * _height * _plane_width;
+            for (int j = 0; j < _height; ++j)
+            {
+                const double* row = _img.data() + j * _width;
+                for (int i = 0; i < _plane_width; ++i)
+                {
+                    int x = r + i * _search_step;
+                    *plane++ = x < _width ? row[x] : 0;
+                }
+            }
+        }
     }
 }
 
 void rect_gaussian_dots_target_calculator::calculate_ncc()
 {
-    double* pncc = _ncc.data() + (_htsize * _width + _htsize);
-    double* pi = _img.data();
-    double* pit = _imgt.data();
+    double min_val = 2.0;
+    double max_val = -2.0;
 
-    const double* pt = nullptr;
-    const double* qi = nullptr;
+    // A coarse search leaves the positions in between without a value
+    if (_search_step > 1)
+    {
+        for (int j = 0; j < _ht; ++j)
+            std::fill_n(_ncc.data() + (_htsize + j) * _width + _htsize, _wt, std::numeric_limits<double>::quiet_NaN());
+    }
 
-    double sum = 0.0;
-    double mean = 0.0;
-    double norm = 0.0;
+    correlate(0, _wt, 0, _ht, _search_step, min_val, max_val);
 
-    double min_val = 2.0;
-    double max_val = -2.0;
-    double tmp = 0.0;
+    // Then completed around the best match in each of the quadrants find_corners() searches, before scaling: the peaks
+    // are there, and the scaling must take them in, as a full search does
+    if (_search_step > 1)
+    {
+        correlate_around_peak(_htsize, _hwidth, _htsize, _hheight, min_val, max_val);
+        correlate_around_peak(_hwidth, _width - _htsize, _htsize, _hheight, min_val, max_val);
+        correlate_around_peak(_htsize, _hwidth, _hheight, _height - _htsize, min_val, max_val);
+        correlate_around_peak(_hwidth, _width - _htsize, _hheight, _height - _htsize, min_val, max_val);
+    }
 
-    for (int j = 0; j < _ht; ++j)
+    _ncc_scaled = max_val > min_val;
+    if (_ncc_scaled)
     {
-        for (int i = 0; i < _wt; ++i)
-        {
-            qi = pi;
-            sum = 0.0f;
-            for (int m = 0; m < _tsize; ++m)
-            {
-                for (int n = 0; n < _tsize; ++n)
-                    sum += *qi++;
+        _ncc_min = min_val;
+        _ncc_factor = 1.0 / (max_val - min_val);
+        double* pncc = _ncc.data();
+        for (int i = 0; i < _size; ++i, ++pncc)
+            *pncc = scale_ncc(*pncc);
+    }
+}
 
-                qi += _wt;
-            }
+// The normalized cross-correlation of the template with the inverted image (the dots are dark), for the template
+// positions [x_begin, x_end) x [y_begin, y_end), every 'step' pixels; x_begin must be a multiple of a step above 1.
+// The values go to the NCC map, at the template centers, and update min_val and max_val.
+void rect_gaussian_dots_target_calculator::correlate(int x_begin, int x_end, int y_begin, int y_end, int step,
+                                                     double& min_val, double& max_val)
+{
+    if (x_begin >= x_end || y_begin >= y_end)
+        return;
 
-            mean = sum / _tsize2;
+    const int n = (x_end - x_begin + step - 1) / step;
+    const int cols = (n - 1) * step + _tsize;
+    const double count = _tsize2;
 
-            qi = pi;
-            sum = 0.0f;
-            pit = _imgt.data();
+    std::vector<const double*> planes(step);
+    const int stride = step > 1 ? _plane_width : _width;
+
+    double* cs = _col_sums.data();
+    double* cs2 = _col_sums2.data();
+    double* ps = _prefix_sums.data();
+    double* ps2 = _prefix_sums2.data();
+
+    int sums_row = -1; // the first of the rows summed
+    for (int y = y_begin; y < y_end; y += step)
+    {
+        const double* first = _img.data() + x_begin;
+        if (sums_row < 0 || y - sums_row >= _tsize)
+        {
+            std::fill_n(cs, cols, 0.0);
+            std::fill_n(cs2, cols, 0.0);
             for (int m = 0; m < _tsize; ++m)
             {
-                for (int n = 0; n < _tsize; ++n)
+                const double* row = first + (y + m) * _width;
+                for (int c = 0; c < cols; ++c)
                 {
-                    *pit = *qi++ - mean;
-                    sum += *pit * *pit;
-                    ++pit;
+                    cs[c] += row[c];
+                    cs2[c] += row[c] * row[c];
                 }
-                qi += _wt;
             }
+        }
+        else
+        {
+            for (int m = sums_row; m < y; ++m)
+            {
+                const double* gone = first + m * _width;
+                const double* added = first + (m + _tsize) * _width;
+                for (int c = 0; c < cols; ++c)
+                {
+                    cs[c] += added[c] - gone[c];
+                    cs2[c] += added[c] * added[c] - gone[c] * gone[c];
+                }
+            }
+        }
+        sums_row = y;
 
-            norm = sqrt(sum);
+        ps[0] = ps2[0] = 0;
+        for (int c = 0; c < cols; ++c)
+        {
+            ps[c + 1] = ps[c] + cs[c];
+            ps2[c + 1] = ps2[c] + cs2[c];
+        }
 
-            pt = _template.data();
-            pit = _imgt.data();
-            sum = 0.0;
-            for (int k = 0; k < _tsize2; ++k)
-                sum += *pit++ * *pt++;
+        if (step > 1)
+        {
+            for (int r = 0; r < step; ++r)
+                planes[r] = _planes.data() + (r * _height + y) * _plane_width + x_begin / step;
+        }
+        else
+            planes[0] = first + y * _width;
 
-            tmp = sum / norm;
+        target_correlate_row(planes.data(), stride, step, _template.data(), _tsize, _correlation.data(), n);
+
+        double* pncc = _ncc.data() + (_htsize + y) * _width + _htsize + x_begin;
+        for (int q = 0; q < n; ++q)
+        {
+            const int c = q * step;
+            const double sum = ps[c + _tsize] - ps[c];
+            const double sum2 = ps2[c + _tsize] - ps2[c];
+
+            // The sum of the squared differences from the mean, times their count: zero in a flat window, where the
+            // NCC is 0 / 0
+            const double var = count * sum2 - sum * sum;
+            const double tmp = var > 0 ? (sum * _tsum / count - _correlation[q]) / sqrt(var / count)
+                                       : std::numeric_limits<double>::quiet_NaN();
             if (tmp < min_val)
                 min_val = tmp;
 
             if (tmp > max_val)
                 max_val = tmp;
 
-            *pncc++ = tmp;
-            ++pi;
+            pncc[c] = tmp;
         }
-
-        pncc += _tsize;
-        pi += _tsize;
     }
+}
 
-    if (max_val > min_val)
-    {
-        double factor = 1.0 / (max_val - min_val);
-        double div = 1.0 - _thresh;
-        pncc = _ncc.data();
-        for (int i = 0; i < _size; ++i)
-        {
-            tmp = (*pncc - min_val) * factor;
-            *pncc++ = (tmp < _thresh ? 0 : (tmp - _thresh) / div);
-        }
-    }
+double rect_gaussian_dots_target_calculator::scale_ncc(double ncc) const
+{
+    double tmp = (ncc - _ncc_min) * _ncc_factor;
+    return tmp < _thresh ? 0 : (tmp - _thresh) / (1.0 - _thresh);
 }
 
 bool rect_gaussian_dots_target_calculator::find_corners()
@@ -752,98 +952,22 @@ bool rect_gaussian_dots_target_calculator::find_corners()
     static const int edge = 20;
 
     // upper left
-    _pts[0].x = 0;
-    _pts[0].y = 0;
-    double peak = 0.0f;
-    double* p = _ncc.data() + _htsize * _width;
-    for (int j = _htsize; j < _hheight; ++j)
-    {
-        p += _htsize;
-        for (int i = _htsize; i < _hwidth; ++i)
-        {
-            if (*p > peak)
-            {
-                peak = *p;
-                _pts[0].x = i;
-                _pts[0].y = j;
-            }
-            ++p;
-        }
-        p += _hwidth;
-    }
-
+    double peak = find_peak(_htsize, _hwidth, _htsize, _hheight, _pts[0]);
     if (peak < _thresh || _pts[0].x < edge || _pts[0].y < edge)
         return false;
 
     // upper right
-    _pts[1].x = 0;
-    _pts[1].y = 0;
-    peak = 0.0f;
-    p = _ncc.data() + (_htsize * _width);
-    for (int j = _htsize; j < _hheight; ++j)
-    {
-        p += _hwidth;
-        for (int i = _hwidth; i < _width - _htsize; ++i)
-        {
-            if (*p > peak)
-            {
-                peak = *p;
-                _pts[1].x = i;
-                _pts[1].y = j;
-            }
-            ++p;
-        }
-        p += _htsize;
-    }
-
+    peak = find_peak(_hwidth, _width - _htsize, _htsize, _hheight, _pts[1]);
     if (peak < _thresh || _pts[1].x + edge > _width || _pts[1].y < edge || _pts[1].x - _pts[0].x < edge)
         return false;
 
     // lower left
-    _pts[2].x = 0;
-    _pts[2].y = 0;
-    peak = 0.0f;
-    p = _ncc.data() + (_hheight * _width);
-    for (int j = _hheight; j < _height - _htsize; ++j)
-    {
-        p += _htsize;
-        for (int i = _htsize; i < _hwidth; ++i)
-        {
-            if (*p > peak)
-            {
-                peak = *p;
-                _pts[2].x = i;
-                _pts[2].y = j;
-            }
-            ++p;
-        }
-        p += _hwidth;
-    }
-
+    peak = find_peak(_htsize, _hwidth, _hheight, _height - _htsize, _pts[2]);
     if (peak < _thresh || _pts[2].x < edge || _pts[2].y + edge > _height || _pts[2].y - _pts[1].y < edge)
         return false;
 
     // lower right
-    _pts[3].x = 0;
-    _pts[3].y = 0;
-    peak = 0.0f;
-    p = _ncc.data() + (_hheight * _width);
-    for (int j = _hheight; j < _height - _htsize; ++j)
-    {
-        p += _hwidth;
-        for (int i = _hwidth; i < _width - _htsize; ++i)
-        {
-            if (*p > peak)
-            {
-                peak = *p;
-                _pts[3].x = i;
-                _pts[3].y = j;
-            }
-            ++p;
-        }
-        p += _htsize;
-    }
-
+    peak = find_peak(_hwidth, _width - _htsize, _hheight, _height - _htsize, _pts[3]);
     if (peak < _thresh || _pts[3].x + edge > _width || _pts[3].y + edge > _height || _pts[3].x - _pts[2].x < edge || _pts[3].y - _pts[1].y < edge)
         return false;
     else
@@ -852,6 +976,45 @@ bool rect_gaussian_dots_target_calculator::find_corners()
     return true;
 }
 
+// After a coarse search, the NCC map is completed around its best match in [x_begin, x_end) x [y_begin, y_end): where
+// find_peak() then finds the corner, in between the positions searched, and the patch refine_corners() takes around it
+void rect_gaussian_dots_target_calculator::correlate_around_peak(int x_begin, int x_end, int y_begin, int y_end,
+                                                                 double& min_val, double& max_val)
+{
+    point<int> pt;
+    if (find_peak(x_begin, x_end, y_begin, y_end, pt) <= 0)
+        return;
+
+    const int s = _search_step - 1;
+    const int hs = _patch_size >> 1;
+    const int x0 = std::max(pt.x - s - hs, _htsize);
+    const int x1 = std::min(pt.x + s + hs, _width - _htsize);
+    const int y0 = std::max(pt.y - s - hs, _htsize);
+    const int y1 = std::min(pt.y + s + hs, _height - _htsize);
+    correlate(x0 - _htsize, x1 - _htsize, y0 - _htsize, y1 - _htsize, 1, min_val, max_val);
+}
+
+double rect_gaussian_dots_target_calculator::find_peak(int x_begin, int x_end, int y_begin, int y_end, point<int>& pt) const
+{
+    pt.x = 0;
+    pt.y = 0;
+    double peak = 0.0;
+    for (int j = y_begin; j < y_end; ++j)
+    {
+        const double* p = _ncc.data() + j * _width;
+        for (int i = x_begin; i < x_end; ++i)
+        {
+            if (p[i] > peak)
+            {
+                peak = p[i];
+                pt.x = i;
+                pt.y = j;
+            }
+        }
+    }
+    return peak;
+}
+
 void rect_gaussian_dots_target_calculator::refine_corners()
 {
     double* f = _buf.data();
@@ -32,20 +32,25 @@ namespace librealsense
             is_auto_exposure(true),
             mode(auto_exposure_modes::auto_exposure_hybrid),
             rate(60),
-            step(ae_step_default_value)
+            step(ae_step_default_value),
+            subsampling(1),
+            skip_unapplied_exposure(false)
         {}
 
         bool get_enable_auto_exposure() const;
         auto_exposure_modes get_auto_exposure_mode() const;
         unsigned get_auto_exposure_antiflicker_rate() const;
         float get_auto_exposure_step() const;
+        unsigned get_auto_exposure_subsampling() const;
+        bool get_skip_unapplied_exposure() const;
 
         void set_enable_auto_exposure(bool value);
         void set_auto_exposure_mode(auto_exposure_modes value);
         void set_auto_exposure_antiflicker_rate(unsigned value);
         void set_auto_exposure_step(float value);
+        void set_auto_exposure_subsampling(unsigned value);
+        void set_skip_unapplied_exposure(bool value);
 
-        static const unsigned      sample_rate = 1;
         static const unsigned      skip_frames = 2;
 
     private:
@@ -53,6 +58,8 @@ namespace librealsense
         auto_exposure_modes mode;
         unsigned            rate;
         float               step;
+        unsigned            subsampling;  // the histogram takes every Nth pixel of every Nth row of the ROI
+        bool                skip_unapplied_exposure;  // frames taken before the last exposure set are not analyzed
     };
 
 
@@ -68,7 +75,7 @@ namespace librealsense
         struct histogram_metric { int under_exposure_count; int over_exposure_count; int shadow_limit; int highlight_limit; int lower_q; int upper_q; float main_mean; float main_std; };
         enum class rounding_mode_type { round, ceil, floor };
 
-        inline void im_hist(const uint8_t* data, const region_of_interest& image_roi, const int rowStep, int h[]);
+        inline void im_hist(const uint8_t* data, const region_of_interest& image_roi, const int rowStep, const int step, int h[]);
         void increase_exposure_target(float mult, float& target_exposure);
         void decrease_exposure_target(float mult, float& target_exposure);
         void increase_exposure_gain(const float& target_exposure, const float& target_exposure0, float& exposure, float& gain);
@@ -89,7 +96,7 @@ namespace librealsense
         float exposure_to_value(float exp_ms, rounding_mode_type rounding_mode);
         float gain_to_value(float gain, rounding_mode_type rounding_mode);
         template <typename T> inline T sqr(const T& x) { return (x*x); }
-        void histogram_score(std::vector<int>& h, const int total_weight, histogram_metric& score);
+        void histogram_score(std::vector<int>& h, const int total_weight, const int step, histogram_metric& score);
 
 
         float minimal_exposure = 0.2f, maximal_exposure = 20.f, base_gain = 2.0f, gain_limit = 15.0f;
@@ -127,6 +134,8 @@ namespace librealsense
 
     private:
         static const int                          queue_size = 2;
+        // With skip_unapplied_exposure, how many frames to wait for an exposure to be applied before analyzing anyway
+        static const int                          max_frames_waiting_for_exposure = 5;
         option&                                   _gain_option;
         option&                                   _exposure_option;
         auto_exposure_algorithm                   _auto_exposure_algo;
@@ -137,6 +146,11 @@ namespace librealsense
         std::mutex                                _queue_mtx;
         std::atomic<unsigned>                     _frames_counter;
         std::atomic<unsigned>                     _skip_frames;
+        std::atomic<bool>                         _skip_unapplied_exposure;
+        // The exposure last set, in the option's units, until frames show it; only used by the exposure thread
+        float                                     _requested_exposure;
+        bool                                      _exposure_pending;
+        int                                       _frames_waiting_for_exposure;
     };
 
     // Interface for target calculator
@@ -156,7 +170,11 @@ namespace librealsense
     class rect_gaussian_dots_target_calculator : public target_calculator_interface
     {
     public:
-        rect_gaussian_dots_target_calculator(int width, int height, int roi_start_x, int roi_start_y, int roi_width, int roi_height);
+        // With a search step above 1, the template is first matched every search_step pixels, along rows and columns,
+        // then at every pixel only around the best match of each corner: faster, but a corner can be missed or
+        // placed differently than by the exhaustive search
+        rect_gaussian_dots_target_calculator(int width, int height, int roi_start_x, int roi_start_y, int roi_width, int roi_height,
+                                             int search_step = 1);
         virtual ~rect_gaussian_dots_target_calculator();
         bool calculate(const uint8_t* img, float* target_dims, unsigned int target_dims_size) override;
 
@@ -167,10 +185,21 @@ namespace librealsense
         rect_gaussian_dots_target_calculator& operator=(const rect_gaussian_dots_target_calculator&&) = delete;
 
     protected:
-        void normalize(const uint8_t* img);
+        template <typename T>
+        struct point
+        {
+            T x;
+            T y;
+        };
+
+        void copy_roi(const uint8_t* img);
         void calculate_ncc();
+        void correlate(int x_begin, int x_end, int y_begin, int y_end, int step, double& min_val, double& max_val);
+        double scale_ncc(double ncc) const;
+        void correlate_around_peak(int x_begin, int x_end, int y_begin, int y_end, double& min_val, double& max_val);
 
         bool find_corners();
+        double find_peak(int x_begin, int x_end, int y_begin, int y_end, point<int>& pt) const;
         void refine_corners();
         bool validate_corners(const uint8_t* img);
 
@@ -184,7 +213,6 @@ namespace librealsense
         const int _tsize = 28; // template size
         const int _htsize = _tsize >> 1;
         const int _tsize2 = _tsize * _tsize;
-        std::vector<double> _imgt;
 
         const std::vector<double> _template
         {
@@ -219,10 +247,28 @@ namespace librealsense
         };
 
         const double _thresh = 0.7; // used internally, range from 0 to 1 for normalized image ma
+        double _tsum = 0.0; // sum of the template
         std::vector<double> _buf;
 
-        std::vector<double> _img;
+        std::vector<double> _img; // the ROI pixels: the correlation is normalized, so their range does not matter
         std::vector<double> _ncc;
+
+        // The NCC map is scaled to its range, as found by the (coarse) search, then thresholded
+        bool _ncc_scaled = false;
+        double _ncc_min = 0.0;
+        double _ncc_factor = 0.0;
+
+        int _search_step = 1;
+        std::vector<double> _planes; // for a coarse search, the ROI columns split by their remainder from the step
+        int _plane_width = 0;
+
+        // Of the pixels and of their squares, the sums over the template rows at each column, then the running sums
+        // of those along the row: all integers, so exact
+        std::vector<double> _col_sums;
+        std::vector<double> _col_sums2;
+        std::vector<double> _prefix_sums;
+        std::vector<double> _prefix_sums2;
+        std::vector<double> _correlation;
         int _width = 0;
         int _height = 0;
         int _size = 0;
@@ -232,13 +278,6 @@ namespace librealsense
         int _hwidth;
         int _hheight;
 
-        template <typename T>
-        struct point
-        {
-            T x;
-            T y;
-        };
-
         point<double> _corners[4];
         point<int> _pts[4];
 
@@ -6,12 +6,33 @@
 #include "core/frame-additional-data.h"
 #include "callback-invocation.h"
 
+#include <librealsense2/h/rs_option.h>
+
+#include <atomic>
+
 
 namespace librealsense
 {
     class frame_interface;
     class sensor_interface;
 
+    // How many frames the user may hold on to, per stream, and what happens once they do. These are shared by all the
+    // archives of a frame_source, and changed through its options.
+    struct frame_publish_limits
+    {
+        std::atomic< uint32_t > max_frames;     // RS2_OPTION_FRAMES_QUEUE_SIZE; 0 for no limit
+        std::atomic< int > policy;              // rs2_frames_queue_policy
+        std::atomic< uint32_t > max_megabytes;  // RS2_OPTION_FRAMES_QUEUE_MEMORY_LIMIT, with the MEMORY_LIMIT policy
+        bool producer_may_block = false;        // whether the BLOCK policy is allowed; see allow_blocking_producer()
+
+        explicit frame_publish_limits( uint32_t max_frames_ )
+            : max_frames( max_frames_ )
+            , policy( RS2_FRAMES_QUEUE_POLICY_DROP_NEWEST )
+            , max_megabytes( 256 )
+        {
+        }
+    };
+
     class archive_interface
     {
     public:
@@ -29,11 +50,17 @@ namespace librealsense
         virtual frame_interface* publish_frame(frame_interface* frame) = 0;
         virtual void unpublish_frame(frame_interface* frame) = 0;
         virtual void keep_frame(frame_interface* frame) = 0;
+
+        // Frames published and not yet released, the most there ever were at once, and how many are allowed (0 for no
+        // limit)
+        virtual uint32_t get_published_count() const = 0;
+        virtual uint32_t get_published_high_water() const = 0;
+        virtual uint32_t get_published_capacity() const = 0;
         virtual ~archive_interface() = default;
     };
 
     std::shared_ptr<archive_interface> make_archive(rs2_extension type,
-        std::atomic<uint32_t>* in_max_frame_queue_size,
+        frame_publish_limits const * limits,
         std::shared_ptr<metadata_parser_map> parsers);
 
 }
@@ -4,11 +4,13 @@
 
 #include "ds/ds-private.h"
 #include "hw-monitor.h"
+#include "hw-monitor-queue.h"
 #include "option.h"
 #include "ds/advanced_mode/presets.h"
 #include <librealsense2/h/rs_advanced_mode_command.h>
 #include "serializable-interface.h"
 #include <rsutils/lazy.h>
+#include <rsutils/time/stopwatch.h>
 
 
 typedef enum
@@ -51,6 +53,12 @@ namespace librealsense
     MAP_ADVANCED_MODE(STCensusRadius, etCencusRadius9);
     MAP_ADVANCED_MODE(STAFactor, etAFactor);
 
+    // Sets of advanced-mode groups are kept as bit-masks of (1 << EtAdvancedModeRegGroup)
+    const uint32_t all_advanced_mode_groups = ( 1u << etLastAdvancedModeGroup ) - 1;
+
+    // Returns the advanced-mode structs that differ between the two presets
+    uint32_t changed_advanced_mode_groups( const preset & from, const preset & to );
+
 
     class ds_advanced_mode_interface : public serializable_interface
     {
@@ -207,12 +215,22 @@ namespace librealsense
         rsutils::lazy< bool > _enabled;
         std::shared_ptr<advanced_mode_preset_option> _preset_opt;
         rsutils::lazy< bool > _amplitude_factor_support;
+        rsutils::lazy< std::shared_ptr< hw_monitor_queue > > _hwm_queue;
         bool _blocked = false;
         std::string _block_message;
 
         preset get_all() const;
-        void set_all( const preset & p );
-        void set_all_depth( const preset & p );
+        // Only the advanced-mode structs in 'groups' are written; other controls are always set, except the depth
+        // auto-white-balance when 'depth_auto_white_balance' is false. Whenever it is written, the color correction
+        // must be in 'groups', as the FW changes it with the auto-white-balance.
+        void set_all( const preset & p, uint32_t groups = all_advanced_mode_groups,
+                      bool depth_auto_white_balance = true );
+        void set_all_depth( const preset & p, uint32_t groups = all_advanced_mode_groups,
+                            bool depth_auto_white_balance = true );
+        // Applies 'p' over 'current' (as read from the device): only advanced-mode structs that actually
+        // changed are written
+        void set_changes( const preset & current, const preset & p, const char * what,
+                          const rsutils::time::stopwatch & sw );
         void set_all_rgb( const preset & p );
         bool should_set_rgb_preset() const;
 
@@ -232,19 +250,45 @@ namespace librealsense
             std::this_thread::sleep_for(std::chrono::milliseconds(20));
         }
 
+        template<class T>
+        void set_if_in(uint32_t groups, const T& strct) const
+        {
+            auto group = advanced_mode_traits<T>::group;
+            if (groups & (1u << group))
+                set(strct, group);
+        }
+
         template<class T>
         T get(EtAdvancedModeRegGroup cmd, T* ptr = static_cast<T*>(nullptr), int mode = 0) const
         {
-            T res;
-            auto data = assert_no_error(ds::fw_cmd::GET_ADV,
-                send_receive(encode_command(ds::fw_cmd::GET_ADV,
+            return parse_result<T>(send_receive(encode_command(ds::fw_cmd::GET_ADV,
                 static_cast<uint32_t>(cmd), mode)));
+        }
+
+        // Like get(), but the command is queued with others and only waited on when the result is needed
+        template<class T>
+        std::future<T> get_async(int mode = 0) const
+        {
+            auto result = (*_hwm_queue)->send(encode_command(ds::fw_cmd::GET_ADV,
+                static_cast<uint32_t>(advanced_mode_traits<T>::group), mode));
+            return std::async(std::launch::deferred, [result = std::move(result)]() mutable
+            {
+                auto res = result.get();
+                if (res.empty())
+                    throw std::runtime_error("Advanced mode read failed!");
+                return parse_result<T>(res);
+            });
+        }
+
+        template<class T>
+        static T parse_result(const std::vector<uint8_t>& results)
+        {
+            auto data = assert_no_error(ds::fw_cmd::GET_ADV, results);
             if (data.size() < sizeof(T))
             {
                 throw std::runtime_error("The camera returned invalid sized result!");
             }
-            res = *reinterpret_cast<T*>(data.data());
-            return res;
+            return *reinterpret_cast<T*>(data.data());
         }
 
         static uint32_t pack(uint8_t c0, uint8_t c1, uint8_t c2, uint8_t c3);
@@ -79,6 +79,7 @@ RS2_ENUM_HELPERS( rs2_host_perf_mode, HOST_PERF )
 RS2_ENUM_HELPERS( rs2_emitter_frequency_mode, EMITTER_FREQUENCY )
 RS2_ENUM_HELPERS( rs2_depth_auto_exposure_mode, DEPTH_AUTO_EXPOSURE )
 RS2_ENUM_HELPERS( rs2_gyro_sensitivity, GYRO_SENSITIVITY )
+RS2_ENUM_HELPERS( rs2_frames_queue_policy, FRAMES_QUEUE_POLICY )
 
 
 }  // namespace librealsense
@@ -0,0 +1,137 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "frame-statistics.h"
+#include "enum-helpers.h"
+#include "stream-profile-interface.h"
+
+#include <src/composite-frame.h>
+
+#include <rsutils/json.h>
+
+#include <algorithm>
+
+
+namespace librealsense {
+
+
+char const * get_string( frame_drop_reason reason )
+{
+    switch( reason )
+    {
+    case frame_drop_reason::missed:
+        return "missed";
+    case frame_drop_reason::inactive:
+        return "inactive";
+    case frame_drop_reason::archive_full:
+        return "archive-full";
+    case frame_drop_reason::queue_full:
+        return "queue-full";
+    default:
+        return "unknown";
+    }
+}
+
+
+void stream_frame_counters::update_queue_size( size_t size )
+{
+    auto const new_size = uint32_t( size );
+    auto high_water = queue_high_water.load( std::memory_order_relaxed );
+    while( new_size > high_water
+           && ! queue_high_water.compare_exchange_weak( high_water, new_size, std::memory_order_relaxed ) )
+    {
+    }
+}
+
+
+stream_frame_counters & frame_statistics::get( rs2_stream stream, int index )
+{
+    if( stream < 0 || stream >= RS2_STREAM_COUNT )
+        stream = RS2_STREAM_ANY;
+    return _counters[stream][std::min( std::max( index, 0 ), max_stream_index )];
+}
+
+
+stream_frame_counters & frame_statistics::get( frame_interface const & f )
+{
+    auto profile = f.get_stream();
+    if( ! profile )
+        return get( RS2_STREAM_ANY, 0 );
+    return get( profile->get_stream_type(), profile->get_stream_index() );
+}
+
+
+namespace {
+
+
+template< class Fn >
+void for_each_frame( frame_interface const * f, Fn && fn )
+{
+    if( ! f )
+        return;
+    if( auto composite = dynamic_cast< composite_frame const * >( f ) )
+    {
+        for( size_t i = 0; i < composite->get_embedded_frames_count(); ++i )
+            if( auto embedded = composite->get_frame( int( i ) ) )
+                fn( *embedded );
+    }
+    else
+        fn( *f );
+}
+
+
+}  // namespace
+
+
+void frame_statistics::add( frame_interface const * f, std::atomic< uint64_t > stream_frame_counters::*counter )
+{
+    for_each_frame( f, [&]( frame_interface const & frame ) { stream_frame_counters::add( get( frame ).*counter ); } );
+}
+
+
+void frame_statistics::add_dropped( frame_interface const * f, frame_drop_reason reason )
+{
+    for_each_frame( f, [&]( frame_interface const & frame ) { get( frame ).add_dropped( reason ); } );
+}
+
+
+void frame_statistics::update_queue_size( frame_interface const * f, size_t size )
+{
+    for_each_frame( f, [&]( frame_interface const & frame ) { get( frame ).update_queue_size( size ); } );
+}
+
+
+rsutils::json frame_statistics::to_json() const
+{
+    rsutils::json j = rsutils::json::object();
+    for( int stream = 0; stream < RS2_STREAM_COUNT; ++stream )
+    {
+        for( int index = 0; index <= max_stream_index; ++index )
+        {
+            auto & c = _counters[stream][index];
+            if( c.empty() )
+                continue;
+
+            rsutils::json counters = rsutils::json::object();
+            counters["received"] = c.received.load();
+            counters["converted"] = c.converted.load();
+            counters["synced"] = c.synced.load();
+            counters["delivered"] = c.delivered.load();
+            rsutils::json dropped = rsutils::json::object();
+            for( int reason = 0; reason < int( frame_drop_reason::count ); ++reason )
+                if( auto n = c.dropped[reason].load() )
+                    dropped[get_string( frame_drop_reason( reason ) )] = n;
+            counters["dropped"] = std::move( dropped );
+            counters["queue-high-water"] = c.queue_high_water.load();
+
+            std::string name = get_string( rs2_stream( stream ) );
+            if( index )
+                name += ' ' + std::to_string( index );
+            j[name] = std::move( counters );
+        }
+    }
+    return j;
+}
+
+
+}  // namespace librealsense
@@ -0,0 +1,93 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+#pragma once
+
+#include <librealsense2/h/rs_sensor.h>
+#include <rsutils/json-fwd.h>
+
+#include <atomic>
+#include <cstdint>
+
+
+namespace librealsense {
+
+
+class frame_interface;
+
+
+// Why a frame did not make it to the user
+enum class frame_drop_reason
+{
+    missed,        // never reached us: a gap in the frame counter
+    inactive,      // arrived when the sensor was not streaming
+    archive_full,  // too many frames of the stream are still held (by the user, queues, etc.)
+    queue_full,    // a frame queue overflowed and threw away its oldest
+    count
+};
+
+char const * get_string( frame_drop_reason );
+
+
+// Counters for the frames of one stream as they make their way from the backend to the user.
+//
+// These are updated on the streaming threads without taking any lock: each counter is normally only incremented by the
+// one thread handling that stage (relaxed atomics, so no contention and no ordering cost), and can be read from any
+// thread at any time.
+//
+struct stream_frame_counters
+{
+    std::atomic< uint64_t > received{ 0 };   // from the backend (or software/DDS/playback source)
+    std::atomic< uint64_t > converted{ 0 };  // output by format conversion
+    std::atomic< uint64_t > synced{ 0 };     // output by the syncer
+    std::atomic< uint64_t > delivered{ 0 };  // passed on to the user
+    std::atomic< uint64_t > dropped[int( frame_drop_reason::count )] = {};
+    std::atomic< uint32_t > queue_high_water{ 0 };  // the most frames ever waiting in a queue
+
+    static void add( std::atomic< uint64_t > & counter, uint64_t n = 1 )
+    {
+        counter.fetch_add( n, std::memory_order_relaxed );
+    }
+    void add_dropped( frame_drop_reason reason, uint64_t n = 1 ) { add( dropped[int( reason )], n ); }
+    void update_queue_size( size_t size );
+
+    // Nothing was counted: a stream whose frames were only dropped still shows
+    bool empty() const
+    {
+        if( received || converted || synced || delivered )
+            return false;
+        for( auto & n : dropped )
+            if( n )
+                return false;
+        return true;
+    }
+};
+
+
+// Frame counters for all the streams of a sensor or a pipeline, queryable while streaming (e.g., for monitoring).
+//
+// Counters are kept in a fixed table by stream type and index so that finding them never needs a lock, either.
+//
+class frame_statistics
+{
+public:
+    // Stream indices above this share the last entry
+    static constexpr int max_stream_index = 7;
+
+    stream_frame_counters & get( rs2_stream, int index );
+    stream_frame_counters & get( frame_interface const & );  // according to its stream profile
+
+    // Count a frame, or each of the frames in a frame set
+    void add( frame_interface const *, std::atomic< uint64_t > stream_frame_counters::*counter );
+    void add_dropped( frame_interface const *, frame_drop_reason );
+    void update_queue_size( frame_interface const *, size_t );
+
+    // Objects keyed by stream name ("Depth", "Infrared 1", ...) for every stream that has seen any frames:
+    //     { "Depth": { "received": 300, "delivered": 298, "dropped": { "archive-full": 2 }, ... }, ... }
+    rsutils::json to_json() const;
+
+private:
+    stream_frame_counters _counters[RS2_STREAM_COUNT][max_stream_index + 1];
+};
+
+
+}  // namespace librealsense
@@ -21,4 +21,23 @@ public:
 MAP_EXTENSION( RS2_EXTENSION_MOTION_FRAME, librealsense::motion_frame );
 
 
+// Consecutive samples of a motion stream in a single frame, so high-rate streams don't pay the per-frame overhead for
+// each sample. The data is a structure of arrays: the timestamps of all the samples (double), then all their X values,
+// their Y values and their Z values (float). The frame header (timestamp, number, metadata) is that of the last sample.
+class motion_block_frame : public frame
+{
+public:
+    static constexpr size_t bytes_per_sample = sizeof( double ) + 3 * sizeof( float );
+
+    motion_block_frame()
+        : frame()
+    {
+    }
+
+    size_t get_sample_count() const { return data.size() / bytes_per_sample; }
+};
+
+MAP_EXTENSION( RS2_EXTENSION_MOTION_BLOCK_FRAME, librealsense::motion_block_frame );
+
+
 }  // namespace librealsense
@@ -2,15 +2,81 @@
 // Copyright(c) 2023 Intel Corporation. All Rights Reserved.
 
 #include <src/core/options-watcher.h>
+#include <src/core/enum-helpers.h>
 #include <proc/synthetic-stream.h>
 #include <rsutils/json.h>
 
+#include <cstring>
+#include <vector>
+
 using rsutils::json;
 
 
 namespace librealsense {
 
 
+const std::chrono::milliseconds options_watcher::default_interval( -1 );
+const std::chrono::milliseconds options_watcher::on_write_only( 0 );
+
+
+// Values are compared by their bits, recursively for arrays and objects: besides being cheaper than a json comparison,
+// it means a NaN value does not look like a change every time it is queried
+static bool same_value( json const & a, json const & b )
+{
+    if( a.type() != b.type() )
+        return false;
+    switch( a.type() )
+    {
+    case json::value_t::null:
+        return true;
+    case json::value_t::boolean:
+        return *a.get_ptr< json::boolean_t const * >() == *b.get_ptr< json::boolean_t const * >();
+    case json::value_t::number_integer:
+        return *a.get_ptr< json::number_integer_t const * >() == *b.get_ptr< json::number_integer_t const * >();
+    case json::value_t::number_unsigned:
+        return *a.get_ptr< json::number_unsigned_t const * >() == *b.get_ptr< json::number_unsigned_t const * >();
+    case json::value_t::number_float:
+        return std::memcmp( a.get_ptr< json::number_float_t const * >(),
+                            b.get_ptr< json::number_float_t const * >(),
+                            sizeof( json::number_float_t ) )
+            == 0;
+    case json::value_t::string:
+    {
+        auto & sa = *a.get_ptr< json::string_t const * >();
+        auto & sb = *b.get_ptr< json::string_t const * >();
+        return sa.size() == sb.size() && std::memcmp( sa.data(), sb.data(), sa.size() ) == 0;
+    }
+    case json::value_t::binary:
+    {
+        auto & ba = *a.get_ptr< json::binary_t const * >();
+        auto & bb = *b.get_ptr< json::binary_t const * >();
+        return ba.size() == bb.size() && ( ba.empty() || std::memcmp( ba.data(), bb.data(), ba.size() ) == 0 );
+    }
+    case json::value_t::array:
+    {
+        if( a.size() != b.size() )
+            return false;
+        for( size_t i = 0; i < a.size(); ++i )
+            if( ! same_value( a[i], b[i] ) )
+                return false;
+        return true;
+    }
+    case json::value_t::object:
+    {
+        if( a.size() != b.size() )
+            return false;
+        // Both are ordered by key
+        for( auto ia = a.begin(), ib = b.begin(); ia != a.end(); ++ia, ++ib )
+            if( ia.key() != ib.key() || ! same_value( ia.value(), ib.value() ) )
+                return false;
+        return true;
+    }
+    default:
+        return false;  // discarded: never a value of ours
+    }
+}
+
+
 options_watcher::options_watcher( std::chrono::milliseconds update_interval )
     : _update_interval( update_interval )
     , _destructing( false )
@@ -23,11 +89,44 @@ options_watcher::~options_watcher()
     stop();
 }
 
-void options_watcher::register_option( rs2_option id, std::shared_ptr< option > option )
+std::chrono::milliseconds options_watcher::builtin_update_interval( rs2_option id )
+{
+    switch( id )
+    {
+    case RS2_OPTION_FRAMES_QUEUE_SIZE:
+    case RS2_OPTION_ERROR_POLLING_ENABLED:
+    case RS2_OPTION_GLOBAL_TIME_ENABLED:
+        return on_write_only;
+
+    case RS2_OPTION_ASIC_TEMPERATURE:
+    case RS2_OPTION_PROJECTOR_TEMPERATURE:
+    case RS2_OPTION_MOTION_MODULE_TEMPERATURE:
+    case RS2_OPTION_LLD_TEMPERATURE:
+    case RS2_OPTION_MC_TEMPERATURE:
+    case RS2_OPTION_MA_TEMPERATURE:
+    case RS2_OPTION_APD_TEMPERATURE:
+    case RS2_OPTION_HUMIDITY_TEMPERATURE:
+    case RS2_OPTION_OHM_TEMPERATURE:
+    case RS2_OPTION_SOC_PVT_TEMPERATURE:
+        return std::chrono::milliseconds( 5000 );
+
+    default:
+        return default_interval;
+    }
+}
+
+void options_watcher::register_option( rs2_option id,
+                                       std::shared_ptr< option > option,
+                                       std::chrono::milliseconds update_interval )
 {
+    if( update_interval == default_interval )
+        update_interval = builtin_update_interval( id );
     {
         std::lock_guard< std::mutex > lock( _mutex );
         _options[id] = { option };
+        auto & schedule = _schedules[id];
+        schedule.interval = update_interval;
+        schedule.next_update = {};
     }
 
     if( should_start() )
@@ -39,12 +138,93 @@ void options_watcher::unregister_option( rs2_option id )
     {
         std::lock_guard< std::mutex > lock( _mutex );
         _options.erase( id );
+        _schedules.erase( id );
     }
 
     if( should_stop() )
         stop();
 }
 
+void options_watcher::option_written( rs2_option id )
+{
+    {
+        std::lock_guard< std::mutex > lock( _mutex );
+        auto it = _schedules.find( id );
+        if( it == _schedules.end() )
+            return;
+        it->second.next_update = {};
+        _written = true;
+    }
+    _stopping.notify_all();
+}
+
+void options_watcher::options_notified()
+{
+    {
+        std::lock_guard< std::mutex > lock( _mutex );
+        for( auto & id_schedule : _schedules )
+        {
+            auto it = _interval_overrides.find( id_schedule.first );
+            auto interval = it != _interval_overrides.end() ? it->second : id_schedule.second.interval;
+            if( interval == on_write_only )
+                id_schedule.second.next_update = {};
+        }
+        _written = true;
+    }
+    _stopping.notify_all();
+}
+
+void options_watcher::set_update_interval( rs2_option id, std::chrono::milliseconds update_interval )
+{
+    std::lock_guard< std::mutex > lock( _mutex );
+    _interval_overrides[id] = update_interval;
+}
+
+void options_watcher::configure( json const & settings )
+{
+    if( auto interval_j = settings.nested( std::string( "options-update-interval", 23 ) ) )
+    {
+        auto interval = interval_j.get< uint32_t >();  // NOTE: can throw!
+        set_update_interval( std::chrono::milliseconds( interval ) );
+    }
+    if( auto intervals_j = settings.nested( std::string( "options-update-intervals", 24 ), &json::is_object ) )
+    {
+        for( auto it = intervals_j.begin(); it != intervals_j.end(); ++it )
+        {
+            rs2_option id;
+            if( ! try_parse( it.key(), id ) )
+                throw invalid_value_exception( "invalid option name in options-update-intervals: " + it.key() );
+            auto interval = it.value().get< uint32_t >();  // NOTE: can throw!
+            set_update_interval( id, std::chrono::milliseconds( interval ) );
+        }
+    }
+}
+
+json options_watcher::statistics::to_json() const
+{
+    return json::object( { { "updates", n_updates }, { "queries", n_queries }, { "changes", n_changes } } );
+}
+
+options_watcher::statistics options_watcher::get_statistics() const
+{
+    std::lock_guard< std::mutex > lock( _mutex );
+    return _stats;
+}
+
+std::chrono::milliseconds options_watcher::get_interval( option_schedule const & schedule ) const
+{
+    return schedule.interval == default_interval ? _update_interval : schedule.interval;
+}
+
+std::chrono::steady_clock::time_point options_watcher::next_update_time() const
+{
+    // Never sleep longer than the default interval, so changes to it take effect
+    auto next = now() + _update_interval;
+    for( auto & id_schedule : _schedules )
+        next = std::min( next, id_schedule.second.next_update );
+    return next;
+}
+
 rsutils::subscription options_watcher::subscribe( callback && cb )
 {
     rsutils::subscription ret = _on_values_changed.subscribe( std::move( cb ) );
@@ -99,7 +279,9 @@ void options_watcher::thread_loop()
     {
         {
             std::unique_lock< std::mutex > lock( _mutex );
-            _stopping.wait_for( lock, _update_interval );
+            if( ! _written )
+                _stopping.wait_for( lock, next_update_time() - now() );
+            _written = false;
         }
 
         // Checking for stop conditions after sleep.
@@ -120,33 +302,63 @@ options_watcher::options_and_values options_watcher::update_options()
 {
     options_and_values updated_options;
 
-    std::lock_guard< std::mutex > lock( _mutex );
+    // The options that are due are picked under the lock, but queried without it: each query is a device control or
+    // HW command, and option_written() and the rest should not have to wait for them
+    std::vector< std::pair< rs2_option, option_and_value > > due;
+    {
+        std::lock_guard< std::mutex > lock( _mutex );
 
-    if( should_stop() )
-        return updated_options;
+        if( should_stop() )
+            return updated_options;
+
+        ++_stats.n_updates;
+        auto const now = this->now();
+        for( auto & opt : _options )
+        {
+            // Only options that are due are updated; new ones are due right away. Options that have no value (or
+            // could not be queried) are no exception: they, too, wait for their interval
+            auto & schedule = _schedules[opt.first];
+            if( now < schedule.next_update )
+                continue;
+            auto it = _interval_overrides.find( opt.first );
+            if( it != _interval_overrides.end() )
+                schedule.interval = it->second;
+            auto const interval = get_interval( schedule );
+            if( interval == on_write_only )
+                schedule.next_update = std::chrono::steady_clock::time_point::max();
+            else
+                schedule.next_update = now + interval;
+            due.emplace_back( opt.first, opt.second );
+        }
+    }
 
-    for( auto & opt : _options )
+    size_t n_queries = 0;
+    for( auto & id_opt : due )
     {
+        auto & opt = id_opt.second;
         try
         {
             json curr_val;
-            if( opt.second.sptr->is_enabled() )
-                curr_val = opt.second.sptr->get_value();
+            if( opt.sptr->is_enabled() )
+            {
+                ++n_queries;
+                curr_val = opt.sptr->get_value();
+            }
 
-            if( ! opt.second.p_last_known_value || *opt.second.p_last_known_value != curr_val )
+            if( ! opt.p_last_known_value || ! same_value( *opt.p_last_known_value, curr_val ) )
             {
-                opt.second.p_last_known_value = std::make_shared< const json >( std::move( curr_val ) );
-                updated_options[opt.first] = opt.second;
+                opt.p_last_known_value = std::make_shared< const json >( std::move( curr_val ) );
+                updated_options[id_opt.first] = opt;
             }
         }
         catch( ... )
         {
             // Some options cannot be queried all the time (i.e. streaming only) - so if we HAD a value, it needs to be
             // removed!
-            if( opt.second.p_last_known_value && ! opt.second.p_last_known_value->is_null() )
+            if( opt.p_last_known_value && ! opt.p_last_known_value->is_null() )
             {
-                opt.second.p_last_known_value = std::make_shared< const json >();
-                updated_options[opt.first] = opt.second;
+                opt.p_last_known_value = std::make_shared< const json >();
+                updated_options[id_opt.first] = opt;
             }
         }
 
@@ -155,6 +367,21 @@ options_watcher::options_and_values options_watcher::update_options()
             break;
     }
 
+    std::lock_guard< std::mutex > lock( _mutex );
+    _stats.n_queries += n_queries;
+    for( auto it = updated_options.begin(); it != updated_options.end(); )
+    {
+        // Unless the option was unregistered (or replaced) while we queried it
+        auto registered = _options.find( it->first );
+        if( registered == _options.end() || registered->second.sptr != it->second.sptr )
+        {
+            it = updated_options.erase( it );
+            continue;
+        }
+        registered->second.p_last_known_value = it->second.p_last_known_value;
+        ++_stats.n_changes;
+        ++it;
+    }
     return updated_options;
 }
 
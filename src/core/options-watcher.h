@@ -24,6 +24,11 @@ namespace librealsense {
 // When a user subscribes to notification the options_watcher will automatically update (query) registered options
 // values in set time intervals (creates a thread). If one or more of the values have changed the watcher will notify
 // through the callback subscription.
+//
+// Each option can have its own update interval; an option with an interval of 'on_write_only' is never polled, and is
+// only re-queried after option_written() is called for it (i.e., when the option is known to have been set) or after
+// options_notified() (when the device notified of changes). Options registered without an interval get their
+// built-in one (see builtin_update_interval()), which is usually the watcher's default.
 class options_watcher
 {
 public:
@@ -36,33 +41,82 @@ public:
     using options_and_values = std::map< rs2_option, option_and_value >;
     using callback = std::function< void( options_and_values const & ) >;
 
+    // Use the watcher's default update interval
+    static const std::chrono::milliseconds default_interval;
+    // Never poll; query only after the option is written
+    static const std::chrono::milliseconds on_write_only;
+
+    struct statistics
+    {
+        size_t n_updates = 0;  // number of update cycles
+        size_t n_queries = 0;  // number of option values queried
+        size_t n_changes = 0;  // number of value changes found
+
+        // { "updates": <n>, "queries": <n>, "changes": <n> }
+        rsutils::json to_json() const;
+    };
+
 public:
     options_watcher( std::chrono::milliseconds update_interval = std::chrono::milliseconds( 1000 ) );
     ~options_watcher();
 
-    void register_option( rs2_option id, std::shared_ptr< option > option );
+    void register_option( rs2_option id,
+                          std::shared_ptr< option > option,
+                          std::chrono::milliseconds update_interval = default_interval );
     void unregister_option( rs2_option id );
 
+    // Let the watcher know an option was set, so it is queried on the next update rather than when its interval is up
+    void option_written( rs2_option id );
+    // Let the watcher know the device notified of option changes: 'on_write_only' options are queried on the next update
+    void options_notified();
+
+    // Host-side options, only changed when written, are never polled; slowly-changing readings (temperatures) are
+    // polled every few seconds; all others use the watcher's default interval
+    static std::chrono::milliseconds builtin_update_interval( rs2_option id );
+
     rsutils::subscription subscribe( callback && cb );
 
     void set_update_interval( std::chrono::milliseconds update_interval ) { _update_interval = update_interval; }
+    void set_update_interval( rs2_option id, std::chrono::milliseconds update_interval );
+
+    // Read the update interval(s) from the context settings:
+    //     options-update-interval: <ms>                  - the default update interval
+    //     options-update-intervals: { <option>: <ms> }   - per-option intervals; 0 to update only when written
+    void configure( rsutils::json const & settings );
+
+    statistics get_statistics() const;
 
 protected:
     bool should_start() const;
     bool should_stop() const;
-    void start();
+    virtual void start();
     void stop();
     void thread_loop();
     virtual options_and_values update_options();
     void notify( options_and_values const & updated_options );
+    // The time update intervals are measured by
+    virtual std::chrono::steady_clock::time_point now() const { return std::chrono::steady_clock::now(); }
+
+    struct option_schedule
+    {
+        std::chrono::milliseconds interval = default_interval;
+        std::chrono::steady_clock::time_point next_update;  // default (epoch) means ASAP
+    };
+
+    std::chrono::milliseconds get_interval( option_schedule const & ) const;
+    std::chrono::steady_clock::time_point next_update_time() const;
 
     options_and_values _options;
+    std::map< rs2_option, option_schedule > _schedules;
+    std::map< rs2_option, std::chrono::milliseconds > _interval_overrides;
     rsutils::signal< options_and_values const & > _on_values_changed;
     std::chrono::milliseconds _update_interval;
     std::thread _updater;
-    std::mutex _mutex;
+    mutable std::mutex _mutex;
     std::condition_variable _stopping;
     std::atomic_bool _destructing;
+    bool _written = false;
+    statistics _stats;
 };
 
 
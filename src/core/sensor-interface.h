@@ -13,6 +13,7 @@
 #include <librealsense2/hpp/rs_types.hpp>
 
 #include <rsutils/subscription.h>
+#include <rsutils/json-fwd.h>
 
 #include <vector>
 #include <memory>
@@ -58,6 +59,14 @@ public:
     virtual void set_frames_callback( rs2_frame_callback_sptr cb ) = 0;
 
     virtual rsutils::subscription register_options_changed_callback( options_watcher::callback && cb ) = 0;
+
+    // Called after an option value was set through the API, so options-changed callbacks can be raised promptly
+    virtual void on_option_written( rs2_option ) {}
+
+    // Frame counters by stream, since the sensor was created (see frame_statistics):
+    //     { "streams": { "Depth": { "received": 300, ..., "archive": { "in-use": 2, ... } }, ... } }
+    // Safe to call while streaming.
+    virtual rsutils::json get_statistics() const = 0;
 };
 
 
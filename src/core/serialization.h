@@ -336,12 +336,17 @@ namespace librealsense
             virtual void write_snapshot(const sensor_identifier& sensor_id, const nanoseconds& timestamp, rs2_extension type, const std::shared_ptr<extension_snapshot>& snapshot) = 0;
             virtual void write_notification(const sensor_identifier& stream_id, const nanoseconds& timestamp, const notification& n) = 0;
             virtual const std::string& get_file_name() const = 0;
+            // Compress depth (Z16) images with RVL, dropping trim_bits least-significant bits (0 is lossless)
+            virtual void set_depth_codec(bool enabled, unsigned trim_bits) = 0;
             virtual ~writer() = default;
         };
 
         class reader
         {
         public:
+            // What max-throughput playback reads ahead, unless set otherwise
+            static constexpr uint32_t default_read_ahead_chunks = 4;
+
             virtual ~reader() = default;
             virtual device_snapshot query_device_description(const nanoseconds& time) = 0;
             virtual std::shared_ptr<serialized_data> read_next_data() = 0;
@@ -352,6 +357,12 @@ namespace librealsense
             virtual void disable_stream(const std::vector<device_serializer::stream_identifier>& stream_ids) = 0;
             virtual const std::string& get_file_name() const = 0;
             virtual std::vector<std::shared_ptr<serialized_data>> fetch_last_frames(const nanoseconds& seek_time) = 0;
+            // Random access to the frames of a single stream, by their order in the file
+            virtual size_t query_frame_count(const stream_identifier& stream_id) = 0;
+            virtual nanoseconds query_frame_timestamp(const stream_identifier& stream_id, size_t index) = 0;
+            // How much of the file to read (and decompress) ahead of playback, in the background; none by default.
+            // With 0 threads, reads ahead on threads shared with all other readers.
+            virtual void set_read_ahead(uint32_t chunks, uint32_t threads) = 0;
         };
     }
 }
@@ -16,6 +16,7 @@
 #include <realdds/topics/device-info-msg.h>
 #include <realdds/topics/flexible-msg.h>
 #include <realdds/topics/blob-msg.h>
+#include <realdds/topics/metadata-msg.h>
 #include <realdds/topics/dds-topic-names.h>
 
 #include <src/stream.h>
@@ -349,13 +350,12 @@ dds_device_proxy::dds_device_proxy( std::shared_ptr< const device_info > const &
 
     if( _dds_dev->supports_metadata() )
     {
-        _metadata_subscription = _dds_dev->on_metadata_available(
-            [this]( std::shared_ptr< const json > const & dds_md )
+        _metadata_subscription = _dds_dev->on_metadata_msg_available(
+            [this]( std::shared_ptr< const realdds::topics::metadata_msg > const & dds_md )
             {
-                auto & stream_name = dds_md->nested( realdds::topics::metadata::key::stream_name ).string_ref();
-                auto it = _stream_name_to_owning_sensor.find( stream_name );
+                auto it = _stream_name_to_owning_sensor.find( dds_md->stream_name );
                 if( it != _stream_name_to_owning_sensor.end() )
-                    it->second->handle_new_metadata( stream_name, dds_md );
+                    it->second->handle_new_metadata( dds_md );
             } );
     }
 
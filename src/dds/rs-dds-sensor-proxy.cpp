@@ -14,6 +14,7 @@
 #include <realdds/topics/device-info-msg.h>
 #include <realdds/topics/image-msg.h>
 #include <realdds/topics/imu-msg.h>
+#include <realdds/topics/metadata-msg.h>
 #include <realdds/topics/dds-topic-names.h>
 
 #include <src/core/options-registry.h>
@@ -42,12 +43,19 @@ dds_sensor_proxy::dds_sensor_proxy( std::string const & sensor_name,
     , _name( sensor_name )
     , _md_enabled( dev->supports_metadata() )
 {
-    rsutils::json const & settings = owner->get_context()->get_settings();
-    if( auto interval_j = settings.nested( std::string( "options-update-interval", 23 ) ) )
-    {
-        auto interval = interval_j.get< uint32_t >();  // NOTE: can throw!
-        _options_watcher.set_update_interval( std::chrono::milliseconds( interval ) );
-    }
+    _options_watcher.configure( owner->get_context()->get_settings() );
+    // Our option values are only ever changed by the device's replies and notifications: the watcher is told of
+    // those rather than poll for them
+    _option_notifications = dev->on_notification(
+        [this]( std::string const & id, json const & )
+        {
+            if( id == realdds::topics::reply::set_option::id || id == realdds::topics::reply::query_option::id
+                || id == realdds::topics::reply::query_options::id )
+                _options_watcher.options_notified();
+        } );
+    // Frames go through our formats converter before they're delivered
+    _source.set_statistics( _statistics, false );
+    _formats_converter.set_statistics( _statistics );
 }
 
 
@@ -163,6 +171,13 @@ rsutils::subscription dds_sensor_proxy::register_options_changed_callback( optio
     return _options_watcher.subscribe( std::move( cb ) );
 }
 
+json dds_sensor_proxy::get_statistics() const
+{
+    auto j = super::get_statistics();
+    j["options"] = _options_watcher.get_statistics().to_json();
+    return j;
+}
+
 stream_profiles dds_sensor_proxy::get_active_streams() const 
 {
     return _active_converted_profiles;
@@ -360,21 +375,14 @@ void dds_sensor_proxy::handle_motion_data( realdds::topics::imu_msg && imu,
 }
 
 
-void dds_sensor_proxy::handle_new_metadata( std::string const & stream_name,
-                                            std::shared_ptr< const json > const & dds_md )
+void dds_sensor_proxy::handle_new_metadata( std::shared_ptr< const realdds::topics::metadata_msg > const & dds_md )
 {
     if( ! _md_enabled )
         return;
 
-    auto it = _streaming_by_name.find( stream_name );
+    auto it = _streaming_by_name.find( dds_md->stream_name );
     if( it != _streaming_by_name.end() )
-    {
-        if( auto timestamp = dds_md->nested( realdds::topics::metadata::key::header,
-                                             realdds::topics::metadata::header::key::timestamp ) )
-            it->second.syncer.enqueue_metadata( timestamp.get< realdds::dds_nsec >(), dds_md );
-        else
-            throw std::runtime_error( "missing metadata header/timestamp" );
-    }
+        it->second.syncer.enqueue_metadata( dds_md->timestamp, dds_md );
     // else we're not streaming -- must be another client that's subscribed
 }
 
@@ -390,25 +398,21 @@ void dds_sensor_proxy::add_no_metadata( frame * const f, streaming_impl & stream
 
 
 void dds_sensor_proxy::add_frame_metadata( frame * const f,
-                                           json const & dds_md,
+                                           realdds::topics::metadata_msg const & dds_md,
                                            streaming_impl & streaming )
 {
-    auto md_header = dds_md.nested( realdds::topics::metadata::key::header );
-    auto md = dds_md.nested( realdds::topics::metadata::key::metadata );
-
     // A frame number is "optional". If the server supplies it, we try to use it for the simple fact that,
     // otherwise, we have no way of detecting drops without some advanced heuristic tracking the FPS and
     // timestamps. If not supplied, we use an increasing counter.
     // Note that if we have no metadata, we have no frame-numbers! So we need a way of generating them
-    if( md_header.nested( realdds::topics::metadata::header::key::frame_number )
-            .get_ex( f->additional_data.frame_number ) )
+    if( dds_md.has_frame_number )
     {
+        f->additional_data.frame_number = dds_md.frame_number;
         f->additional_data.last_frame_number = streaming.last_frame_number.exchange( f->additional_data.frame_number );
         if( f->additional_data.frame_number != f->additional_data.last_frame_number + 1
             && f->additional_data.last_frame_number )
         {
-            LOG_DEBUG( dds_md.nested( realdds::topics::metadata::key::stream_name ).string_ref_or_empty()
-                       << " frame drop? expecting " << f->additional_data.last_frame_number + 1 << "; got "
+            LOG_DEBUG( dds_md.stream_name << " frame drop? expecting " << f->additional_data.last_frame_number + 1 << "; got "
                        << f->additional_data.frame_number );
         }
     }
@@ -422,28 +426,31 @@ void dds_sensor_proxy::add_frame_metadata( frame * const f,
     // purposes, so we ignore here. The domain is optional, and really only rs-dds-adapter communicates it
     // because the source is librealsense...
     f->additional_data.timestamp;
-    md_header.nested( realdds::topics::metadata::header::key::timestamp_domain )
-        .get_ex( f->additional_data.timestamp_domain );
+    if( dds_md.has_timestamp_domain )
+        f->additional_data.timestamp_domain = static_cast< rs2_timestamp_domain >( dds_md.timestamp_domain );
 
-    if( ! md.empty() )
+    if( ! dds_md.values.empty() && dds_md.keys )
     {
-        // Other metadata fields. Metadata fields that are present but unknown by librealsense will be ignored.
-        auto & metadata = reinterpret_cast< metadata_array & >( f->additional_data.metadata_blob );
-        for( size_t i = 0; i < static_cast< size_t >( RS2_FRAME_METADATA_COUNT ); ++i )
+        // Other metadata fields, by key index: the mapping to rs2 values is computed once per set of keys rather than
+        // per frame. Metadata fields that are present but unknown by librealsense will be ignored.
+        std::lock_guard< std::mutex > lock( _md_keys_mutex );
+        if( _md_keys != dds_md.keys )
         {
-            auto key = static_cast< rs2_frame_metadata_value >( i );
-            std::string const & keystr = librealsense::get_string( key );
-            try
-            {
-                if( auto value_j = md.nested( keystr, &json::is_number_integer ) )
-                    metadata[key] = { true, value_j.get< rs2_metadata_type >() };
-            }
-            catch( json::exception const & )
+            _md_keys = dds_md.keys;
+            _md_key_to_rs2.assign( _md_keys->size(), -1 );
+            for( int i = 0; i < static_cast< int >( RS2_FRAME_METADATA_COUNT ); ++i )
             {
-                // The metadata key doesn't exist or the value isn't the right type... we ignore it!
-                // (all metadata is not there when we create the frame, so no need to erase)
+                int index = _md_keys->index_of( librealsense::get_string( static_cast< rs2_frame_metadata_value >( i ) ) );
+                if( index >= 0 )
+                    _md_key_to_rs2[index] = i;
             }
         }
+        auto & metadata = reinterpret_cast< metadata_array & >( f->additional_data.metadata_blob );
+        for( auto & kv : dds_md.values )
+        {
+            if( kv.first < _md_key_to_rs2.size() && _md_key_to_rs2[kv.first] >= 0 )
+                metadata[_md_key_to_rs2[kv.first]] = { true, kv.second };
+        }
     }
 }
 
@@ -467,7 +474,7 @@ void dds_sensor_proxy::start( rs2_frame_callback_sptr callback )
         auto & streaming = _streaming_by_name[dds_stream->name()];
         streaming.syncer.on_frame_release( frame_releaser );
         streaming.syncer.on_frame_ready(
-            [this, &streaming]( syncer_type::frame_holder && fh, std::shared_ptr< const json > const & md )
+            [this, &streaming]( syncer_type::frame_holder && fh, syncer_type::metadata_type const & md )
             {
                 if( _is_streaming ) // stop was not called
                 {
@@ -531,7 +538,15 @@ void dds_sensor_proxy::stop()
         // Nullifing the lambda is commented out because we don't want to nullify in middle of user callback (that might
         // be long) instead we use start/stop.
         //_streaming_by_name[dds_stream->name()].syncer.on_frame_ready( nullptr );
-        _streaming_by_name[dds_stream->name()].syncer.stop();
+        auto & syncer = _streaming_by_name[dds_stream->name()].syncer;
+        syncer.stop();
+        auto const stats = syncer.get_statistics();
+        if( stats.n_frames )
+            LOG_DEBUG( dds_stream->name() << " metadata syncer: " << stats.n_frames << " frames, "
+                                          << stats.n_frames_without_metadata << " without metadata, "
+                                          << stats.n_metadata_dropped << " metadata dropped; average latency "
+                                          << stats.total_latency / stats.n_frames / 1000 << " us, max "
+                                          << stats.max_latency / 1000 << " us" );
 
         if( auto dds_video_stream = std::dynamic_pointer_cast< realdds::dds_video_stream >( dds_stream ) )
         {
@@ -622,7 +637,7 @@ void dds_sensor_proxy::add_option( std::shared_ptr< realdds::dds_option > option
             // Then we may have get a null even when is_enabled() returned true!
         } );
     register_option( option_id, opt );
-    _options_watcher.register_option( option_id, opt );
+    _options_watcher.register_option( option_id, opt, options_watcher::on_write_only );
 
     if( std::dynamic_pointer_cast< realdds::dds_rect_option >( option ) && option->get_name() == "Region of Interest" )
     {
@@ -14,6 +14,8 @@
 #include <rsutils/json-fwd.h>
 #include <memory>
 #include <map>
+#include <mutex>
+#include <vector>
 
 
 namespace realdds {
@@ -25,6 +27,8 @@ class dds_motion_stream_profile;
 namespace topics {
 class image_msg;
 class imu_msg;
+class metadata_msg;
+class metadata_keys;
 }  // namespace topics
 }  // namespace realdds
 
@@ -44,8 +48,9 @@ class dds_sensor_proxy : public software_sensor
     std::string const _name;
     bool const _md_enabled;
     options_watcher _options_watcher;
+    rsutils::subscription _option_notifications;  // after the watcher: unsubscribed before it is destroyed
 
-    typedef realdds::dds_metadata_syncer syncer_type;
+    typedef realdds::basic_metadata_syncer< realdds::topics::metadata_msg > syncer_type;
     static void frame_releaser( syncer_type::frame_type * f ) { static_cast< frame * >( f )->release(); }
 
     std::shared_ptr< roi_sensor_interface > _roi_support;
@@ -62,6 +67,11 @@ private:
     std::map< sid_index, std::shared_ptr< realdds::dds_stream > > _streams;
     std::map< std::string, streaming_impl > _streaming_by_name;
 
+    // Metadata key indices mapped to rs2 metadata values (or -1 if unknown to us), for the last set of keys seen
+    std::mutex _md_keys_mutex;
+    std::shared_ptr< const realdds::topics::metadata_keys > _md_keys;
+    std::vector< int > _md_key_to_rs2;
+
     formats_converter _formats_converter;
     stream_profiles _active_converted_profiles;
 
@@ -92,7 +102,9 @@ public:
     // sensor_interface
 public:
     rsutils::subscription register_options_changed_callback( options_watcher::callback && ) override;
+    void on_option_written( rs2_option id ) override { _options_watcher.option_written( id ); }
     stream_profiles get_active_streams() const override;
+    rsutils::json get_statistics() const override;
 
 protected:
     void register_basic_converters();
@@ -112,11 +124,10 @@ protected:
                              realdds::dds_sample &&,
                              const std::shared_ptr< stream_profile_interface > &,
                              streaming_impl & );
-    void handle_new_metadata( std::string const & stream_name,
-                              std::shared_ptr< const rsutils::json > const & metadata );
+    void handle_new_metadata( std::shared_ptr< const realdds::topics::metadata_msg > const & metadata );
 
     virtual void add_no_metadata( frame *, streaming_impl & );
-    virtual void add_frame_metadata( frame *, rsutils::json const & metadata, streaming_impl & );
+    virtual void add_frame_metadata( frame *, realdds::topics::metadata_msg const & metadata, streaming_impl & );
 
     void add_processing_block_settings( const std::string & filter_name,
                                         std::shared_ptr< librealsense::processing_block_interface > & ppb ) const;
@@ -17,6 +17,8 @@ static std::set< rs2_option > get_options_to_ignore()
 {
     return {
         RS2_OPTION_FRAMES_QUEUE_SIZE,  // Internally added and is not an option we need to record/load
+        RS2_OPTION_FRAMES_QUEUE_POLICY,
+        RS2_OPTION_FRAMES_QUEUE_MEMORY_LIMIT,
         RS2_OPTION_REGION_OF_INTEREST  // The RoI is temporary, uses another mechanism for get/set, and we don't load it
     };
 }
@@ -12,9 +12,38 @@
 
 #include <rsutils/string/from.h>
 #include <rsutils/string/hexdump.h>
+#include <rsutils/time/stopwatch.h>
+
+#include <cstring>
 
 namespace librealsense
 {
+    template< class T >
+    static uint32_t group_if_changed( const T & from, const T & to )
+    {
+        // All advanced-mode structs are made of 4-byte fields: no padding to worry about
+        if( std::memcmp( &from, &to, sizeof( T ) ) == 0 )
+            return 0;
+        return 1u << advanced_mode_traits< T >::group;
+    }
+
+    uint32_t changed_advanced_mode_groups( const preset & from, const preset & to )
+    {
+        return group_if_changed( from.depth_controls, to.depth_controls )
+             | group_if_changed( from.rsm, to.rsm )
+             | group_if_changed( from.rsvc, to.rsvc )
+             | group_if_changed( from.color_control, to.color_control )
+             | group_if_changed( from.rctc, to.rctc )
+             | group_if_changed( from.sctc, to.sctc )
+             | group_if_changed( from.spc, to.spc )
+             | group_if_changed( from.hdad, to.hdad )
+             | group_if_changed( from.cc, to.cc )
+             | group_if_changed( from.depth_table, to.depth_table )
+             | group_if_changed( from.ae, to.ae )
+             | group_if_changed( from.census, to.census )
+             | group_if_changed( from.amplitude_factor, to.amplitude_factor );
+    }
+
     void ds_advanced_mode_base::register_to_visual_preset_option()
     {
         _preset_opt = std::make_shared<advanced_mode_preset_option>(*this,
@@ -67,6 +96,10 @@ namespace librealsense
         _amplitude_factor_support = [this]() {
             return _depth_sensor.get_device().supports_feature( amplitude_factor_feature::ID );
         };
+
+        _hwm_queue = [this]() {
+            return std::make_shared< hw_monitor_queue >( _hw_monitor );
+        };
     }
 
     bool ds_advanced_mode_base::is_enabled() const
@@ -92,7 +125,9 @@ namespace librealsense
                                               rs2_rs400_visual_preset preset, uint16_t device_pid,
                                               const firmware_version& fw_version)
     {
-        auto p = get_all();
+        rsutils::time::stopwatch sw;
+        auto const current = get_all();
+        auto p = current;
         res_type res;
         // configuration is empty before first streaming - so set default res
         if (configuration.empty())
@@ -201,7 +236,7 @@ namespace librealsense
             throw invalid_value_exception( rsutils::string::from()
                                             << "apply_preset(...) failed! Invalid preset! (" << preset << ")" );
         }
-        set_all(p);
+        set_changes(current, p, "apply_preset", sw);
     }
 
     void ds_advanced_mode_base::get_depth_control_group(STDepthControlGroup* ptr, int mode) const
@@ -726,29 +761,68 @@ namespace librealsense
             throw wrong_api_call_sequence_exception( rsutils::string::from()
                                                      << "load_json(...) failed! Device is not in Advanced-Mode." );
 
-        auto p = get_all();
+        rsutils::time::stopwatch sw;
+        auto const current = get_all();
+        auto p = current;
         update_structs(_depth_sensor.get_device(),  json_content, p);
-        set_all(p);
+        set_changes(current, p, "load_json", sw);
         _preset_opt->set(RS2_RS400_VISUAL_PRESET_CUSTOM);
     }
 
+    void ds_advanced_mode_base::set_changes(const preset& current, const preset& p, const char* what,
+                                            const rsutils::time::stopwatch& sw)
+    {
+        // Each struct write is a blocking HW command followed by a delay: skipping the ones that are
+        // already in place is what makes switching between similar presets fast
+        auto groups = changed_advanced_mode_groups(current, p);
+        // The depth auto-white-balance control is only written when it changes; the FW then updates the color
+        // correction, so that is written after it even if it did not change
+        bool const awb_changed = p.depth_auto_white_balance.was_set
+                              && ( ! current.depth_auto_white_balance.was_set
+                                   || current.depth_auto_white_balance.auto_white_balance
+                                          != p.depth_auto_white_balance.auto_white_balance );
+        if (awb_changed)
+            groups |= 1u << advanced_mode_traits<STColorCorrection>::group;
+        set_all(p, groups, awb_changed);
+
+        int n_changed = 0;
+        for (auto g = groups; g; g &= g - 1)
+            ++n_changed;
+        LOG_DEBUG(what << ": " << n_changed << " of " << int(etLastAdvancedModeGroup)
+                       << " advanced-mode structs written in " << sw.get_elapsed_ms() << " ms");
+    }
+
     preset ds_advanced_mode_base::get_all() const
     {
         preset p;
 
         rsutils::deferred depth_bulk = _depth_sensor.bulk_operation();
-        get_depth_control_group(&p.depth_controls);
-        get_rsm(&p.rsm);
-        get_rau_support_vector_control(&p.rsvc);
-        get_color_control(&p.color_control);
-        get_rau_color_thresholds_control(&p.rctc);
-        get_slo_color_thresholds_control(&p.sctc);
-        get_slo_penalty_control(&p.spc);
-        get_hdad(&p.hdad);
-        get_color_correction(&p.cc);
-        get_depth_table_control(&p.depth_table);
-        get_ae_control(&p.ae);
-        get_census_radius(&p.census);
+
+        // The structs are independent of each other: queue all the reads so they go out as one batch
+        auto depth_controls = get_async< STDepthControlGroup >();
+        auto rsm = get_async< STRsm >();
+        auto rsvc = get_async< STRauSupportVectorControl >();
+        auto color_control = get_async< STColorControl >();
+        auto rctc = get_async< STRauColorThresholdsControl >();
+        auto sctc = get_async< STSloColorThresholdsControl >();
+        auto spc = get_async< STSloPenaltyControl >();
+        auto hdad = get_async< STHdad >();
+        auto cc = get_async< STColorCorrection >();
+        auto depth_table = get_async< STDepthTableControl >();
+        auto ae = get_async< STAEControl >();
+        auto census = get_async< STCensusRadius >();
+        p.depth_controls = depth_controls.get();
+        p.rsm = rsm.get();
+        p.rsvc = rsvc.get();
+        p.color_control = color_control.get();
+        p.rctc = rctc.get();
+        p.sctc = sctc.get();
+        p.spc = spc.get();
+        p.hdad = hdad.get();
+        p.cc = cc.get();
+        p.depth_table = depth_table.get();
+        p.ae = ae.get();
+        p.census = census.get();
         get_amp_factor(&p.amplitude_factor);
         get_laser_power(&p.laser_power);
         get_laser_state(&p.laser_state);
@@ -777,31 +851,32 @@ namespace librealsense
         return p;
     }
 
-    void ds_advanced_mode_base::set_all( const preset & p )
+    void ds_advanced_mode_base::set_all( const preset & p, uint32_t groups, bool depth_auto_white_balance )
     {
-        set_all_depth( p );
+        set_all_depth( p, groups, depth_auto_white_balance );
         if( should_set_rgb_preset() )
             set_all_rgb( p );
     }
 
-    void ds_advanced_mode_base::set_all_depth(const preset& p)
+    void ds_advanced_mode_base::set_all_depth(const preset& p, uint32_t groups, bool depth_auto_white_balance)
     {
         rsutils::deferred depth_bulk = _depth_sensor.bulk_operation();
 
-        set(p.depth_controls, advanced_mode_traits<STDepthControlGroup>::group);
-        set(p.rsm           , advanced_mode_traits<STRsm>::group);
-        set(p.rsvc          , advanced_mode_traits<STRauSupportVectorControl>::group);
-        set(p.hdad          , advanced_mode_traits<STHdad>::group);
+        set_if_in(groups, p.depth_controls);
+        set_if_in(groups, p.rsm);
+        set_if_in(groups, p.rsvc);
+        set_if_in(groups, p.hdad);
 
         // Setting auto-white-balance control before colorCorrection parameters
-        set_depth_auto_white_balance(p.depth_auto_white_balance);
-        set(p.cc            , advanced_mode_traits<STColorCorrection>::group);
+        if (depth_auto_white_balance)
+            set_depth_auto_white_balance(p.depth_auto_white_balance);
+        set_if_in(groups, p.cc);
 
-        set(p.depth_table   , advanced_mode_traits<STDepthTableControl>::group);
-        set(p.ae            , advanced_mode_traits<STAEControl>::group);
-        set(p.census        , advanced_mode_traits<STCensusRadius>::group);
+        set_if_in(groups, p.depth_table);
+        set_if_in(groups, p.ae);
+        set_if_in(groups, p.census);
         if (*_amplitude_factor_support)
-            set(p.amplitude_factor, advanced_mode_traits<STAFactor>::group);
+            set_if_in(groups, p.amplitude_factor);
 
         set_laser_state(p.laser_state);
         if (p.laser_state.was_set && p.laser_state.laser_state == 1) // 1 - on
@@ -815,10 +890,10 @@ namespace librealsense
         }
 
         // Depth sensor related even though they have color in the name. Probably color from left IR imager.
-        set( p.color_control, advanced_mode_traits< STColorControl >::group );
-        set( p.rctc         , advanced_mode_traits< STRauColorThresholdsControl >::group );
-        set( p.sctc         , advanced_mode_traits< STSloColorThresholdsControl >::group );
-        set( p.spc          , advanced_mode_traits< STSloPenaltyControl >::group );
+        set_if_in( groups, p.color_control );
+        set_if_in( groups, p.rctc );
+        set_if_in( groups, p.sctc );
+        set_if_in( groups, p.spc );
     }
 
     void ds_advanced_mode_base::set_all_rgb( const preset & p )
@@ -10,6 +10,7 @@
 #include "algo.h"
 #include <src/core/video-frame.h>
 #include <src/ds/ds-thermal-monitor.h>
+#include <src/proc/row-bands.h>
 
 #include <rsutils/string/from.h>
 
@@ -2141,6 +2142,8 @@ namespace librealsense
         int queue_size = rs2_frame_queue_size(queue1, &e);
         int fc = 0;
 
+        // Finding the target takes most of the time: the frames are taken first, then several are searched at once
+        std::vector<rs2::frame> frames;
         while ((fc++ < queue_size) && rs2_poll_for_frame(queue1, &f, &e))
         {
             rs2::frame ff(f);
@@ -2155,20 +2158,36 @@ namespace librealsense
                     created = true;
                 }
 
-                // retirieve target size and accumulate results, skip frame if target could not be found
-                if (target_z_calculator.extract_target_dims(f, rect_sides))
-                {
-                    rec_sides_data.push_back(rect_sides);
-                }
-
+                frames.push_back(std::move(ff));
                 frm_idx++;
             }
+            else if (progress_callback)
+                progress_callback->on_update_progress(static_cast<float>(progress++));
+        }
 
-            rs2_release_frame(f);
+        // In batches, so progress is still reported from this thread as frames are done
+        row_bands bands;
+        std::vector<float4> frame_rect_sides(frames.size());
+        std::vector<int> found(frames.size());
+        for (size_t first = 0; first < frames.size(); first += bands.get_max_bands())
+        {
+            size_t const count = std::min(bands.get_max_bands(), frames.size() - first);
+            bands.run(count, 1, [&](size_t begin, size_t end)
+            {
+                for (size_t i = first + begin; i < first + end; ++i)
+                    found[i] = target_z_calculator.extract_target_dims(frames[i].get(), frame_rect_sides[i]);
+            });
 
-            if (progress_callback)
-                progress_callback->on_update_progress(static_cast<float>(progress++));
+            for (size_t i = first; i < first + count; ++i)
+            {
+                // retirieve target size and accumulate results, skip frame if target could not be found
+                if (found[i])
+                    rec_sides_data.push_back(frame_rect_sides[i]);
 
+                frames[i] = {};
+                if (progress_callback)
+                    progress_callback->on_update_progress(static_cast<float>(progress++));
+            }
         }
 
         if (rec_sides_data.size())
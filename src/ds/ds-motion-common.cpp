@@ -17,6 +17,7 @@
 #include "d400/d400-motion.h"
 #include "d500/d500-motion.h"
 #include "proc/motion-transform.h"
+#include "proc/motion-block-batcher.h"
 
 #include "ds-timestamp.h"
 #include "ds-options.h"
@@ -134,6 +135,7 @@ namespace librealsense
         : synthetic_sensor( name, sensor, owner )
         , _owner( owner )
     {
+        register_motion_block_option();
     }
 
     ds_motion_sensor::ds_motion_sensor( std::string const & name,
@@ -144,6 +146,40 @@ namespace librealsense
         : synthetic_sensor( name, sensor, owner, motion_fourcc_to_rs2_format, motion_fourcc_to_rs2_stream )
         , _owner( owner )
     {
+        register_motion_block_option();
+    }
+
+    void ds_motion_sensor::register_motion_block_option()
+    {
+        register_option( RS2_OPTION_MOTION_BLOCK_SIZE,
+                         std::make_shared< ptr_option< int > >(
+                             1,
+                             64,
+                             1,
+                             1,
+                             &_motion_block_size,
+                             "Number of motion samples delivered together in each motion block frame; 1 to deliver "
+                             "single motion frames. Takes effect on the next start" ) );
+    }
+
+    void ds_motion_sensor::start( rs2_frame_callback_sptr callback )
+    {
+        if( _motion_block_size > 1 )
+        {
+            _batcher = std::make_shared< motion_block_batcher >( _motion_block_size, shared_from_this() );
+            callback = _batcher->wrap( std::move( callback ) );
+        }
+        synthetic_sensor::start( std::move( callback ) );
+    }
+
+    void ds_motion_sensor::stop()
+    {
+        synthetic_sensor::stop();
+        if( _batcher )
+        {
+            _batcher->reset();
+            _batcher.reset();
+        }
     }
 
     rs2_motion_device_intrinsic ds_motion_sensor::get_motion_intrinsics(rs2_stream stream) const
@@ -240,6 +276,14 @@ namespace librealsense
             std::make_shared<auto_exposure_step_option>(auto_exposure,
                 ae_state,
                 option_range{ 0.1f, 1.0f, 0.1f, ae_step_default_value }));
+        ep->register_option(RS2_OPTION_AUTO_EXPOSURE_SUBSAMPLING,
+            std::make_shared<auto_exposure_subsampling_option>(auto_exposure,
+                ae_state,
+                option_range{ 1, 8, 1, 1 }));
+        ep->register_option(RS2_OPTION_AUTO_EXPOSURE_SKIP_UNAPPLIED,
+            std::make_shared<auto_exposure_skip_unapplied_option>(auto_exposure,
+                ae_state,
+                option_range{ 0, 1, 1, 0 }));
         ep->register_option(RS2_OPTION_POWER_LINE_FREQUENCY,
             std::make_shared<auto_exposure_antiflicker_rate_option>(auto_exposure,
                 ae_state,
@@ -495,6 +539,8 @@ namespace librealsense
         auto hid_ep = std::make_shared<ds_motion_sensor>("Motion Module", raw_hid_ep, _owner);
 
         hid_ep->register_option(RS2_OPTION_GLOBAL_TIME_ENABLED, enable_global_time_option);
+        for( auto id : { RS2_OPTION_MOTION_THREAD_PRIORITY, RS2_OPTION_MOTION_THREAD_AFFINITY } )
+            hid_ep->register_option( id, raw_hid_ep->get_option_handler( id ) );
 
         // register pre-processing
         std::shared_ptr<enable_motion_correction> mm_correct_opt = nullptr;
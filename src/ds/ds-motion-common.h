@@ -48,6 +48,7 @@ namespace librealsense
 #endif
 
     class auto_exposure_mechanism;
+    class motion_block_batcher;
     class fisheye_auto_exposure_roi_method : public region_of_interest_method
     {
     public:
@@ -96,11 +97,20 @@ namespace librealsense
 
         stream_profiles init_stream_profiles() override;
 
+        void start( rs2_frame_callback_sptr callback ) override;
+        void stop() override;
+
     private:
+        void register_motion_block_option();
+
         std::shared_ptr<stream_interface> get_accel_stream() const;
         std::shared_ptr<stream_interface> get_gyro_stream() const;
 
         const device* _owner;
+
+        // RS2_OPTION_MOTION_BLOCK_SIZE; when more than 1, the samples we stream are collected into motion blocks
+        int _motion_block_size = 1;
+        std::shared_ptr< motion_block_batcher > _batcher;
     };
 
     class global_time_option;
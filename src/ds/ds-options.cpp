@@ -297,6 +297,52 @@ namespace librealsense
         return static_cast<float>(_auto_exposure_state->get_auto_exposure_step());
     }
 
+    auto_exposure_subsampling_option::auto_exposure_subsampling_option(std::shared_ptr<auto_exposure_mechanism> auto_exposure,
+        std::shared_ptr<auto_exposure_state> auto_exposure_state,
+        const option_range& opt_range)
+        : option_base(opt_range),
+        _auto_exposure_state(auto_exposure_state),
+        _auto_exposure(auto_exposure)
+    {}
+
+    void auto_exposure_subsampling_option::set(float value)
+    {
+        if (!is_valid(value))
+            throw invalid_value_exception(rsutils::string::from() << "set(auto_exposure_subsampling_option) failed! Given value " << value << " is out of range.");
+
+        _auto_exposure_state->set_auto_exposure_subsampling(static_cast<unsigned>(value));
+        _auto_exposure->update_auto_exposure_state(*_auto_exposure_state);
+        _recording_function(*this);
+    }
+
+    float auto_exposure_subsampling_option::query() const
+    {
+        return static_cast<float>(_auto_exposure_state->get_auto_exposure_subsampling());
+    }
+
+    auto_exposure_skip_unapplied_option::auto_exposure_skip_unapplied_option(std::shared_ptr<auto_exposure_mechanism> auto_exposure,
+        std::shared_ptr<auto_exposure_state> auto_exposure_state,
+        const option_range& opt_range)
+        : option_base(opt_range),
+        _auto_exposure_state(auto_exposure_state),
+        _auto_exposure(auto_exposure)
+    {}
+
+    void auto_exposure_skip_unapplied_option::set(float value)
+    {
+        if (!is_valid(value))
+            throw invalid_value_exception(rsutils::string::from() << "set(auto_exposure_skip_unapplied_option) failed! Given value " << value << " is out of range.");
+
+        _auto_exposure_state->set_skip_unapplied_exposure(0.f < std::fabs(value));
+        _auto_exposure->update_auto_exposure_state(*_auto_exposure_state);
+        _recording_function(*this);
+    }
+
+    float auto_exposure_skip_unapplied_option::query() const
+    {
+        return _auto_exposure_state->get_skip_unapplied_exposure();
+    }
+
     auto_exposure_antiflicker_rate_option::auto_exposure_antiflicker_rate_option(std::shared_ptr<auto_exposure_mechanism> auto_exposure,
                                                                                  std::shared_ptr<auto_exposure_state> auto_exposure_state,
                                                                                  const option_range& opt_range,
@@ -42,13 +42,65 @@ namespace librealsense
     }
 
     void firmware_logger_device::get_fw_logs_from_hw_monitor()
+    {
+        std::vector< uint8_t > res;
+        bool fetched = false;
+        if( _prefetched_fw_logs.valid() )
+        {
+            // A prefetch that failed is sent again, now: errors are those of the command this call sends, as
+            // without prefetching, rather than of one sent on an earlier call
+            try
+            {
+                res = _prefetched_fw_logs.get();
+                fetched = true;
+            }
+            catch( std::exception const & e )
+            {
+                LOG_DEBUG( "FW logs prefetch failed; sending again: " << e.what() );
+            }
+        }
+        if( ! fetched )
+        {
+            command update_command = get_update_command();
+            if( update_command.cmd == 0 )
+                return;
+            res = _hw_monitor->send( update_command );
+        }
+
+        if( ! res.empty() )
+        {
+            handle_received_data( res );
+            // More logs are likely waiting in the device: get them while the ones we have are consumed
+            prefetch_fw_logs();
+        }
+    }
+
+    void firmware_logger_device::prefetch_fw_logs()
     {
         command update_command = get_update_command();
-        if( update_command.cmd != 0 )
+        if( update_command.cmd == 0 )
+            return;
+
+        if( ! _hwm_queue )
+            _hwm_queue = std::make_shared< hw_monitor_queue >( _hw_monitor );
+        _prefetched_fw_logs = _hwm_queue->send( update_command );
+    }
+
+    void firmware_logger_device::collect_prefetched_fw_logs()
+    {
+        if( _prefetched_fw_logs.valid() )
         {
-            auto res = _hw_monitor->send( update_command );
-            if( ! res.empty() )
-                handle_received_data( res );
+            // No get_fw_log() call sent it, so none reports its failure
+            try
+            {
+                auto res = _prefetched_fw_logs.get();
+                if( ! res.empty() )
+                    handle_received_data( res );
+            }
+            catch( std::exception const & e )
+            {
+                LOG_DEBUG( "FW logs prefetch failed: " << e.what() );
+            }
         }
     }
 
@@ -190,6 +242,9 @@ namespace librealsense
         if( ! _parser || ! ( parser = dynamic_cast< fw_logs::extended_fw_logs_parser * >( _parser.get() ) ) )
             throw librealsense::wrong_api_call_sequence_exception( "FW log parser is not initialized" );
 
+        // Logs already fetched must not be lost (or reordered) by stopping
+        collect_prefetched_fw_logs();
+
         command stop_command = parser->get_stop_command();
         stop_command.cmd = _fw_logs_command.cmd; // Opcode comes from the device, may be different between devices
         if( stop_command.cmd != 0 )
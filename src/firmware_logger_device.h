@@ -6,6 +6,7 @@
 #include "core/extension.h"
 #include "device.h"
 #include "hw-monitor.h"
+#include "hw-monitor-queue.h"
 #include "fw-logs/fw-log-data.h"
 #include "fw-logs/fw-logs-parser.h"
 
@@ -49,6 +50,10 @@ namespace librealsense
 
     protected:
         void get_fw_logs_from_hw_monitor();
+        // After a non-empty fetch, the next one is sent right away, in the background; get_fw_logs_from_hw_monitor()
+        // takes its result when it next needs logs, or sends it again itself if it failed
+        void prefetch_fw_logs();
+        void collect_prefetched_fw_logs();
         void handle_received_data( const std::vector< uint8_t > & res );
         void get_flash_logs_from_hw_monitor();
         virtual command get_update_command();
@@ -56,6 +61,8 @@ namespace librealsense
         
         command _fw_logs_command;
         std::shared_ptr< hw_monitor > _hw_monitor;
+        std::shared_ptr< hw_monitor_queue > _hwm_queue;
+        std::future< std::vector< uint8_t > > _prefetched_fw_logs;
         std::queue< fw_logs::fw_logs_binary_data > _fw_logs;
         std::unique_ptr< fw_logs::fw_logs_parser > _parser;
 
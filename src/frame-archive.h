@@ -6,6 +6,8 @@
 #include <src/core/frame-interface.h>
 
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <vector>
 
 namespace librealsense
@@ -16,8 +18,10 @@ namespace librealsense
     template<class T>
     class frame_archive : public std::enable_shared_from_this<frame_archive<T>>, public archive_interface
     {
-        std::atomic<uint32_t>* max_frame_queue_size;
+        frame_publish_limits const * _limits;
         std::atomic<uint32_t> published_frames_count;
+        std::atomic<uint32_t> published_frames_high_water;
+        std::atomic<uint64_t> published_bytes;
         small_heap<T, RS2_USER_QUEUE_SIZE> published_frames;
         std::shared_ptr<metadata_parser_map> _metadata_parsers = nullptr;
         callbacks_heap callback_inflight;
@@ -27,6 +31,12 @@ namespace librealsense
         int pending_frames = 0;
         std::recursive_mutex mutex;
 
+        // With the BLOCK policy, producers wait on these for the user to release a frame
+        std::mutex _released_mutex;
+        std::condition_variable _released_cv;
+        std::atomic<int> _n_waiting;
+        std::atomic<unsigned> _n_flushes;
+
         std::weak_ptr<sensor_interface> _sensor;
         std::shared_ptr<sensor_interface> get_sensor() const override { return _sensor.lock(); }
         void set_sensor( const std::weak_ptr< sensor_interface > & s ) override { _sensor = s; }
@@ -64,12 +74,33 @@ namespace librealsense
             {
                 backbuffer.data.resize(size, 0); // TODO: Allow users to provide a custom allocator for frame buffers
             }
+            backbuffer.data_size = 0;
             backbuffer.additional_data = std::move( additional_data );
             return backbuffer;
         }
 
+        // Wait a while for the user to release a frame if they're holding as many as they may, rather than have
+        // publish_frame() drop the new one
+        void wait_for_release()
+        {
+            auto const max_frames = _limits->max_frames.load();
+            if( ! max_frames )
+                return;
+
+            std::unique_lock< std::mutex > lock( _released_mutex );
+            auto const flushes = _n_flushes.load();
+            ++_n_waiting;
+            _released_cv.wait_for( lock,
+                                   std::chrono::milliseconds( 100 ),
+                                   [&]() { return published_frames_count < max_frames || _n_flushes != flushes; } );
+            --_n_waiting;
+        }
+
         frame_interface* track_frame(T& f)
         {
+            if( _limits->policy == RS2_FRAMES_QUEUE_POLICY_BLOCK )
+                wait_for_release();
+
             std::unique_lock<std::recursive_mutex> lock(mutex);
 
             auto published_frame = f.publish(this->shared_from_this());
@@ -108,15 +139,33 @@ namespace librealsense
         void keep_frame(frame_interface* frame) override
         {
             --published_frames_count;
+            published_bytes -= ((T *)frame)->data.size();
+            if( _n_waiting )
+            {
+                std::lock_guard< std::mutex > lock( _released_mutex );
+                _released_cv.notify_all();
+            }
         }
 
         frame_interface * publish_frame( frame_interface * fi ) override
         {
             auto f = (T *)fi;
 
-            unsigned int max_frames = *max_frame_queue_size;
+            unsigned int max_frames = _limits->max_frames;
 
-            if (published_frames_count >= max_frames
+            if( _limits->policy == RS2_FRAMES_QUEUE_POLICY_MEMORY_LIMIT && ! f->data.empty() )
+            {
+                // The frame data is what takes up the memory; there's always room for at least one frame. Frames
+                // without data of ours (e.g., their pixels belong to the user) are limited by number, as usual.
+                uint64_t const max_bytes = uint64_t( _limits->max_megabytes ) << 20;
+                if( published_frames_count && published_bytes + f->data.size() > max_bytes )
+                {
+                    LOG_DEBUG( "User didn't release frame resource (" << published_bytes << " bytes held)" );
+                    return nullptr;
+                }
+                max_frames = 0;  // not limited by the number of frames: allocate them on the heap
+            }
+            else if (published_frames_count >= max_frames
                 && max_frames)
             {
                 LOG_DEBUG("User didn't release frame resource.");
@@ -134,24 +183,35 @@ namespace librealsense
                 new_frame = new T();
             }
 
-            ++published_frames_count;
+            auto const count = ++published_frames_count;
+            if( count > published_frames_high_water )
+                published_frames_high_water = count;  // only ever published from one thread
             *new_frame = std::move(*f);
+            published_bytes += new_frame->data.size();
 
             return new_frame;
         }
 
         std::shared_ptr<metadata_parser_map> get_md_parsers() const override { return _metadata_parsers; };
 
+        uint32_t get_published_count() const override { return published_frames_count; }
+        uint32_t get_published_high_water() const override { return published_frames_high_water; }
+        uint32_t get_published_capacity() const override { return _limits->max_frames; }
+
         friend class frame;
 
     public:
-        explicit frame_archive( std::atomic< uint32_t > * in_max_frame_queue_size,
+        explicit frame_archive( frame_publish_limits const * limits,
                                 std::shared_ptr< metadata_parser_map > const & parsers )
-            : max_frame_queue_size( in_max_frame_queue_size )
+            : _limits( limits )
             , recycle_frames( true )
             , _metadata_parsers( parsers )
         {
             published_frames_count = 0;
+            published_frames_high_water = 0;
+            published_bytes = 0;
+            _n_waiting = 0;
+            _n_flushes = 0;
         }
 
         callback_invocation_holder begin_callback() override
@@ -176,6 +236,13 @@ namespace librealsense
             callback_inflight.stop_allocation();
             recycle_frames = false;
 
+            // Nobody should be left waiting for frames that are no longer coming
+            {
+                std::lock_guard< std::mutex > lock( _released_mutex );
+                ++_n_flushes;
+            }
+            _released_cv.notify_all();
+
             auto callbacks_inflight = callback_inflight.get_size();
             if (callbacks_inflight > 0)
             {
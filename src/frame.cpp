@@ -124,7 +124,7 @@ bool frame::find_metadata( rs2_frame_metadata_value frame_metadata, rs2_metadata
 
 int frame::get_frame_data_size() const
 {
-    return (int)data.size();
+    return (int)( data_size ? data_size : data.size() );
 }
 
 const uint8_t * frame::get_frame_data() const
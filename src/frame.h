@@ -21,6 +21,9 @@ class LRS_EXTENSION_API frame : public frame_interface
 {
 public:
     std::vector< uint8_t > data;
+    // When not 0, the size of the frame's data, which only takes the start of 'data' (e.g., compressed depth): 'data'
+    // keeps the size it was allocated with, so the archive can recycle it
+    size_t data_size = 0;
     frame_additional_data additional_data;
     std::shared_ptr< metadata_parser_map > metadata_parsers = nullptr;
     
@@ -46,6 +49,7 @@ public:
     frame& operator=(frame&& r)
     {
         data = std::move(r.data);
+        data_size = r.data_size;
         owner = r.owner;
         ref_count = r.ref_count.exchange(0);
         _kept = r._kept.exchange(false);
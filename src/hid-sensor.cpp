@@ -9,9 +9,11 @@
 #include "metadata.h"
 #include "platform/stream-profile-impl.h"
 #include <src/metadata-parser.h>
+#include <src/option.h>
 #include <src/core/time-service.h>
 
 #include <rsutils/type/fourcc.h>
+#include <rsutils/os/thread-priority.h>
 using rsutils::type::fourcc;
 
 
@@ -54,7 +56,45 @@ hid_sensor::hid_sensor(
     , _is_configured_stream( RS2_STREAM_COUNT )
     , _hid_iio_timestamp_reader( std::move( hid_iio_timestamp_reader ) )
     , _custom_hid_timestamp_reader( std::move( custom_hid_timestamp_reader ) )
+    , _samples( 256 )
+    , _priority_option_value( 0 )
+    , _affinity_option_value( -1 )
+    , _delivery_thread_priority( 0 )
+    , _delivery_thread_affinity( -1 )
+    , _delivery_thread_settings_version( 0 )
 {
+    auto priority_option = std::make_shared< ptr_option< int > >(
+        0,
+        2,
+        1,
+        0,
+        &_priority_option_value,
+        "Scheduling priority of the thread motion samples are delivered from (Real-time may require privileges)",
+        std::map< float, std::string >{ { 0.f, "Normal" }, { 1.f, "High" }, { 2.f, "Real-time" } } );
+    priority_option->on_set(
+        [this]( float value )
+        {
+            _delivery_thread_priority = static_cast< int >( value );
+            ++_delivery_thread_settings_version;
+        } );
+    register_option( RS2_OPTION_MOTION_THREAD_PRIORITY, priority_option );
+
+    auto affinity_option = std::make_shared< ptr_option< int > >(
+        -1,
+        255,
+        1,
+        -1,
+        &_affinity_option_value,
+        "The CPU to run the thread motion samples are delivered from, or -1 for any",
+        std::map< float, std::string >{ { -1.f, "Any" } } );
+    affinity_option->on_set(
+        [this]( float value )
+        {
+            _delivery_thread_affinity = static_cast< int >( value );
+            ++_delivery_thread_settings_version;
+        } );
+    register_option( RS2_OPTION_MOTION_THREAD_AFFINITY, affinity_option );
+
     register_metadata( RS2_FRAME_METADATA_BACKEND_TIMESTAMP,
                        make_additional_data_parser( &frame_additional_data::backend_timestamp ) );
 
@@ -184,103 +224,194 @@ void hid_sensor::start( rs2_frame_callback_sptr callback )
     _source.init( _metadata_parsers );
     _source.set_sensor( _source_owner->shared_from_this() );
 
-    unsigned long long last_frame_number = 0;
-    rs2_time_t last_timestamp = 0;
     raise_on_before_streaming_changes( true );  // Required to be just before actual start allow recording to work
 
-    _hid_device->start_capture(
-        [this, last_frame_number, last_timestamp]( const platform::sensor_data & sensor_data ) mutable
+    _samples.reset();
+    auto stopped = std::make_shared< std::atomic< bool > >( false );
+    _delivery_stopped = stopped;
+    _delivery_thread = std::thread( [this, stopped]() { deliver_samples( *stopped ); } );
+    _hid_device->start_capture( [this]( const platform::sensor_data & sensor_data ) { enqueue_sample( sensor_data ); } );
+    _is_streaming = true;
+}
+
+// On the backend thread: as little as possible, so it's ready for the next sample
+void hid_sensor::enqueue_sample( const platform::sensor_data & sensor_data )
+{
+    const auto system_time = time_service::get_time();  // time frame was received from the backend
+    auto sample = _samples.reserve();
+    if( ! sample )
+    {
+        // We're not keeping up; the samples we already have are older, so this is the one to lose
+        LOG_DEBUG( "HID sample queue is full; " << sensor_data.sensor.name << " sample dropped" );
+        std::shared_ptr< stream_profile_interface > request;
+        {
+            std::lock_guard< std::mutex > lock( _configure_lock );
+            auto it = _configured_profiles.find( sensor_data.sensor.name );
+            if( it != _configured_profiles.end() )
+                request = it->second;
+        }
+        if( request )
+            _source.on_frame_dropped( request->get_stream_type(),
+                                      request->get_stream_index(),
+                                      frame_drop_reason::queue_full );
+        return;
+    }
+    if( sensor_data.fo.frame_size > sizeof( sample->pixels )
+        || sensor_data.fo.metadata_size > sizeof( sample->metadata ) )
+    {
+        LOG_ERROR( "HID sample of " << sensor_data.fo.frame_size << " bytes is too big; dropped" );
+        return;
+    }
+
+    sample->system_time = system_time;
+    sample->data.sensor.name = sensor_data.sensor.name;
+    sample->data.fo = sensor_data.fo;
+    memcpy( sample->pixels, sensor_data.fo.pixels, sensor_data.fo.frame_size );
+    sample->data.fo.pixels = sample->pixels;
+    if( sensor_data.fo.metadata && sensor_data.fo.metadata_size )
+    {
+        memcpy( sample->metadata, sensor_data.fo.metadata, sensor_data.fo.metadata_size );
+        sample->data.fo.metadata = sample->metadata;
+    }
+    _samples.push();
+}
+
+void hid_sensor::deliver_samples( std::atomic< bool > const & stopped )
+{
+    unsigned settings_version = 0;
+    apply_delivery_thread_settings();
+
+    unsigned long long last_frame_number = 0;
+    rs2_time_t last_timestamp = 0;
+    while( ! stopped )
+    {
+        if( settings_version != _delivery_thread_settings_version )
         {
-            const auto system_time = time_service::get_time();  // time frame was received from the backend
-            auto timestamp_reader = _hid_iio_timestamp_reader.get();
-            static const std::string custom_sensor_name = "custom";
-            auto && sensor_name = sensor_data.sensor.name;
-            std::shared_ptr< stream_profile_interface > request;
+            settings_version = _delivery_thread_settings_version;
+            apply_delivery_thread_settings();
+        }
+        if( ! _samples.wait_for( std::chrono::milliseconds( 100 ) ) )
+            continue;
+        while( auto sample = _samples.front() )
+        {
+            try
             {
-                std::lock_guard< std::mutex > lock( _configure_lock );
-                request = _configured_profiles[sensor_name];
+                on_sample( *sample, last_frame_number, last_timestamp );
             }
-            bool is_custom_sensor = false;
-            static const uint32_t custom_source_id_offset = 16;
-            uint8_t custom_gpio = 0;
-            auto custom_stream_type = RS2_STREAM_ANY;
-            if( sensor_name == custom_sensor_name )
+            catch( std::exception const & e )
             {
-                custom_gpio = *(
-                    reinterpret_cast< uint8_t * >( (uint8_t *)( sensor_data.fo.pixels ) + custom_source_id_offset ) );
-                custom_stream_type = custom_gpio_to_stream_type( custom_gpio );
-
-                if( ! _is_configured_stream[custom_stream_type] )
-                {
-                    LOG_DEBUG( "Unrequested " << rs2_stream_to_string( custom_stream_type ) << " frame was dropped." );
-                    return;
-                }
-
-                is_custom_sensor = true;
-                timestamp_reader = _custom_hid_timestamp_reader.get();
+                LOG_ERROR( "Failed to deliver HID sample: " << e.what() );
             }
+            if( stopped )
+                return;  // from the callback; the queue may already belong to the next run
+            _samples.pop();
+        }
+    }
+}
 
-            if( ! this->is_streaming() )
-            {
-                auto stream_type = request->get_stream_type();
-                LOG_INFO( "HID Frame received when Streaming is not active," << get_string( stream_type ) << ",Arrived,"
-                                                                             << std::fixed << system_time );
-                return;
-            }
+void hid_sensor::apply_delivery_thread_settings()
+{
+    int const priority = _delivery_thread_priority;
+    if( ! rsutils::os::set_current_thread_priority( static_cast< rsutils::os::thread_priority >( priority ) ) )
+        LOG_WARNING( "Failed to set motion delivery thread priority to " << priority << " (missing privileges?)" );
+    int const affinity = _delivery_thread_affinity;
+    if( ! rsutils::os::set_current_thread_affinity( affinity ) )
+        LOG_WARNING( "Failed to set motion delivery thread affinity to CPU " << affinity );
+}
 
-            const auto && fr = generate_frame_from_data( sensor_data.fo,
-                                                         system_time,
-                                                         timestamp_reader,
-                                                         last_timestamp,
-                                                         last_frame_number,
-                                                         request );
-            auto && frame_counter = fr->additional_data.frame_number;
-            const auto && timestamp_domain = timestamp_reader->get_frame_timestamp_domain( fr );
-            auto && timestamp = fr->additional_data.timestamp;
-            const auto && bpp = get_image_bpp( request->get_format() );
-            auto && data_size = sensor_data.fo.frame_size;
-
-            LOG_DEBUG( "FrameAccepted," << get_string( request->get_stream_type() ) << ",Counter," << std::dec
-                                        << frame_counter << ",Index,0"
-                                        << ",BackEndTS," << std::fixed << sensor_data.fo.backend_time << ",SystemTime,"
-                                        << std::fixed << system_time << " ,diff_ts[Sys-BE],"
-                                        << system_time - sensor_data.fo.backend_time << ",TS," << std::fixed
-                                        << timestamp << ",TS_Domain,"
-                                        << rs2_timestamp_domain_to_string( timestamp_domain ) << ",last_frame_number,"
-                                        << last_frame_number << ",last_timestamp," << last_timestamp );
-
-            last_frame_number = frame_counter;
-            last_timestamp = timestamp;
-            frame_holder frame = _source.alloc_frame(
-                { request->get_stream_type(), request->get_stream_index(), RS2_EXTENSION_MOTION_FRAME },
-                data_size,
-                std::move( fr->additional_data ),
-                true );
-            memcpy( (void *)frame->get_frame_data(),
-                    sensor_data.fo.pixels,
-                    sizeof( uint8_t ) * sensor_data.fo.frame_size );
-            if( ! frame )
-            {
-                LOG_INFO( "Dropped frame. alloc_frame(...) returned nullptr" );
-                return;
-            }
-            frame->set_stream( request );
-            frame->set_timestamp_domain( timestamp_domain );
+void hid_sensor::on_sample( const hid_sample & sample,
+                            unsigned long long & last_frame_number,
+                            rs2_time_t & last_timestamp )
+{
+    auto const & sensor_data = sample.data;
+    auto const system_time = sample.system_time;
+    auto timestamp_reader = _hid_iio_timestamp_reader.get();
+    static const std::string custom_sensor_name = "custom";
+    auto && sensor_name = sensor_data.sensor.name;
+    std::shared_ptr< stream_profile_interface > request;
+    {
+        std::lock_guard< std::mutex > lock( _configure_lock );
+        request = _configured_profiles[sensor_name];
+    }
+    bool is_custom_sensor = false;
+    static const uint32_t custom_source_id_offset = 16;
+    uint8_t custom_gpio = 0;
+    auto custom_stream_type = RS2_STREAM_ANY;
+    if( sensor_name == custom_sensor_name )
+    {
+        custom_gpio = *(
+            reinterpret_cast< uint8_t * >( (uint8_t *)( sensor_data.fo.pixels ) + custom_source_id_offset ) );
+        custom_stream_type = custom_gpio_to_stream_type( custom_gpio );
 
-            // Gather info for logging the callback ended
-            auto fps = frame->get_stream()->get_framerate();
-            auto stream_type = frame->get_stream()->get_stream_type();
-            auto frame_number = frame->get_frame_number();
+        if( ! _is_configured_stream[custom_stream_type] )
+        {
+            LOG_DEBUG( "Unrequested " << rs2_stream_to_string( custom_stream_type ) << " frame was dropped." );
+            return;
+        }
 
-            // Invoke first callback
-            auto callback_start_time = time_service::get_time();
-            auto callback = frame->get_owner()->begin_callback();
-            _source.invoke_callback( std::move( frame ) );
+        is_custom_sensor = true;
+        timestamp_reader = _custom_hid_timestamp_reader.get();
+    }
 
-            // Log callback ended
-            log_callback_end( fps, callback_start_time, time_service::get_time(), stream_type, frame_number );
-        } );
-    _is_streaming = true;
+    if( ! this->is_streaming() )
+    {
+        auto stream_type = request->get_stream_type();
+        LOG_INFO( "HID Frame received when Streaming is not active," << get_string( stream_type ) << ",Arrived,"
+                                                                     << std::fixed << system_time );
+        return;
+    }
+
+    const auto && fr = generate_frame_from_data( sensor_data.fo,
+                                                 system_time,
+                                                 timestamp_reader,
+                                                 last_timestamp,
+                                                 last_frame_number,
+                                                 request );
+    auto && frame_counter = fr->additional_data.frame_number;
+    const auto && timestamp_domain = timestamp_reader->get_frame_timestamp_domain( fr );
+    auto && timestamp = fr->additional_data.timestamp;
+    const auto && bpp = get_image_bpp( request->get_format() );
+    auto && data_size = sensor_data.fo.frame_size;
+
+    LOG_DEBUG( "FrameAccepted," << get_string( request->get_stream_type() ) << ",Counter," << std::dec
+                                << frame_counter << ",Index,0"
+                                << ",BackEndTS," << std::fixed << sensor_data.fo.backend_time << ",SystemTime,"
+                                << std::fixed << system_time << " ,diff_ts[Sys-BE],"
+                                << system_time - sensor_data.fo.backend_time << ",TS," << std::fixed
+                                << timestamp << ",TS_Domain,"
+                                << rs2_timestamp_domain_to_string( timestamp_domain ) << ",last_frame_number,"
+                                << last_frame_number << ",last_timestamp," << last_timestamp );
+
+    last_frame_number = frame_counter;
+    last_timestamp = timestamp;
+    frame_holder frame = _source.alloc_frame(
+        { request->get_stream_type(), request->get_stream_index(), RS2_EXTENSION_MOTION_FRAME },
+        data_size,
+        std::move( fr->additional_data ),
+        true );
+    if( ! frame )
+    {
+        LOG_INFO( "Dropped frame. alloc_frame(...) returned nullptr" );
+        return;
+    }
+    memcpy( (void *)frame->get_frame_data(),
+            sensor_data.fo.pixels,
+            sizeof( uint8_t ) * sensor_data.fo.frame_size );
+    frame->set_stream( request );
+    frame->set_timestamp_domain( timestamp_domain );
+
+    // Gather info for logging the callback ended
+    auto fps = frame->get_stream()->get_framerate();
+    auto stream_type = frame->get_stream()->get_stream_type();
+    auto frame_number = frame->get_frame_number();
+
+    // Invoke first callback
+    auto callback_start_time = time_service::get_time();
+    auto callback = frame->get_owner()->begin_callback();
+    _source.invoke_callback( std::move( frame ) );
+
+    // Log callback ended
+    log_callback_end( fps, callback_start_time, time_service::get_time(), stream_type, frame_number );
 }
 
 void hid_sensor::stop()
@@ -289,6 +420,15 @@ void hid_sensor::stop()
         throw wrong_api_call_sequence_exception( "stop_streaming() failed. Hid device is not streaming!" );
 
     _hid_device->stop_capture();
+    *_delivery_stopped = true;
+    _samples.stop();
+    if( _delivery_thread.joinable() )
+    {
+        if( _delivery_thread.get_id() != std::this_thread::get_id() )
+            _delivery_thread.join();
+        else
+            _delivery_thread.detach();  // stopped from a frame callback
+    }
     _is_streaming = false;
     {
         std::lock_guard< std::mutex > lock( _configure_lock );
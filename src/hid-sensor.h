@@ -6,6 +6,11 @@
 #include "sensor.h"
 #include "platform/hid-device.h"
 
+#include <rsutils/concurrency/spsc-queue.h>
+
+#include <atomic>
+#include <thread>
+
 
 namespace librealsense {
 
@@ -62,6 +67,20 @@ protected:
     stream_profiles init_stream_profiles() override;
 
 private:
+    // A sample as it arrived from the backend, copied so the backend can go on to the next right away
+    struct hid_sample
+    {
+        rs2_time_t system_time;  // when it arrived
+        platform::sensor_data data;  // pointing to the buffers below
+        uint8_t pixels[64];
+        uint8_t metadata[256];
+    };
+
+    void enqueue_sample( const platform::sensor_data & sensor_data );
+    void deliver_samples( std::atomic< bool > const & stopped );
+    void apply_delivery_thread_settings();
+    void on_sample( const hid_sample & sample, unsigned long long & last_frame_number, rs2_time_t & last_timestamp );
+
     const std::vector< std::pair< std::string, stream_profile > > _sensor_name_and_hid_profiles;
     std::map< rs2_stream, std::map< uint32_t, uint32_t > > _fps_and_sampling_frequency_per_rs2_stream;
     std::shared_ptr< platform::hid_device > _hid_device;
@@ -74,6 +93,21 @@ private:
     //Keeps set sensitivity values for gyro and accel
     std::map< rs2_stream, float > _imu_sensitivity_per_rs2_stream;
 
+    // Samples are delivered from our own thread: the backend thread only queues them, and never waits on the user or
+    // on locks shared with other streams
+    rsutils::concurrency::spsc_queue< hid_sample > _samples;
+    std::thread _delivery_thread;
+    // Set by stop() for the thread of that run only: a thread we had to detach (when stopped from its own callback)
+    // may still be returning from that callback after we're started again, and must not touch the new run's samples
+    std::shared_ptr< std::atomic< bool > > _delivery_stopped;
+    // RS2_OPTION_MOTION_THREAD_PRIORITY and RS2_OPTION_MOTION_THREAD_AFFINITY: as the options hold them, and as the
+    // thread reads them, when the version changes
+    int _priority_option_value;
+    int _affinity_option_value;
+    std::atomic< int > _delivery_thread_priority;
+    std::atomic< int > _delivery_thread_affinity;
+    std::atomic< unsigned > _delivery_thread_settings_version;
+
     stream_profiles get_sensor_profiles( std::string sensor_name ) const;
 
     const std::string & rs2_stream_to_sensor_name( rs2_stream stream ) const;
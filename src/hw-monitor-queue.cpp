@@ -0,0 +1,162 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "hw-monitor-queue.h"
+
+
+namespace librealsense
+{
+    hw_monitor_queue::hw_monitor_queue( std::shared_ptr< hw_monitor > hwm )
+        : _hwm( std::move( hwm ) )
+        , _dispatcher( 10 )
+    {
+        if( ! _hwm )
+            throw invalid_value_exception( "HW monitor is empty" );
+        _dispatcher.start();
+    }
+
+    hw_monitor_queue::~hw_monitor_queue()
+    {
+        // Anything already queued is still sent, so no future is left without a result
+        try
+        {
+            flush();
+        }
+        catch( ... )
+        {
+            LOG_DEBUG( "Error while flushing hw-monitor queue" );
+        }
+        _dispatcher.stop();
+    }
+
+    std::future< std::vector< uint8_t > > hw_monitor_queue::send( command const & cmd )
+    {
+        auto hwm = _hwm;
+        return enqueue( cmd.cmd, [hwm, cmd]() { return hwm->send( cmd ); } );
+    }
+
+    std::future< std::vector< uint8_t > > hw_monitor_queue::send( std::vector< uint8_t > const & data )
+    {
+        // The opcode is at offset 4; see hw_monitor::fill_usb_buffer
+        uint8_t opcode = data.size() > 4 ? data[4] : 0;
+        auto hwm = _hwm;
+        return enqueue( opcode, [hwm, data]() { return hwm->send( data ); } );
+    }
+
+    std::future< std::vector< uint8_t > >
+    hw_monitor_queue::enqueue( uint8_t opcode, std::function< std::vector< uint8_t >() > && transfer )
+    {
+        auto cmd = std::make_shared< pending_command >();
+        cmd->opcode = opcode;
+        cmd->transfer = std::move( transfer );
+        cmd->queued = std::chrono::steady_clock::now();
+        auto result = cmd->result.get_future();
+
+        bool schedule = false;
+        {
+            std::lock_guard< std::mutex > lock( _pending_mutex );
+            _pending.push_back( cmd );
+            // Only one send is ever scheduled: it takes everything pending at the time it runs
+            schedule = ! _send_scheduled;
+            _send_scheduled = true;
+        }
+        if( schedule )
+            _dispatcher.invoke( [this]( dispatcher::cancellable_timer ) { send_pending(); }, true );
+
+        return result;
+    }
+
+    void hw_monitor_queue::send_pending()
+    {
+        std::deque< std::shared_ptr< pending_command > > batch;
+        {
+            std::lock_guard< std::mutex > lock( _pending_mutex );
+            batch.swap( _pending );
+            _send_scheduled = false;
+        }
+        if( batch.empty() )
+            return;
+
+        auto send_all = [&]()
+        {
+            for( auto & cmd : batch )
+            {
+                try
+                {
+                    auto res = cmd->transfer();
+                    update_statistics( *cmd, false );
+                    cmd->result.set_value( std::move( res ) );
+                }
+                catch( ... )
+                {
+                    update_statistics( *cmd, true );
+                    cmd->result.set_exception( std::current_exception() );
+                }
+            }
+        };
+
+        try
+        {
+            if( batch.size() > 1 )
+                _hwm->invoke_locked( send_all );
+            else
+                send_all();
+        }
+        catch( ... )
+        {
+            // Failure to lock/power the device: whatever was not sent yet gets the error
+            for( auto & cmd : batch )
+            {
+                try
+                {
+                    cmd->result.set_exception( std::current_exception() );
+                }
+                catch( std::future_error const & )
+                {
+                    // Already satisfied
+                }
+            }
+        }
+
+        std::lock_guard< std::mutex > lock( _stats_mutex );
+        ++_batches;
+    }
+
+    void hw_monitor_queue::update_statistics( pending_command const & cmd, bool failed )
+    {
+        auto latency = std::chrono::duration_cast< std::chrono::microseconds >( std::chrono::steady_clock::now()
+                                                                                 - cmd.queued );
+        std::lock_guard< std::mutex > lock( _stats_mutex );
+        auto & stats = _stats[cmd.opcode];
+        ++stats.count;
+        if( failed )
+            ++stats.errors;
+        stats.total_latency += latency;
+        stats.min_latency = std::min( stats.min_latency, latency );
+        stats.max_latency = std::max( stats.max_latency, latency );
+    }
+
+    bool hw_monitor_queue::flush( std::chrono::steady_clock::duration timeout )
+    {
+        return _dispatcher.flush( timeout );
+    }
+
+    std::map< uint8_t, hwm_command_stats > hw_monitor_queue::get_statistics() const
+    {
+        std::lock_guard< std::mutex > lock( _stats_mutex );
+        return _stats;
+    }
+
+    size_t hw_monitor_queue::get_number_of_batches() const
+    {
+        std::lock_guard< std::mutex > lock( _stats_mutex );
+        return _batches;
+    }
+
+    void hw_monitor_queue::reset_statistics()
+    {
+        std::lock_guard< std::mutex > lock( _stats_mutex );
+        _stats.clear();
+        _batches = 0;
+    }
+}
@@ -0,0 +1,90 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include "hw-monitor.h"
+
+#include <rsutils/concurrency/concurrency.h>
+
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+
+
+namespace librealsense
+{
+    // Latency statistics of all the commands with the same opcode that went through an hw_monitor_queue.
+    // Latency is measured from the time the command was queued until its result was available.
+    struct hwm_command_stats
+    {
+        size_t count = 0;
+        size_t errors = 0;
+        std::chrono::microseconds total_latency{ 0 };
+        std::chrono::microseconds min_latency{ std::chrono::microseconds::max() };
+        std::chrono::microseconds max_latency{ 0 };
+
+        std::chrono::microseconds average_latency() const
+        {
+            return count ? total_latency / static_cast< std::chrono::microseconds::rep >( count ) : total_latency;
+        }
+    };
+
+
+    // Asynchronous front-end to an hw_monitor: commands can be queued from any thread and are sent, in
+    // order, by a single worker; results (or errors) are returned through futures.
+    //
+    // Whatever is pending when the worker wakes up is sent as a single batch, with the transfer locked
+    // and the device powered up once for the whole batch rather than once per command. Independent
+    // commands (e.g., reading many advanced-mode structs) should therefore all be queued before waiting
+    // on any of their results.
+    //
+    class hw_monitor_queue
+    {
+    public:
+        explicit hw_monitor_queue( std::shared_ptr< hw_monitor > hwm );
+        ~hw_monitor_queue();
+
+        std::future< std::vector< uint8_t > > send( command const & cmd );
+        // Raw buffer, as built by hw_monitor::build_command()
+        std::future< std::vector< uint8_t > > send( std::vector< uint8_t > const & data );
+
+        // Wait until everything queued so far was sent
+        bool flush( std::chrono::steady_clock::duration timeout = std::chrono::seconds( 10 ) );
+
+        // Per-opcode latency statistics since construction (or the last reset)
+        std::map< uint8_t, hwm_command_stats > get_statistics() const;
+        size_t get_number_of_batches() const;
+        void reset_statistics();
+
+    private:
+        struct pending_command
+        {
+            uint8_t opcode;
+            std::function< std::vector< uint8_t >() > transfer;
+            std::promise< std::vector< uint8_t > > result;
+            std::chrono::steady_clock::time_point queued;
+        };
+
+        std::future< std::vector< uint8_t > > enqueue( uint8_t opcode,
+                                                       std::function< std::vector< uint8_t >() > && transfer );
+        void send_pending();
+        void update_statistics( pending_command const & cmd, bool failed );
+
+        std::shared_ptr< hw_monitor > _hwm;
+
+        std::mutex _pending_mutex;
+        std::deque< std::shared_ptr< pending_command > > _pending;
+        bool _send_scheduled = false;
+
+        mutable std::mutex _stats_mutex;
+        std::map< uint8_t, hwm_command_stats > _stats;
+        size_t _batches = 0;
+
+        dispatcher _dispatcher;
+    };
+}
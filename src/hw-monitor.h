@@ -51,9 +51,11 @@ namespace librealsense
     class locked_transfer
     {
     public:
+        // A null uvc_ep means the transfer does not need a sensor to be powered in order to go through
         locked_transfer(std::shared_ptr<platform::command_transfer> command_transfer, const std::shared_ptr< uvc_sensor > & uvc_ep)
             :_command_transfer(command_transfer),
-            _uvc_sensor_base(uvc_ep)
+            _uvc_sensor_base(uvc_ep),
+            _power_managed(uvc_ep != nullptr)
         {}
 
         std::vector<uint8_t> send_receive(
@@ -68,6 +70,9 @@ namespace librealsense
             if( !token.get() ) throw io_exception( "heap allocation failed" );
 
             std::lock_guard<std::recursive_mutex> lock(_local_mtx);
+            if( ! _power_managed )
+                return _command_transfer->send_receive(pb, cb, timeout_ms, require_response);
+
             auto strong_uvc = _uvc_sensor_base.lock();
             if( ! strong_uvc )
                 return std::vector< uint8_t >();
@@ -79,6 +84,20 @@ namespace librealsense
                 });
         }
 
+        // Runs 'action' while holding the transfer lock and keeping the device powered, so that any
+        // number of send_receive() calls made from it go out back-to-back, without other commands
+        // interleaving and without paying for a power-up each
+        template< class T >
+        auto invoke_locked( T action ) -> decltype( action() )
+        {
+            std::lock_guard<std::recursive_mutex> lock(_local_mtx);
+            auto strong_uvc = _uvc_sensor_base.lock();
+            if( ! strong_uvc )
+                return action();
+
+            return strong_uvc->invoke_powered( [&]( platform::uvc_device & ) { return action(); } );
+        }
+
         ~locked_transfer()
         {
             try
@@ -95,6 +114,7 @@ namespace librealsense
         std::weak_ptr< uvc_sensor> _uvc_sensor_base;
         std::recursive_mutex _local_mtx;
         small_heap<int, 256> _heap;
+        bool _power_managed;
     };
 
     struct command
@@ -154,6 +174,13 @@ namespace librealsense
             : _locked_transfer(std::move(locked_transfer)), _hwmon_response(hwmon_response)
         {}
 
+        // Used to send several commands as one batch; see locked_transfer::invoke_locked
+        template< class T >
+        auto invoke_locked( T action ) const -> decltype( action() )
+        {
+            return _locked_transfer->invoke_locked( std::move( action ) );
+        }
+
         static void fill_usb_buffer( int opCodeNumber,
                                       int p1,
                                       int p2,
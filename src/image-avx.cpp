@@ -1,21 +1,21 @@
 // License: Apache 2.0. See LICENSE file in root directory.
 // Copyright(c) 2015 Intel Corporation. All Rights Reserved.
 
-#define _USE_MATH_DEFINES
-#include <cmath>
 #include "image-avx.h"
 
-#ifndef ANDROID
-    #if defined(__SSSE3__) && defined(__AVX2__)
+#include <cassert>
+
+#ifdef RS2_USE_X86_SIMD
     #include <tmmintrin.h> // For SSE3 intrinsic used in unpack_yuy2_sse
     #include <immintrin.h>
 
     #pragma pack(push, 1) // All structs in this file are assumed to be byte-packed
     namespace librealsense
     {
-        template<rs2_format FORMAT> void unpack_yuy2( uint8_t * const d[], const uint8_t * s, int n)
+        template<rs2_format FORMAT> void unpack_yuy2_avx( uint8_t * const d[], const uint8_t * s, int width, int height )
         {
-            assert(n % 16 == 0); // All currently supported color resolutions are multiples of 16 pixels. Could easily extend support to other resolutions by copying final n<16 pixels into a zero-padded buffer and recursively calling self for final iteration.
+            auto n = width * height;
+            assert(n % 32 == 0); // Each iteration unpacks 32 pixels; other resolutions are left to the SSSE3 version
 
             auto src = reinterpret_cast<const __m256i *>(s);
             auto dst = reinterpret_cast<__m256i *>(d[0]);
@@ -39,12 +39,12 @@
 
                 if (FORMAT == RS2_FORMAT_Y8)
                 {
-                    // Align all Y components and output 32 pixels (32 bytes) at once
-                    __m256i y0 = _mm256_shuffle_epi8(s0, _mm256_setr_epi8(1, 3, 5, 7, 9, 11, 13, 15, 0, 2, 4, 6, 8, 10, 12, 14,
-                        1, 3, 5, 7, 9, 11, 13, 15, 0, 2, 4, 6, 8, 10, 12, 14));
-                    __m256i y1 = _mm256_shuffle_epi8(s1, _mm256_setr_epi8(0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15,
-                        0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15));
-                    _mm256_storeu_si256(&dst[i], _mm256_alignr_epi8(y0, y1, 8));
+                    const __m256i vmask = _mm256_set1_epi16(0x00ff);
+                    s0 = _mm256_and_si256(s0, vmask);  // mask unwanted bytes
+                    s1 = _mm256_and_si256(s1, vmask);
+                    // Packing works per 128-bit lane, leaving the pixels in 0-7, 16-23, 8-15, 24-31 order
+                    __m256i y = _mm256_packus_epi16(s0, s1);
+                    _mm256_storeu_si256(&dst[i], _mm256_permute4x64_epi64(y, _MM_SHUFFLE(3, 1, 2, 0)));
                     continue;
                 }
 
@@ -216,11 +216,11 @@
                         // Shuffle rgb triples to the start and end of each register
                         __m128i bgr0 = _mm_shuffle_epi8(rgba0, _mm_setr_epi8(3, 7, 11, 15, 0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14));
                         __m128i bgr1 = _mm_shuffle_epi8(rgba1, _mm_setr_epi8(0, 1, 2, 4, 3, 7, 11, 15, 5, 6, 8, 9, 10, 12, 13, 14));
-                        __m128i bgr2 = _mm_shuffle_epi8(rgba2, _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 3, 7, 11, 15, 10, 12, 13, 1));
+                        __m128i bgr2 = _mm_shuffle_epi8(rgba2, _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 3, 7, 11, 15, 10, 12, 13, 14));
                         __m128i bgr3 = _mm_shuffle_epi8(rgba3, _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, 3, 7, 11, 15));
                         __m128i bgr4 = _mm_shuffle_epi8(rgba4, _mm_setr_epi8(3, 7, 11, 15, 0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14));
                         __m128i bgr5 = _mm_shuffle_epi8(rgba5, _mm_setr_epi8(0, 1, 2, 4, 3, 7, 11, 15, 5, 6, 8, 9, 10, 12, 13, 14));
-                        __m128i bgr6 = _mm_shuffle_epi8(rgba6, _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 3, 7, 11, 15, 10, 12, 13, 1));
+                        __m128i bgr6 = _mm_shuffle_epi8(rgba6, _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 3, 7, 11, 15, 10, 12, 13, 14));
                         __m128i bgr7 = _mm_shuffle_epi8(rgba7, _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, 3, 7, 11, 15));
 
                         __m128i a1 = _mm_alignr_epi8(bgr1, bgr0, 4);
@@ -248,32 +248,13 @@
             }
         }
 
-        void unpack_yuy2_avx_y8( uint8_t * const d[], const uint8_t * s, int n)
-        {
-            unpack_yuy2<RS2_FORMAT_Y8>(d, s, n);
-        }
-        void unpack_yuy2_avx_y16( uint8_t * const d[], const uint8_t * s, int n)
-        {
-            unpack_yuy2<RS2_FORMAT_Y16>(d, s, n);
-        }
-        void unpack_yuy2_avx_rgb8( uint8_t * const d[], const uint8_t * s, int n)
-        {
-            unpack_yuy2<RS2_FORMAT_RGB8>(d, s, n);
-        }
-        void unpack_yuy2_avx_rgba8( uint8_t * const d[], const uint8_t * s, int n)
-        {
-            unpack_yuy2<RS2_FORMAT_RGBA8>(d, s, n);
-        }
-        void unpack_yuy2_avx_bgr8( uint8_t * const d[], const uint8_t * s, int n)
-        {
-            unpack_yuy2<RS2_FORMAT_BGR8>(d, s, n);
-        }
-        void unpack_yuy2_avx_bgra8( uint8_t * const d[], const uint8_t * s, int n)
-        {
-            unpack_yuy2<RS2_FORMAT_BGRA8>(d, s, n);
-        }
+        template void unpack_yuy2_avx< RS2_FORMAT_Y8 >( uint8_t * const d[], const uint8_t * s, int width, int height );
+        template void unpack_yuy2_avx< RS2_FORMAT_Y16 >( uint8_t * const d[], const uint8_t * s, int width, int height );
+        template void unpack_yuy2_avx< RS2_FORMAT_RGB8 >( uint8_t * const d[], const uint8_t * s, int width, int height );
+        template void unpack_yuy2_avx< RS2_FORMAT_RGBA8 >( uint8_t * const d[], const uint8_t * s, int width, int height );
+        template void unpack_yuy2_avx< RS2_FORMAT_BGR8 >( uint8_t * const d[], const uint8_t * s, int width, int height );
+        template void unpack_yuy2_avx< RS2_FORMAT_BGRA8 >( uint8_t * const d[], const uint8_t * s, int width, int height );
     }
 
     #pragma pack(pop)
-    #endif
 #endif
@@ -5,20 +5,13 @@
 #ifndef LIBREALSENSE_IMAGE_AVX_H
 #define LIBREALSENSE_IMAGE_AVX_H
 
-#include "types.h"
+#include <librealsense2/h/rs_sensor.h>
+#include <cstdint>
 
 namespace librealsense
 {
-#ifndef ANDROID
-    #if defined(__SSSE3__) && defined(__AVX2__)
-    void unpack_yuy2_avx_y8(uint8_t * const d[], const uint8_t * s, int n);
-    void unpack_yuy2_avx_y16(uint8_t * const d[], const uint8_t * s, int n);
-    void unpack_yuy2_avx_rgb8(uint8_t * const d[], const uint8_t * s, int n);
-    void unpack_yuy2_avx_rgba8(uint8_t * const d[], const uint8_t * s, int n);
-    void unpack_yuy2_avx_bgr8(uint8_t * const d[], const uint8_t * s, int n);
-    void unpack_yuy2_avx_bgra8(uint8_t * const d[], const uint8_t * s, int n);
-    #endif
-#endif
+    // Unpacks YUY2 into Y8/Y16/RGB8/RGBA8/BGR8/BGRA8; the number of pixels must be a multiple of 32.
+    template< rs2_format FORMAT > void unpack_yuy2_avx( uint8_t * const d[], const uint8_t * s, int width, int height );
 }
 
 #endif
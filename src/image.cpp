@@ -53,6 +53,7 @@ namespace librealsense
         case RS2_FORMAT_FG: return 16;
         case RS2_FORMAT_Y411: return 12;
         case RS2_FORMAT_Y16I: return 32;
+        case RS2_FORMAT_Z16RVL: return 16; // the frame is allocated for the decoded size; the data is usually smaller
         default: assert(false); return 0;
         }
     }
@@ -39,8 +39,12 @@ playback_device::playback_device( std::shared_ptr< const device_info > const & d
     , m_is_paused( false )
     , m_sample_rate( 1 )
     , m_real_time( true )
+    , m_read_ahead_set( false )
     , m_prev_timestamp( 0 )
     , m_last_published_timestamp( 0 )
+    , m_frames_delivered( 0 )
+    , m_play_start_ns( 0 )
+    , m_last_delivery_ns( 0 )
 {
     if (serializer == nullptr)
     {
@@ -321,6 +325,78 @@ void playback_device::seek_to_time(std::chrono::nanoseconds time)
     }
 }
 
+void playback_device::seek_to_frame(const stream_interface& stream, uint64_t index)
+{
+    auto stream_id = get_stream_identifier(stream);
+    device_serializer::nanoseconds time;
+    std::exception_ptr error;
+    (*m_read_thread)->invoke([&](dispatcher::cancellable_timer t)
+    {
+        try
+        {
+            time = m_reader->query_frame_timestamp(stream_id, index);
+        }
+        catch (...)
+        {
+            error = std::current_exception();
+        }
+    });
+    if ((*m_read_thread)->flush() == false)
+    {
+        LOG_ERROR("Error - timeout waiting for seek_to_frame, possible deadlock detected");
+        assert(0); //Detect this immediately in debug
+    }
+    if (error)
+        std::rethrow_exception(error);
+    seek_to_time(time);
+}
+
+uint64_t playback_device::get_frame_count(const stream_interface& stream) const
+{
+    auto stream_id = get_stream_identifier(stream);
+    uint64_t count = 0;
+    std::exception_ptr error;
+    //The reader is only accessed from the read thread
+    (*m_read_thread)->invoke([&](dispatcher::cancellable_timer t)
+    {
+        try
+        {
+            count = m_reader->query_frame_count(stream_id);
+        }
+        catch (...)
+        {
+            error = std::current_exception();
+        }
+    });
+    if ((*m_read_thread)->flush() == false)
+    {
+        LOG_ERROR("Error - timeout waiting for get_frame_count, possible deadlock detected");
+        assert(0); //Detect this immediately in debug
+    }
+    if (error)
+        std::rethrow_exception(error);
+    return count;
+}
+
+device_serializer::stream_identifier playback_device::get_stream_identifier(const stream_interface& stream) const
+{
+    for (auto&& sensor_pair : m_sensors)
+    {
+        for (auto&& profile : sensor_pair.second->get_stream_profiles())
+        {
+            if (profile->get_stream_type() == stream.get_stream_type() && profile->get_stream_index() == stream.get_stream_index())
+            {
+                return { get_device_index(),
+                         sensor_pair.first,
+                         stream.get_stream_type(),
+                         static_cast<uint32_t>(stream.get_stream_index()) };
+            }
+        }
+    }
+    throw invalid_value_exception( rsutils::string::from() << "Stream " << stream.get_stream_type() << " "
+                                                           << stream.get_stream_index() << " is not in the file" );
+}
+
 rs2_playback_status playback_device::get_current_status() const
 {
     return m_is_started ?
@@ -412,6 +488,49 @@ bool playback_device::is_real_time() const
     return m_real_time;
 }
 
+void playback_device::set_read_ahead(uint32_t chunks, uint32_t threads)
+{
+    (*m_read_thread)->invoke([this, chunks, threads](dispatcher::cancellable_timer t)
+    {
+        m_read_ahead_set = true;
+        m_reader->set_read_ahead(chunks, threads);
+    });
+    if ((*m_read_thread)->flush() == false)
+    {
+        LOG_ERROR("Error - timeout waiting for set_read_ahead, possible deadlock detected");
+        assert(0); //Detect this immediately in debug
+    }
+}
+
+void playback_device::set_max_throughput(uint32_t queue_size)
+{
+    LOG_INFO("Set max-throughput queue size to " << queue_size);
+    // Frames are then read as fast as they are consumed, however long that takes
+    if (queue_size)
+        set_real_time(false);
+    (*m_read_thread)->invoke([this, queue_size](dispatcher::cancellable_timer t)
+    {
+        for (auto&& s : m_sensors)
+            s.second->set_max_throughput(queue_size);
+        // Reading is then worth doing ahead, on the threads all playback devices share, unless the user chose
+        if (!m_read_ahead_set)
+            m_reader->set_read_ahead(queue_size ? device_serializer::reader::default_read_ahead_chunks : 0, 0);
+    });
+    if ((*m_read_thread)->flush() == false)
+    {
+        LOG_ERROR("Error - timeout waiting for set_max_throughput, possible deadlock detected");
+        assert(0); //Detect this immediately in debug
+    }
+}
+
+double playback_device::get_throughput() const
+{
+    double const elapsed_ns = double(m_last_delivery_ns - m_play_start_ns);
+    if (elapsed_ns <= 0)
+        return 0;
+    return m_frames_delivered.load() * 1e9 / elapsed_ns;
+}
+
 std::shared_ptr< const device_info > playback_device::get_device_info() const
 {
     return m_device_info;
@@ -482,6 +601,10 @@ void playback_device::start()
         return; //nothing to do
 
     m_is_started = true;
+    auto const now = std::chrono::steady_clock::now().time_since_epoch().count();
+    m_frames_delivered = 0;
+    m_play_start_ns = now;
+    m_last_delivery_ns = now;
     catch_up();
     try_looping();
     LOG_INFO("Playback started");
@@ -561,6 +684,7 @@ void playback_device::do_loop(T action)
                     psc->stop( false );
                 }
             }
+            LOG_INFO( "Played " << m_frames_delivered.load() << " frames at " << get_throughput() << " frames/s" );
 
             std::lock_guard<std::mutex> locker(m_last_published_timestamp_mutex);
             m_last_published_timestamp = device_serializer::nanoseconds(0);
@@ -677,8 +801,12 @@ void playback_device::try_looping()
                     [this, timestamp]() { return calc_sleep_time( timestamp ); },
                     [this]() { return m_is_paused == true; },
                     [this, timestamp]() {
-                        std::lock_guard< std::mutex > locker( m_last_published_timestamp_mutex );
-                        m_last_published_timestamp = timestamp;
+                        {
+                            std::lock_guard< std::mutex > locker( m_last_published_timestamp_mutex );
+                            m_last_published_timestamp = timestamp;
+                        }
+                        ++m_frames_delivered;
+                        m_last_delivery_ns = std::chrono::steady_clock::now().time_since_epoch().count();
                     } );
             }
             return true;
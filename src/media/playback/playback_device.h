@@ -37,6 +37,8 @@ namespace librealsense
 
         void set_frame_rate(double rate);
         void seek_to_time(std::chrono::nanoseconds time);
+        void seek_to_frame(const stream_interface& stream, uint64_t index);
+        uint64_t get_frame_count(const stream_interface& stream) const;
         rs2_playback_status get_current_status() const;
         uint64_t get_duration() const;
         void pause();
@@ -44,6 +46,9 @@ namespace librealsense
         void stop();
         void set_real_time(bool real_time);
         bool is_real_time() const;
+        void set_read_ahead(uint32_t chunks, uint32_t threads);
+        void set_max_throughput(uint32_t queue_size);
+        double get_throughput() const;
         const std::string& get_file_name() const;
         uint64_t get_position() const;
         rsutils::public_signal< playback_device, rs2_playback_status > playback_status_changed;
@@ -71,6 +76,7 @@ namespace librealsense
         template <typename T> void do_loop(T op);
         std::map<uint32_t, std::shared_ptr<playback_sensor>> create_playback_sensors(const device_serializer::device_snapshot& device_description);
         std::shared_ptr<stream_profile_interface> get_stream(const std::map<unsigned, std::shared_ptr<playback_sensor>>& sensors_map, device_serializer::stream_identifier stream_id);
+        device_serializer::stream_identifier get_stream_identifier(const stream_interface& stream) const;
         rs2_extrinsics calc_extrinsic(const rs2_extrinsics& from, const rs2_extrinsics& to);
         void catch_up();
         void register_device_info(const device_serializer::device_snapshot& device_description);
@@ -91,12 +97,17 @@ namespace librealsense
         std::map<uint32_t, std::shared_ptr<playback_sensor>> m_active_sensors;
         std::atomic<double> m_sample_rate;
         std::atomic_bool m_real_time;
+        bool m_read_ahead_set;  // by the user; only accessed on the read thread
         device_serializer::nanoseconds m_prev_timestamp;
         std::vector< std::shared_ptr< rsutils::lazy< rs2_extrinsics > > > m_extrinsics_fetchers;
         std::map<int, std::pair<uint32_t, rs2_extrinsics>> m_extrinsics_map;
         device_serializer::nanoseconds m_last_published_timestamp;
         std::mutex m_last_published_timestamp_mutex;
         std::mutex _active_sensors_mutex;
+        // Frames delivered since playback started, and when: steady_clock nanoseconds, so they can be atomic
+        std::atomic< uint64_t > m_frames_delivered;
+        std::atomic< int64_t > m_play_start_ns;
+        std::atomic< int64_t > m_last_delivery_ns;
     };
 
     MAP_EXTENSION(RS2_EXTENSION_PLAYBACK, playback_device);
@@ -10,6 +10,7 @@
 #include "media/ros/ros_reader.h"
 
 #include <rsutils/string/from.h>
+#include <rsutils/json.h>
 
 
 using namespace librealsense;
@@ -33,7 +34,8 @@ playback_sensor::playback_sensor(device_interface& parent_device, const device_s
     m_sensor_description(sensor_description),
     m_sensor_id(sensor_description.get_sensor_index()),
     m_parent_device(parent_device),
-    _default_queue_size(1)
+    _default_queue_size(1),
+    m_max_throughput_queue_size(0)
 {
     register_sensor_streams(m_sensor_description.get_stream_profiles());
     register_sensor_infos(m_sensor_description);
@@ -89,15 +91,7 @@ void playback_sensor::open(const stream_profiles& requests)
     //For each stream, create a dedicated dispatching thread
     for (auto&& profile : requests)
     {
-        auto on_drop_callback = [profile]( dispatcher::action act ) {
-            LOG_DEBUG( "Dropping frame from dispatcher " << profile_to_string( profile ) );
-        };
-
-        m_dispatchers.emplace( std::make_pair(
-            profile->get_unique_id(),
-            std::make_shared< dispatcher >( _default_queue_size, on_drop_callback ) ) );
-
-        m_dispatchers[profile->get_unique_id()]->start();
+        m_dispatchers.emplace( profile->get_unique_id(), create_dispatcher( profile ) );
 
         device_serializer::stream_identifier f{ get_device_index(), m_sensor_id, profile->get_stream_type(), static_cast<uint32_t>(profile->get_stream_index()) };
         opened_streams.push_back(f);
@@ -222,6 +216,42 @@ void playback_sensor::flush_pending_frames()
     }
 }
 
+std::shared_ptr< dispatcher >
+playback_sensor::create_dispatcher( std::shared_ptr< stream_profile_interface > const & profile )
+{
+    auto & counters = m_statistics.get( profile->get_stream_type(), profile->get_stream_index() );
+    auto on_drop_callback = [profile, &counters]( dispatcher::action act ) {
+        LOG_DEBUG( "Dropping frame from dispatcher " << profile_to_string( profile ) );
+        counters.add_dropped( frame_drop_reason::queue_full );
+    };
+    auto queue_size = m_max_throughput_queue_size ? m_max_throughput_queue_size.load() : _default_queue_size;
+    auto d = std::make_shared< dispatcher >( queue_size, on_drop_callback );
+    d->start();
+    return d;
+}
+
+rsutils::json playback_sensor::get_statistics() const
+{
+    rsutils::json j = rsutils::json::object();
+    j["streams"] = m_statistics.to_json();
+    return j;
+}
+
+void playback_sensor::set_max_throughput( uint32_t queue_size )
+{
+    std::lock_guard< std::mutex > l( m_mutex );
+    m_max_throughput_queue_size = queue_size;
+    // Streams already open get queues of the new size: the device calls us when it is not handling frames
+    for( auto const & profile : get_active_streams() )
+    {
+        auto it = m_dispatchers.find( profile->get_unique_id() );
+        if( it == m_dispatchers.end() )
+            continue;
+        it->second->flush();
+        it->second = create_dispatcher( profile );
+    }
+}
+
 void playback_sensor::register_sensor_streams(const stream_profiles& profiles)
 {
     for (auto profile : profiles)
@@ -7,6 +7,7 @@
 #include "../../core/serialization.h"
 #include "../../archive.h"
 #include "../../sensor.h"
+#include "../../core/frame-statistics.h"
 #include "../../types.h"
 
 #include <rsutils/signal.h>
@@ -53,6 +54,9 @@ namespace librealsense
         void update_option(rs2_option id, std::shared_ptr<option> option);
         void stop(bool invoke_required);
         void flush_pending_frames();
+        // 0 for synchronous delivery (see handle_frame); otherwise, up to that many frames of each stream are queued,
+        // and the streams are delivered in parallel. Must be called from the device's reading thread.
+        void set_max_throughput( uint32_t queue_size );
         void update(const device_serializer::sensor_snapshot& sensor_snapshot);
         rs2_frame_callback_sptr get_frames_callback() const override;
         void set_frames_callback( rs2_frame_callback_sptr callback ) override;
@@ -82,6 +86,8 @@ namespace librealsense
             throw not_implemented_exception( "Registering options value changed callback is not implemented for playback sensor" );
         }
 
+        rsutils::json get_statistics() const override;
+
     protected:
         void set_active_streams(const stream_profiles& requests);
 
@@ -89,6 +95,7 @@ namespace librealsense
         void register_sensor_streams(const stream_profiles& vector);
         void register_sensor_infos(const device_serializer::sensor_snapshot& sensor_snapshot);
         void register_sensor_options(const device_serializer::sensor_snapshot& sensor_snapshot);
+        std::shared_ptr< dispatcher > create_dispatcher( std::shared_ptr< stream_profile_interface > const & profile );
         
 
 
@@ -106,6 +113,8 @@ namespace librealsense
         stream_profiles m_active_streams;
         mutable std::mutex m_active_profile_mutex;
         const unsigned int _default_queue_size;
+        std::atomic< uint32_t > m_max_throughput_queue_size;
+        frame_statistics m_statistics;
 
     public:
         //handle frame use 3 lambda functions that determines if and when a frame should be published.
@@ -126,13 +135,15 @@ namespace librealsense
                 frame->get_owner()->set_sensor(shared_from_this());
                 auto type = frame->get_stream()->get_stream_type();
                 auto index = static_cast<uint32_t>(frame->get_stream()->get_stream_index());
+                auto & counters = m_statistics.get( type, index );
+                stream_frame_counters::add( counters.received );
                 frame->set_stream(m_streams[std::make_pair(type, index)]);
                 frame->set_sensor(shared_from_this());
                 auto stream_id = frame.frame->get_stream()->get_unique_id();
                 //TODO: Ziv, remove usage of shared_ptr when frame_holder is cpoyable
                 auto pf = std::make_shared<frame_holder>(std::move(frame));
 
-                auto callback = [this, is_real_time, stream_id, pf, calc_sleep, is_paused, update_last_pushed_frame](dispatcher::cancellable_timer t)
+                auto callback = [this, is_real_time, stream_id, pf, calc_sleep, is_paused, update_last_pushed_frame, &counters](dispatcher::cancellable_timer t)
                 {                  
                     device_serializer::nanoseconds sleep_for = calc_sleep();
                     if (sleep_for.count() > 0)
@@ -142,11 +153,11 @@ namespace librealsense
 
                     frame_interface* pframe = nullptr;
 
-                    if (!is_streaming())
-                        return;
-
-                    if (is_paused())
+                    if( ! is_streaming() || is_paused() )
+                    {
+                        counters.add_dropped( frame_drop_reason::inactive );
                         return;
+                    }
 
                     std::swap((*pf).frame, pframe);
                     
@@ -154,18 +165,25 @@ namespace librealsense
                     // "reset()" it will not destroy the object
                     auto user_callback = m_user_callback;
                     if (user_callback)
+                    {
+                        stream_frame_counters::add( counters.delivered );
                         user_callback->on_frame((rs2_frame*)pframe);
+                    }
                     
                     update_last_pushed_frame();
                     
                 };
-                m_dispatchers.at(stream_id)->invoke(callback, !is_real_time);
+                auto & stream_dispatcher = m_dispatchers.at( stream_id );
+                stream_dispatcher->invoke( callback, ! is_real_time );
+                counters.update_queue_size( stream_dispatcher->size() );
 
                 // On non-real-time, we want the playback to run in synchronous mode:
                 // The playback will dispatch each frame and wait for it callback to finish before
                 // moving on to the next one.
-                if( ! is_real_time )
-                    m_dispatchers.at( stream_id )->flush();
+                // In max-throughput mode the (blocking) invoke above is enough: the playback only waits once
+                // the stream's queue is full, reading ahead of callbacks that run in parallel for each stream.
+                if( ! is_real_time && ! m_max_throughput_queue_size )
+                    stream_dispatcher->flush();
             }
         }
     };
@@ -433,6 +433,11 @@ const std::string& librealsense::record_device::get_filename() const
 {
     return m_ros_writer->get_file_name();
 }
+
+void librealsense::record_device::set_depth_codec(bool enabled, unsigned trim_bits)
+{
+    m_ros_writer->set_depth_codec(enabled, trim_bits);
+}
 std::shared_ptr< const device_info > record_device::get_device_info() const
 {
     return m_device->get_device_info();
@@ -9,6 +9,7 @@
 #include <src/core/frame-callback.h>
 
 #include <rsutils/string/from.h>
+#include <rsutils/json.h>
 
 using namespace librealsense;
 
@@ -248,6 +249,11 @@ processing_blocks librealsense::record_sensor::get_recommended_processing_blocks
     return m_sensor.get_recommended_processing_blocks();
 }
 
+rsutils::json record_sensor::get_statistics() const
+{
+    return m_sensor.get_statistics();
+}
+
 void record_sensor::record_frame(frame_holder frame)
 {
     if(m_is_recording)
@@ -61,6 +61,8 @@ namespace librealsense
             throw not_implemented_exception( "Registering options value changed callback is not implemented for record sensor" );
         }
 
+        rsutils::json get_statistics() const override;
+
     private /*methods*/:
         std::function< void( const notification & ) > _on_notification;
         std::function< void( frame_holder ) > _on_frame;
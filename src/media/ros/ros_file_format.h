@@ -229,6 +229,9 @@ namespace librealsense
     constexpr const char* FRAME_TIMESTAMP_MD_STR = "frame_timestamp";
     constexpr const char* TRACKER_CONFIDENCE_MD_STR = "Tracker Confidence";
 
+    // Appended to the encoding of images whose data is RVL-compressed (e.g., "mono16;rvl")
+    constexpr const char* RVL_ENCODING_SUFFIX = ";rvl";
+
     class ros_topic
     {
     public:
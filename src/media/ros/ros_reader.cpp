@@ -13,16 +13,40 @@
 #include <src/context.h>
 
 #include <rsutils/string/from.h>
+#include <rsutils/codec/rvl.h>
 #include <cstring>
+#include <thread>
 
 
 namespace librealsense
 {
     using namespace device_serializer;
 
+    namespace {
+
+    // Kept for as long as any reader uses it
+    std::shared_ptr< rosbag::ReadAheadPool > shared_read_ahead_pool()
+    {
+        static std::mutex mutex;
+        static std::weak_ptr< rosbag::ReadAheadPool > weak_pool;
+
+        std::lock_guard< std::mutex > lock( mutex );
+        auto pool = weak_pool.lock();
+        if( ! pool )
+        {
+            uint32_t const min_threads = ros_reader::shared_read_ahead_threads;
+            pool = std::make_shared< rosbag::ReadAheadPool >( std::max( min_threads, std::thread::hardware_concurrency() ) );
+            weak_pool = pool;
+        }
+        return pool;
+    }
+
+    }  // namespace
+
     ros_reader::ros_reader(const std::string& file, const std::shared_ptr<context>& ctx) :
         m_metadata_parser_map(md_constant_parser::create_metadata_parser_map()),
         m_total_duration(0),
+        m_end_time(0),
         m_file_path(file),
         m_context(ctx),
         m_version(0),
@@ -32,6 +56,7 @@ namespace librealsense
         {
             reset(); //Note: calling a virtual function inside c'tor, safe while base function is pure virtual
             m_total_duration = get_file_duration(m_file, m_version);
+            m_end_time = get_file_end_time(m_file, m_version);
         }
         catch (const std::exception& e)
         {
@@ -45,16 +70,31 @@ namespace librealsense
         return read_device_description(time);
     }
 
+    void ros_reader::read_sample()
+    {
+        rosbag::MessageInstance msg = *m_samples_itrator;
+        ++m_samples_itrator;
+        if (m_side_topics.count(msg.getTopic()))
+            m_side_messages[msg.getTopic()].push_back(msg);
+        else
+            m_read_ahead.push_back(msg);
+    }
+
     std::shared_ptr<serialized_data> ros_reader::read_next_data()
     {
-        if (m_samples_view == nullptr || m_samples_itrator == m_samples_view->end())
+        if (m_samples_view != nullptr)
+        {
+            while (m_read_ahead.empty() && m_samples_itrator != m_samples_view->end())
+                read_sample();
+        }
+        if (m_read_ahead.empty())
         {
             LOG_DEBUG("End of file reached");
             return std::make_shared<serialized_end_of_file>();
         }
 
-        rosbag::MessageInstance next_msg = *m_samples_itrator;
-        ++m_samples_itrator;
+        rosbag::MessageInstance next_msg = m_read_ahead.front();
+        m_read_ahead.pop_front();
 
         if (next_msg.isType<sensor_msgs::Image>()
             || next_msg.isType<sensor_msgs::Imu>()
@@ -62,7 +102,14 @@ namespace librealsense
             || next_msg.isType<geometry_msgs::Transform>())
         {
             LOG_DEBUG("Next message is a frame");
-            return create_frame(next_msg);
+            if (m_version == legacy_file_format::file_version())
+                return create_frame(next_msg);
+
+            // The frame's side messages have the same time, but may come before or after it in the view
+            while (m_samples_itrator != m_samples_view->end() && (*m_samples_itrator).getTime() <= next_msg.getTime())
+                read_sample();
+            auto side = take_side_messages(next_msg);
+            return create_frame(next_msg, &side);
         }
 
         if (m_version >= 3)
@@ -94,15 +141,18 @@ namespace librealsense
 
     void ros_reader::seek_to_time(const nanoseconds& seek_time)
     {
-        if (seek_time > m_total_duration)
+        //Seek times are file times, like the frames': the bound is the last frame's time, not the duration (a
+        //length, from the first frame to the last)
+        if (seek_time > m_end_time)
         {
             throw invalid_value_exception( rsutils::string::from()
                                            << "Requested time is out of playback length. (Requested = "
-                                           << seek_time.count() << ", Duration = " << m_total_duration.count() << ")" );
+                                           << seek_time.count() << ", Last frame = " << m_end_time.count() << ")" );
         }
         auto seek_time_as_secs = std::chrono::duration_cast<std::chrono::duration<double>>(seek_time);
         auto seek_time_as_rostime = rs2rosinternal::Time(seek_time_as_secs.count());
 
+        clear_read_ahead();
         m_samples_view.reset(new rosbag::View(m_file, FalseQuery()));
 
         //Using cached topics here and not querying them (before reseting) since a previous call to seek
@@ -119,32 +169,70 @@ namespace librealsense
     {
         std::vector<std::shared_ptr<serialized_data>> result;
         rosbag::View view(m_file, FalseQuery());
-        auto as_rostime = to_rostime(seek_time);
-        auto start_time = to_rostime(get_static_file_info_timestamp());
-
         for (auto topic : m_enabled_streams_topics)
         {
-            view.addQuery(m_file, rosbag::TopicQuery(topic), start_time, as_rostime);
+            view.addQuery(m_file, rosbag::TopicQuery(topic));
         }
-        std::map<device_serializer::stream_identifier, rs2rosinternal::Time> last_frames;
-        for (auto&& m : view)
+        auto as_rostime = to_rostime(seek_time);
+        auto start_time = to_rostime(get_static_file_info_timestamp());
+
+        std::set<std::string> frame_topics;
+        for (auto connection : view.getConnections())
         {
-            if (m.isType<sensor_msgs::Image>() || m.isType<sensor_msgs::Imu>())
+            if (connection->datatype == rs2rosinternal::message_traits::DataType<sensor_msgs::Image>::value()
+                || connection->datatype == rs2rosinternal::message_traits::DataType<sensor_msgs::Imu>::value())
             {
-                auto id = ros_topic::get_stream_identifier(m.getTopic());
-                last_frames[id] = m.getTime();
+                frame_topics.insert(connection->topic);
             }
         }
-        for (auto&& kvp : last_frames)
+        for (auto&& topic : frame_topics)
         {
-            auto topic = ros_topic::frame_data_topic(kvp.first);
-            rosbag::View view(m_file, rosbag::TopicQuery(topic), kvp.second, kvp.second);
-            auto msg = view.begin();
+            //The last frame at or before the seek time
+            auto& times = get_frame_times(topic);
+            auto it = std::upper_bound(times.begin(), times.end(), as_rostime);
+            if (it == times.begin() || *std::prev(it) < start_time)
+                continue;
+            auto frame_time = *std::prev(it);
+            rosbag::View frame_view(m_file, rosbag::TopicQuery(topic), frame_time, frame_time);
+            auto msg = frame_view.begin();
             auto new_frame = create_frame(*msg);
             result.push_back(new_frame);
         }
         return result;
     }
+
+    size_t ros_reader::query_frame_count(const stream_identifier& stream_id)
+    {
+        return get_frame_times(get_frame_topic(stream_id)).size();
+    }
+
+    nanoseconds ros_reader::query_frame_timestamp(const stream_identifier& stream_id, size_t index)
+    {
+        auto& times = get_frame_times(get_frame_topic(stream_id));
+        if (index >= times.size())
+        {
+            throw invalid_value_exception( rsutils::string::from()
+                                           << "Requested frame is out of range. (Requested = " << index
+                                           << ", Number of frames = " << times.size() << ")" );
+        }
+        return to_nanoseconds(times[index]);
+    }
+
+    void ros_reader::set_read_ahead(uint32_t chunks, uint32_t threads)
+    {
+        //Applies whenever the file is (re)opened
+        if (threads == 0)
+        {
+            LOG_DEBUG("Reading " << chunks << " chunks ahead on shared threads");
+            m_file.setReadAhead(chunks, chunks ? shared_read_ahead_pool() : nullptr);
+        }
+        else
+        {
+            LOG_DEBUG("Reading " << chunks << " chunks ahead on " << threads << " threads");
+            m_file.setReadAhead(chunks, threads);
+        }
+    }
+
     nanoseconds ros_reader::query_duration() const
     {
         return m_total_duration;
@@ -156,6 +244,9 @@ namespace librealsense
         m_file.open(m_file_path, rosbag::BagMode::Read);
         m_version = read_file_version(m_file);
         m_samples_view = nullptr;
+        clear_read_ahead();
+        m_side_topics.clear();
+        m_frame_times.clear();
         m_frame_source = std::make_shared<frame_source>(m_version == 1 ? 128 : 32);
         m_frame_source->init(m_metadata_parser_map);
         m_initial_device_description = read_device_description(get_static_file_info_timestamp(), true);
@@ -173,14 +264,11 @@ namespace librealsense
         }
         else //Already streaming
         {
-            if (m_samples_itrator != m_samples_view->end())
-            {
-                rosbag::MessageInstance sample_msg = *m_samples_itrator;
-                start_time = sample_msg.getTime();
-            }
+            start_time = current_sample_time(start_time);
         }
         auto currently_streaming = get_topics(m_samples_view);
         //empty the view
+        clear_read_ahead();
         m_samples_view = std::unique_ptr<rosbag::View>(new rosbag::View(m_file, FalseQuery()));
 
         for (auto&& stream_id : stream_ids)
@@ -193,6 +281,19 @@ namespace librealsense
             else
             {
                 m_samples_view->addQuery(m_file, StreamQuery(stream_id), start_time);
+
+                //frame metadata is read along with the frames (see read_next_data)
+                std::vector<std::string> side_topics{ ros_topic::frame_metadata_topic(stream_id) };
+                if (stream_id.stream_type == RS2_STREAM_POSE)
+                {
+                    side_topics.push_back(ros_topic::pose_accel_topic(stream_id));
+                    side_topics.push_back(ros_topic::pose_twist_topic(stream_id));
+                }
+                for (auto&& topic : side_topics)
+                {
+                    m_samples_view->addQuery(m_file, rosbag::TopicQuery(topic), start_time);
+                    m_side_topics.insert(topic);
+                }
             }
         }
 
@@ -211,17 +312,9 @@ namespace librealsense
         {
             return;
         }
-        rs2rosinternal::Time curr_time;
-        if (m_samples_itrator == m_samples_view->end())
-        {
-            curr_time = m_samples_view->getEndTime();
-        }
-        else
-        {
-            rosbag::MessageInstance sample_msg = *m_samples_itrator;
-            curr_time = sample_msg.getTime();
-        }
+        rs2rosinternal::Time curr_time = current_sample_time(m_samples_view->getEndTime());
         auto currently_streaming = get_topics(m_samples_view);
+        clear_read_ahead();
         m_samples_view = std::unique_ptr<rosbag::View>(new rosbag::View(m_file, FalseQuery()));
         for (auto topic : currently_streaming)
         {
@@ -245,7 +338,96 @@ namespace librealsense
         return m_file_path;
     }
 
-    std::shared_ptr<serialized_frame> ros_reader::create_frame(const rosbag::MessageInstance& msg)
+    rs2rosinternal::Time ros_reader::current_sample_time(const rs2rosinternal::Time& default_time) const
+    {
+        //The next sample to be returned may have been read ahead already
+        if (!m_read_ahead.empty())
+            return m_read_ahead.front().getTime();
+        if (m_samples_itrator != m_samples_view->end())
+            return (*m_samples_itrator).getTime();
+        return default_time;
+    }
+
+    void ros_reader::clear_read_ahead()
+    {
+        m_read_ahead.clear();
+        m_side_messages.clear();
+    }
+
+    const std::vector<rs2rosinternal::Time>& ros_reader::get_frame_times(const std::string& topic)
+    {
+        auto it = m_frame_times.find(topic);
+        if (it != m_frame_times.end())
+            return it->second;
+
+        //Iterating a view only walks the bag's index; message data is read on instantiation
+        std::vector<rs2rosinternal::Time> times;
+        rosbag::View view(m_file, rosbag::TopicQuery(topic));
+        times.reserve(view.size());
+        for (auto&& msg : view)
+            times.push_back(msg.getTime());
+        return m_frame_times.emplace(topic, std::move(times)).first->second;
+    }
+
+    std::string ros_reader::get_frame_topic(const stream_identifier& stream_id) const
+    {
+        if (m_version == legacy_file_format::file_version())
+            throw not_implemented_exception("Frame random access is not supported for this file version");
+        if (stream_id.stream_type == RS2_STREAM_POSE)
+            return ros_topic::pose_transform_topic(stream_id);
+        return ros_topic::frame_data_topic(stream_id);
+    }
+
+    ros_reader::side_messages ros_reader::take_side_messages(const rosbag::MessageInstance& msg)
+    {
+        side_messages side;
+        auto stream_id = ros_topic::get_stream_identifier(msg.getTopic());
+        auto collect = [&](const std::string& topic)
+        {
+            auto it = m_side_messages.find(topic);
+            if (it == m_side_messages.end())
+                return;
+            auto& queue = it->second;
+            //Anything older belongs to a frame that's not coming (e.g., it was skipped when seeking)
+            while (!queue.empty() && queue.front().getTime() < msg.getTime())
+                queue.pop_front();
+            auto& messages = side[topic];
+            while (!queue.empty() && queue.front().getTime() == msg.getTime())
+            {
+                messages.push_back(queue.front());
+                queue.pop_front();
+            }
+        };
+        collect(ros_topic::frame_metadata_topic(stream_id));
+        if (stream_id.stream_type == RS2_STREAM_POSE)
+        {
+            collect(ros_topic::pose_accel_topic(stream_id));
+            collect(ros_topic::pose_twist_topic(stream_id));
+        }
+        return side;
+    }
+
+    std::vector<rosbag::MessageInstance> ros_reader::get_side_messages(const side_messages* side,
+        const std::string& topic,
+        const rosbag::MessageInstance& msg) const
+    {
+        if (side)
+        {
+            auto it = side->find(topic);
+            if (it == side->end())
+                return {};
+            return it->second;
+        }
+
+        //Not read along with the frame (e.g., when fetching the last frames): look it up
+        std::vector<rosbag::MessageInstance> messages;
+        rosbag::View view(m_file, rosbag::TopicQuery(topic), msg.getTime(), msg.getTime());
+        for (auto&& message_instance : view)
+            messages.push_back(message_instance);
+        return messages;
+    }
+
+    std::shared_ptr<serialized_frame> ros_reader::create_frame(const rosbag::MessageInstance& msg, const side_messages* side)
     {
         auto next_msg_topic = msg.getTopic();
         auto next_msg_time = msg.getTime();
@@ -263,15 +445,15 @@ namespace librealsense
         frame_holder frame{ nullptr };
         if (msg.isType<sensor_msgs::Image>())
         {
-            frame = create_image_from_message(msg);
+            frame = create_image_from_message(msg, side);
         }
         else if (msg.isType<sensor_msgs::Imu>())
         {
-            frame = create_motion_sample(msg);
+            frame = create_motion_sample(msg, side);
         }
         else if (msg.isType<realsense_legacy_msgs::pose>() || msg.isType<geometry_msgs::Transform>())
         {
-            frame = create_pose_sample(msg);
+            frame = create_pose_sample(msg, side);
         }
         else
         {
@@ -288,18 +470,26 @@ namespace librealsense
         return std::make_shared<serialized_frame>(timestamp, stream_id, std::move(frame));
     }
 
-    nanoseconds ros_reader::get_file_duration(const rosbag::Bag& file, uint32_t version)
+    static std::function<bool(rosbag::ConnectionInfo const* info)> frames_query(uint32_t version)
     {
-        std::function<bool(rosbag::ConnectionInfo const* info)> query;
         if (version == legacy_file_format::file_version())
-            query = legacy_file_format::FrameQuery();
-        else
-            query = FrameQuery();
-        rosbag::View all_frames_view(file, query);
+            return legacy_file_format::FrameQuery();
+        return FrameQuery();
+    }
+
+    nanoseconds ros_reader::get_file_duration(const rosbag::Bag& file, uint32_t version)
+    {
+        rosbag::View all_frames_view(file, frames_query(version));
         auto streaming_duration = all_frames_view.getEndTime() - all_frames_view.getBeginTime();
         return nanoseconds(streaming_duration.toNSec());
     }
 
+    nanoseconds ros_reader::get_file_end_time(const rosbag::Bag& file, uint32_t version)
+    {
+        rosbag::View all_frames_view(file, frames_query(version));
+        return nanoseconds(all_frames_view.getEndTime().toNSec());
+    }
+
     void ros_reader::get_legacy_frame_metadata(const rosbag::Bag& bag,
         const device_serializer::stream_identifier& stream_id,
         const rosbag::MessageInstance &msg,
@@ -349,17 +539,13 @@ namespace librealsense
         }
     }
 
-    std::map<std::string, std::string> ros_reader::get_frame_metadata(const rosbag::Bag& bag,
-        const std::string& topic,
-        const device_serializer::stream_identifier& stream_id,
-        const rosbag::MessageInstance &msg,
+    std::map<std::string, std::string> ros_reader::get_frame_metadata(const std::vector<rosbag::MessageInstance>& metadata_msgs,
         frame_additional_data& additional_data)
     {
         uint32_t total_md_size = 0;
         std::map<std::string, std::string> remaining;
-        rosbag::View frame_metadata_view(bag, rosbag::TopicQuery(topic), msg.getTime(), msg.getTime());
 
-        for (auto message_instance : frame_metadata_view)
+        for (auto&& message_instance : metadata_msgs)
         {
             auto key_val_msg = instantiate_msg<diagnostic_msgs::KeyValue>(message_instance);
             if (key_val_msg->key == TIMESTAMP_DOMAIN_MD_STR)
@@ -403,7 +589,7 @@ namespace librealsense
         return remaining;
     }
 
-    frame_holder ros_reader::create_image_from_message(const rosbag::MessageInstance &image_data) const
+    frame_holder ros_reader::create_image_from_message(const rosbag::MessageInstance &image_data, const side_messages* side) const
     {
         LOG_DEBUG("Trying to create an image frame from message");
         auto msg = instantiate_msg<sensor_msgs::Image>(image_data);
@@ -429,12 +615,25 @@ namespace librealsense
             //Version 2 and above
             stream_id = ros_topic::get_stream_identifier(image_data.getTopic());
             auto info_topic = ros_topic::frame_metadata_topic(stream_id);
-            get_frame_metadata(m_file, info_topic, stream_id, image_data, additional_data);
+            get_frame_metadata(get_side_messages(side, info_topic, image_data), additional_data);
+        }
+
+        // RVL-compressed depth is decoded straight into the frame
+        std::string encoding = msg->encoding;
+        size_t const rvl_suffix_length = std::strlen( RVL_ENCODING_SUFFIX );
+        bool const is_rvl = encoding.size() > rvl_suffix_length
+                         && encoding.compare( encoding.size() - rvl_suffix_length, rvl_suffix_length, RVL_ENCODING_SUFFIX ) == 0;
+        if( is_rvl )
+        {
+            encoding.resize( encoding.size() - rvl_suffix_length );
+            if( msg->step != 2 * msg->width )
+                throw io_exception( rsutils::string::from() << "RVL image of width " << msg->width << " has a step of "
+                                                            << msg->step );
         }
 
         frame_interface * frame = m_frame_source->alloc_frame(
             { stream_id.stream_type, stream_id.stream_index, frame_source::stream_to_frame_types( stream_id.stream_type ) },
-            msg->data.size(),
+            is_rvl ? size_t( msg->step ) * msg->height : msg->data.size(),
             std::move( additional_data ),
             true );
 
@@ -446,20 +645,35 @@ namespace librealsense
         librealsense::video_frame* video_frame = static_cast<librealsense::video_frame*>(frame);
         video_frame->assign(msg->width, msg->height, msg->step, msg->step / msg->width * 8);
         rs2_format stream_format;
-        convert(msg->encoding, stream_format);
+        convert(encoding, stream_format);
         //attaching a temp stream to the frame. Playback sensor should assign the real stream
         frame->set_stream( std::make_shared< video_stream_profile >() );
         frame->get_stream()->set_format(stream_format);
         frame->get_stream()->set_stream_index(int(stream_id.stream_index));
         frame->get_stream()->set_stream_type(stream_id.stream_type);
-        video_frame->data = std::move(msg->data);
         librealsense::frame_holder fh{ video_frame };
+        if( is_rvl )
+        {
+            try
+            {
+                rsutils::codec::rvl_decode( msg->data.data(),
+                                            msg->data.size(),
+                                            reinterpret_cast< uint16_t * >( video_frame->data.data() ),
+                                            size_t( msg->width ) * msg->height );
+            }
+            catch( std::runtime_error const & e )
+            {
+                throw io_exception( rsutils::string::from() << "Failed to decode image: " << e.what() );
+            }
+        }
+        else
+            video_frame->data = std::move(msg->data);
         LOG_DEBUG("Created image frame: " << stream_id << " " << video_frame->get_width() << "x" << video_frame->get_height() << " " << stream_format);
 
         return fh;
     }
 
-    frame_holder ros_reader::create_motion_sample(const rosbag::MessageInstance &motion_data) const
+    frame_holder ros_reader::create_motion_sample(const rosbag::MessageInstance &motion_data, const side_messages* side) const
     {
         LOG_DEBUG("Trying to create a motion frame from message");
 
@@ -483,7 +697,7 @@ namespace librealsense
             //Version 2 and above
             stream_id = ros_topic::get_stream_identifier(motion_data.getTopic());
             auto info_topic = ros_topic::frame_metadata_topic(stream_id);
-            get_frame_metadata(m_file, info_topic, stream_id, motion_data, additional_data);
+            get_frame_metadata(get_side_messages(side, info_topic, motion_data), additional_data);
         }
 
         size_t size_of_imu_data = (stream_id.stream_type == RS2_STREAM_MOTION) ? sizeof(rs2_combined_motion) : 3 * sizeof(float);
@@ -567,7 +781,7 @@ namespace librealsense
         return f;
     }
 
-    frame_holder ros_reader::create_pose_sample(const rosbag::MessageInstance &msg) const
+    frame_holder ros_reader::create_pose_sample(const rosbag::MessageInstance &msg, const side_messages* side) const
     {
         LOG_DEBUG("Trying to create a pose frame from message");
 
@@ -601,14 +815,18 @@ namespace librealsense
 
             auto stream_id = ros_topic::get_stream_identifier(msg.getTopic());
             std::string accel_topic = ros_topic::pose_accel_topic(stream_id);
-            rosbag::View accel_view(m_file, rosbag::TopicQuery(accel_topic), msg.getTime(), msg.getTime());
-            assert(accel_view.size() == 1);
-            auto accel_msg = instantiate_msg<geometry_msgs::Accel>(*accel_view.begin());
+            auto accel_msgs = get_side_messages(side, accel_topic, msg);
+            assert(accel_msgs.size() == 1);
+            if (accel_msgs.empty())
+                throw io_exception("Invalid file format, missing " + accel_topic + " message");
+            auto accel_msg = instantiate_msg<geometry_msgs::Accel>(accel_msgs.front());
 
             std::string twist_topic = ros_topic::pose_twist_topic(stream_id);
-            rosbag::View twist_view(m_file, rosbag::TopicQuery(twist_topic), msg.getTime(), msg.getTime());
-            assert(twist_view.size() == 1);
-            auto twist_msg = instantiate_msg<geometry_msgs::Twist>(*twist_view.begin());
+            auto twist_msgs = get_side_messages(side, twist_topic, msg);
+            assert(twist_msgs.size() == 1);
+            if (twist_msgs.empty())
+                throw io_exception("Invalid file format, missing " + twist_topic + " message");
+            auto twist_msg = instantiate_msg<geometry_msgs::Twist>(twist_msgs.front());
 
             pose.rotation = to_float4(transform_msg->rotation);
             pose.translation = to_float3(transform_msg->translation);
@@ -630,7 +848,7 @@ namespace librealsense
             //Version 2 and above
             stream_id = ros_topic::get_stream_identifier(msg.getTopic());
             auto info_topic = ros_topic::frame_metadata_topic(stream_id);
-            auto remaining = get_frame_metadata(m_file, info_topic, stream_id, msg, additional_data);
+            auto remaining = get_frame_metadata(get_side_messages(side, info_topic, msg), additional_data);
             for (auto&& kvp : remaining)
             {
                 if (kvp.first == MAPPER_CONFIDENCE_MD_STR)
@@ -9,6 +9,10 @@
 
 #include <rsutils/string/from.h>
 
+#include <deque>
+#include <map>
+#include <set>
+
 
 namespace librealsense
 {
@@ -25,11 +29,19 @@ namespace librealsense
     class ros_reader: public device_serializer::reader
     {
     public:
+        // Chunks are 768KB (uncompressed) by default, so default_read_ahead_chunks keep about 3MB decompressed ahead
+        // of playback. Readers that read ahead on shared threads share one pool of (at least this many) threads, so
+        // playing many files at once does not multiply the threads.
+        static constexpr uint32_t shared_read_ahead_threads = 2;
+
         ros_reader(const std::string& file, const std::shared_ptr<context>& ctx);
         device_snapshot query_device_description(const nanoseconds& time) override;
         std::shared_ptr<serialized_data> read_next_data() override;
         void seek_to_time(const nanoseconds& seek_time) override;
         std::vector<std::shared_ptr<serialized_data>> fetch_last_frames(const nanoseconds& seek_time) override;
+        size_t query_frame_count(const stream_identifier& stream_id) override;
+        nanoseconds query_frame_timestamp(const stream_identifier& stream_id, size_t index) override;
+        void set_read_ahead(uint32_t chunks, uint32_t threads) override;
         nanoseconds query_duration() const override;
         void reset() override;
         virtual void enable_stream(const std::vector<device_serializer::stream_identifier>& stream_ids) override;
@@ -52,8 +64,19 @@ namespace librealsense
             return msg_instnance_ptr;
         }
 
-        std::shared_ptr<serialized_frame> create_frame(const rosbag::MessageInstance& msg);
+        // Messages that accompany frame data (metadata, pose accel/twist), by topic, all with the frame's time
+        typedef std::map<std::string, std::vector<rosbag::MessageInstance>> side_messages;
+
+        std::shared_ptr<serialized_frame> create_frame(const rosbag::MessageInstance& msg, const side_messages* side = nullptr);
+        void read_sample();
+        side_messages take_side_messages(const rosbag::MessageInstance& msg);
+        std::vector<rosbag::MessageInstance> get_side_messages(const side_messages* side, const std::string& topic, const rosbag::MessageInstance& msg) const;
+        rs2rosinternal::Time current_sample_time(const rs2rosinternal::Time& default_time) const;
+        void clear_read_ahead();
+        const std::vector<rs2rosinternal::Time>& get_frame_times(const std::string& topic);
+        std::string get_frame_topic(const stream_identifier& stream_id) const;
         static nanoseconds get_file_duration(const rosbag::Bag& file, uint32_t version);
+        static nanoseconds get_file_end_time(const rosbag::Bag& file, uint32_t version);
         static void get_legacy_frame_metadata(const rosbag::Bag& bag,
             const device_serializer::stream_identifier& stream_id,
             const rosbag::MessageInstance &msg,
@@ -74,16 +97,13 @@ namespace librealsense
             return ret;
         }
 
-        static std::map<std::string, std::string> get_frame_metadata(const rosbag::Bag& bag,
-            const std::string& topic,
-            const device_serializer::stream_identifier& stream_id,
-            const rosbag::MessageInstance &msg,
+        static std::map<std::string, std::string> get_frame_metadata(const std::vector<rosbag::MessageInstance>& metadata_msgs,
             frame_additional_data& additional_data);
-        frame_holder create_image_from_message(const rosbag::MessageInstance &image_data) const;
-        frame_holder create_motion_sample(const rosbag::MessageInstance &motion_data) const;
+        frame_holder create_image_from_message(const rosbag::MessageInstance &image_data, const side_messages* side) const;
+        frame_holder create_motion_sample(const rosbag::MessageInstance &motion_data, const side_messages* side) const;
         static inline float3 to_float3(const geometry_msgs::Vector3& v);
         static inline float4 to_float4(const geometry_msgs::Quaternion& q);
-        frame_holder create_pose_sample(const rosbag::MessageInstance &msg) const;
+        frame_holder create_pose_sample(const rosbag::MessageInstance &msg, const side_messages* side) const;
         static uint32_t read_file_version(const rosbag::Bag& file);
         bool try_read_legacy_stream_extrinsic(const stream_identifier& stream_id, uint32_t& group_id, rs2_extrinsics& extrinsic) const;
         bool try_read_stream_extrinsic(const stream_identifier& stream_id, uint32_t& group_id, rs2_extrinsics& extrinsic) const;
@@ -129,12 +149,22 @@ namespace librealsense
         std::shared_ptr<metadata_parser_map>    m_metadata_parser_map;
         device_snapshot                         m_initial_device_description;
         nanoseconds                             m_total_duration;
+        nanoseconds                             m_end_time;
         std::string                             m_file_path;
         std::shared_ptr<frame_source>           m_frame_source;
         rosbag::Bag                             m_file;
         std::unique_ptr<rosbag::View>           m_samples_view;
         rosbag::View::iterator                  m_samples_itrator;
         std::vector<std::string>                m_enabled_streams_topics;
+        // Frame metadata (and pose accel/twist) topics are read in the same pass as the frame data rather than with a
+        // separate view per frame; the side messages read so far are kept here until their frame is created
+        std::set<std::string>                   m_side_topics;
+        std::map<std::string, std::deque<rosbag::MessageInstance>> m_side_messages;
+        // Samples read ahead of their turn, while looking for the side messages of an earlier frame
+        std::deque<rosbag::MessageInstance>     m_read_ahead;
+        // The time of every frame, per frame data topic, as found in the bag's own index (no message data is read).
+        // Built the first time a topic is seeked into, and used to find frames without walking the file
+        std::map<std::string, std::vector<rs2rosinternal::Time>> m_frame_times;
         std::shared_ptr<context>                m_context;
         uint32_t                                m_version;
         float                                   m_legacy_depth_units;
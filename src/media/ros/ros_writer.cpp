@@ -17,6 +17,7 @@
 #include <src/core/device-interface.h>
 
 #include <rsutils/string/from.h>
+#include <rsutils/codec/rvl.h>
 
 namespace librealsense
 {
@@ -85,6 +86,15 @@ namespace librealsense
         return m_file_path;
     }
 
+    void ros_writer::set_depth_codec(bool enabled, unsigned trim_bits)
+    {
+        if (trim_bits > rsutils::codec::rvl_max_trim_bits)
+            throw invalid_value_exception( rsutils::string::from() << "RVL trim bits (" << trim_bits << ") must be <= "
+                                                                   << rsutils::codec::rvl_max_trim_bits );
+        LOG_INFO("Depth RVL compression while record is set to " << (enabled ? "ON" : "OFF") << ", trim bits " << trim_bits);
+        m_depth_rvl_trim_bits = enabled ? int(trim_bits) : -1;
+    }
+
     void ros_writer::write_file_version()
     {
         std_msgs::UInt32 msg;
@@ -188,7 +198,21 @@ namespace librealsense
         image.is_bigendian = is_big_endian();
         auto size = vid_frame->get_stride() * vid_frame->get_height();
         auto p_data = vid_frame->get_frame_data();
-        image.data.assign(p_data, p_data + size);
+        int const rvl_trim_bits = m_depth_rvl_trim_bits;
+        if (rvl_trim_bits >= 0 && vid_frame->get_stream()->get_format() == RS2_FORMAT_Z16
+            && vid_frame->get_stride() == 2 * vid_frame->get_width())
+        {
+            // The reader decodes it back to the same Z16 image
+            size_t const n_pixels = size_t(vid_frame->get_width()) * vid_frame->get_height();
+            image.data.resize(rsutils::codec::rvl_max_encoded_size(n_pixels));
+            image.data.resize(rsutils::codec::rvl_encode(reinterpret_cast<const uint16_t*>(p_data),
+                                                         n_pixels,
+                                                         image.data.data(),
+                                                         unsigned(rvl_trim_bits)));
+            image.encoding += RVL_ENCODING_SUFFIX;
+        }
+        else
+            image.data.assign(p_data, p_data + size);
         image.header.seq = static_cast<uint32_t>(vid_frame->get_frame_number());
         std::chrono::duration<double, std::milli> timestamp_ms(vid_frame->get_frame_timestamp());
         image.header.stamp = rs2rosinternal::Time(std::chrono::duration<double>(timestamp_ms).count());
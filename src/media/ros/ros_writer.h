@@ -3,6 +3,7 @@
 
 #pragma once
 #include "rosbag/bag.h"
+#include <atomic>
 #include "ros_file_format.h"
 
 #include <rsutils/string/from.h>
@@ -23,6 +24,7 @@ namespace librealsense
         void write_snapshot(uint32_t device_index, const nanoseconds& timestamp, rs2_extension type, const std::shared_ptr<extension_snapshot>& snapshot) override;
         void write_snapshot(const sensor_identifier& sensor_id, const nanoseconds& timestamp, rs2_extension type, const std::shared_ptr<extension_snapshot>& snapshot) override;
         const std::string& get_file_name() const override;
+        void set_depth_codec(bool enabled, unsigned trim_bits) override;
 
     private:
         void write_file_version();
@@ -82,5 +84,6 @@ namespace librealsense
         std::string m_file_path;
         rosbag::Bag m_bag;
         std::map<uint32_t, std::set<rs2_option>> m_written_options_descriptions;
+        std::atomic<int> m_depth_rvl_trim_bits{ -1 };  // set from the user's thread; -1 when not compressing
     };
 }
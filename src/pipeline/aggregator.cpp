@@ -11,12 +11,21 @@ namespace librealsense
 {
     namespace pipeline
     {
-        aggregator::aggregator(const std::vector<int>& streams_to_aggregate, const std::vector<int>& streams_to_sync) :
-            processing_block("aggregator"),
-            _queue(new single_consumer_frame_queue<frame_holder>(1)),
-            _streams_to_aggregate_ids(streams_to_aggregate),
-            _streams_to_sync_ids(streams_to_sync),
-            _accepting(true)
+        aggregator::aggregator( const std::vector< int > & streams_to_aggregate,
+                                const std::vector< int > & streams_to_sync,
+                                std::shared_ptr< frame_statistics > const & statistics )
+            : processing_block( "aggregator" )
+            , _queue( new single_consumer_frame_queue< frame_holder >(
+                  1,
+                  [statistics]( frame_holder const & fh )
+                  {
+                      if( statistics )
+                          statistics->add_dropped( fh.frame, frame_drop_reason::queue_full );
+                  } ) )
+            , _streams_to_aggregate_ids( streams_to_aggregate )
+            , _streams_to_sync_ids( streams_to_sync )
+            , _accepting( true )
+            , _statistics( statistics )
         {
             set_processing_callback(
                 make_frame_processor_callback( [&]( frame_holder && frame, synthetic_source_interface * source )
@@ -75,7 +84,7 @@ namespace librealsense
                 source->frame_ready(async_fref.clone());
 
                 // for sync pipeline usage - push the aggregated to the output queue
-                _queue->enqueue(sync_fref.clone());
+                enqueue( sync_fref );
             }
             else
             {
@@ -95,19 +104,34 @@ namespace librealsense
                         return;
                     }
                     // for sync pipeline usage - push the aggregated to the output queue
-                    _queue->enqueue(sync_fref.clone());
+                    enqueue( sync_fref );
                 }
             }
         }
 
+        void aggregator::enqueue( frame_holder & frameset )
+        {
+            _queue->enqueue( frameset.clone() );
+            if( _statistics )
+                _statistics->update_queue_size( frameset.frame, _queue->size() );
+        }
+
         bool aggregator::dequeue(frame_holder* item, unsigned int timeout_ms)
         {
-            return _queue->dequeue(item, timeout_ms);
+            if( ! _queue->dequeue( item, timeout_ms ) )
+                return false;
+            if( _statistics )
+                _statistics->add( item->frame, &stream_frame_counters::delivered );
+            return true;
         }
 
         bool aggregator::try_dequeue(frame_holder* item)
         {
-            return _queue->try_dequeue(item);
+            if( ! _queue->try_dequeue( item ) )
+                return false;
+            if( _statistics )
+                _statistics->add( item->frame, &stream_frame_counters::delivered );
+            return true;
         }
 
         void aggregator::start()
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "proc/synthetic-stream.h"
+#include <src/core/frame-statistics.h>
 #include <rsutils/concurrency/concurrency.h>
 #include <vector>
 #include <memory>
@@ -26,9 +27,14 @@ namespace librealsense
             std::vector<int> _streams_to_aggregate_ids;
             std::vector<int> _streams_to_sync_ids;
             std::atomic<bool> _accepting;
+            std::shared_ptr< frame_statistics > _statistics;
             void handle_frame(frame_holder frame, synthetic_source_interface* source);
+            void enqueue( frame_holder & frameset );
         public:
-            aggregator(const std::vector<int>& streams_to_aggregate, const std::vector<int>& streams_to_sync);
+            // Frames dropped from, and delivered by, our output queue are counted in the statistics, if any
+            aggregator( const std::vector< int > & streams_to_aggregate,
+                        const std::vector< int > & streams_to_sync,
+                        std::shared_ptr< frame_statistics > const & statistics );
             bool dequeue(frame_holder* item, unsigned int timeout_ms);
             bool try_dequeue(frame_holder* item);
             void start();
@@ -14,6 +14,7 @@
 #endif
 
 #include <rsutils/string/from.h>
+#include <rsutils/json.h>
 
 
 namespace librealsense
@@ -24,7 +25,8 @@ namespace librealsense
             _ctx(ctx),
             _dispatcher(10),
             _hub( device_hub::make( ctx, RS2_PRODUCT_LINE_ANY_INTEL )),
-            _synced_streams({ RS2_STREAM_COLOR, RS2_STREAM_DEPTH, RS2_STREAM_INFRARED, RS2_STREAM_FISHEYE })
+            _synced_streams({ RS2_STREAM_COLOR, RS2_STREAM_DEPTH, RS2_STREAM_INFRARED, RS2_STREAM_FISHEYE }),
+            _statistics( std::make_shared< frame_statistics >() )
         {}
 
         pipeline::~pipeline()
@@ -147,6 +149,9 @@ namespace librealsense
             }
             _active_profile = profile;
             _prev_conf = std::make_shared<config>(*conf);
+
+            std::lock_guard< std::mutex > lock( _statistics_mtx );
+            _statistics_device = dev;
         }
 
         void pipeline::stop()
@@ -218,22 +223,41 @@ namespace librealsense
             }
 
             _syncer = std::unique_ptr<syncer_process_unit>(new syncer_process_unit());
-            _aggregator = std::unique_ptr<aggregator>(new aggregator(_streams_to_aggregate_ids, _streams_to_sync_ids));
+            // With a callback, nobody reads from the aggregator queue so it should not be counted
+            _aggregator = std::unique_ptr< aggregator >(
+                new aggregator( _streams_to_aggregate_ids,
+                                _streams_to_sync_ids,
+                                _streams_callback ? nullptr : _statistics ) );
 
-            if (_streams_callback)
-                _aggregator->set_output_callback(_streams_callback);
+            if( _streams_callback )
+            {
+                auto user_callback = _streams_callback;
+                auto statistics = _statistics;
+                _aggregator->set_output_callback( make_frame_callback(
+                    [user_callback, statistics]( frame_interface * f )
+                    {
+                        statistics->add( f, &stream_frame_counters::delivered );
+                        user_callback->on_frame( (rs2_frame *)f );
+                    } ) );
+            }
 
             return _streams_to_sync_ids;
         }
 
         rs2_frame_callback_sptr pipeline::get_callback(std::vector<int> synced_streams_ids)
         {
-            _syncer->set_output_callback(
-                make_frame_callback( [&]( frame_holder fref ) { _aggregator->invoke( std::move( fref ) ); } ) );
+            _syncer->set_output_callback( make_frame_callback(
+                [&]( frame_holder fref )
+                {
+                    _statistics->add( fref.frame, &stream_frame_counters::synced );
+                    _aggregator->invoke( std::move( fref ) );
+                } ) );
 
             return make_frame_callback(
                 [&, synced_streams_ids]( frame_holder fref )
                 {
+                    _statistics->add( fref.frame, &stream_frame_counters::received );
+
                     // if the user requested to sync the frame push it to the syncer, otherwise push it to the
                     // aggregator
                     if( std::find( synced_streams_ids.begin(),
@@ -246,6 +270,27 @@ namespace librealsense
                 } );
         }
 
+        rsutils::json pipeline::get_statistics() const
+        {
+            rsutils::json sensors = rsutils::json::object();
+            std::shared_ptr< device_interface > dev;
+            {
+                std::lock_guard< std::mutex > lock( _statistics_mtx );
+                dev = _statistics_device.lock();
+            }
+            if( dev )
+            {
+                for( size_t i = 0; i < dev->get_sensors_count(); ++i )
+                {
+                    auto & sensor = dev->get_sensor( i );
+                    auto name = sensor.supports_info( RS2_CAMERA_INFO_NAME ) ? sensor.get_info( RS2_CAMERA_INFO_NAME )
+                                                                             : std::string( rsutils::string::from( i ) );
+                    sensors[name] = sensor.get_statistics();
+                }
+            }
+            return rsutils::json::object( { { "streams", _statistics->to_json() }, { "sensors", std::move( sensors ) } } );
+        }
+
         frame_holder pipeline::wait_for_frames(unsigned int timeout_ms)
         {
             std::lock_guard<std::mutex> lock(_mtx);
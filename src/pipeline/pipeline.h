@@ -39,6 +39,11 @@ namespace librealsense
             void set_device( std::shared_ptr< librealsense::device_interface >  dev );
             std::shared_ptr< librealsense::device_interface >  get_device();
 
+            // Frame counters for the streams going through the pipeline, and those of the sensors streaming them:
+            //     { "streams": { "Depth": {...}, ... }, "sensors": { "Stereo Module": {...}, ... } }
+            // Available at any time, even while waiting for frames.
+            rsutils::json get_statistics() const;
+
         protected:
             rs2_frame_callback_sptr get_callback(std::vector<int> unique_ids);
             std::vector<int> on_start(std::shared_ptr<profile> profile);
@@ -64,6 +69,11 @@ namespace librealsense
             rs2_frame_callback_sptr _streams_callback;
             std::vector<rs2_stream> _synced_streams;
             std::shared_ptr< librealsense::device_interface > _dev = nullptr;
+
+            // Not protected by _mtx, which is held while waiting for frames
+            std::shared_ptr< frame_statistics > const _statistics;
+            mutable std::mutex _statistics_mtx;
+            std::weak_ptr< device_interface > _statistics_device;
         };
     }
 }
@@ -15,10 +15,9 @@
 #include "proc/cuda/cuda-align.h"
 #include "rsutils/accelerators/gpu.h"
 #endif
-#if defined(__SSSE3__)
 #include "proc/sse/sse-align.h"
-#endif
 #include "proc/neon/neon-align.h"
+#include "simd-dispatch.h"
 
 namespace librealsense
 {
@@ -32,9 +31,13 @@ namespace librealsense
             return std::make_shared<librealsense::align_cuda>(align_to);
         }
         #endif
-        #if defined(__SSSE3__)
+        #if defined(RS2_USE_X86_SIMD)
+        if (get_simd_level() >= RS2_SIMD_LEVEL_SSSE3)
+        {
             return std::make_shared<librealsense::align_sse>(align_to);
-        #elif defined(__ARM_NEON) && ! defined(ANDROID)
+        }
+        #endif
+        #if defined(__ARM_NEON) && ! defined(ANDROID)
             return std::make_shared<librealsense::align_neon>(align_to);
         #else
             return std::make_shared<librealsense::align>(align_to);
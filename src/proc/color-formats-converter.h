@@ -86,4 +86,9 @@ namespace librealsense
 
         void process_function( uint8_t * const dest[], const uint8_t * source, int width, int height, int actual_size, int input_size ) override;
     };
+
+    // The conversions behind the converters above, using the best kernel for the current SIMD level
+    void unpack_yuy2( rs2_format dst_format, rs2_stream dst_stream, uint8_t * const d[], const uint8_t * s, int w, int h, int actual_size );
+    void unpack_uyvyc( rs2_format dst_format, rs2_stream dst_stream, uint8_t * const d[], const uint8_t * s, int w, int h, int actual_size );
+    void unpack_m420( rs2_format dst_format, rs2_stream dst_stream, uint8_t * const d[], const uint8_t * s, int w, int h, int actual_size );
     }
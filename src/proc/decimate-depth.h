@@ -0,0 +1,37 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace librealsense {
+
+
+// The decimation filter's depth kernels.
+
+
+struct decimate_depth_params
+{
+    const uint16_t * in;
+    size_t width_in;      // Input pixels per row
+    size_t scale;         // Each output pixel is made of a scale x scale patch of input pixels
+    uint16_t * out;
+    size_t real_width;    // Output pixels per row made of full patches
+    size_t padded_width;  // Output pixels per row; the ones past real_width are zero
+};
+
+
+// Decimate the output rows [first_row, end_row), including their padding. Each output pixel is the median of its
+// patch's valid (non-zero) pixels for scales 2 and 3 (the lower of the two middle ones, for even counts), or their
+// mean for larger scales; 0 if none are valid.
+void decimate_depth_generic( decimate_depth_params const &, size_t first_row, size_t end_row );
+
+#ifdef RS2_USE_X86_SIMD
+void decimate_depth_avx2( decimate_depth_params const &, size_t first_row, size_t end_row );
+#endif
+
+
+}  // namespace librealsense
@@ -0,0 +1,27 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace librealsense {
+
+
+// The decimation filter's kernels for the formats other than depth, whose patches are averaged: the sums of the
+// columns of a row of patches, which the means are then made of.
+
+
+// sums[x] = in[x] + in[stride + x] + ... over 'rows' rows (up to 8), for x in [0, n). Strides are in values.
+void sum_columns_generic( const uint8_t * in, size_t stride, size_t rows, size_t n, uint16_t * sums );
+void sum_columns_generic( const uint16_t * in, size_t stride, size_t rows, size_t n, uint32_t * sums );
+
+#ifdef RS2_USE_X86_SIMD
+void sum_columns_avx2( const uint8_t * in, size_t stride, size_t rows, size_t n, uint16_t * sums );
+void sum_columns_avx2( const uint16_t * in, size_t stride, size_t rows, size_t n, uint32_t * sums );
+#endif
+
+
+}  // namespace librealsense
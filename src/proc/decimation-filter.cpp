@@ -4,6 +4,7 @@
 #include <librealsense2/hpp/rs_sensor.hpp>
 #include <librealsense2/hpp/rs_processing.hpp>
 
+#include <algorithm>
 #include <numeric>
 #include <cmath>
 #include "environment.h"
@@ -12,6 +13,8 @@
 #include "core/video.h"
 #include "proc/synthetic-stream.h"
 #include "proc/decimation-filter.h"
+#include "proc/decimate-others.h"
+#include "simd-dispatch.h"
 
 #include <rsutils/string/from.h>
 
@@ -373,26 +376,27 @@ namespace librealsense
         return ret;
     }
 
-    void decimation_filter::decimate_depth(const uint16_t * frame_data_in, uint16_t * frame_data_out,
-        size_t width_in, size_t height_in, size_t scale)
+    void decimate_depth_generic(const decimate_depth_params& params, size_t first_row, size_t end_row)
     {
         // Use median filtering
-        std::vector<uint16_t> working_kernel(_kernel_size);
-        auto wk_begin = working_kernel.data();
+        uint16_t working_kernel[9];
+        auto wk_begin = working_kernel;
         auto wk_itr = wk_begin;
-        std::vector<uint16_t*> pixel_raws(scale);
-        uint16_t* block_start = const_cast<uint16_t*>(frame_data_in);
+        auto scale = params.scale;
+        uint16_t* frame_data_out = params.out + first_row * params.padded_width;
+        const uint16_t* block_start = params.in + first_row * scale * params.width_in;
+        const uint16_t* pixel_raws[8];
 
         if (scale == 2 || scale == 3)
         {
-            for (int j = 0; j < _real_height; j++)
+            for (size_t j = first_row; j < end_row; j++)
             {
-                uint16_t *p{};
+                const uint16_t *p{};
                 // Mark the beginning of each of the N lines that the filter will run upon
-                for (size_t i = 0; i < pixel_raws.size(); i++)
-                    pixel_raws[i] = block_start + (width_in*i);
+                for (size_t i = 0; i < scale; i++)
+                    pixel_raws[i] = block_start + (params.width_in*i);
 
-                for (size_t i = 0, chunk_offset = 0; i < _real_width; i++)
+                for (size_t i = 0, chunk_offset = 0; i < params.real_width; i++)
                 {
                     wk_itr = wk_begin;
                     // extract data the kernel to process
@@ -421,25 +425,25 @@ namespace librealsense
                             *frame_data_out++ = PIX_MIN(working_kernel[0], working_kernel[1]);
                             break;
                         case 3:
-                            *frame_data_out++ = opt_med3<uint16_t>(working_kernel.data());
+                            *frame_data_out++ = opt_med3<uint16_t>(working_kernel);
                             break;
                         case 4:
-                            *frame_data_out++ = opt_med4<uint16_t>(working_kernel.data());
+                            *frame_data_out++ = opt_med4<uint16_t>(working_kernel);
                             break;
                         case 5:
-                            *frame_data_out++ = opt_med5<uint16_t>(working_kernel.data());
+                            *frame_data_out++ = opt_med5<uint16_t>(working_kernel);
                             break;
                         case 6:
-                            *frame_data_out++ = opt_med6<uint16_t>(working_kernel.data());
+                            *frame_data_out++ = opt_med6<uint16_t>(working_kernel);
                             break;
                         case 7:
-                            *frame_data_out++ = opt_med7<uint16_t>(working_kernel.data());
+                            *frame_data_out++ = opt_med7<uint16_t>(working_kernel);
                             break;
                         case 8:
-                            *frame_data_out++ = opt_med8<uint16_t>(working_kernel.data());
+                            *frame_data_out++ = opt_med8<uint16_t>(working_kernel);
                             break;
                         case 9:
-                            *frame_data_out++ = opt_med9<uint16_t>(working_kernel.data());
+                            *frame_data_out++ = opt_med9<uint16_t>(working_kernel);
                             break;
                         }
                     }
@@ -448,23 +452,23 @@ namespace librealsense
                 }
 
                 // Fill-in the padded colums with zeros
-                for (int j = _real_width; j < _padded_width; j++)
+                for (size_t i = params.real_width; i < params.padded_width; i++)
                     *frame_data_out++ = 0;
 
                 // Skip N lines to the beginnig of the next processing segment
-                block_start += width_in * scale;
+                block_start += params.width_in * scale;
             }
         }
         else
         {
-            for (int j = 0; j < _real_height; j++)
+            for (size_t j = first_row; j < end_row; j++)
             {
-                uint16_t *p{};
+                const uint16_t *p{};
                 // Mark the beginning of each of the N lines that the filter will run upon
-                for (size_t i = 0; i < pixel_raws.size(); i++)
-                    pixel_raws[i] = block_start + (width_in*i);
+                for (size_t i = 0; i < scale; i++)
+                    pixel_raws[i] = block_start + (params.width_in*i);
 
-                for (size_t i = 0, chunk_offset = 0; i < _real_width; i++)
+                for (size_t i = 0, chunk_offset = 0; i < params.real_width; i++)
                 {
                     int sum = 0;
                     int counter = 0;
@@ -488,371 +492,213 @@ namespace librealsense
                 }
 
                 // Fill-in the padded colums with zeros
-                for (int j = _real_width; j < _padded_width; j++)
+                for (size_t i = params.real_width; i < params.padded_width; i++)
                     *frame_data_out++ = 0;
 
                 // Skip N lines to the beginnig of the next processing segment
-                block_start += width_in * scale;
+                block_start += params.width_in * scale;
             }
         }
+    }
 
-        // Fill-in the padded rows with zeros
-        for (auto v = _real_height; v < _padded_height; ++v)
+    void decimate_depth(row_bands& bands, const decimate_depth_params& params, size_t real_height, size_t padded_height)
+    {
+        typedef void(*decimate_fn)(const decimate_depth_params&, size_t, size_t);
+        static simd_kernel<decimate_fn> const kernel = simd_kernel<decimate_fn>(decimate_depth_generic)
+#ifdef RS2_USE_X86_SIMD
+            .add(RS2_SIMD_LEVEL_AVX2, decimate_depth_avx2)
+#endif
+            ;
+        auto fn = kernel.get();
+        bands.run(real_height, 8, [&](size_t first_row, size_t end_row)
         {
-            for (auto u = 0; u < _padded_width; ++u)
-                *frame_data_out++ = 0;
-        }
+            fn(params, first_row, end_row);
+        });
+
+        // Fill-in the padded rows with zeros
+        std::fill(params.out + real_height * params.padded_width, params.out + padded_height * params.padded_width, uint16_t(0));
     }
 
-    void decimation_filter::decimate_others(rs2_format format, const void * frame_data_in, void * frame_data_out,
+    void decimation_filter::decimate_depth(const uint16_t * frame_data_in, uint16_t * frame_data_out,
         size_t width_in, size_t height_in, size_t scale)
     {
-        int sum = 0;
-        auto patch_size = scale * scale;
+        decimate_depth_params params;
+        params.in = frame_data_in;
+        params.width_in = width_in;
+        params.scale = scale;
+        params.out = frame_data_out;
+        params.real_width = _real_width;
+        params.padded_width = _padded_width;
+        librealsense::decimate_depth(_bands, params, _real_height, _padded_height);
+    }
 
-        switch (format)
-        {
-        case RS2_FORMAT_YUYV:
+    void sum_columns_generic(const uint8_t* in, size_t stride, size_t rows, size_t n, uint16_t* sums)
+    {
+        std::copy(in, in + n, sums);
+        for (size_t r = 1; r < rows; ++r)
         {
-            uint8_t* from = (uint8_t*)frame_data_in;
-            uint8_t* p = nullptr;
-            uint8_t* q = (uint8_t*)frame_data_out;
-
-            auto w_2 = width_in >> 1;
-            auto rw_2 = _real_width >> 1;
-            auto pw_2 = _padded_width >> 1;
-            auto s2 = scale >> 1;
-            bool odd = (scale & 1);
-            for (int j = 0; j < _real_height; ++j)
-            {
-                for (int i = 0; i < rw_2; ++i)
-                {
-                    p = from + scale * (j * w_2 + i) * 4;
-                    sum = 0;
-                    for (size_t n = 0; n < scale; ++n)
-                    {
-                        for (size_t m = 0; m < scale; ++m)
-                            sum += p[m * 2];
-
-                        p += w_2 * 4;
-                    }
-                    *q++ = (uint8_t)(sum / patch_size);
-
-                    p = from + scale * (j * w_2 + i) * 4 + 1;
-                    sum = 0;
-                    for (size_t n = 0; n < scale; ++n)
-                    {
-                        for (size_t m = 0; m < s2; ++m)
-                            sum += 2 * p[m * 4];
-
-                        if (odd)
-                            sum += p[s2 * 4];
-
-                        p += w_2 * 4;
-                    }
-                    *q++ = (uint8_t)(sum / patch_size);
-
-                    p = from + scale * (j * w_2 + i) * 4 + s2 * 4 + (odd ? 2 : 0);
-                    sum = 0;
-                    for (size_t n = 0; n < scale; ++n)
-                    {
-                        for (size_t m = 0; m < scale; ++m)
-                            sum += p[m * 2];
-
-                        p += w_2 * 4;
-                    }
-                    *q++ = (uint8_t)(sum / patch_size);
-
-                    p = from + scale * (j * w_2 + i) * 4 + 3;
-                    sum = 0;
-                    for (size_t n = 0; n < scale; ++n)
-                    {
-                        for (size_t m = 0; m < s2; ++m)
-                            sum += 2 * p[m * 4];
-
-                        if (odd)
-                            sum += p[s2 * 4];
-
-                        p += w_2 * 4;
-                    }
-                    *q++ = (uint8_t)(sum / patch_size);
-                }
-
-                for (int i = rw_2; i < pw_2; ++i)
-                {
-                    *q++ = 0;
-                    *q++ = 0;
-                    *q++ = 0;
-                    *q++ = 0;
-                }
-            }
-
-            for (int j = _real_height; j < _padded_height; ++j)
-            {
-                for (int i = 0; i < _padded_width; ++i)
-                {
-                    *q++ = 0;
-                    *q++ = 0;
-                }
-            }
+            in += stride;
+            for (size_t x = 0; x < n; ++x)
+                sums[x] += in[x];
         }
-        break;
+    }
 
-        case RS2_FORMAT_UYVY:
+    void sum_columns_generic(const uint16_t* in, size_t stride, size_t rows, size_t n, uint32_t* sums)
+    {
+        std::copy(in, in + n, sums);
+        for (size_t r = 1; r < rows; ++r)
         {
-            uint8_t* from = (uint8_t*)frame_data_in;
-            uint8_t* p = nullptr;
-            uint8_t* q = (uint8_t*)frame_data_out;
-
-            auto w_2 = width_in >> 1;
-            auto rw_2 = _real_width >> 1;
-            auto pw_2 = _padded_width >> 1;
-            auto s2 = scale >> 1;
-            bool odd = (scale & 1);
-            for (int j = 0; j < _real_height; ++j)
-            {
-                for (int i = 0; i < rw_2; ++i)
-                {
-                    p = from + scale * (j * w_2 + i) * 4;
-                    sum = 0;
-                    for (size_t n = 0; n < scale; ++n)
-                    {
-                        for (size_t m = 0; m < s2; ++m)
-                            sum += 2 * p[m * 4];
-
-                        if (odd)
-                            sum += p[s2 * 4];
-
-                        p += w_2 * 4;
-                    }
-                    *q++ = (uint8_t)(sum / patch_size);
-
-                    p = from + scale * (j * w_2 + i) * 4 + 1;
-                    sum = 0;
-                    for (size_t n = 0; n < scale; ++n)
-                    {
-                        for (size_t m = 0; m < scale; ++m)
-                            sum += p[m * 2];
-
-                        p += w_2 * 4;
-                    }
-                    *q++ = (uint8_t)(sum / patch_size);
-
-                    p = from + scale * (j * w_2 + i) * 4 + 2;
-                    sum = 0;
-                    for (size_t n = 0; n < scale; ++n)
-                    {
-                        for (size_t m = 0; m < s2; ++m)
-                            sum += 2 * p[m * 4];
-
-                        if (odd)
-                            sum += p[s2 * 4];
-
-                        p += w_2 * 4;
-                    }
-                    *q++ = (uint8_t)(sum / patch_size);
-
-                    p = from + scale * (j * w_2 + i) * 4 + s2 * 4 + (odd ? 3 : 1);
-                    sum = 0;
-                    for (size_t n = 0; n < scale; ++n)
-                    {
-                        for (size_t m = 0; m < scale; ++m)
-                            sum += p[m * 2];
-
-                        p += w_2 * 4;
-                    }
-                    *q++ = (uint8_t)(sum / patch_size);
-                }
-
-                for (int i = rw_2; i < pw_2; ++i)
-                {
-                    *q++ = 0;
-                    *q++ = 0;
-                    *q++ = 0;
-                    *q++ = 0;
-                }
-            }
-
-            for (int j = _real_height; j < _padded_height; ++j)
-            {
-                for (int i = 0; i < _padded_width; ++i)
-                {
-                    *q++ = 0;
-                    *q++ = 0;
-                }
-            }
+            in += stride;
+            for (size_t x = 0; x < n; ++x)
+                sums[x] += in[x];
         }
-        break;
+    }
 
-        case RS2_FORMAT_RGB8:
-        case RS2_FORMAT_BGR8:
+    namespace
+    {
+        template<class S>
+        int sum_of(const S* sums, size_t count, size_t step)
         {
-            uint8_t* from = (uint8_t*)frame_data_in;
-            uint8_t* p = nullptr;
-            uint8_t* q = (uint8_t*)frame_data_out;;
-
-            for (int j = 0; j < _real_height; ++j)
-            {
-                for (int i = 0; i < _real_width; ++i)
-                {
-                    for (int k = 0; k < 3; ++k)
-                    {
-                        p = from + scale * (j * width_in + i) * 3 + k;
-                        sum = 0;
-                        for (size_t n = 0; n < scale; ++n)
-                        {
-                            for (size_t m = 0; m < scale; ++m)
-                                sum += p[m * 3];
-
-                            p += width_in * 3;
-                        }
-
-                        *q++ = (uint8_t)(sum / patch_size);
-                    }
-                }
-
-                for (int i = _real_width; i < _padded_width; ++i)
-                {
-                    *q++ = 0;
-                    *q++ = 0;
-                    *q++ = 0;
-                }
-            }
-
-            for (int j = _real_height; j < _padded_height; ++j)
-            {
-                for (int i = 0; i < _padded_width; ++i)
-                {
-                    *q++ = 0;
-                    *q++ = 0;
-                    *q++ = 0;
-                }
-            }
+            int sum = 0;
+            for (size_t m = 0; m < count; ++m)
+                sum += sums[m * step];
+            return sum;
         }
-        break;
 
-        case RS2_FORMAT_RGBA8:
-        case RS2_FORMAT_BGRA8:
+        // A row of pixels of 'channels' interleaved values, from the column sums of their patches
+        template<class T, class S>
+        void decimate_interleaved_row(const S* sums, size_t scale, size_t channels, T* q, size_t real_width, size_t padded_width)
         {
-            uint8_t* from = (uint8_t*)frame_data_in;
-            uint8_t* p = nullptr;
-            uint8_t* q = (uint8_t*)frame_data_out;
-
-            for (int j = 0; j < _real_height; ++j)
-            {
-                for (int i = 0; i < _real_width; ++i)
-                {
-                    for (int k = 0; k < 4; ++k)
-                    {
-                        p = from + scale * (j * width_in + i) * 4 + k;
-                        sum = 0;
-                        for (size_t n = 0; n < scale; ++n)
-                        {
-                            for (size_t m = 0; m < scale; ++m)
-                                sum += p[m * 4];
-
-                            p += width_in * 4;
-                        }
-
-                        *q++ = (uint8_t)(sum / patch_size);
-                    }
-                }
-
-                for (int i = _real_width; i < _padded_width; ++i)
-                {
-                    *q++ = 0;
-                    *q++ = 0;
-                    *q++ = 0;
-                    *q++ = 0;
-                }
-            }
-
-            for (int j = _real_height; j < _padded_height; ++j)
+            int const patch_size = int(scale * scale);
+            for (size_t i = 0; i < real_width; ++i)
             {
-                for (int i = 0; i < _padded_width; ++i)
-                {
-                    *q++ = 0;
-                    *q++ = 0;
-                    *q++ = 0;
-                    *q++ = 0;
-                }
+                const S* p = sums + scale * i * channels;
+                for (size_t k = 0; k < channels; ++k)
+                    *q++ = T(sum_of(p + k, scale, channels) / patch_size);
             }
+            std::fill(q, q + (padded_width - real_width) * channels, T(0));
         }
-        break;
 
-        case RS2_FORMAT_Y8:
+        // A row of YUYV or UYVY pixel pairs, from the column sums of their patches. The chroma of an output pair is
+        // the mean of the first pixel's patch: each input pair in it counts twice (once per pixel), but for odd scales
+        // the last one, which it only has a pixel of.
+        void decimate_yuv_row(const uint16_t* sums, size_t scale, bool yuyv, uint8_t* q, size_t real_width, size_t padded_width)
         {
-            uint8_t* from = (uint8_t*)frame_data_in;
-            uint8_t* p = nullptr;
-            uint8_t* q = (uint8_t*)frame_data_out;
-
-            for (int j = 0; j < _real_height; ++j)
+            int const patch_size = int(scale * scale);
+            size_t const s2 = scale >> 1;
+            bool const odd = (scale & 1);
+            size_t const luma = yuyv ? 0 : 1, chroma = yuyv ? 1 : 0;
+            uint8_t* const end = q + padded_width * 2;
+            for (size_t i = 0; i < real_width / 2; ++i)
             {
-                for (int i = 0; i < _real_width; ++i)
+                const uint16_t* p = sums + scale * i * 4;
+                auto chroma_sum = [&](size_t at)
                 {
-                    p = from + scale * (j * width_in + i);
-                    sum = 0;
-                    for (size_t n = 0; n < scale; ++n)
-                    {
-                        for (size_t m = 0; m < scale; ++m)
-                            sum += p[m];
-
-                        p += width_in;
-                    }
-
-                    *q++ = (uint8_t)(sum / patch_size);
-                }
-
-                for (int i = _real_width; i < _padded_width; ++i)
-                    *q++ = 0;
-            }
-
-            for (int j = _real_height; j < _padded_height; ++j)
-            {
-                for (int i = 0; i < _padded_width; ++i)
-                    *q++ = 0;
+                    int sum = 2 * sum_of(p + at, s2, 4);
+                    if (odd)
+                        sum += p[at + s2 * 4];
+                    return sum;
+                };
+                q[luma] = uint8_t(sum_of(p + luma, scale, 2) / patch_size);
+                q[chroma] = uint8_t(chroma_sum(chroma) / patch_size);
+                q[luma + 2] = uint8_t(sum_of(p + s2 * 4 + (odd ? 2 : 0) + luma, scale, 2) / patch_size);
+                q[chroma + 2] = uint8_t(chroma_sum(chroma + 2) / patch_size);
+                q += 4;
             }
+            std::fill(q, end, uint8_t(0));
         }
-        break;
+    }
 
-        case RS2_FORMAT_Y16:
+    void decimate_others(row_bands& bands, std::vector<std::vector<uint8_t>>& buffers, const decimate_others_params& params,
+        size_t real_height, size_t padded_height)
+    {
+        typedef void(*sum_bytes_fn)(const uint8_t*, size_t, size_t, size_t, uint16_t*);
+        typedef void(*sum_words_fn)(const uint16_t*, size_t, size_t, size_t, uint32_t*);
+        static simd_kernel<sum_bytes_fn> const sum_bytes_kernel = simd_kernel<sum_bytes_fn>(sum_columns_generic)
+#ifdef RS2_USE_X86_SIMD
+            .add(RS2_SIMD_LEVEL_AVX2, sum_columns_avx2)
+#endif
+            ;
+        static simd_kernel<sum_words_fn> const sum_words_kernel = simd_kernel<sum_words_fn>(sum_columns_generic)
+#ifdef RS2_USE_X86_SIMD
+            .add(RS2_SIMD_LEVEL_AVX2, sum_columns_avx2)
+#endif
+            ;
+
+        size_t bpp;
+        switch (params.format)
         {
-            uint16_t* from = (uint16_t*)frame_data_in;
-            uint16_t* p = nullptr;
-            uint16_t* q = (uint16_t*)frame_data_out;
+        case RS2_FORMAT_YUYV:
+        case RS2_FORMAT_UYVY:
+        case RS2_FORMAT_Y16:
+            bpp = 2;
+            break;
+        case RS2_FORMAT_RGB8:
+        case RS2_FORMAT_BGR8:
+            bpp = 3;
+            break;
+        case RS2_FORMAT_RGBA8:
+        case RS2_FORMAT_BGRA8:
+            bpp = 4;
+            break;
+        case RS2_FORMAT_Y8:
+            bpp = 1;
+            break;
+        default:
+            return;
+        }
+
+        auto const sum_bytes = sum_bytes_kernel.get();
+        auto const sum_words = sum_words_kernel.get();
+        auto const scale = params.scale;
+        auto const out = static_cast<uint8_t*>(params.out);
+        size_t const row_bytes = params.width_in * bpp;
+        size_t const n_bands = std::max(size_t(1), std::min(bands.get_max_bands(), real_height / 8));
+        if (buffers.size() < n_bands)
+            buffers.resize(n_bands);
 
-            for (int j = 0; j < _real_height; ++j)
+        bands.run(n_bands, 1, [&](size_t band, size_t)
+        {
+            // Room for the sums of a row of patches, in 16 bits per byte or 32 bits per 16-bit value
+            auto& buffer = buffers[band];
+            buffer.resize(row_bytes * 2);
+            for (size_t j = band * real_height / n_bands; j < (band + 1) * real_height / n_bands; ++j)
             {
-                for (int i = 0; i < _real_width; ++i)
+                uint8_t* q = out + j * params.padded_width * bpp;
+                if (params.format == RS2_FORMAT_Y16)
                 {
-                    p = from + scale * (j * width_in + i);
-                    sum = 0;
-                    for (size_t n = 0; n < scale; ++n)
-                    {
-                        for (size_t m = 0; m < scale; ++m)
-                            sum += p[m];
-
-                        p += width_in;
-                    }
-
-                    *q++ = (uint16_t)(sum / patch_size);
+                    auto sums = reinterpret_cast<uint32_t*>(buffer.data());
+                    sum_words(static_cast<const uint16_t*>(params.in) + j * scale * params.width_in, params.width_in,
+                        scale, params.width_in, sums);
+                    decimate_interleaved_row(sums, scale, 1, reinterpret_cast<uint16_t*>(q), params.real_width, params.padded_width);
+                    continue;
                 }
 
-                for (int i = _real_width; i < _padded_width; ++i)
-                    *q++ = 0;
+                auto sums = reinterpret_cast<uint16_t*>(buffer.data());
+                sum_bytes(static_cast<const uint8_t*>(params.in) + j * scale * row_bytes, row_bytes, scale, row_bytes, sums);
+                if (params.format == RS2_FORMAT_YUYV || params.format == RS2_FORMAT_UYVY)
+                    decimate_yuv_row(sums, scale, params.format == RS2_FORMAT_YUYV, q, params.real_width, params.padded_width);
+                else
+                    decimate_interleaved_row(sums, scale, bpp, q, params.real_width, params.padded_width);
             }
+        });
 
-            for (int j = _real_height; j < _padded_height; ++j)
-            {
-                for (int i = 0; i < _padded_width; ++i)
-                    *q++ = 0;
-            }
-        }
-        break;
+        // Fill-in the padded rows with zeros
+        std::fill(out + real_height * params.padded_width * bpp, out + padded_height * params.padded_width * bpp, uint8_t(0));
+    }
 
-        default:
-            break;
-        }
+    void decimation_filter::decimate_others(rs2_format format, const void * frame_data_in, void * frame_data_out,
+        size_t width_in, size_t height_in, size_t scale)
+    {
+        decimate_others_params params;
+        params.format = format;
+        params.in = frame_data_in;
+        params.width_in = width_in;
+        params.scale = scale;
+        params.out = frame_data_out;
+        params.real_width = _real_width;
+        params.padded_width = _padded_width;
+        librealsense::decimate_others(_bands, _buffers, params, _real_height, _padded_height);
     }
 }
 
@@ -6,6 +6,10 @@
 #include "../include/librealsense2/hpp/rs_frame.hpp"
 #include "../include/librealsense2/hpp/rs_processing.hpp"
 #include "proc/synthetic-stream.h"
+#include "proc/row-bands.h"
+#include "proc/decimate-depth.h"
+
+#include <vector>
 
 namespace librealsense
 {
@@ -41,6 +45,30 @@ namespace librealsense
         uint16_t                _padded_height;
         bool                    _recalc_profile;
         bool                    _options_changed;   // Tracking changes imposed by user
+        row_bands               _bands;
+        std::vector<std::vector<uint8_t>> _buffers;  // per band, for decimate_others
     };
     MAP_EXTENSION(RS2_EXTENSION_DECIMATION_FILTER, librealsense::decimation_filter);
+
+    // Decimate a whole depth frame of real_height rows of full patches, padded with zero rows to padded_height, in row
+    // bands run in parallel with the best kernel for the current SIMD level
+    void decimate_depth(row_bands& bands, const decimate_depth_params& params, size_t real_height, size_t padded_height);
+
+    // A frame of any other format the filter takes: each output pixel is the mean of its patch (for YUYV and UYVY, the
+    // chroma of a pair of pixels is that of the first one's patch)
+    struct decimate_others_params
+    {
+        rs2_format format;
+        const void * in;
+        size_t width_in;
+        size_t scale;
+        void * out;
+        size_t real_width;
+        size_t padded_width;
+    };
+
+    // Decimate a whole frame of real_height rows of full patches, padded with zero rows to padded_height, in row bands
+    // run in parallel, each with a buffer of its own from 'buffers'
+    void decimate_others(row_bands& bands, std::vector<std::vector<uint8_t>>& buffers, const decimate_others_params& params,
+        size_t real_height, size_t padded_height);
 }
@@ -0,0 +1,110 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "proc/depth-maps.h"
+#include "simd-dispatch.h"
+
+#include <algorithm>
+#include <cmath>
+
+
+namespace librealsense {
+
+
+// The first z in [begin, end) for which pred is true, given it is false then true
+template< class Pred >
+static uint32_t partition_point( uint32_t begin, uint32_t end, Pred pred )
+{
+    while( begin < end )
+    {
+        uint32_t mid = begin + ( end - begin ) / 2;
+        if( pred( mid ) )
+            end = mid;
+        else
+            begin = mid + 1;
+    }
+    return begin;
+}
+
+
+z16_range get_z16_range( float depth_units, float min_distance, float max_distance )
+{
+    uint32_t first = partition_point( 0, uint32_t( Z16_LUT_SIZE ),
+                                      [&]( uint32_t z ) { return depth_units * uint16_t( z ) >= min_distance; } );
+    uint32_t end = partition_point( 0, uint32_t( Z16_LUT_SIZE ),
+                                    [&]( uint32_t z ) { return ! ( depth_units * uint16_t( z ) <= max_distance ); } );
+    z16_range range;
+    range.empty = first >= end;
+    range.first = range.empty ? 0 : uint16_t( first );
+    range.last = range.empty ? 0 : uint16_t( end - 1 );
+    return range;
+}
+
+
+void threshold_z16( uint16_t const * in, uint16_t * out, size_t n, z16_range range )
+{
+    if( range.empty )
+    {
+        for( size_t i = 0; i < n; ++i )
+            out[i] = 0;
+        return;
+    }
+    // One unsigned comparison per pixel, without branches, so it vectorizes
+    uint16_t const span = uint16_t( range.last - range.first );
+    for( size_t i = 0; i < n; ++i )
+        out[i] = uint16_t( in[i] - range.first ) <= span ? in[i] : 0;
+}
+
+
+void z16_to_meters( uint16_t const * in, float * out, size_t n, float depth_units )
+{
+    for( size_t i = 0; i < n; ++i )
+        out[i] = depth_units * in[i];
+}
+
+
+void make_disparity_lut( float * lut, float d2d_convert_factor, z16_range range )
+{
+    for( size_t z = 0; z < Z16_LUT_SIZE; ++z )
+        lut[z] = 0;
+    if( range.empty )
+        return;
+    // Z16 values, being integers, are normal floats unless 0
+    for( size_t z = std::max< size_t >( range.first, 1 ); z <= range.last; ++z )
+        lut[z] = d2d_convert_factor / float( z );
+}
+
+
+void z16_to_float( uint16_t const * in, float * out, size_t n, float const * lut )
+{
+    for( size_t i = 0; i < n; ++i )
+        out[i] = lut[in[i]];
+}
+
+
+void disparity_to_z16_generic( float const * in, uint16_t * out, size_t n, float d2d_convert_factor )
+{
+    for( size_t i = 0; i < n; ++i )
+    {
+        float input = in[i];
+        if( std::isnormal( input ) )
+            out[i] = static_cast< uint16_t >( ( d2d_convert_factor / input ) + 0.5f );
+        else
+            out[i] = 0;
+    }
+}
+
+
+void disparity_to_z16( float const * in, uint16_t * out, size_t n, float d2d_convert_factor )
+{
+    typedef void ( *convert_fn )( float const *, uint16_t *, size_t, float );
+    static simd_kernel< convert_fn > const kernel = simd_kernel< convert_fn >( disparity_to_z16_generic )
+#ifdef RS2_USE_X86_SIMD
+        .add( RS2_SIMD_LEVEL_SSSE3, disparity_to_z16_sse )
+#endif
+        ;
+    kernel.get()( in, out, n, d2d_convert_factor );
+}
+
+
+}  // namespace librealsense
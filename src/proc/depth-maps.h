@@ -0,0 +1,66 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace librealsense {
+
+
+// Per-pixel maps of depth, shared by the threshold, units and disparity transforms.
+
+
+// The most meters the threshold and disparity transform ranges can be set to
+constexpr float MAX_DISTANCE_RANGE = 16.f;
+
+
+// The Z16 values whose distance (depth_units * z) is within [min_distance, max_distance] meters. The distance only
+// grows with z, so these are a contiguous range.
+struct z16_range
+{
+    uint16_t first;
+    uint16_t last;
+    bool empty;
+
+    bool operator==( z16_range const & other ) const
+    {
+        return empty == other.empty && ( empty || ( first == other.first && last == other.last ) );
+    }
+    bool operator!=( z16_range const & other ) const { return ! ( *this == other ); }
+};
+
+// The same float comparisons as applying the threshold to each pixel would make, so the results are identical
+z16_range get_z16_range( float depth_units, float min_distance, float max_distance );
+
+// Zero the pixels out of range
+void threshold_z16( uint16_t const * in, uint16_t * out, size_t n, z16_range );
+
+// Meters, in float
+void z16_to_meters( uint16_t const * in, float * out, size_t n, float depth_units );
+
+
+// 64K-entry Z16 lookup tables
+const size_t Z16_LUT_SIZE = 0x10000;
+
+// The disparity of each Z16 value: d2d_convert_factor / z; 0 for no depth or out of range, so this applies the
+// threshold too
+void make_disparity_lut( float * lut, float d2d_convert_factor, z16_range );
+
+void z16_to_float( uint16_t const * in, float * out, size_t n, float const * lut );
+
+
+// Back from disparity: d2d_convert_factor / disparity, rounded; 0 unless the disparity is a normal float
+void disparity_to_z16_generic( float const * in, uint16_t * out, size_t n, float d2d_convert_factor );
+
+#ifdef RS2_USE_X86_SIMD
+void disparity_to_z16_sse( float const * in, uint16_t * out, size_t n, float d2d_convert_factor );
+#endif
+
+// With the best kernel for the current SIMD level
+void disparity_to_z16( float const * in, uint16_t * out, size_t n, float d2d_convert_factor );
+
+
+}  // namespace librealsense
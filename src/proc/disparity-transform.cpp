@@ -10,18 +10,43 @@
 #include "core/video.h"
 #include "proc/synthetic-stream.h"
 #include "proc/disparity-transform.h"
+#include "proc/depth-maps.h"
 #include "software-device.h"
 #include "environment.h"
 
+#include <limits>
+
 namespace librealsense
 {
     disparity_transform::disparity_transform(bool transform_to_disparity):
         generic_processing_block(transform_to_disparity ? "Depth to Disparity" : "Disparity to Depth"),
         _transform_to_disparity(transform_to_disparity),
         _update_target(false),
-        _width(0), _height(0), _bpp(0)
+        _width(0), _height(0), _bpp(0),
+        _min_distance(0.f), _max_distance(MAX_DISTANCE_RANGE),
+        _lut_convert_factor(0.f), _lut_range()
     {
         unregister_option(RS2_OPTION_FRAMES_QUEUE_SIZE);
+        unregister_option( RS2_OPTION_FRAMES_QUEUE_POLICY );
+        unregister_option( RS2_OPTION_FRAMES_QUEUE_MEMORY_LIMIT );
+
+        if (transform_to_disparity)
+        {
+            // The same range as the threshold filter's, so both can be done in a single pass over the frame
+            auto min_opt = std::make_shared<ptr_option<float>>(0.f, MAX_DISTANCE_RANGE, 0.1f, 0.f, &_min_distance, "Min range in meters");
+            auto max_opt = std::make_shared<ptr_option<float>>(0.f, MAX_DISTANCE_RANGE, 0.1f, MAX_DISTANCE_RANGE, &_max_distance,
+                "Max range in meters; none at the maximum");
+
+            register_option(RS2_OPTION_MAX_DISTANCE,
+                std::make_shared<max_distance_option>(
+                    max_opt,
+                    min_opt));
+
+            register_option(RS2_OPTION_MIN_DISTANCE,
+                std::make_shared<min_distance_option>(
+                    min_opt,
+                    max_opt));
+        }
 
         on_set_mode(_transform_to_disparity);
     }
@@ -58,14 +83,37 @@ namespace librealsense
             auto src = f.as<rs2::video_frame>();
 
             if (_transform_to_disparity)
-                convert<uint16_t, float>(src.get_data(), const_cast<void*>(tgt.get_data()));
+            {
+                update_disparity_lut(f);
+                z16_to_float(static_cast<const uint16_t*>(src.get_data()),
+                    static_cast<float*>(const_cast<void*>(tgt.get_data())), _width * _height, _disparity_lut.data());
+            }
             else
-                convert<float, uint16_t>(src.get_data(), const_cast<void*>(tgt.get_data()));
+                disparity_to_z16(static_cast<const float*>(src.get_data()),
+                    static_cast<uint16_t*>(const_cast<void*>(tgt.get_data())), _width * _height, _d2d_convert_factor);
         }
 
         return tgt;
     }
 
+    void disparity_transform::update_disparity_lut(const rs2::frame& f)
+    {
+        float depth_units = 0.001f;
+        if (f.as<rs2::depth_frame>())
+            depth_units = ((depth_frame*)f.get())->get_units();
+        auto max_distance = _max_distance < MAX_DISTANCE_RANGE ? _max_distance : std::numeric_limits<float>::infinity();
+        auto range = get_z16_range(depth_units, _min_distance, max_distance);
+
+        // Rebuilt only when the baseline, the depth units or the range change
+        if (_disparity_lut.empty() || _lut_convert_factor != _d2d_convert_factor || _lut_range != range)
+        {
+            _disparity_lut.resize(Z16_LUT_SIZE);
+            make_disparity_lut(_disparity_lut.data(), _d2d_convert_factor, range);
+            _lut_convert_factor = _d2d_convert_factor;
+            _lut_range = range;
+        }
+    }
+
     void disparity_transform::on_set_mode(bool to_disparity)
     {
         _transform_to_disparity = to_disparity;
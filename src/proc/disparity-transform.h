@@ -11,6 +11,7 @@
 #include <src/core/sensor-interface.h>
 #include <src/depth-sensor.h>
 #include "synthetic-stream.h"
+#include "depth-maps.h"
 
 namespace librealsense
 {
@@ -24,31 +25,8 @@ namespace librealsense
     protected:
         rs2::frame prepare_target_frame(const rs2::frame& f, const rs2::frame_source& source);
 
-        template<typename Tin, typename Tout>
-        void convert(const void* in_data, void* out_data)
-        {
-            static_assert((std::is_arithmetic<Tin>::value), "disparity transform requires numeric type for input data");
-            static_assert((std::is_arithmetic<Tout>::value), "disparity transform requires numeric type for output data");
-
-            auto in = reinterpret_cast<const Tin*>(in_data);
-            auto out = reinterpret_cast<Tout*>(out_data);
-
-            const bool fp = (std::is_floating_point<Tin>::value);
-            const float round = fp ? 0.5f : 0.f;
-
-            float input{};
-            //TODO SSE optimize
-            for (size_t i = 0; i < _height; i++)
-                for (size_t j = 0; j < _width; j++)
-                {
-                    input = *in;
-                    if (std::isnormal(input))
-                        *out++ = static_cast<Tout>((_d2d_convert_factor / input)+round);
-                    else
-                        *out++ = 0;
-                    in++;
-                }
-        }
+        // Depth to disparity through a lookup table, which applies the distance range too
+        void update_disparity_lut(const rs2::frame& f);
 
     private:
         void    update_transformation_profile(const rs2::frame& f);
@@ -64,6 +42,11 @@ namespace librealsense
         float                   _d2d_convert_factor;
         size_t                  _width, _height;
         size_t                  _bpp;
+        float                   _min_distance;          // Depth to disparity only: 0 out of this range, in meters
+        float                   _max_distance;          // None at its maximum
+        std::vector<float>      _disparity_lut;
+        float                   _lut_convert_factor;
+        z16_range               _lut_range;
     };
     MAP_EXTENSION(RS2_EXTENSION_DISPARITY_FILTER, librealsense::disparity_transform);
 
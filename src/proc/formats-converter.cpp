@@ -414,6 +414,9 @@ void formats_converter::set_frames_callback( rs2_frame_callback_sptr callback )
         {
             if( ! dynamic_cast< composite_frame * >( fr ) )
             {
+                if( _statistics )
+                    _statistics->add( fr, &stream_frame_counters::converted );
+
                 // We find a from profile with the same format+index+type as the frame profile and save it back
                 // to the frame. Reason - viewer uses syncher and matcher that uses rs2::stream_profile.clone()
                 // that generates a new ID for the clone and than the match can fail.
@@ -428,7 +431,11 @@ void formats_converter::set_frames_callback( rs2_frame_callback_sptr callback )
 
                 fr->acquire();
                 if( _converted_frames_callback )
+                {
+                    if( _statistics )
+                        _statistics->add( fr, &stream_frame_counters::delivered );
                     _converted_frames_callback->on_frame( (rs2_frame *)fr );
+                }
             }
         }
     } );
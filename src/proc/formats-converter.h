@@ -4,6 +4,7 @@
 #pragma once
 
 #include "processing-blocks-factory.h"
+#include <src/core/frame-statistics.h>
 
 #include <vector>
 #include <unordered_set>
@@ -43,6 +44,9 @@ namespace librealsense
         rs2_frame_callback_sptr get_frames_callback() const { return _converted_frames_callback; }
         void convert_frame( frame_holder & f );
 
+        // Count converted and delivered frames
+        void set_statistics( std::shared_ptr< frame_statistics > const & statistics ) { _statistics = statistics; }
+
         stream_profiles const & get_source_profiles_from_target( std::shared_ptr< stream_profile_interface > const & target_profile ) const;
 
     protected:
@@ -67,5 +71,6 @@ namespace librealsense
         std::unordered_map< rs2_format, stream_profiles > _format_mapping_to_from_profiles;
 
         rs2_frame_callback_sptr _converted_frames_callback;
+        std::shared_ptr< frame_statistics > _statistics;
     };
 }
@@ -0,0 +1,42 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace librealsense {
+
+
+// The HDR merge's per-pixel kernels.
+
+
+// The depth of the first frame of the pair where it has one, else that of the second; 'out' may be the same as 'd0'
+void hdr_merge_depth_generic( uint16_t const * d0, uint16_t const * d1, uint16_t * out, size_t n );
+
+// The same, where the pixel's infrared is within (ir_min, ir_max), exclusive, i.e. neither under nor over saturated;
+// where neither frame qualifies, 0
+void hdr_merge_depth_generic( uint16_t const * d0, uint16_t const * d1, uint8_t const * ir0, uint8_t const * ir1,
+                              uint8_t ir_min, uint8_t ir_max, uint16_t * out, size_t n );
+void hdr_merge_depth_generic( uint16_t const * d0, uint16_t const * d1, uint16_t const * ir0, uint16_t const * ir1,
+                              uint16_t ir_min, uint16_t ir_max, uint16_t * out, size_t n );
+
+#ifdef RS2_USE_X86_SIMD
+void hdr_merge_depth_sse( uint16_t const * d0, uint16_t const * d1, uint16_t * out, size_t n );
+void hdr_merge_depth_sse( uint16_t const * d0, uint16_t const * d1, uint8_t const * ir0, uint8_t const * ir1,
+                          uint8_t ir_min, uint8_t ir_max, uint16_t * out, size_t n );
+void hdr_merge_depth_sse( uint16_t const * d0, uint16_t const * d1, uint16_t const * ir0, uint16_t const * ir1,
+                          uint16_t ir_min, uint16_t ir_max, uint16_t * out, size_t n );
+#endif
+
+// With the best kernel for the current SIMD level
+void hdr_merge_depth( uint16_t const * d0, uint16_t const * d1, uint16_t * out, size_t n );
+void hdr_merge_depth( uint16_t const * d0, uint16_t const * d1, uint8_t const * ir0, uint8_t const * ir1,
+                      uint8_t ir_min, uint8_t ir_max, uint16_t * out, size_t n );
+void hdr_merge_depth( uint16_t const * d0, uint16_t const * d1, uint16_t const * ir0, uint16_t const * ir1,
+                      uint16_t ir_min, uint16_t ir_max, uint16_t * out, size_t n );
+
+
+}  // namespace librealsense
@@ -2,6 +2,7 @@
 // Copyright(c) 2020 Intel Corporation. All Rights Reserved.
 
 #include "hdr-merge.h"
+#include "simd-dispatch.h"
 #include <src/core/depth-frame.h>
 
 namespace librealsense
@@ -9,8 +10,10 @@ namespace librealsense
     hdr_merge::hdr_merge()
         : generic_processing_block("HDR Merge"),
         _previous_depth_frame_counter(0),
-        _frames_without_requested_metadata_counter(0)
-    {}
+        _frames_without_requested_metadata_counter(0),
+        _framesets_count(0)
+    {
+    }
 
     // processing only framesets
     bool hdr_merge::should_process(const rs2::frame& frame)
@@ -83,21 +86,22 @@ namespace librealsense
         // saving frame of sequence id 0
         // so that the merging with be deterministic - always done with frame n and n+1
         // with frame n as basis
-        if (_framesets.size() == depth_seq_id)
+        if (_framesets_count == depth_seq_id)
         {
-            _framesets[(int)depth_seq_id] = fs;
+            _framesets[_framesets_count++] = fs;
         }
 
         // discard merged frame if not relevant
         discard_depth_merged_frame_if_needed(depth_frame);
 
         // 3. check if size of this vector is at least 2 (if not - return latest merge frame)
-        if (_framesets.size() >= 2)
+        if (_framesets_count == _framesets.size())
         {
             // 4. pop out both framesets from the vector
             rs2::frameset fs_0 = _framesets[0];
             rs2::frameset fs_1 = _framesets[1];
-            _framesets.clear();
+            _framesets[0] = _framesets[1] = rs2::frameset();
+            _framesets_count = 0;
 
             bool use_ir = false;
             if (check_frames_mergeability(fs_0, fs_1, use_ir))
@@ -197,35 +201,29 @@ namespace librealsense
             if (!orig)
                 throw std::runtime_error("Frame interface is not depth frame");
 
-            auto d0 = (uint16_t*)first_depth.get_data();
-            auto d1 = (uint16_t*)second_depth.get_data();
+            auto d0 = (const uint16_t*)first_depth.get_data();
+            auto d1 = (const uint16_t*)second_depth.get_data();
 
             auto new_data = (uint16_t*)ptr->get_frame_data();
 
             ptr->set_sensor(orig->get_sensor());
 
-            memset(new_data, 0, width * height * sizeof(uint16_t));
+            // Every pixel is written
+            size_t width_height_product = size_t(width) * height;
 
-            int width_height_product = width * height;
-
-            if (use_ir)
+            if (use_ir && first_ir.get_profile().format() == RS2_FORMAT_Y8)
             {
-                if (first_ir.get_profile().format() == RS2_FORMAT_Y8)
-                {
-                    merge_frames_using_ir<uint8_t>(new_data, d0, d1, first_ir, second_ir, width_height_product);
-                }
-                else if (first_ir.get_profile().format() == RS2_FORMAT_Y16)
-                {
-                    merge_frames_using_ir<uint16_t>(new_data, d0, d1, first_ir, second_ir, width_height_product);
-                }
-                else
-                {
-                    merge_frames_using_only_depth(new_data, d0, d1, width_height_product);
-                }
+                hdr_merge_depth(d0, d1, (const uint8_t*)first_ir.get_data(), (const uint8_t*)second_ir.get_data(),
+                    uint8_t(IR_UNDER_SATURATED_VALUE_Y8), uint8_t(IR_OVER_SATURATED_VALUE_Y8), new_data, width_height_product);
+            }
+            else if (use_ir && first_ir.get_profile().format() == RS2_FORMAT_Y16)
+            {
+                hdr_merge_depth(d0, d1, (const uint16_t*)first_ir.get_data(), (const uint16_t*)second_ir.get_data(),
+                    uint16_t(IR_UNDER_SATURATED_VALUE_Y16), uint16_t(IR_OVER_SATURATED_VALUE_Y16), new_data, width_height_product);
             }
             else
             {
-                merge_frames_using_only_depth(new_data, d0, d1, width_height_product);
+                hdr_merge_depth(d0, d1, new_data, width_height_product);
             }
 
             return new_f;
@@ -233,19 +231,76 @@ namespace librealsense
         return first_fs;
     }
 
-    void hdr_merge::merge_frames_using_only_depth(uint16_t* new_data, uint16_t* d0, uint16_t* d1, int width_height_prod) const
+    void hdr_merge_depth_generic(const uint16_t* d0, const uint16_t* d1, uint16_t* out, size_t n)
+    {
+        for (size_t i = 0; i < n; i++)
+            out[i] = d0[i] ? d0[i] : d1[i];
+    }
+
+    template<typename T>
+    static void merge_using_ir(const uint16_t* d0, const uint16_t* d1, const T* ir0, const T* ir1, T ir_min, T ir_max,
+                               uint16_t* out, size_t n)
     {
-        for (int i = 0; i < width_height_prod; i++)
+        for (size_t i = 0; i < n; i++)
         {
-            if (d0[i])
-                new_data[i] = d0[i];
-            else if (d1[i])
-                new_data[i] = d1[i];
+            if (ir0[i] > ir_min && ir0[i] < ir_max && d0[i])
+                out[i] = d0[i];
+            else if (ir1[i] > ir_min && ir1[i] < ir_max && d1[i])
+                out[i] = d1[i];
             else
-                new_data[i] = 0;
+                out[i] = 0;
         }
     }
 
+    void hdr_merge_depth_generic(const uint16_t* d0, const uint16_t* d1, const uint8_t* ir0, const uint8_t* ir1,
+                                 uint8_t ir_min, uint8_t ir_max, uint16_t* out, size_t n)
+    {
+        merge_using_ir(d0, d1, ir0, ir1, ir_min, ir_max, out, n);
+    }
+
+    void hdr_merge_depth_generic(const uint16_t* d0, const uint16_t* d1, const uint16_t* ir0, const uint16_t* ir1,
+                                 uint16_t ir_min, uint16_t ir_max, uint16_t* out, size_t n)
+    {
+        merge_using_ir(d0, d1, ir0, ir1, ir_min, ir_max, out, n);
+    }
+
+    void hdr_merge_depth(const uint16_t* d0, const uint16_t* d1, uint16_t* out, size_t n)
+    {
+        typedef void(*merge_fn)(const uint16_t*, const uint16_t*, uint16_t*, size_t);
+        static simd_kernel<merge_fn> const kernel = simd_kernel<merge_fn>(hdr_merge_depth_generic)
+#ifdef RS2_USE_X86_SIMD
+            .add(RS2_SIMD_LEVEL_SSSE3, hdr_merge_depth_sse)
+#endif
+            ;
+        kernel.get()(d0, d1, out, n);
+    }
+
+    void hdr_merge_depth(const uint16_t* d0, const uint16_t* d1, const uint8_t* ir0, const uint8_t* ir1,
+                         uint8_t ir_min, uint8_t ir_max, uint16_t* out, size_t n)
+    {
+        typedef void(*merge_fn)(const uint16_t*, const uint16_t*, const uint8_t*, const uint8_t*, uint8_t, uint8_t,
+                                uint16_t*, size_t);
+        static simd_kernel<merge_fn> const kernel = simd_kernel<merge_fn>(hdr_merge_depth_generic)
+#ifdef RS2_USE_X86_SIMD
+            .add(RS2_SIMD_LEVEL_SSSE3, hdr_merge_depth_sse)
+#endif
+            ;
+        kernel.get()(d0, d1, ir0, ir1, ir_min, ir_max, out, n);
+    }
+
+    void hdr_merge_depth(const uint16_t* d0, const uint16_t* d1, const uint16_t* ir0, const uint16_t* ir1,
+                         uint16_t ir_min, uint16_t ir_max, uint16_t* out, size_t n)
+    {
+        typedef void(*merge_fn)(const uint16_t*, const uint16_t*, const uint16_t*, const uint16_t*, uint16_t, uint16_t,
+                                uint16_t*, size_t);
+        static simd_kernel<merge_fn> const kernel = simd_kernel<merge_fn>(hdr_merge_depth_generic)
+#ifdef RS2_USE_X86_SIMD
+            .add(RS2_SIMD_LEVEL_SSSE3, hdr_merge_depth_sse)
+#endif
+            ;
+        kernel.get()(d0, d1, ir0, ir1, ir_min, ir_max, out, n);
+    }
+
     bool hdr_merge::should_ir_be_used_for_merging(const rs2::depth_frame& first_depth, const rs2::video_frame& first_ir,
         const rs2::depth_frame& second_depth, const rs2::video_frame& second_ir) const
     {
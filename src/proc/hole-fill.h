@@ -0,0 +1,43 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace librealsense {
+
+
+// The hole filling filter's per-row kernels.
+
+
+enum holes_filling_types : uint8_t
+{
+    hf_fill_from_left,
+    hf_farest_from_around,
+    hf_nearest_from_around,
+    hf_max_value
+};
+
+
+// Fill the holes of columns [first, end) of a row, first > 0, as if a single pass over the frame had filled all the
+// pixels before them, in place:
+// - 'in' and 'down' are this row and the next one as they were (unused by hf_fill_from_left, as is 'up')
+// - 'up' is the previous row, and 'out' this one, filled up to 'first'; 'out' may be the same as 'in'
+// For disparity, holes are +0 and the other values must not be negative or NaN.
+void hole_fill_row_generic( uint8_t mode, uint16_t const * up, uint16_t const * in, uint16_t const * down,
+                            uint16_t * out, size_t first, size_t end );
+void hole_fill_row_generic( uint8_t mode, float const * up, float const * in, float const * down, float * out,
+                            size_t first, size_t end );
+
+#ifdef RS2_USE_X86_SIMD
+void hole_fill_row_sse( uint8_t mode, uint16_t const * up, uint16_t const * in, uint16_t const * down, uint16_t * out,
+                        size_t first, size_t end );
+void hole_fill_row_sse( uint8_t mode, float const * up, float const * in, float const * down, float * out,
+                        size_t first, size_t end );
+#endif
+
+
+}  // namespace librealsense
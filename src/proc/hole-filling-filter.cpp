@@ -9,9 +9,15 @@
 #include "software-device.h"
 #include "proc/synthetic-stream.h"
 #include "proc/hole-filling-filter.h"
+#include "simd-dispatch.h"
 
 #include <rsutils/string/from.h>
 
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <thread>
+
 
 namespace librealsense
 {
@@ -64,11 +70,11 @@ namespace librealsense
         update_configuration(f);
         auto tgt = prepare_target_frame(f, source);
 
-        // Hole filling pass
+        // Hole filling pass, from the source straight to the target
         if (_extension_type == RS2_EXTENSION_DISPARITY_FRAME)
-            apply_hole_filling<float>(const_cast<void*>(tgt.get_data()));
+            apply_hole_filling<float>(f.get_data(), const_cast<void*>(tgt.get_data()));
         else
-            apply_hole_filling<uint16_t>(const_cast<void*>(tgt.get_data()));
+            apply_hole_filling<uint16_t>(f.get_data(), const_cast<void*>(tgt.get_data()));
 
         return tgt;
     }
@@ -93,11 +99,162 @@ namespace librealsense
 
     rs2::frame hole_filling_filter::prepare_target_frame(const rs2::frame& f, const rs2::frame_source& source)
     {
-        // Allocate and copy the content of the input data to the target
-        rs2::frame tgt = source.allocate_video_frame(_target_stream_profile, f, int(_bpp), int(_width), int(_height), int(_stride), _extension_type);
+        // Allocate the target; the hole filling writes all of it
+        return source.allocate_video_frame(_target_stream_profile, f, int(_bpp), int(_width), int(_height), int(_stride), _extension_type);
+    }
 
-        memmove(const_cast<void*>(tgt.get_data()), f.get_data(), _current_frm_size_pixels * _bpp);
-        return tgt;
+    template<typename T>
+    static bool is_hole(T val)
+    {
+        return !val;
+    }
+
+    static bool is_hole(float val)
+    {
+        // Only +0
+        int32_t bits;
+        std::memcpy(&bits, &val, sizeof(bits));
+        return !bits;
+    }
+
+    template<typename T>
+    static void hole_fill_row(uint8_t mode, const T* up, const T* in, const T* down, T* out, size_t first, size_t end)
+    {
+        // The left neighbor comes from 'out': it may have been a hole, too
+        switch (mode)
+        {
+        case hf_fill_from_left:
+            for (size_t i = first; i < end; ++i)
+                out[i] = is_hole(in[i]) ? out[i - 1] : in[i];
+            break;
+        case hf_farest_from_around:
+            for (size_t i = first; i < end; ++i)
+            {
+                T tmp = in[i];
+                if (is_hole(tmp))
+                {
+                    tmp = up[i];
+                    if (up[i - 1] > tmp)
+                        tmp = up[i - 1];
+                    if (out[i - 1] > tmp)
+                        tmp = out[i - 1];
+                    if (down[i - 1] > tmp)
+                        tmp = down[i - 1];
+                    if (down[i] > tmp)
+                        tmp = down[i];
+                }
+                out[i] = tmp;
+            }
+            break;
+        case hf_nearest_from_around:
+            for (size_t i = first; i < end; ++i)
+            {
+                T tmp = in[i];
+                if (is_hole(tmp))
+                {
+                    tmp = up[i];
+                    if (!is_hole(up[i - 1]) && (up[i - 1] < tmp))
+                        tmp = up[i - 1];
+                    if (!is_hole(out[i - 1]) && (out[i - 1] < tmp))
+                        tmp = out[i - 1];
+                    if (!is_hole(down[i - 1]) && (down[i - 1] < tmp))
+                        tmp = down[i - 1];
+                    if (!is_hole(down[i]) && (down[i] < tmp))
+                        tmp = down[i];
+                }
+                out[i] = tmp;
+            }
+            break;
+        }
+    }
+
+    void hole_fill_row_generic(uint8_t mode, const uint16_t* up, const uint16_t* in, const uint16_t* down, uint16_t* out,
+                               size_t first, size_t end)
+    {
+        hole_fill_row(mode, up, in, down, out, first, end);
+    }
+
+    void hole_fill_row_generic(uint8_t mode, const float* up, const float* in, const float* down, float* out,
+                               size_t first, size_t end)
+    {
+        hole_fill_row(mode, up, in, down, out, first, end);
+    }
+
+    // Columns per step of the wavefront: a row waits until the one above it is a step ahead, so that both the filled
+    // pixels it needs from that row are there and that row is done reading the pixels it is about to fill
+    static const size_t WAVEFRONT_STEP = 128;
+
+    template<typename T, typename Fn>
+    static void hole_fill_frame(row_bands& bands, Fn kernel, uint8_t mode, const T* in, T* out, size_t width, size_t height)
+    {
+        if (mode == hf_fill_from_left)
+        {
+            bands.run(height, 16, [&](size_t first_row, size_t end_row)
+            {
+                for (size_t j = first_row; j < end_row; ++j)
+                {
+                    out[j * width] = in[j * width];
+                    if (width > 1)
+                        kernel(mode, nullptr, in + j * width, nullptr, out + j * width, 1, width);
+                }
+            });
+            return;
+        }
+
+        // The first and last rows, and the first column, stay as they are
+        if (in != out && height)
+        {
+            std::copy(in, in + width, out);
+            std::copy(in + (height - 1) * width, in + height * width, out + (height - 1) * width);
+        }
+        if (height < 3)
+            return;
+
+        // Row j goes to band j % n_bands
+        size_t const n_bands = std::min(bands.get_max_bands(), height - 2);
+        std::vector<std::atomic<size_t>> columns_done(height);
+        bands.run(n_bands, 1, [&](size_t band, size_t)
+        {
+            for (size_t j = 1 + band; j < height - 1; j += n_bands)
+            {
+                out[j * width] = in[j * width];
+                for (size_t first = 1; first < width;)
+                {
+                    size_t end = std::min(width, first + WAVEFRONT_STEP);
+                    if (j > 1 && n_bands > 1)
+                    {
+                        size_t const needed = std::min(width, end + 1);
+                        while (columns_done[j - 1].load(std::memory_order_acquire) < needed)
+                            std::this_thread::yield();
+                    }
+                    kernel(mode, out + (j - 1) * width, in + j * width, in + (j + 1) * width, out + j * width, first, end);
+                    columns_done[j].store(end, std::memory_order_release);
+                    first = end;
+                }
+            }
+        });
+    }
+
+    void hole_fill(row_bands& bands, uint8_t mode, const uint16_t* in, uint16_t* out, size_t width, size_t height)
+    {
+        typedef void(*fill_fn)(uint8_t, const uint16_t*, const uint16_t*, const uint16_t*, uint16_t*, size_t, size_t);
+        static simd_kernel<fill_fn> const kernel = simd_kernel<fill_fn>(hole_fill_row_generic)
+#ifdef RS2_USE_X86_SIMD
+            .add(RS2_SIMD_LEVEL_SSSE3, hole_fill_row_sse)
+#endif
+            ;
+        hole_fill_frame(bands, kernel.get(), mode, in, out, width, height);
+    }
+
+    void hole_fill(row_bands& bands, uint8_t mode, const float* in, float* out, size_t width, size_t height)
+    {
+        typedef void(*fill_fn)(uint8_t, const float*, const float*, const float*, float*, size_t, size_t);
+        static simd_kernel<fill_fn> const kernel = simd_kernel<fill_fn>(hole_fill_row_generic)
+#ifdef RS2_USE_X86_SIMD
+            .add(RS2_SIMD_LEVEL_SSSE3, hole_fill_row_sse)
+#endif
+            ;
+        hole_fill_frame(bands, kernel.get(), mode, in, out, width, height);
     }
 
 }
@@ -0,0 +1,119 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "motion-block-batcher.h"
+
+#include <src/core/motion-frame.h>
+#include <src/core/frame-callback.h>
+#include <src/core/stream-profile-interface.h>
+#include <src/core/sensor-interface.h>
+
+#include <cstring>
+
+
+namespace librealsense {
+
+
+motion_block_batcher::motion_block_batcher( size_t block_size, std::shared_ptr< sensor_interface > const & sensor )
+    : _block_size( block_size )
+{
+    _source.set_sensor( sensor );
+}
+
+
+motion_block_batcher::~motion_block_batcher()
+{
+    reset();
+}
+
+
+rs2_frame_callback_sptr motion_block_batcher::wrap( rs2_frame_callback_sptr callback )
+{
+    _source.set_callback( std::move( callback ) );
+    // The callback may be kept (and even called) after we're gone
+    std::weak_ptr< motion_block_batcher > weak = shared_from_this();
+    return make_frame_callback(
+        [weak]( frame_holder f )
+        {
+            if( auto batcher = weak.lock() )
+                batcher->add( std::move( f ) );
+        } );
+}
+
+
+void motion_block_batcher::add( frame_holder && f )
+{
+    auto const profile = f ? f->get_stream() : nullptr;
+    auto const sample = dynamic_cast< frame * >( f.frame );
+    // NOTE: the data size of software frames is 0 (their pixels are external), so is not checked
+    if( ! profile || ! sample || profile->get_format() != RS2_FORMAT_MOTION_XYZ32F || ! sample->get_frame_data() )
+    {
+        _source.invoke_callback( std::move( f ) );
+        return;
+    }
+
+    frame_holder done;
+    {
+        std::lock_guard< std::mutex > lock( _mutex );
+        if( ! _initialized )
+        {
+            // Our blocks carry the metadata of the samples, so need the same parsers
+            _source.init( f->get_owner()->get_md_parsers() );
+            _initialized = true;
+        }
+
+        auto const stream = profile->get_stream_type();
+        auto const index = profile->get_stream_index();
+        auto & block = _pending[{ stream, index }];
+        if( ! block.frame )
+        {
+            block.frame = _source.alloc_frame( { stream, index, RS2_EXTENSION_MOTION_BLOCK_FRAME },
+                                               _block_size * motion_block_frame::bytes_per_sample,
+                                               frame_additional_data( sample->additional_data ),
+                                               true );
+            if( ! block.frame )
+            {
+                LOG_DEBUG( "Dropped " << get_string( stream ) << " sample: motion block could not be allocated" );
+                return;
+            }
+            block.frame->set_stream( profile );
+            block.n_samples = 0;
+        }
+
+        // Structure of arrays: all timestamps, then all X, all Y, all Z
+        auto const timestamps = reinterpret_cast< double * >( const_cast< uint8_t * >( block.frame->get_frame_data() ) );
+        auto const x = reinterpret_cast< float * >( timestamps + _block_size );
+        auto const y = x + _block_size;
+        auto const z = y + _block_size;
+        float xyz[3];
+        std::memcpy( xyz, sample->get_frame_data(), sizeof( xyz ) );
+        auto const i = block.n_samples++;
+        timestamps[i] = sample->get_frame_timestamp();
+        x[i] = xyz[0];
+        y[i] = xyz[1];
+        z[i] = xyz[2];
+
+        if( block.n_samples < _block_size )
+            return;
+
+        // The block as a whole is as of its last sample
+        auto const block_frame = static_cast< frame * >( block.frame.frame );
+        block_frame->additional_data = sample->additional_data;
+        block_frame->set_timestamp_domain( sample->get_frame_timestamp_domain() );
+        done = std::move( block.frame );
+    }
+    _source.invoke_callback( std::move( done ) );
+}
+
+
+void motion_block_batcher::reset()
+{
+    {
+        std::lock_guard< std::mutex > lock( _mutex );
+        _pending.clear();
+    }
+    _source.flush();
+}
+
+
+}  // namespace librealsense
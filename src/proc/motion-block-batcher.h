@@ -0,0 +1,58 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <src/source.h>
+#include <src/core/frame-holder.h>
+
+#include <map>
+#include <mutex>
+
+
+namespace librealsense {
+
+
+class sensor_interface;
+
+
+// Collects the samples of motion streams into motion block frames (see RS2_OPTION_MOTION_BLOCK_SIZE), so that each
+// block of N samples costs one callback, one trip through the user's queues and syncer, etc.
+// It wraps the synthetic sensor's callback, so each sample is still allocated as a frame (raw, then converted) before
+// it's copied into its block: what is saved is everything downstream of the sensor, not the per-sample allocations.
+//
+// Each stream fills its own block, allocated when its first sample arrives. Frames that are not motion samples
+// (MOTION_XYZ32F) are passed through as they are.
+//
+class motion_block_batcher : public std::enable_shared_from_this< motion_block_batcher >
+{
+public:
+    motion_block_batcher( size_t block_size, std::shared_ptr< sensor_interface > const & sensor );
+    ~motion_block_batcher();
+
+    size_t get_block_size() const { return _block_size; }
+
+    // A callback that batches the frames it gets and passes the blocks on to 'callback'
+    rs2_frame_callback_sptr wrap( rs2_frame_callback_sptr callback );
+
+    // Discard the blocks we're still filling
+    void reset();
+
+private:
+    void add( frame_holder && );
+
+    struct pending_block
+    {
+        frame_holder frame;
+        size_t n_samples = 0;
+    };
+
+    size_t const _block_size;
+    frame_source _source;
+    bool _initialized = false;
+    std::mutex _mutex;
+    std::map< std::pair< rs2_stream, int >, pending_block > _pending;
+};
+
+
+}  // namespace librealsense
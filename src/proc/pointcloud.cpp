@@ -20,10 +20,9 @@
 #include "proc/cuda/cuda-pointcloud.h"
 #include "rsutils/accelerators/gpu.h"
 #endif
-#ifdef __SSSE3__
 #include "proc/sse/sse-pointcloud.h"
-#endif
 #include "proc/neon/neon-pointcloud.h"
+#include "simd-dispatch.h"
 
 
 namespace librealsense
@@ -402,9 +401,13 @@ namespace librealsense
             return std::make_shared<librealsense::pointcloud_cuda>();
         }
         #endif
-        #ifdef __SSSE3__
+        #ifdef RS2_USE_X86_SIMD
+        if (get_simd_level() >= RS2_SIMD_LEVEL_SSSE3)
+        {
             return std::make_shared<librealsense::pointcloud_sse>();
-        #elif defined(__ARM_NEON)  && ! defined ANDROID
+        }
+        #endif
+        #if defined(__ARM_NEON)  && ! defined ANDROID
             return std::make_shared<librealsense::pointcloud_neon>();
         #else
             return std::make_shared<librealsense::pointcloud>();
@@ -0,0 +1,43 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace librealsense {
+
+
+// The resizing color converter's kernels, on rows of 'bpp' (3 or 4) interleaved 8-bit values per pixel, as converted
+// at full resolution. All give the same results.
+//
+// The 16-bit rows they read from must be readable 32 values past their end (the converter's buffer is): the SIMD
+// kernels read whole registers, and ignore what they do not need.
+
+
+// blend[i] = top[i] * ( 256 - weight ) + bottom[i] * weight, for i in [0, n)
+void resize_blend_rows_generic( const uint8_t * top, const uint8_t * bottom, int weight, size_t n, uint16_t * blend );
+
+// Boxes all 'span' (up to 4) columns wide, of n_rows summed rows, for areas span * n_rows up to 256: each output value
+// is the sum of its box's, plus half the area, divided by the area
+void resize_box_columns_generic( const uint16_t * sums, int bpp, int span, int n_rows, int width_out, uint8_t * out );
+
+// Each output pixel from two blended columns: columns[2 * x] and the next, columns[2 * x + 1] / 256 of the way to it,
+// rounded to nearest. The weight of the next column must be 0 where there is none.
+void resize_bilinear_columns_generic( const uint16_t * blend, int bpp, const int32_t * columns, int width_out,
+                                      uint8_t * out );
+
+#ifdef RS2_USE_X86_SIMD
+// The box and interpolation kernels shuffle values within 128-bit registers, and have nothing to gain from AVX2; the
+// blend, which the compiler vectorizes well enough at the baseline, only gains from the wider registers.
+void resize_box_columns_sse( const uint16_t * sums, int bpp, int span, int n_rows, int width_out, uint8_t * out );
+void resize_bilinear_columns_sse( const uint16_t * blend, int bpp, const int32_t * columns, int width_out,
+                                  uint8_t * out );
+
+void resize_blend_rows_avx2( const uint8_t * top, const uint8_t * bottom, int weight, size_t n, uint16_t * blend );
+#endif
+
+
+}  // namespace librealsense
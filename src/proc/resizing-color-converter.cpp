@@ -0,0 +1,522 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include <librealsense2/hpp/rs_sensor.hpp>
+#include <librealsense2/hpp/rs_processing.hpp>
+
+#include "option.h"
+#include "stream.h"
+#include "image.h"
+#include "core/video.h"
+#include "proc/resizing-color-converter.h"
+#include "proc/color-formats-converter.h"
+#include "proc/y411-converter.h"
+#include "proc/resize-color-kernels.h"
+#include "simd-dispatch.h"
+
+#include <rsutils/string/from.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace librealsense
+{
+    const uint8_t resize_magnitude_min_val = 1;
+    const uint8_t resize_magnitude_max_val = 8;
+    const uint8_t resize_magnitude_default_val = 2;
+    const int resize_max_size = 8192;
+
+    resizing_color_converter::resizing_color_converter(rs2_format target_format) :
+        stream_filter_processing_block("Resizing Color Converter"),
+        _target_format(target_format),
+        _target_bpp(get_image_bpp(target_format) / 8),
+        _control_magnitude(resize_magnitude_default_val),
+        _control_width(0),
+        _control_height(0),
+        _control_filter(rf_box),
+        _magnitude(resize_magnitude_default_val),
+        _requested_width(0),
+        _requested_height(0),
+        _filter(rf_box),
+        _width(0),
+        _height(0),
+        _options_changed(false)
+    {
+        if (target_format != RS2_FORMAT_RGB8 && target_format != RS2_FORMAT_BGR8
+            && target_format != RS2_FORMAT_RGBA8 && target_format != RS2_FORMAT_BGRA8)
+            throw invalid_value_exception( rsutils::string::from() << "Unsupported target format "
+                                                                   << rs2_format_to_string( target_format )
+                                                                   << " for resizing color conversion" );
+
+        auto magnitude_control = std::make_shared<ptr_option<uint8_t>>(
+            resize_magnitude_min_val,
+            resize_magnitude_max_val,
+            uint8_t(1),
+            resize_magnitude_default_val,
+            &_control_magnitude, "Resize by this scale, unless a width or height is set");
+        auto width_control = std::make_shared<ptr_option<int>>(0, resize_max_size, 1, 0, &_control_width,
+            "Output width, up to the input's; 0 for the input's divided by the magnitude or, with a height, to keep the aspect ratio");
+        auto height_control = std::make_shared<ptr_option<int>>(0, resize_max_size, 1, 0, &_control_height,
+            "Output height, up to the input's; 0 for the input's divided by the magnitude or, with a width, to keep the aspect ratio");
+        auto filter_control = std::make_shared<ptr_option<uint8_t>>(uint8_t(rf_box), uint8_t(rf_max_value - 1), uint8_t(1),
+            uint8_t(rf_box), &_control_filter, "Resize filter");
+        filter_control->set_description(float(rf_box), "Box");
+        filter_control->set_description(float(rf_bilinear), "Bilinear");
+
+        // Taken in between frames
+        auto apply = [this](float)
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _magnitude = _control_magnitude;
+            _requested_width = _control_width;
+            _requested_height = _control_height;
+            _filter = _control_filter;
+            _options_changed = true;
+        };
+        magnitude_control->on_set(apply);
+        width_control->on_set(apply);
+        height_control->on_set(apply);
+        filter_control->on_set(apply);
+
+        register_option(RS2_OPTION_FILTER_MAGNITUDE, magnitude_control);
+        register_option(RS2_OPTION_RESIZE_WIDTH, width_control);
+        register_option(RS2_OPTION_RESIZE_HEIGHT, height_control);
+        register_option(RS2_OPTION_RESIZE_FILTER, filter_control);
+    }
+
+    bool resizing_color_converter::should_process(const rs2::frame& frame)
+    {
+        if (!frame || frame.is<rs2::frameset>() || !frame.is<rs2::video_frame>())
+            return false;
+
+        switch (frame.get_profile().format())
+        {
+        case RS2_FORMAT_YUYV:
+        case RS2_FORMAT_UYVY:
+        case RS2_FORMAT_M420:
+            return true;
+        case RS2_FORMAT_Y411:
+            return _target_format == RS2_FORMAT_RGB8;
+        default:
+            return false;
+        }
+    }
+
+    rs2::frame resizing_color_converter::process_frame(const rs2::frame_source& source, const rs2::frame& f)
+    {
+        update_output_profile(f);
+
+        auto vf = f.as<rs2::video_frame>();
+        auto tgt = source.allocate_video_frame(_target_stream_profile, f, _target_bpp, _width, _height,
+                                               _width * _target_bpp, RS2_EXTENSION_VIDEO_FRAME);
+        if (!tgt)
+            return f;
+
+        resize_color_params params;
+        params.source_format = f.get_profile().format();
+        params.target_format = _target_format;
+        params.filter = _filter;
+        params.in = static_cast<const uint8_t*>(vf.get_data());
+        params.width_in = vf.get_width();
+        params.height_in = vf.get_height();
+        params.out = static_cast<uint8_t*>(const_cast<void*>(tgt.get_data()));
+        params.width_out = _width;
+        params.height_out = _height;
+        resize_color(_bands, _buffers, params);
+        return tgt;
+    }
+
+    void resizing_color_converter::update_output_profile(const rs2::frame& f)
+    {
+        if (!_options_changed && f.get_profile().get() == _source_stream_profile.get())
+            return;
+
+        _options_changed = false;
+        _source_stream_profile = f.get_profile();
+
+        auto src_vspi = dynamic_cast<video_stream_profile_interface*>(_source_stream_profile.get()->profile);
+        if (!src_vspi)
+            throw std::runtime_error("Stream profile interface is not video stream profile interface");
+
+        int const width_in = src_vspi->get_width();
+        int const height_in = src_vspi->get_height();
+        int width = _requested_width;
+        int height = _requested_height;
+        if (!width && !height)
+        {
+            width = width_in / _magnitude;
+            height = height_in / _magnitude;
+        }
+        else if (!height)
+            height = int((int64_t(height_in) * width * 2 + width_in) / (2 * int64_t(width_in)));
+        else if (!width)
+            width = int((int64_t(width_in) * height * 2 + height_in) / (2 * int64_t(height_in)));
+        _width = std::max(1, std::min(width, width_in));
+        _height = std::max(1, std::min(height, height_in));
+
+        auto const key = std::make_tuple(_source_stream_profile.get(), _width, _height);
+        auto const pf = _registered_profiles.find(key);
+        if (_registered_profiles.end() != pf)
+        {
+            _target_stream_profile = pf->second;
+            return;
+        }
+
+        auto tmp_profile = _source_stream_profile.clone(_source_stream_profile.stream_type(),
+                                                        _source_stream_profile.stream_index(), _target_format);
+        auto tgt_vspi = dynamic_cast<video_stream_profile_interface*>(tmp_profile.get()->profile);
+        if (!tgt_vspi)
+            throw std::runtime_error("Profile is not video stream profile");
+
+        rs2_intrinsics src_intrin = src_vspi->get_intrinsics();
+        rs2_intrinsics tgt_intrin = src_intrin;
+
+        // The principal point keeps its place relative to the pixel centers, as the resizing maps them
+        float const scale_x = float(_width) / width_in;
+        float const scale_y = float(_height) / height_in;
+        tgt_intrin.width = _width;
+        tgt_intrin.height = _height;
+        tgt_intrin.fx = src_intrin.fx * scale_x;
+        tgt_intrin.fy = src_intrin.fy * scale_y;
+        tgt_intrin.ppx = (src_intrin.ppx + 0.5f) * scale_x - 0.5f;
+        tgt_intrin.ppy = (src_intrin.ppy + 0.5f) * scale_y - 0.5f;
+
+        tgt_vspi->set_intrinsics([tgt_intrin]() { return tgt_intrin; });
+        tgt_vspi->set_dims(tgt_intrin.width, tgt_intrin.height);
+
+        _registered_profiles[key] = _target_stream_profile = tmp_profile;
+    }
+
+    namespace
+    {
+        // Input rows converted into a band's buffer at a time, about: enough to amortize the converters' setup, few
+        // enough to stay in the cache
+        const int STRIP_ROWS = 16;
+
+        // The converters take whole pairs of rows of M420 and Y411, which pack them together, and a multiple of 16
+        // pixels (of 32, for the AVX2 YUYV kernel); with rows that cannot be split so, the whole frame
+        int group_rows(rs2_format format, int width, int height)
+        {
+            int const base = (format == RS2_FORMAT_M420 || format == RS2_FORMAT_Y411) ? 2 : 1;
+            int rows = base;
+            while ((width * rows) % 32)
+                rows += base;
+            return height % rows ? height : rows;
+        }
+
+        // Convert input rows [first, first + rows), both multiples of group_rows()
+        void convert_rows(const resize_color_params& p, int first, int rows, uint8_t* dst)
+        {
+            uint8_t* const d[] = { dst };
+            int const actual_size = p.width_in * rows * get_image_bpp(p.target_format) / 8;
+            switch (p.source_format)
+            {
+            case RS2_FORMAT_YUYV:
+                unpack_yuy2(p.target_format, RS2_STREAM_COLOR, d, p.in + size_t(first) * p.width_in * 2,
+                            p.width_in, rows, actual_size);
+                break;
+            case RS2_FORMAT_UYVY:
+                unpack_uyvyc(p.target_format, RS2_STREAM_COLOR, d, p.in + size_t(first) * p.width_in * 2,
+                             p.width_in, rows, actual_size);
+                break;
+            case RS2_FORMAT_M420:
+                // Two rows of Y, then one of U,V pairs
+                unpack_m420(p.target_format, RS2_STREAM_COLOR, d, p.in + size_t(first) / 2 * p.width_in * 3,
+                            p.width_in, rows, actual_size);
+                break;
+            case RS2_FORMAT_Y411:
+                unpack_y411(d, p.in + size_t(first) / 2 * p.width_in * 3, p.width_in, rows, actual_size);
+                break;
+            default:
+                break;
+            }
+        }
+
+        // The input pixels [first, end) the box of output pixel i covers
+        int box_first(int i, int n_in, int n_out) { return int(int64_t(i) * n_in / n_out); }
+        int box_end(int i, int n_in, int n_out)
+        {
+            return std::max(box_first(i, n_in, n_out) + 1, int(int64_t(i + 1) * n_in / n_out));
+        }
+
+        // The input position of the center of output pixel i, in 1/256 of a pixel
+        int bilinear_position(int i, int n_in, int n_out)
+        {
+            int64_t const t = ((2 * int64_t(i) + 1) * n_in * 256 + n_out) / (2 * int64_t(n_out)) - 128;
+            return int(std::max(int64_t(0), std::min(t, int64_t(n_in - 1) * 256)));
+        }
+
+        // Dividing by the area with a multiplication, exact for sums up to 256 times the area: 32 bits are enough for
+        // areas up to 256, 64 for up to 2^23
+        template<typename R> int reciprocal_shift() { return sizeof(R) == 4 ? 24 : 55; }
+        template<typename R> R reciprocal(uint32_t area)
+        {
+            return R(((uint64_t(1) << reciprocal_shift<R>()) + area - 1) / area);
+        }
+
+        template<typename S>
+        void sum_rows(const uint8_t* rows, size_t stride, int n_rows, S* sums)
+        {
+            for (size_t i = 0; i < stride; ++i)
+                sums[i] = rows[i];
+            for (int r = 1; r < n_rows; ++r)
+            {
+                const uint8_t* row = rows + r * stride;
+                for (size_t i = 0; i < stride; ++i)
+                    sums[i] = S(sums[i] + row[i]);
+            }
+        }
+
+        // All boxes SPAN columns wide
+        template<int BPP, int SPAN, typename S, typename R>
+        void box_columns(const S* sums, int n_rows, int width_out, uint8_t* out)
+        {
+            uint32_t const area = uint32_t(SPAN * n_rows);
+            uint32_t const half = area / 2;
+            R const rcp = reciprocal<R>(area);
+            int const shift = reciprocal_shift<R>();
+            for (int x = 0; x < width_out; ++x)
+                for (int c = 0; c < BPP; ++c)
+                {
+                    R sum = half;
+                    for (int k = 0; k < SPAN; ++k)
+                        sum += sums[(x * SPAN + k) * BPP + c];
+                    out[x * BPP + c] = uint8_t((sum * rcp) >> shift);
+                }
+        }
+
+        // The columns of each output pixel: its first one, and its width less the narrowest one's
+        template<int BPP, typename S, typename R>
+        void box_columns(const S* sums, int n_rows, const int32_t* columns, int min_span, int width_out, uint8_t* out)
+        {
+            uint32_t const areas[] = { uint32_t(min_span * n_rows), uint32_t((min_span + 1) * n_rows) };
+            R const reciprocals[] = { reciprocal<R>(areas[0]), reciprocal<R>(areas[1]) };
+            int const shift = reciprocal_shift<R>();
+            for (int x = 0; x < width_out; ++x, out += BPP)
+            {
+                const S* in = sums + columns[2 * x] * BPP;
+                int const wider = columns[2 * x + 1];
+                int const span = min_span + wider;
+                for (int c = 0; c < BPP; ++c)
+                {
+                    R sum = areas[wider] / 2;
+                    for (int k = 0; k < span; ++k)
+                        sum += in[k * BPP + c];
+                    out[c] = uint8_t((sum * reciprocals[wider]) >> shift);
+                }
+            }
+        }
+
+        template<int BPP, typename S, typename R>
+        void box_columns(const S* sums, int n_rows, const int32_t* columns, int min_span, bool uniform, int width_out,
+                         uint8_t* out)
+        {
+            if (uniform && min_span == 2)
+                box_columns<BPP, 2, S, R>(sums, n_rows, width_out, out);
+            else if (uniform && min_span == 3)
+                box_columns<BPP, 3, S, R>(sums, n_rows, width_out, out);
+            else if (uniform && min_span == 4)
+                box_columns<BPP, 4, S, R>(sums, n_rows, width_out, out);
+            else
+                box_columns<BPP, S, R>(sums, n_rows, columns, min_span, width_out, out);
+        }
+
+        // The kernels for the current SIMD level
+        struct resize_kernels
+        {
+            void (*blend_rows)(const uint8_t*, const uint8_t*, int, size_t, uint16_t*);
+            void (*box_columns)(const uint16_t*, int, int, int, int, uint8_t*);
+            void (*bilinear_columns)(const uint16_t*, int, const int32_t*, int, uint8_t*);
+        };
+
+        // The boxes of an output row: the rows summed first, then the columns
+        template<int BPP>
+        void box_row(const resize_kernels& kernels, const uint8_t* rows, size_t stride, int n_rows, void* sums,
+                     const int32_t* columns, int min_span, bool uniform, int width_out, uint8_t* out)
+        {
+            // 16-bit sums are enough for up to 257 rows
+            if (n_rows <= 257)
+            {
+                auto s16 = static_cast<uint16_t*>(sums);
+                sum_rows(rows, stride, n_rows, s16);
+                if (uniform && min_span <= 4 && min_span * n_rows <= 256)
+                    kernels.box_columns(s16, BPP, min_span, n_rows, width_out, out);
+                else if ((min_span + 1) * n_rows <= 256)
+                    box_columns<BPP, uint16_t, uint32_t>(s16, n_rows, columns, min_span, uniform, width_out, out);
+                else
+                    box_columns<BPP, uint16_t, uint64_t>(s16, n_rows, columns, min_span, uniform, width_out, out);
+            }
+            else
+            {
+                auto s32 = static_cast<uint32_t*>(sums);
+                sum_rows(rows, stride, n_rows, s32);
+                box_columns<BPP, uint32_t, uint64_t>(s32, n_rows, columns, min_span, uniform, width_out, out);
+            }
+        }
+
+        template<int BPP>
+        void resize_rows(const resize_kernels& kernels, const resize_color_params& p, std::vector<uint8_t>& buffer,
+                         int group, int strip, int first_out, int end_out)
+        {
+            int const w_in = p.width_in, h_in = p.height_in, w_out = p.width_out, h_out = p.height_out;
+            size_t const stride = size_t(w_in) * BPP;
+            bool const box = p.filter != rf_bilinear;
+
+            // Input rows a strip may need: those of its output rows, one more to interpolate, and rounded out to
+            // whole groups
+            int const max_rows = std::min(h_in, int(int64_t(strip) * ((h_in + h_out - 1) / h_out)) + 2 + 2 * group);
+            size_t const columns_size = (size_t(w_out) * 2 * sizeof(int32_t) + 15) & ~size_t(15);
+            // With room past the end for the SIMD kernels' reads (see resize-color-kernels.h)
+            size_t const sums_size = (stride * sizeof(uint32_t) + 64 + 15) & ~size_t(15);
+            size_t const size = columns_size + sums_size + max_rows * stride;
+            if (buffer.size() < size)
+                buffer.resize(size);
+            auto columns = reinterpret_cast<int32_t*>(buffer.data());
+            auto sums = buffer.data() + columns_size;
+            auto rows = buffer.data() + columns_size + sums_size;
+
+            int const min_span = std::max(1, w_in / w_out);
+            bool const uniform = w_in % w_out == 0;
+            for (int x = 0; x < w_out; ++x)
+            {
+                if (box)
+                {
+                    columns[2 * x] = box_first(x, w_in, w_out);
+                    columns[2 * x + 1] = box_end(x, w_in, w_out) - columns[2 * x] - min_span;
+                }
+                else
+                {
+                    int const t = bilinear_position(x, w_in, w_out);
+                    columns[2 * x] = t >> 8;
+                    columns[2 * x + 1] = t & 255;
+                }
+            }
+
+            for (int y0 = first_out; y0 < end_out; y0 += strip)
+            {
+                int const y1 = std::min(end_out, y0 + strip);
+                int first, end;
+                if (box)
+                {
+                    first = box_first(y0, h_in, h_out);
+                    end = box_end(y1 - 1, h_in, h_out);
+                }
+                else
+                {
+                    first = bilinear_position(y0, h_in, h_out) >> 8;
+                    end = std::min(h_in - 1, (bilinear_position(y1 - 1, h_in, h_out) >> 8) + 1) + 1;
+                }
+                first = first / group * group;
+                end = std::min(h_in, (end + group - 1) / group * group);
+                convert_rows(p, first, end - first, rows);
+
+                for (int y = y0; y < y1; ++y)
+                {
+                    uint8_t* out = p.out + size_t(y) * w_out * BPP;
+                    if (box)
+                    {
+                        int const r0 = box_first(y, h_in, h_out);
+                        int const n_rows = box_end(y, h_in, h_out) - r0;
+                        box_row<BPP>(kernels, rows + (r0 - first) * stride, stride, n_rows, sums, columns, min_span,
+                                     uniform, w_out, out);
+                    }
+                    else
+                    {
+                        int const t = bilinear_position(y, h_in, h_out);
+                        int const r0 = t >> 8;
+                        int const r1 = std::min(r0 + 1, h_in - 1);
+                        auto blend = reinterpret_cast<uint16_t*>(sums);
+                        kernels.blend_rows(rows + (r0 - first) * stride, rows + (r1 - first) * stride, t & 255,
+                                           stride, blend);
+                        kernels.bilinear_columns(blend, BPP, columns, w_out, out);
+                    }
+                }
+            }
+        }
+    }
+
+    void resize_blend_rows_generic(const uint8_t* top, const uint8_t* bottom, int weight, size_t n, uint16_t* blend)
+    {
+        for (size_t i = 0; i < n; ++i)
+            blend[i] = uint16_t(top[i] * (256 - weight) + bottom[i] * weight);
+    }
+
+    void resize_box_columns_generic(const uint16_t* sums, int bpp, int span, int n_rows, int width_out, uint8_t* out)
+    {
+        typedef void (*box_fn)(const uint16_t*, int, int, uint8_t*);
+        static box_fn const boxes[2][4] = {
+            { box_columns<3, 1, uint16_t, uint32_t>, box_columns<3, 2, uint16_t, uint32_t>,
+              box_columns<3, 3, uint16_t, uint32_t>, box_columns<3, 4, uint16_t, uint32_t> },
+            { box_columns<4, 1, uint16_t, uint32_t>, box_columns<4, 2, uint16_t, uint32_t>,
+              box_columns<4, 3, uint16_t, uint32_t>, box_columns<4, 4, uint16_t, uint32_t> } };
+        boxes[bpp == 4][span - 1](sums, n_rows, width_out, out);
+    }
+
+    void resize_bilinear_columns_generic(const uint16_t* blend, int bpp, const int32_t* columns, int width_out,
+                                         uint8_t* out)
+    {
+        for (int x = 0; x < width_out; ++x, out += bpp)
+        {
+            int const x0 = columns[2 * x];
+            uint32_t const w1 = uint32_t(columns[2 * x + 1]);
+            uint32_t const w0 = 256 - w1;
+            int const x1 = w1 ? x0 + 1 : x0;
+            for (int c = 0; c < bpp; ++c)
+                out[c] = uint8_t((blend[x0 * bpp + c] * w0 + blend[x1 * bpp + c] * w1 + 32768) >> 16);
+        }
+    }
+
+    void resize_color(row_bands& bands, std::vector<std::vector<uint8_t>>& buffers, const resize_color_params& params)
+    {
+        typedef decltype(resize_kernels::blend_rows) blend_rows_fn;
+        typedef decltype(resize_kernels::box_columns) box_columns_fn;
+        typedef decltype(resize_kernels::bilinear_columns) bilinear_columns_fn;
+        static simd_kernel<blend_rows_fn> const blend_rows_kernel = simd_kernel<blend_rows_fn>(resize_blend_rows_generic)
+#ifdef RS2_USE_X86_SIMD
+            .add(RS2_SIMD_LEVEL_AVX2, resize_blend_rows_avx2)
+#endif
+            ;
+        static simd_kernel<box_columns_fn> const box_columns_kernel = simd_kernel<box_columns_fn>(resize_box_columns_generic)
+#ifdef RS2_USE_X86_SIMD
+            .add(RS2_SIMD_LEVEL_SSSE3, resize_box_columns_sse)
+#endif
+            ;
+        static simd_kernel<bilinear_columns_fn> const bilinear_columns_kernel
+            = simd_kernel<bilinear_columns_fn>(resize_bilinear_columns_generic)
+#ifdef RS2_USE_X86_SIMD
+            .add(RS2_SIMD_LEVEL_SSSE3, resize_bilinear_columns_sse)
+#endif
+            ;
+        resize_kernels const kernels = { blend_rows_kernel.get(), box_columns_kernel.get(),
+                                         bilinear_columns_kernel.get() };
+
+        int const group = group_rows(params.source_format, params.width_in, params.height_in);
+        int strip, n_bands;
+        if (group == params.height_in)
+        {
+            // Converted all at once
+            strip = params.height_out;
+            n_bands = 1;
+        }
+        else
+        {
+            strip = std::max(1, int(int64_t(std::max(STRIP_ROWS, group)) * params.height_out / params.height_in));
+            n_bands = int(std::min(bands.get_max_bands(), size_t((params.height_out + strip - 1) / strip)));
+        }
+        if (buffers.size() < size_t(n_bands))
+            buffers.resize(n_bands);
+
+        auto const bpp = get_image_bpp(params.target_format) / 8;
+        bands.run(n_bands, 1, [&](size_t band, size_t)
+        {
+            // Bands of whole strips, so they convert no more rows than needed
+            int const n_strips = (params.height_out + strip - 1) / strip;
+            int const first = int(band * n_strips / n_bands) * strip;
+            int const end = std::min(params.height_out, int((band + 1) * n_strips / n_bands) * strip);
+            if (bpp == 4)
+                resize_rows<4>(kernels, params, buffers[band], group, strip, first, end);
+            else
+                resize_rows<3>(kernels, params, buffers[band], group, strip, first, end);
+        });
+    }
+}
@@ -0,0 +1,79 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include "synthetic-stream.h"
+#include "row-bands.h"
+
+#include <map>
+#include <tuple>
+#include <vector>
+
+namespace librealsense
+{
+    enum resize_filter_types : uint8_t
+    {
+        rf_box,         // the mean of the input pixels each output pixel covers
+        rf_bilinear,    // interpolated between the four input pixels nearest each output pixel's center
+        rf_max_value
+    };
+
+    // Converts YUYV, UYVY, M420 and Y411 color frames to RGB8, BGR8, RGBA8 or BGRA8 (only RGB8 from Y411) at a lower
+    // resolution, in one pass: a few rows at a time are converted, at full resolution, into a buffer that stays in
+    // the cache, and resized from there. The output is either the input divided by RS2_OPTION_FILTER_MAGNITUDE, or
+    // RS2_OPTION_RESIZE_WIDTH x RS2_OPTION_RESIZE_HEIGHT.
+    class resizing_color_converter : public stream_filter_processing_block
+    {
+    public:
+        resizing_color_converter(rs2_format target_format = RS2_FORMAT_RGB8);
+
+    protected:
+        bool should_process(const rs2::frame& frame) override;
+        rs2::frame process_frame(const rs2::frame_source& source, const rs2::frame& f) override;
+
+    private:
+        void update_output_profile(const rs2::frame& f);
+
+        rs2_format              _target_format;
+        int                     _target_bpp;
+        uint8_t                 _control_magnitude;     // the options, as set
+        int                     _control_width;
+        int                     _control_height;
+        uint8_t                 _control_filter;
+        uint8_t                 _magnitude;             // the options, as applied: only while processing no frame
+        int                     _requested_width;
+        int                     _requested_height;
+        uint8_t                 _filter;
+        int                     _width;                 // of the output
+        int                     _height;
+        rs2::stream_profile     _source_stream_profile;
+        rs2::stream_profile     _target_stream_profile;
+        std::map<std::tuple<const rs2_stream_profile*, int, int>, rs2::stream_profile> _registered_profiles;
+        bool                    _options_changed;
+        row_bands               _bands;
+        std::vector<std::vector<uint8_t>> _buffers;
+    };
+
+    struct resize_color_params
+    {
+        rs2_format source_format;   // YUYV, UYVY, M420 or Y411
+        rs2_format target_format;   // RGB8, BGR8, RGBA8 or BGRA8; only RGB8 from Y411
+        uint8_t filter;             // resize_filter_types
+        const uint8_t* in;
+        int width_in;               // as the converters need it: a multiple of 16 for M420 and Y411, and the whole
+        int height_in;              // frame a multiple of 16 pixels
+        uint8_t* out;
+        int width_out;              // up to width_in
+        int height_out;             // up to height_in
+    };
+
+    // Convert and resize a whole frame, in row bands run in parallel. Each band works in a buffer of its own, kept
+    // between frames in 'buffers', so they need not be allocated again.
+    // Box: the output pixel x covers input columns [x * width_in / width_out, (x + 1) * width_in / width_out), at
+    // least one, and likewise for rows; the mean is rounded to nearest.
+    // Bilinear: the output pixel x has its center at (x + 0.5) * width_in / width_out - 0.5 in the input, clamped
+    // to the input and rounded to 1/256 of a pixel, and likewise for rows. The two rows are blended first, to 16
+    // bits, then the two columns, rounded to nearest.
+    void resize_color(row_bands& bands, std::vector<std::vector<uint8_t>>& buffers, const resize_color_params& params);
+}
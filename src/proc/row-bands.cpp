@@ -0,0 +1,118 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "row-bands.h"
+
+#include <algorithm>
+#include <atomic>
+
+
+namespace librealsense {
+
+
+// Past a few threads, memory bandwidth rather than the CPU limits most kernels; more just adds idle threads
+static size_t const MAX_AUTO_BANDS = 8;
+
+
+struct row_bands::job
+{
+    std::function< void( size_t, size_t ) > const * fn;
+    size_t rows;
+    size_t n_bands;
+    std::atomic< size_t > next_band{ 0 };
+    size_t n_done = 0;   // under _mutex
+    size_t n_active = 0; // workers using the job; under _mutex
+};
+
+
+row_bands::row_bands( size_t max_bands )
+    : _max_bands( max_bands ? max_bands
+                            : std::max( size_t( 1 ), std::min( MAX_AUTO_BANDS, size_t( std::thread::hardware_concurrency() ) ) ) )
+{
+}
+
+
+row_bands::~row_bands()
+{
+    {
+        std::lock_guard< std::mutex > lock( _mutex );
+        _stopping = true;
+    }
+    _cv.notify_all();
+    for( auto & thread : _threads )
+        thread.join();
+}
+
+
+void row_bands::run( size_t rows, size_t min_rows, std::function< void( size_t, size_t ) > const & fn )
+{
+    size_t const n_bands = std::min( _max_bands, rows / std::max( size_t( 1 ), min_rows ) );
+    if( n_bands <= 1 )
+    {
+        fn( 0, rows );
+        return;
+    }
+
+    std::lock_guard< std::mutex > serialize( _run_mutex );
+    job j;
+    j.fn = &fn;
+    j.rows = rows;
+    j.n_bands = n_bands;
+    {
+        std::lock_guard< std::mutex > lock( _mutex );
+        while( _threads.size() + 1 < n_bands )
+            _threads.emplace_back( [this] { worker(); } );
+        _job = &j;
+        ++_generation;
+    }
+    _cv.notify_all();
+
+    work( j );
+
+    // The job lives on our stack: wait until no worker uses it anymore
+    std::unique_lock< std::mutex > lock( _mutex );
+    _cv.wait( lock, [&] { return j.n_done == j.n_bands && ! j.n_active; } );
+    _job = nullptr;
+}
+
+
+void row_bands::work( job & j )
+{
+    while( true )
+    {
+        size_t const band = j.next_band++;
+        if( band >= j.n_bands )
+            break;
+        ( *j.fn )( j.rows * band / j.n_bands, j.rows * ( band + 1 ) / j.n_bands );
+
+        std::lock_guard< std::mutex > lock( _mutex );
+        if( ++j.n_done == j.n_bands )
+            _cv.notify_all();
+    }
+}
+
+
+void row_bands::worker()
+{
+    size_t generation = 0;
+    std::unique_lock< std::mutex > lock( _mutex );
+    while( true )
+    {
+        _cv.wait( lock, [&] { return _stopping || _generation != generation; } );
+        if( _stopping )
+            break;
+        generation = _generation;
+        if( auto j = _job )
+        {
+            ++j->n_active;
+            lock.unlock();
+            work( *j );
+            lock.lock();
+            if( ! --j->n_active )
+                _cv.notify_all();
+        }
+    }
+}
+
+
+}  // namespace librealsense
@@ -0,0 +1,58 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+namespace librealsense {
+
+
+// Runs a per-pixel image kernel over contiguous bands of rows, in parallel: the calling thread does one band while
+// worker threads do the rest. Meant to be owned by a processing block, so the workers (created only when first
+// needed, and waiting idle between frames) go away with it.
+//
+// The kernel must be safe to run on different rows at the same time, and must not throw. Each band gets a thread of
+// its own, so bands may wait for one another (to process rows in a wavefront, say).
+//
+class row_bands
+{
+public:
+    // 0 to use as many bands as there are CPUs, up to a limit
+    explicit row_bands( size_t max_bands = 0 );
+    ~row_bands();
+
+    row_bands( row_bands const & ) = delete;
+    row_bands & operator=( row_bands const & ) = delete;
+
+    size_t get_max_bands() const { return _max_bands; }
+
+    // Calls fn( first_row, end_row ) for bands covering [0, rows), each at least min_rows long unless there are fewer
+    // rows than that. Returns once all bands are done.
+    void run( size_t rows, size_t min_rows, std::function< void( size_t first_row, size_t end_row ) > const & fn );
+
+private:
+    struct job;
+
+    void work( job & );
+    void worker();
+
+    size_t const _max_bands;
+    std::mutex _run_mutex;  // one run() at a time
+
+    std::mutex _mutex;
+    std::condition_variable _cv;
+    job * _job = nullptr;
+    size_t _generation = 0;
+    bool _stopping = false;
+    std::vector< std::thread > _threads;
+};
+
+
+}  // namespace librealsense
@@ -0,0 +1,96 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include <librealsense2/hpp/rs_sensor.hpp>
+#include <librealsense2/hpp/rs_processing.hpp>
+
+#include "core/video-frame.h"
+#include "proc/synthetic-stream.h"
+#include "rvl-codec.h"
+
+#include <rsutils/codec/rvl.h>
+#include <rsutils/string/from.h>
+
+namespace librealsense
+{
+    rvl_encoder::rvl_encoder( unsigned trim_bits )
+        : stream_filter_processing_block( "RVL Encoder" )
+        , _trim_bits( trim_bits )
+    {
+        if( trim_bits > rsutils::codec::rvl_max_trim_bits )
+            throw invalid_value_exception( rsutils::string::from() << "RVL trim bits (" << trim_bits
+                                                                   << ") must be <= "
+                                                                   << rsutils::codec::rvl_max_trim_bits );
+        _stream_filter.format = RS2_FORMAT_Z16;
+        _stream_filter.stream = RS2_STREAM_DEPTH;
+    }
+
+    rs2::frame rvl_encoder::process_frame( const rs2::frame_source & source, const rs2::frame & f )
+    {
+        auto profile = f.get_profile();
+        if( profile.get() != _source_stream_profile.get() )
+        {
+            _source_stream_profile = profile;
+            _target_stream_profile = profile.clone( profile.stream_type(), profile.stream_index(), RS2_FORMAT_Z16RVL );
+        }
+
+        auto vf = f.as< rs2::video_frame >();
+        int const width = vf.get_width();
+        int const height = vf.get_height();
+        size_t const n_pixels = size_t( width ) * height;
+        if( vf.get_stride_in_bytes() != width * 2 )
+            throw invalid_value_exception( "RVL encoder expects contiguous Z16 depth" );
+
+        // The frame is described by its decoded geometry, but only holds the encoded data
+        auto new_f = source.allocate_video_frame( _target_stream_profile, f, 2, width, height, width * 2,
+                                                  RS2_EXTENSION_VIDEO_FRAME );
+        if( ! new_f )
+            return f;
+
+        // Encoded straight into the frame, which has room for the decoded depth and keeps it, to be recycled: only
+        // depth that does not compress (noise) needs more, and goes through a buffer of the worst-case size
+        auto pixels = reinterpret_cast< uint16_t const * >( vf.get_data() );
+        auto ptr = static_cast< librealsense::frame * >( (librealsense::frame_interface *)new_f.get() );
+        auto size = rsutils::codec::rvl_encode( pixels, n_pixels, ptr->data.data(), ptr->data.size(), _trim_bits );
+        if( ! size )
+        {
+            _encoded.resize( rsutils::codec::rvl_max_encoded_size( n_pixels ) );
+            size = rsutils::codec::rvl_encode( pixels, n_pixels, _encoded.data(), _trim_bits );
+            ptr->data.assign( _encoded.begin(), _encoded.begin() + size );
+        }
+        ptr->data_size = size;
+        return new_f;
+    }
+
+    rvl_decoder::rvl_decoder()
+        : stream_filter_processing_block( "RVL Decoder" )
+    {
+        _stream_filter.format = RS2_FORMAT_Z16RVL;
+        _stream_filter.stream = RS2_STREAM_DEPTH;
+    }
+
+    rs2::frame rvl_decoder::process_frame( const rs2::frame_source & source, const rs2::frame & f )
+    {
+        auto profile = f.get_profile();
+        if( profile.get() != _source_stream_profile.get() )
+        {
+            _source_stream_profile = profile;
+            _target_stream_profile = profile.clone( profile.stream_type(), profile.stream_index(), RS2_FORMAT_Z16 );
+        }
+
+        auto vf = f.as< rs2::video_frame >();
+        int const width = vf.get_width();
+        int const height = vf.get_height();
+        auto new_f = source.allocate_video_frame( _target_stream_profile, f, 2, width, height, width * 2,
+                                                  RS2_EXTENSION_DEPTH_FRAME );
+        if( ! new_f )
+            return f;
+
+        auto ptr = (librealsense::frame_interface *)new_f.get();
+        rsutils::codec::rvl_decode( static_cast< uint8_t const * >( f.get_data() ),
+                                    f.get_data_size(),
+                                    (uint16_t *)ptr->get_frame_data(),
+                                    size_t( width ) * height );
+        return new_f;
+    }
+}
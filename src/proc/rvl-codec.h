@@ -0,0 +1,47 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include "synthetic-stream.h"
+
+#include <vector>
+
+namespace rs2
+{
+    class stream_profile;
+}
+
+namespace librealsense
+{
+    // Compresses Z16 depth frames into Z16RVL; see rsutils/codec/rvl.h
+    class rvl_encoder : public stream_filter_processing_block
+    {
+    public:
+        rvl_encoder( unsigned trim_bits = 0 );
+
+    protected:
+        rs2::frame process_frame( const rs2::frame_source & source, const rs2::frame & f ) override;
+
+    private:
+        rs2::stream_profile _target_stream_profile;
+        rs2::stream_profile _source_stream_profile;
+
+        unsigned _trim_bits;
+        std::vector< uint8_t > _encoded;  // only for depth that does not fit in the frame once encoded
+    };
+
+    // Decompresses Z16RVL frames back into Z16 depth frames
+    class rvl_decoder : public stream_filter_processing_block
+    {
+    public:
+        rvl_decoder();
+
+    protected:
+        rs2::frame process_frame( const rs2::frame_source & source, const rs2::frame & f ) override;
+
+    private:
+        rs2::stream_profile _target_stream_profile;
+        rs2::stream_profile _source_stream_profile;
+    };
+}
@@ -0,0 +1,273 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "../decimate-depth.h"
+#include "../decimate-others.h"
+
+#ifdef RS2_USE_X86_SIMD  // compiled for AVX2
+#include <immintrin.h>
+
+namespace librealsense
+{
+    namespace
+    {
+        // The medians of 16 patches at a time: the values of each patch are spread over N registers, one per lane, and
+        // fully sorted by a sorting network; zeros (invalid) sort first, so with z of them the median of the valid
+        // ones (the lower of the two middle ones for an even count) is at index (N - 1 + z) / 2
+
+        inline void sort2(__m256i& a, __m256i& b)
+        {
+            __m256i t = _mm256_min_epu16(a, b);
+            b = _mm256_max_epu16(a, b);
+            a = t;
+        }
+
+        inline __m256i count_zeros(const __m256i* v, int n)
+        {
+            __m256i zero = _mm256_setzero_si256();
+            __m256i zeros = zero;
+            for (int k = 0; k < n; ++k)
+                zeros = _mm256_sub_epi16(zeros, _mm256_cmpeq_epi16(v[k], zero));
+            return zeros;
+        }
+
+        __m256i median4(__m256i v[4])
+        {
+            __m256i zeros = count_zeros(v, 4);
+            sort2(v[0], v[1]); sort2(v[2], v[3]);
+            sort2(v[0], v[2]); sort2(v[1], v[3]);
+            sort2(v[1], v[2]);
+            // (3 + z) / 2: z = 0 -> 1; 1, 2 -> 2; 3, 4 -> 3
+            __m256i result = _mm256_blendv_epi8(v[1], v[2], _mm256_cmpgt_epi16(zeros, _mm256_setzero_si256()));
+            return _mm256_blendv_epi8(result, v[3], _mm256_cmpgt_epi16(zeros, _mm256_set1_epi16(2)));
+        }
+
+        __m256i median9(__m256i v[9])
+        {
+            __m256i zeros = count_zeros(v, 9);
+            sort2(v[0], v[3]); sort2(v[1], v[7]); sort2(v[2], v[5]); sort2(v[4], v[8]);
+            sort2(v[0], v[7]); sort2(v[2], v[4]); sort2(v[3], v[8]); sort2(v[5], v[6]);
+            sort2(v[0], v[2]); sort2(v[1], v[3]); sort2(v[4], v[5]); sort2(v[7], v[8]);
+            sort2(v[1], v[4]); sort2(v[3], v[6]); sort2(v[5], v[7]);
+            sort2(v[0], v[1]); sort2(v[2], v[4]); sort2(v[3], v[5]); sort2(v[6], v[8]);
+            sort2(v[2], v[3]); sort2(v[4], v[5]); sort2(v[6], v[7]);
+            sort2(v[1], v[2]); sort2(v[3], v[4]); sort2(v[5], v[6]);
+            // (8 + z) / 2: z = 0, 1 -> 4; 2, 3 -> 5; 4, 5 -> 6; 6, 7 -> 7; 8, 9 -> 8
+            __m256i result = v[4];
+            for (int i = 1; i <= 4; ++i)
+                result = _mm256_blendv_epi8(result, v[4 + i], _mm256_cmpgt_epi16(zeros, _mm256_set1_epi16(short(2 * i - 1))));
+            return result;
+        }
+
+        // 32 pixels to the 16 even and 16 odd ones
+        inline void deinterleave2(const uint16_t* p, __m256i& even, __m256i& odd)
+        {
+            const __m256i shuffle = _mm256_setr_epi8(0, 1, 4, 5, 8, 9, 12, 13, 2, 3, 6, 7, 10, 11, 14, 15,
+                                                     0, 1, 4, 5, 8, 9, 12, 13, 2, 3, 6, 7, 10, 11, 14, 15);
+            // Each lane is now 4 even then 4 odd pixels; put the even ones of both lanes in the lower half
+            __m256i a = _mm256_permute4x64_epi64(_mm256_shuffle_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)), shuffle),
+                                                 _MM_SHUFFLE(3, 1, 2, 0));
+            __m256i b = _mm256_permute4x64_epi64(_mm256_shuffle_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + 16)), shuffle),
+                                                 _MM_SHUFFLE(3, 1, 2, 0));
+            even = _mm256_permute2x128_si256(a, b, 0x20);
+            odd = _mm256_permute2x128_si256(a, b, 0x31);
+        }
+
+        // 48 pixels to the 16 of each of the 3 columns of the patches
+        inline void deinterleave3(const uint16_t* p, __m256i planes[3])
+        {
+            // Shuffles within each 128-bit lane, which hold 24 consecutive pixels spread over 3 registers: the
+            // lower lanes pixels 0-23, the upper ones 24-47
+            static const int8_t shuffles[3][3][16] = {
+                { { 0, 1, 6, 7, 12, 13, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 },
+                  { -1, -1, -1, -1, -1, -1, 2, 3, 8, 9, 14, 15, -1, -1, -1, -1 },
+                  { -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 4, 5, 10, 11 } },
+                { { 2, 3, 8, 9, 14, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 },
+                  { -1, -1, -1, -1, -1, -1, 4, 5, 10, 11, -1, -1, -1, -1, -1, -1 },
+                  { -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 1, 6, 7, 12, 13 } },
+                { { 4, 5, 10, 11, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 },
+                  { -1, -1, -1, -1, 0, 1, 6, 7, 12, 13, -1, -1, -1, -1, -1, -1 },
+                  { -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 2, 3, 8, 9, 14, 15 } } };
+
+            __m256i r[3];
+            for (int reg = 0; reg < 3; ++reg)
+                r[reg] = _mm256_inserti128_si256(
+                    _mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 8 * reg))),
+                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 24 + 8 * reg)), 1);
+            for (int k = 0; k < 3; ++k)
+            {
+                __m256i plane = _mm256_setzero_si256();
+                for (int reg = 0; reg < 3; ++reg)
+                    plane = _mm256_or_si256(plane, _mm256_shuffle_epi8(r[reg], _mm256_broadcastsi128_si256(
+                        _mm_loadu_si128(reinterpret_cast<const __m128i*>(shuffles[k][reg])))));
+                planes[k] = plane;
+            }
+        }
+
+        // 16 output pixels from the patches starting at each of the rows
+        __m256i median_pass(const uint16_t* const rows[], size_t scale)
+        {
+            if (scale == 2)
+            {
+                __m256i v[4];
+                deinterleave2(rows[0], v[0], v[1]);
+                deinterleave2(rows[1], v[2], v[3]);
+                return median4(v);
+            }
+            __m256i v[9];
+            deinterleave3(rows[0], v);
+            deinterleave3(rows[1], v + 3);
+            deinterleave3(rows[2], v + 6);
+            return median9(v);
+        }
+
+        void median_row(const uint16_t* const rows[], size_t scale, uint16_t* out, size_t real_width)
+        {
+            size_t i = 0;
+            for (; i + 16 <= real_width; i += 16)
+            {
+                const uint16_t* patch[3];
+                for (size_t n = 0; n < scale; ++n)
+                    patch[n] = rows[n] + i * scale;
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), median_pass(patch, scale));
+            }
+
+            if (i < real_width)
+            {
+                // The rest, through zero-padded copies
+                uint16_t buffer[3][48] = {};
+                const uint16_t* patch[3];
+                for (size_t n = 0; n < scale; ++n)
+                {
+                    for (size_t x = 0; x < (real_width - i) * scale; ++x)
+                        buffer[n][x] = rows[n][i * scale + x];
+                    patch[n] = buffer[n];
+                }
+                uint16_t result[16];
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(result), median_pass(patch, scale));
+                for (size_t x = 0; i + x < real_width; ++x)
+                    out[i + x] = result[x];
+            }
+        }
+
+        // The sums and valid counts of the columns of 8 patches; then their means, with 32-bit float division (exact
+        // for these magnitudes: a sum under 2^22 by a count up to 64)
+        void mean_row(const uint16_t* const rows[], size_t scale, uint16_t* out, size_t real_width)
+        {
+            size_t i = 0;
+            for (; i + 8 <= real_width; i += 8)
+            {
+                // Column x of the 8 patches is in lane x % 8 of register x / 8
+                __m256i sums[8], zeros[8];
+                for (size_t c = 0; c < scale; ++c)
+                    sums[c] = zeros[c] = _mm256_setzero_si256();
+                for (size_t n = 0; n < scale; ++n)
+                {
+                    const uint16_t* p = rows[n] + i * scale;
+                    for (size_t c = 0; c < scale; ++c)
+                    {
+                        __m256i v = _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 8 * c)));
+                        sums[c] = _mm256_add_epi32(sums[c], v);
+                        zeros[c] = _mm256_sub_epi32(zeros[c], _mm256_cmpeq_epi32(v, _mm256_setzero_si256()));
+                    }
+                }
+
+                alignas(32) uint32_t column_sums[64], column_zeros[64];
+                for (size_t c = 0; c < scale; ++c)
+                {
+                    _mm256_store_si256(reinterpret_cast<__m256i*>(column_sums + 8 * c), sums[c]);
+                    _mm256_store_si256(reinterpret_cast<__m256i*>(column_zeros + 8 * c), zeros[c]);
+                }
+                alignas(32) int32_t patch_sums[8], patch_counts[8];
+                for (size_t x = 0; x < 8; ++x)
+                {
+                    uint32_t sum = 0, n_zeros = 0;
+                    for (size_t m = 0; m < scale; ++m)
+                    {
+                        sum += column_sums[x * scale + m];
+                        n_zeros += column_zeros[x * scale + m];
+                    }
+                    patch_sums[x] = int32_t(sum);
+                    patch_counts[x] = int32_t(scale * scale - n_zeros);
+                }
+
+                __m256i counts = _mm256_load_si256(reinterpret_cast<const __m256i*>(patch_counts));
+                __m256i means = _mm256_cvttps_epi32(_mm256_div_ps(
+                    _mm256_cvtepi32_ps(_mm256_load_si256(reinterpret_cast<const __m256i*>(patch_sums))),
+                    _mm256_cvtepi32_ps(counts)));
+                means = _mm256_andnot_si256(_mm256_cmpeq_epi32(counts, _mm256_setzero_si256()), means);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i),
+                                 _mm_packus_epi32(_mm256_castsi256_si128(means), _mm256_extracti128_si256(means, 1)));
+            }
+
+            for (; i < real_width; ++i)
+            {
+                int sum = 0;
+                int counter = 0;
+                for (size_t n = 0; n < scale; ++n)
+                {
+                    const uint16_t* p = rows[n] + i * scale;
+                    for (size_t m = 0; m < scale; ++m)
+                    {
+                        if (p[m])
+                        {
+                            sum += p[m];
+                            ++counter;
+                        }
+                    }
+                }
+                out[i] = uint16_t(counter == 0 ? 0 : sum / counter);
+            }
+        }
+    }
+
+    void decimate_depth_avx2(const decimate_depth_params& params, size_t first_row, size_t end_row)
+    {
+        for (size_t j = first_row; j < end_row; ++j)
+        {
+            const uint16_t* rows[8];
+            for (size_t n = 0; n < params.scale; ++n)
+                rows[n] = params.in + (j * params.scale + n) * params.width_in;
+            uint16_t* out = params.out + j * params.padded_width;
+
+            if (params.scale == 2 || params.scale == 3)
+                median_row(rows, params.scale, out, params.real_width);
+            else
+                mean_row(rows, params.scale, out, params.real_width);
+
+            for (size_t i = params.real_width; i < params.padded_width; ++i)
+                out[i] = 0;
+        }
+    }
+
+    void sum_columns_avx2(const uint8_t* in, size_t stride, size_t rows, size_t n, uint16_t* sums)
+    {
+        // 16 columns at a time, widened to 16 bits: 8 rows of 255 fit
+        size_t x = 0;
+        for (; x + 16 <= n; x += 16)
+        {
+            __m256i sum = _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in + x)));
+            for (size_t r = 1; r < rows; ++r)
+                sum = _mm256_add_epi16(sum, _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in + r * stride + x))));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(sums + x), sum);
+        }
+        if (x < n)
+            sum_columns_generic(in + x, stride, rows, n - x, sums + x);
+    }
+
+    void sum_columns_avx2(const uint16_t* in, size_t stride, size_t rows, size_t n, uint32_t* sums)
+    {
+        size_t x = 0;
+        for (; x + 8 <= n; x += 8)
+        {
+            __m256i sum = _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in + x)));
+            for (size_t r = 1; r < rows; ++r)
+                sum = _mm256_add_epi32(sum, _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in + r * stride + x))));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(sums + x), sum);
+        }
+        if (x < n)
+            sum_columns_generic(in + x, stride, rows, n - x, sums + x);
+    }
+}
+
+#endif
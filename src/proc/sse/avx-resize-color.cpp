@@ -0,0 +1,28 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "../resize-color-kernels.h"
+
+#ifdef RS2_USE_X86_SIMD  // compiled for AVX2
+#include <immintrin.h>
+
+namespace librealsense
+{
+    void resize_blend_rows_avx2(const uint8_t* top, const uint8_t* bottom, int weight, size_t n, uint16_t* blend)
+    {
+        __m256i const w0 = _mm256_set1_epi16(short(256 - weight));
+        __m256i const w1 = _mm256_set1_epi16(short(weight));
+        size_t i = 0;
+        for (; i + 16 <= n; i += 16)
+        {
+            __m256i t = _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(top + i)));
+            __m256i b = _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(bottom + i)));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(blend + i),
+                                _mm256_add_epi16(_mm256_mullo_epi16(t, w0), _mm256_mullo_epi16(b, w1)));
+        }
+        for (; i < n; ++i)
+            blend[i] = uint16_t(top[i] * (256 - weight) + bottom[i] * weight);
+    }
+}
+
+#endif
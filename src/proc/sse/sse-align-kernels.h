@@ -0,0 +1,24 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2019 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <librealsense2/h/rs_sensor.h>
+#include <cstdint>
+
+namespace librealsense
+{
+    // The SSSE3 part of align_sse: projects 'size' depth pixels, along their precomputed (undistorted) rays, into the
+    // other stream. Writes the pixel each lands on, rounded, as two int32 (x, y), or (0, 0) where there's no depth.
+    // Only RS2_DISTORTION_MODIFIED_BROWN_CONRADY is applied; any other 'model' is taken as no distortion.
+    // 'size' must be a multiple of 8, and all buffers 16-byte aligned.
+    void project_depth_to_other_sse( const uint16_t * depth,
+                                     float depth_scale,
+                                     unsigned int size,
+                                     const float * pre_compute_x,
+                                     const float * pre_compute_y,
+                                     int32_t * pixels,
+                                     const rs2_intrinsics & to,
+                                     rs2_distortion model,
+                                     const rs2_extrinsics & from_to_other );
+}
@@ -1,9 +1,9 @@
 // License: Apache 2.0. See LICENSE file in root directory.
 // Copyright(c) 2019 Intel Corporation. All Rights Reserved.
-#ifdef __SSSE3__
+#ifdef RS2_USE_X86_SIMD
 
 #include "sse-align.h"
-#include <tmmintrin.h> // For SSE3 intrinsic used in unpack_yuy2_sse
+#include "sse-align-kernels.h"
 #include "../include/librealsense2/hpp/rs_sensor.hpp"
 #include "../include/librealsense2/hpp/rs_processing.hpp"
 
@@ -24,175 +24,6 @@ bool is_special_resolution(const rs2_intrinsics& depth, const rs2_intrinsics& to
     return false;
 }
 
-template<rs2_distortion dist>
-inline void distorte_x_y(const __m128 & x, const __m128 & y, __m128 * distorted_x, __m128 * distorted_y, const rs2_intrinsics& to)
-{
-    *distorted_x = x;
-    *distorted_y = y;
-}
-template<>
-inline void distorte_x_y<RS2_DISTORTION_MODIFIED_BROWN_CONRADY>(const __m128& x, const __m128& y, __m128* distorted_x, __m128* distorted_y, const rs2_intrinsics& to)
-{
-    __m128 c[5];
-    auto one = _mm_set_ps1(1);
-    auto two = _mm_set_ps1(2);
-
-    for (int i = 0; i < 5; ++i)
-    {
-        c[i] = _mm_set_ps1(to.coeffs[i]);
-    }
-    auto r2_0 = _mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y));
-    auto r3_0 = _mm_add_ps(_mm_mul_ps(c[1], _mm_mul_ps(r2_0, r2_0)), _mm_mul_ps(c[4], _mm_mul_ps(r2_0, _mm_mul_ps(r2_0, r2_0))));
-    auto f_0 = _mm_add_ps(one, _mm_add_ps(_mm_mul_ps(c[0], r2_0), r3_0));
-
-    auto x_f0 = _mm_mul_ps(x, f_0);
-    auto y_f0 = _mm_mul_ps(y, f_0);
-
-    auto r4_0 = _mm_mul_ps(c[3], _mm_add_ps(r2_0, _mm_mul_ps(two, _mm_mul_ps(x_f0, x_f0))));
-    auto d_x0 = _mm_add_ps(x_f0, _mm_add_ps(_mm_mul_ps(two, _mm_mul_ps(c[2], _mm_mul_ps(x_f0, y_f0))), r4_0));
-
-    auto r5_0 = _mm_mul_ps(c[2], _mm_add_ps(r2_0, _mm_mul_ps(two, _mm_mul_ps(y_f0, y_f0))));
-    auto d_y0 = _mm_add_ps(y_f0, _mm_add_ps(_mm_mul_ps(two, _mm_mul_ps(c[3], _mm_mul_ps(x_f0, y_f0))), r4_0));
-
-    *distorted_x = d_x0;
-    *distorted_y = d_y0;
-}
-
-
-template<rs2_distortion dist>
-inline void get_texture_map_sse(const uint16_t * depth,
-    float depth_scale,
-    const unsigned int size,
-    const float * pre_compute_x, const float * pre_compute_y,
-    uint8_t * pixels_ptr_int,
-    const rs2_intrinsics& to,
-    const rs2_extrinsics& from_to_other)
-{
-    //mask for shuffle
-    const __m128i mask0 = _mm_set_epi8((char)0xff, (char)0xff, (char)7, (char)6, (char)0xff, (char)0xff, (char)5, (char)4,
-        (char)0xff, (char)0xff, (char)3, (char)2, (char)0xff, (char)0xff, (char)1, (char)0);
-    const __m128i mask1 = _mm_set_epi8((char)0xff, (char)0xff, (char)15, (char)14, (char)0xff, (char)0xff, (char)13, (char)12,
-        (char)0xff, (char)0xff, (char)11, (char)10, (char)0xff, (char)0xff, (char)9, (char)8);
-
-    auto scale = _mm_set_ps1(depth_scale);
-
-    auto mapx = pre_compute_x;
-    auto mapy = pre_compute_y;
-
-    auto res = reinterpret_cast<__m128i*>(pixels_ptr_int);
-
-    __m128 r[9];
-    __m128 t[3];
-    __m128 c[5];
-
-    for (int i = 0; i < 9; ++i)
-    {
-        r[i] = _mm_set_ps1(from_to_other.rotation[i]);
-    }
-    for (int i = 0; i < 3; ++i)
-    {
-        t[i] = _mm_set_ps1(from_to_other.translation[i]);
-    }
-    for (int i = 0; i < 5; ++i)
-    {
-        c[i] = _mm_set_ps1(to.coeffs[i]);
-    }
-    auto zero = _mm_set_ps1(0);
-    auto fx = _mm_set_ps1(to.fx);
-    auto fy = _mm_set_ps1(to.fy);
-    auto ppx = _mm_set_ps1(to.ppx);
-    auto ppy = _mm_set_ps1(to.ppy);
-
-    for (unsigned int i = 0; i < size; i += 8)
-    {
-        auto x0 = _mm_load_ps(mapx + i);
-        auto x1 = _mm_load_ps(mapx + i + 4);
-
-        auto y0 = _mm_load_ps(mapy + i);
-        auto y1 = _mm_load_ps(mapy + i + 4);
-
-
-        __m128i d = _mm_load_si128((__m128i const*)(depth + i));        //d7 d7 d6 d6 d5 d5 d4 d4 d3 d3 d2 d2 d1 d1 d0 d0
-
-                                                                        //split the depth pixel to 2 registers of 4 floats each
-        __m128i d0 = _mm_shuffle_epi8(d, mask0);        // 00 00 d3 d3 00 00 d2 d2 00 00 d1 d1 00 00 d0 d0
-        __m128i d1 = _mm_shuffle_epi8(d, mask1);        // 00 00 d7 d7 00 00 d6 d6 00 00 d5 d5 00 00 d4 d4
-
-        __m128 depth0 = _mm_cvtepi32_ps(d0); //convert depth to float
-        __m128 depth1 = _mm_cvtepi32_ps(d1); //convert depth to float
-
-        depth0 = _mm_mul_ps(depth0, scale);
-        depth1 = _mm_mul_ps(depth1, scale);
-
-        auto p0x = _mm_mul_ps(depth0, x0);
-        auto p0y = _mm_mul_ps(depth0, y0);
-
-        auto p1x = _mm_mul_ps(depth1, x1);
-        auto p1y = _mm_mul_ps(depth1, y1);
-
-        auto p_x0 = _mm_add_ps(_mm_mul_ps(r[0], p0x), _mm_add_ps(_mm_mul_ps(r[3], p0y), _mm_add_ps(_mm_mul_ps(r[6], depth0), t[0])));
-        auto p_y0 = _mm_add_ps(_mm_mul_ps(r[1], p0x), _mm_add_ps(_mm_mul_ps(r[4], p0y), _mm_add_ps(_mm_mul_ps(r[7], depth0), t[1])));
-        auto p_z0 = _mm_add_ps(_mm_mul_ps(r[2], p0x), _mm_add_ps(_mm_mul_ps(r[5], p0y), _mm_add_ps(_mm_mul_ps(r[8], depth0), t[2])));
-
-        auto p_x1 = _mm_add_ps(_mm_mul_ps(r[0], p1x), _mm_add_ps(_mm_mul_ps(r[3], p1y), _mm_add_ps(_mm_mul_ps(r[6], depth1), t[0])));
-        auto p_y1 = _mm_add_ps(_mm_mul_ps(r[1], p1x), _mm_add_ps(_mm_mul_ps(r[4], p1y), _mm_add_ps(_mm_mul_ps(r[7], depth1), t[1])));
-        auto p_z1 = _mm_add_ps(_mm_mul_ps(r[2], p1x), _mm_add_ps(_mm_mul_ps(r[5], p1y), _mm_add_ps(_mm_mul_ps(r[8], depth1), t[2])));
-
-        p_x0 = _mm_div_ps(p_x0, p_z0);
-        p_y0 = _mm_div_ps(p_y0, p_z0);
-
-        p_x1 = _mm_div_ps(p_x1, p_z1);
-        p_y1 = _mm_div_ps(p_y1, p_z1);
-
-        distorte_x_y<dist>(p_x0, p_y0, &p_x0, &p_y0, to);
-        distorte_x_y<dist>(p_x1, p_y1, &p_x1, &p_y1, to);
-
-        //zero the x and y if z is zero
-        auto cmp = _mm_cmpneq_ps(depth0, zero);
-        p_x0 = _mm_and_ps(_mm_add_ps(_mm_mul_ps(p_x0, fx), ppx), cmp);
-        p_y0 = _mm_and_ps(_mm_add_ps(_mm_mul_ps(p_y0, fy), ppy), cmp);
-
-
-        p_x1 = _mm_add_ps(_mm_mul_ps(p_x1, fx), ppx);
-        p_y1 = _mm_add_ps(_mm_mul_ps(p_y1, fy), ppy);
-
-        cmp = _mm_cmpneq_ps(depth0, zero);
-        auto half = _mm_set_ps1(0.5);
-        auto u_round0 = _mm_and_ps(_mm_add_ps(p_x0, half), cmp);
-        auto v_round0 = _mm_and_ps(_mm_add_ps(p_y0, half), cmp);
-
-        auto uuvv1_0 = _mm_shuffle_ps(u_round0, v_round0, _MM_SHUFFLE(1, 0, 1, 0));
-        auto uuvv2_0 = _mm_shuffle_ps(u_round0, v_round0, _MM_SHUFFLE(3, 2, 3, 2));
-
-        auto res1_0 = _mm_shuffle_ps(uuvv1_0, uuvv1_0, _MM_SHUFFLE(3, 1, 2, 0));
-        auto res2_0 = _mm_shuffle_ps(uuvv2_0, uuvv2_0, _MM_SHUFFLE(3, 1, 2, 0));
-
-        auto res1_int0 = _mm_cvtps_epi32(res1_0);
-        auto res2_int0 = _mm_cvtps_epi32(res2_0);
-
-        _mm_stream_si128(&res[0], res1_int0);
-        _mm_stream_si128(&res[1], res2_int0);
-        res += 2;
-
-        cmp = _mm_cmpneq_ps(depth1, zero);
-        auto u_round1 = _mm_and_ps(_mm_add_ps(p_x1, half), cmp);
-        auto v_round1 = _mm_and_ps(_mm_add_ps(p_y1, half), cmp);
-
-        auto uuvv1_1 = _mm_shuffle_ps(u_round1, v_round1, _MM_SHUFFLE(1, 0, 1, 0));
-        auto uuvv2_1 = _mm_shuffle_ps(u_round1, v_round1, _MM_SHUFFLE(3, 2, 3, 2));
-
-        auto res1 = _mm_shuffle_ps(uuvv1_1, uuvv1_1, _MM_SHUFFLE(3, 1, 2, 0));
-        auto res2 = _mm_shuffle_ps(uuvv2_1, uuvv2_1, _MM_SHUFFLE(3, 1, 2, 0));
-
-        auto res1_int1 = _mm_cvtps_epi32(res1);
-        auto res2_int1 = _mm_cvtps_epi32(res2);
-
-        _mm_stream_si128(&res[0], res1_int1);
-        _mm_stream_si128(&res[1], res2_int1);
-        res += 2;
-    }
-}
-
 image_transform::image_transform(const rs2_intrinsics& from, float depth_scale)
     :_depth(from),
     _depth_scale(depth_scale),
@@ -242,15 +73,7 @@ void image_transform::pre_compute_x_y_map(std::vector<float>& pre_compute_map_x,
 void image_transform::align_depth_to_other(const uint16_t* z_pixels, uint16_t* dest, int bpp, const rs2_intrinsics& depth, const rs2_intrinsics& to,
     const rs2_extrinsics& from_to_other)
 {
-    switch (to.model)
-    {
-    case RS2_DISTORTION_MODIFIED_BROWN_CONRADY:
-        align_depth_to_other_sse<RS2_DISTORTION_MODIFIED_BROWN_CONRADY>(z_pixels, dest, depth, to, from_to_other);
-        break;
-    default:
-        align_depth_to_other_sse(z_pixels, dest, depth, to, from_to_other);
-        break;
-    }
+    align_depth_to_other_sse(z_pixels, dest, depth, to, to.model, from_to_other);
 }
 
 inline void image_transform::move_depth_to_other(const uint16_t* z_pixels, uint16_t* dest, const rs2_intrinsics& to,
@@ -284,25 +107,16 @@ inline void image_transform::move_depth_to_other(const uint16_t* z_pixels, uint1
 void image_transform::align_other_to_depth(const uint16_t* z_pixels, const uint8_t * source, uint8_t * dest, int bpp, const rs2_intrinsics& to,
     const rs2_extrinsics& from_to_other)
 {
-    switch (to.model)
-    {
-    case RS2_DISTORTION_MODIFIED_BROWN_CONRADY:
-    case RS2_DISTORTION_INVERSE_BROWN_CONRADY:
-        align_other_to_depth_sse<RS2_DISTORTION_MODIFIED_BROWN_CONRADY>(z_pixels, source, dest, bpp, to, from_to_other);
-        break;
-    default:
-        align_other_to_depth_sse(z_pixels, source, dest, bpp, to, from_to_other);
-        break;
-    }
+    auto const model = to.model == RS2_DISTORTION_INVERSE_BROWN_CONRADY ? RS2_DISTORTION_MODIFIED_BROWN_CONRADY : to.model;
+    align_other_to_depth_sse(z_pixels, source, dest, bpp, to, model, from_to_other);
 }
 
 
-template<rs2_distortion dist>
 inline void image_transform::align_depth_to_other_sse(const uint16_t * z_pixels, uint16_t * dest, const rs2_intrinsics& depth, const rs2_intrinsics& to,
-    const rs2_extrinsics& from_to_other)
+    rs2_distortion model, const rs2_extrinsics& from_to_other)
 {
-    get_texture_map_sse<dist>(z_pixels, _depth_scale, _depth.height*_depth.width, _pre_compute_map_x_top_left.data(),
-        _pre_compute_map_y_top_left.data(), (uint8_t *)_pixel_top_left_int.data(), to, from_to_other);
+    project_depth_to_other_sse(z_pixels, _depth_scale, _depth.height*_depth.width, _pre_compute_map_x_top_left.data(),
+        _pre_compute_map_y_top_left.data(), (int32_t *)_pixel_top_left_int.data(), to, model, from_to_other);
 
     float fov[2];
     rs2_fov(&depth, fov);
@@ -313,8 +127,8 @@ inline void image_transform::align_depth_to_other_sse(const uint16_t * z_pixels,
 
     if (pixels_per_angle_depth.x < pixels_per_angle_target.x || pixels_per_angle_depth.y < pixels_per_angle_target.y || is_special_resolution(depth, to))
     {
-        get_texture_map_sse<dist>(z_pixels, _depth_scale, _depth.height*_depth.width, _pre_compute_map_x_bottom_right.data(),
-            _pre_compute_map_y_bottom_right.data(), (uint8_t *)_pixel_bottom_right_int.data(), to, from_to_other);
+        project_depth_to_other_sse(z_pixels, _depth_scale, _depth.height*_depth.width, _pre_compute_map_x_bottom_right.data(),
+            _pre_compute_map_y_bottom_right.data(), (int32_t *)_pixel_bottom_right_int.data(), to, model, from_to_other);
 
         move_depth_to_other(z_pixels, dest, to, _pixel_top_left_int, _pixel_bottom_right_int);
     }
@@ -325,18 +139,17 @@ inline void image_transform::align_depth_to_other_sse(const uint16_t * z_pixels,
 
 }
 
-template<rs2_distortion dist>
 inline void image_transform::align_other_to_depth_sse(const uint16_t * z_pixels, const uint8_t * source, uint8_t * dest, int bpp, const rs2_intrinsics& to,
-    const rs2_extrinsics& from_to_other)
+    rs2_distortion model, const rs2_extrinsics& from_to_other)
 {
-    get_texture_map_sse<dist>(z_pixels, _depth_scale, _depth.height*_depth.width, _pre_compute_map_x_top_left.data(),
-        _pre_compute_map_y_top_left.data(), (uint8_t *)_pixel_top_left_int.data(), to, from_to_other);
+    project_depth_to_other_sse(z_pixels, _depth_scale, _depth.height*_depth.width, _pre_compute_map_x_top_left.data(),
+        _pre_compute_map_y_top_left.data(), (int32_t *)_pixel_top_left_int.data(), to, model, from_to_other);
 
     std::vector<int2>& bottom_right = _pixel_top_left_int;
     if (to.height < _depth.height && to.width < _depth.width)
     {
-        get_texture_map_sse<dist>(z_pixels, _depth_scale, _depth.height*_depth.width, _pre_compute_map_x_bottom_right.data(),
-            _pre_compute_map_y_bottom_right.data(), (uint8_t *)_pixel_bottom_right_int.data(), to, from_to_other);
+        project_depth_to_other_sse(z_pixels, _depth_scale, _depth.height*_depth.width, _pre_compute_map_x_bottom_right.data(),
+            _pre_compute_map_y_bottom_right.data(), (int32_t *)_pixel_bottom_right_int.data(), to, model, from_to_other);
 
         bottom_right = _pixel_bottom_right_int;
     }
@@ -1,7 +1,7 @@
 // License: Apache 2.0. See LICENSE file in root directory.
 // Copyright(c) 2024 Intel Corporation. All Rights Reserved.
 #pragma once
-#ifdef __SSSE3__
+#ifdef RS2_USE_X86_SIMD
 
 #include "proc/align.h"
 #include <src/float3.h>
@@ -45,16 +45,15 @@ namespace librealsense
             std::vector<float>& pre_compute_map_y,
             float offset = 0);
 
-        template<rs2_distortion dist = RS2_DISTORTION_NONE>
+        // 'model' is the distortion applied by project_depth_to_other_sse(), see sse-align-kernels.h
         inline void align_depth_to_other_sse(const uint16_t* z_pixels,
             uint16_t* dest, const rs2_intrinsics& depth,
-            const rs2_intrinsics& to,
+            const rs2_intrinsics& to, rs2_distortion model,
             const rs2_extrinsics& from_to_other);
 
-        template<rs2_distortion dist = RS2_DISTORTION_NONE>
         inline void align_other_to_depth_sse(const uint16_t* z_pixels,
             const uint8_t * source,
-            uint8_t* dest, int bpp, const rs2_intrinsics& to,
+            uint8_t* dest, int bpp, const rs2_intrinsics& to, rs2_distortion model,
             const rs2_extrinsics& from_to_other);
 
         inline void move_depth_to_other(const uint16_t* z_pixels,
@@ -87,4 +86,4 @@ namespace librealsense
         std::shared_ptr<image_transform> _stream_transform;
     };
 }
-#endif // __SSSE3__
+#endif // RS2_USE_X86_SIMD
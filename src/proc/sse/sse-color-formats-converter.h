@@ -0,0 +1,16 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2019 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <librealsense2/h/rs_sensor.h>
+#include <cstdint>
+
+namespace librealsense
+{
+    // SSSE3 versions of the color format conversions in color-formats-converter.cpp; the number of pixels must be a
+    // multiple of 16.
+    template< rs2_format FORMAT > void unpack_yuy2_sse( uint8_t * const d[], const uint8_t * s, int width, int height );
+    template< rs2_format FORMAT > void unpack_uyvy_sse( uint8_t * const d[], const uint8_t * s, int width, int height );
+    template< rs2_format FORMAT > void unpack_m420_sse( uint8_t * const d[], const uint8_t * s, int width, int height );
+}
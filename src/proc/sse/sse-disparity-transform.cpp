@@ -0,0 +1,45 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "../depth-maps.h"
+
+#ifdef RS2_USE_X86_SIMD  // compiled for SSSE3
+#include <tmmintrin.h> // For SSSE3 intrinsics
+
+namespace librealsense
+{
+    namespace
+    {
+        // 4 disparities to depth, as 32-bit integers; 0 where not normal (zero or subnormal: no exponent bits; infinite
+        // or NaN: all of them)
+        inline __m128i convert4(const float* in, __m128 factor)
+        {
+            const __m128i exponent = _mm_set1_epi32(0x7f800000);
+            __m128 x = _mm_loadu_ps(in);
+            __m128i e = _mm_and_si128(_mm_castps_si128(x), exponent);
+            __m128i not_normal = _mm_or_si128(_mm_cmpeq_epi32(e, _mm_setzero_si128()), _mm_cmpeq_epi32(e, exponent));
+            __m128i z = _mm_cvttps_epi32(_mm_add_ps(_mm_div_ps(factor, x), _mm_set1_ps(0.5f)));
+            return _mm_andnot_si128(not_normal, z);
+        }
+    }
+
+    void disparity_to_z16_sse(const float* in, uint16_t* out, size_t n, float d2d_convert_factor)
+    {
+        // The lower 16 bits of each integer, as a cast to uint16_t keeps them
+        const __m128i low_halves = _mm_setr_epi8(0, 1, 4, 5, 8, 9, 12, 13, -1, -1, -1, -1, -1, -1, -1, -1);
+        __m128 factor = _mm_set1_ps(d2d_convert_factor);
+
+        size_t i = 0;
+        for (; i + 8 <= n; i += 8)
+        {
+            __m128i lo = _mm_shuffle_epi8(convert4(in + i, factor), low_halves);
+            __m128i hi = _mm_shuffle_epi8(convert4(in + i + 4, factor), low_halves);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_unpacklo_epi64(lo, hi));
+        }
+
+        if (i < n)
+            disparity_to_z16_generic(in + i, out + i, n - i, d2d_convert_factor);
+    }
+}
+
+#endif
@@ -0,0 +1,96 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "../hdr-merge-depth.h"
+
+#ifdef RS2_USE_X86_SIMD  // compiled for SSSE3
+#include <tmmintrin.h> // For SSSE3 intrinsics
+
+namespace librealsense
+{
+    namespace
+    {
+        inline __m128i load(const void* p) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); }
+        inline void store(void* p, __m128i v) { _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v); }
+
+        // Masks have all bits set where true
+        inline __m128i select(__m128i mask, __m128i a, __m128i b)
+        {
+            return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+        }
+
+        // The first depth where valid and not 0, else the second where valid, else 0
+        inline __m128i merge8(__m128i d0, __m128i d1, __m128i valid0, __m128i valid1)
+        {
+            const __m128i zero = _mm_setzero_si128();
+            __m128i use0 = _mm_andnot_si128(_mm_cmpeq_epi16(d0, zero), valid0);
+            return select(use0, d0, _mm_and_si128(valid1, d1));
+        }
+
+        // ir_min < ir < ir_max, unsigned: no unsigned comparisons in SSE, so the sign bits are flipped to compare as
+        // signed
+        inline __m128i ir_valid8(__m128i ir, __m128i ir_min, __m128i ir_max)
+        {
+            const __m128i sign = _mm_set1_epi8(-128);
+            ir = _mm_xor_si128(ir, sign);
+            return _mm_and_si128(_mm_cmpgt_epi8(ir, ir_min), _mm_cmpgt_epi8(ir_max, ir));
+        }
+        inline __m128i ir_valid16(__m128i ir, __m128i ir_min, __m128i ir_max)
+        {
+            const __m128i sign = _mm_set1_epi16(-32768);
+            ir = _mm_xor_si128(ir, sign);
+            return _mm_and_si128(_mm_cmpgt_epi16(ir, ir_min), _mm_cmpgt_epi16(ir_max, ir));
+        }
+    }
+
+    void hdr_merge_depth_sse(const uint16_t* d0, const uint16_t* d1, uint16_t* out, size_t n)
+    {
+        const __m128i zero = _mm_setzero_si128();
+        size_t i = 0;
+        for (; i + 8 <= n; i += 8)
+        {
+            __m128i a = load(d0 + i);
+            store(out + i, select(_mm_cmpeq_epi16(a, zero), load(d1 + i), a));
+        }
+
+        if (i < n)
+            hdr_merge_depth_generic(d0 + i, d1 + i, out + i, n - i);
+    }
+
+    void hdr_merge_depth_sse(const uint16_t* d0, const uint16_t* d1, const uint8_t* ir0, const uint8_t* ir1,
+                             uint8_t ir_min, uint8_t ir_max, uint16_t* out, size_t n)
+    {
+        const __m128i min = _mm_set1_epi8(char(ir_min ^ 0x80));
+        const __m128i max = _mm_set1_epi8(char(ir_max ^ 0x80));
+        size_t i = 0;
+        for (; i + 16 <= n; i += 16)
+        {
+            // 16 infrared pixels, their masks widened to the 16-bit depth
+            __m128i valid0 = ir_valid8(load(ir0 + i), min, max);
+            __m128i valid1 = ir_valid8(load(ir1 + i), min, max);
+            store(out + i, merge8(load(d0 + i), load(d1 + i),
+                                  _mm_unpacklo_epi8(valid0, valid0), _mm_unpacklo_epi8(valid1, valid1)));
+            store(out + i + 8, merge8(load(d0 + i + 8), load(d1 + i + 8),
+                                      _mm_unpackhi_epi8(valid0, valid0), _mm_unpackhi_epi8(valid1, valid1)));
+        }
+
+        if (i < n)
+            hdr_merge_depth_generic(d0 + i, d1 + i, ir0 + i, ir1 + i, ir_min, ir_max, out + i, n - i);
+    }
+
+    void hdr_merge_depth_sse(const uint16_t* d0, const uint16_t* d1, const uint16_t* ir0, const uint16_t* ir1,
+                             uint16_t ir_min, uint16_t ir_max, uint16_t* out, size_t n)
+    {
+        const __m128i min = _mm_set1_epi16(short(ir_min ^ 0x8000));
+        const __m128i max = _mm_set1_epi16(short(ir_max ^ 0x8000));
+        size_t i = 0;
+        for (; i + 8 <= n; i += 8)
+            store(out + i, merge8(load(d0 + i), load(d1 + i),
+                                  ir_valid16(load(ir0 + i), min, max), ir_valid16(load(ir1 + i), min, max)));
+
+        if (i < n)
+            hdr_merge_depth_generic(d0 + i, d1 + i, ir0 + i, ir1 + i, ir_min, ir_max, out + i, n - i);
+    }
+}
+
+#endif
@@ -0,0 +1,187 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "../hole-fill.h"
+
+#ifdef RS2_USE_X86_SIMD  // compiled for SSSE3
+#include <tmmintrin.h> // For SSSE3 intrinsics
+
+namespace librealsense
+{
+    namespace
+    {
+        // A hole takes its value from its neighbors and, through the one on its left, from the holes before it in
+        // the row. The vector path computes each hole's value from its neighbors as they were, then carries the
+        // values along runs of holes with a segmented scan: the first lane takes the carry from the previous vector,
+        // then log2(lanes) steps each combine every lane with the one S lanes before it, while both are in the same
+        // run. Masks have all bits set where true. Most vectors have no holes: they are copied, with no dependency on the
+        // vector before them.
+
+        inline __m128i select(__m128i mask, __m128i a, __m128i b)
+        {
+            return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+        }
+
+        struct depth_lanes
+        {
+            typedef uint16_t value_type;
+            typedef __m128i vec;
+            static const size_t N = 8;
+
+            static vec load(const uint16_t* p) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); }
+            static void store(uint16_t* p, vec v) { _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v); }
+            static vec broadcast(uint16_t v) { return _mm_set1_epi16(short(v)); }
+            static __m128i empty(vec v) { return _mm_cmpeq_epi16(v, _mm_setzero_si128()); }
+            static vec choose(__m128i mask, vec a, vec b) { return select(mask, a, b); }
+
+            // No unsigned 16-bit min/max before SSE4.1: flip the sign bits to compare as signed
+            static vec max(vec a, vec b)
+            {
+                const __m128i sign = _mm_set1_epi16(-32768);
+                return _mm_xor_si128(_mm_max_epi16(_mm_xor_si128(a, sign), _mm_xor_si128(b, sign)), sign);
+            }
+            static vec min(vec a, vec b)
+            {
+                const __m128i sign = _mm_set1_epi16(-32768);
+                return _mm_xor_si128(_mm_min_epi16(_mm_xor_si128(a, sign), _mm_xor_si128(b, sign)), sign);
+            }
+
+            // Holes to the largest value, so a minimum skips them
+            static vec unfilled(vec v) { return _mm_or_si128(v, empty(v)); }
+
+            template<class Op>
+            static void scan(vec& v, __m128i run, vec carry, Op op)
+            {
+                const __m128i first = _mm_srli_si128(_mm_set1_epi32(-1), 14);
+                v = select(_mm_and_si128(run, first), op(v, carry), v);
+                run = _mm_andnot_si128(first, run);
+                if (!_mm_movemask_epi8(run))
+                    return;
+                v = select(run, op(v, _mm_slli_si128(v, 2)), v);
+                run = _mm_and_si128(run, _mm_slli_si128(run, 2));
+                v = select(run, op(v, _mm_slli_si128(v, 4)), v);
+                run = _mm_and_si128(run, _mm_slli_si128(run, 4));
+                v = select(run, op(v, _mm_slli_si128(v, 8)), v);
+            }
+        };
+
+        struct disparity_lanes
+        {
+            typedef float value_type;
+            typedef __m128 vec;
+            static const size_t N = 4;
+
+            static vec load(const float* p) { return _mm_loadu_ps(p); }
+            static void store(float* p, vec v) { _mm_storeu_ps(p, v); }
+            static vec broadcast(float v) { return _mm_set1_ps(v); }
+            // Only +0 is a hole, as for the scalar code
+            static __m128i empty(vec v) { return _mm_cmpeq_epi32(_mm_castps_si128(v), _mm_setzero_si128()); }
+            static vec choose(__m128i mask, vec a, vec b)
+            {
+                return _mm_castsi128_ps(select(mask, _mm_castps_si128(a), _mm_castps_si128(b)));
+            }
+
+            static vec max(vec a, vec b) { return _mm_max_ps(a, b); }
+            static vec min(vec a, vec b) { return _mm_min_ps(a, b); }
+
+            static vec unfilled(vec v) { return choose(empty(v), _mm_castsi128_ps(_mm_set1_epi32(0x7f800000)), v); }
+
+            template<class Op>
+            static void scan(vec& v, __m128i run, vec carry, Op op)
+            {
+                const __m128i first = _mm_srli_si128(_mm_set1_epi32(-1), 12);
+                v = choose(_mm_and_si128(run, first), op(v, carry), v);
+                run = _mm_andnot_si128(first, run);
+                if (!_mm_movemask_epi8(run))
+                    return;
+                v = choose(run, op(v, _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(v), 4))), v);
+                run = _mm_and_si128(run, _mm_slli_si128(run, 4));
+                v = choose(run, op(v, _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(v), 8))), v);
+            }
+        };
+
+        template<class L>
+        void fill_row(uint8_t mode, const typename L::value_type* up, const typename L::value_type* in,
+                      const typename L::value_type* down, typename L::value_type* out, size_t first, size_t end)
+        {
+            typedef typename L::vec vec;
+            size_t i = first;
+
+            if (mode == hf_fill_from_left)
+            {
+                // Each hole takes the value on its left
+                for (; i + L::N <= end; i += L::N)
+                {
+                    vec v = L::load(in + i);
+                    __m128i hole = L::empty(v);
+                    if (!_mm_movemask_epi8(hole))
+                    {
+                        L::store(out + i, v);
+                        continue;
+                    }
+                    L::scan(v, hole, L::broadcast(out[i - 1]), [](vec, vec left) { return left; });
+                    L::store(out + i, v);
+                }
+            }
+            else if (mode == hf_farest_from_around)
+            {
+                for (; i + L::N <= end; i += L::N)
+                {
+                    vec cur = L::load(in + i);
+                    __m128i hole = L::empty(cur);
+                    if (!_mm_movemask_epi8(hole))
+                    {
+                        L::store(out + i, cur);
+                        continue;
+                    }
+                    // Loaded before any store: with out == in, the pixel on the left of the first lane is filled
+                    vec left = L::load(in + i - 1);
+                    vec v = L::max(L::max(L::max(L::load(up + i), L::load(up + i - 1)), L::max(left, L::load(down + i - 1))),
+                                   L::load(down + i));
+                    L::scan(v, _mm_and_si128(hole, L::empty(left)), L::broadcast(out[i - 1]),
+                            [](vec a, vec b) { return L::max(a, b); });
+                    L::store(out + i, L::choose(hole, v, cur));
+                }
+            }
+            else
+            {
+                for (; i + L::N <= end; i += L::N)
+                {
+                    vec cur = L::load(in + i);
+                    __m128i hole = L::empty(cur);
+                    if (!_mm_movemask_epi8(hole))
+                    {
+                        L::store(out + i, cur);
+                        continue;
+                    }
+                    vec left = L::load(in + i - 1);
+                    vec up_left = L::load(up + i - 1);
+                    // Starts from the pixel above, even if a hole: then the result is a hole, too
+                    vec v = L::min(L::min(L::load(up + i), L::unfilled(up_left)),
+                                   L::min(L::unfilled(left), L::min(L::unfilled(L::load(down + i - 1)), L::unfilled(L::load(down + i)))));
+                    // A hole on the left stays one if the pixel above it is
+                    __m128i run = _mm_andnot_si128(L::empty(up_left), _mm_and_si128(hole, L::empty(left)));
+                    L::scan(v, run, L::unfilled(L::broadcast(out[i - 1])), [](vec a, vec b) { return L::min(a, b); });
+                    L::store(out + i, L::choose(hole, v, cur));
+                }
+            }
+
+            if (i < end)
+                hole_fill_row_generic(mode, up, in, down, out, i, end);
+        }
+    }
+
+    void hole_fill_row_sse(uint8_t mode, const uint16_t* up, const uint16_t* in, const uint16_t* down, uint16_t* out,
+                           size_t first, size_t end)
+    {
+        fill_row<depth_lanes>(mode, up, in, down, out, first, end);
+    }
+
+    void hole_fill_row_sse(uint8_t mode, const float* up, const float* in, const float* down, float* out,
+                           size_t first, size_t end)
+    {
+        fill_row<disparity_lanes>(mode, up, in, down, out, first, end);
+    }
+}
+
+#endif
@@ -0,0 +1,29 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2017 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <librealsense2/h/rs_sensor.h>
+#include <cstdint>
+
+namespace librealsense
+{
+    // The SSSE3 parts of pointcloud_sse. All buffers must be 16-byte aligned.
+
+    // Deprojects 'size' depth pixels, a multiple of 8, along their precomputed (undistorted) rays into x,y,z points
+    void deproject_depth_sse( const uint16_t * depth,
+                              float depth_scale,
+                              unsigned int size,
+                              const float * pre_compute_x,
+                              const float * pre_compute_y,
+                              float * points );
+
+    // Projects 'size' x,y,z points, a multiple of 4, into the other stream: the pixel of each into 'pixels', and its
+    // texture coordinates (the pixel divided by the other's size) into 'texture_map', both as x,y pairs
+    void project_points_sse( const float * points,
+                             unsigned int size,
+                             const rs2_intrinsics & other_intrinsics,
+                             const rs2_extrinsics & extr,
+                             float * texture_map,
+                             float * pixels );
+}
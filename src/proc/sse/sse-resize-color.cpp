@@ -0,0 +1,165 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "../resize-color-kernels.h"
+
+#ifdef RS2_USE_X86_SIMD  // compiled for SSSE3
+#include <tmmintrin.h>
+
+#include <cstring>
+
+namespace librealsense
+{
+    namespace
+    {
+        // Output value j of a row of boxes 'SPAN' pixels wide, at the start of its box in the input
+        template<int BPP, int SPAN>
+        constexpr int box_start(int j)
+        {
+            return (j / BPP) * SPAN * BPP + j % BPP;
+        }
+
+        // Where the output values of a period of whole pixels, G groups of 8 (so 8 * G * SPAN input values, in as many
+        // registers of 8), are shuffled from
+        template<int BPP, int SPAN>
+        struct box_masks
+        {
+            static constexpr int G = BPP == 3 ? 3 : 2;
+            static constexpr int R = G * SPAN;
+            __m128i masks[G][R];
+
+            box_masks()
+            {
+                for (int g = 0; g < G; ++g)
+                    for (int r = 0; r < R; ++r)
+                    {
+                        alignas(16) int8_t mask[16];
+                        for (int q = 0; q < 8; ++q)
+                        {
+                            int const offset = box_start<BPP, SPAN>(8 * g + q) - 8 * r;
+                            bool const here = offset >= 0 && offset < 8;
+                            mask[2 * q] = here ? int8_t(2 * offset) : int8_t(-1);
+                            mask[2 * q + 1] = here ? int8_t(2 * offset + 1) : int8_t(-1);
+                        }
+                        masks[g][r] = _mm_load_si128(reinterpret_cast<const __m128i*>(mask));
+                    }
+            }
+        };
+
+        // The sums of each input position with the next SPAN - 1 pixels', the box sums of the values at the start of
+        // each box, are shuffled into place. The means are exact with 32-bit floats: one, up to 255 with an area up to
+        // 256, is never closer than half a step of 1 / area to an integer.
+        template<int BPP, int SPAN>
+        void box_columns(const uint16_t* sums, int n_rows, int width_out, uint8_t* out)
+        {
+            typedef box_masks<BPP, SPAN> masks_t;
+            static const masks_t table;
+            int const area = SPAN * n_rows;
+            __m128 const bias = _mm_set1_ps(float(area / 2) + 0.5f);
+            __m128 const rcp = _mm_set1_ps(1.f / float(area));
+            __m128i const zero = _mm_setzero_si128();
+
+            int const n = width_out * BPP;
+            int j = 0;
+            for (; j + 8 * masks_t::G <= n; j += 8 * masks_t::G, sums += 8 * masks_t::R)
+            {
+                __m128i t[masks_t::R];
+                for (int r = 0; r < masks_t::R; ++r)
+                {
+                    t[r] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(sums + 8 * r));
+                    for (int k = 1; k < SPAN; ++k)
+                        t[r] = _mm_add_epi16(t[r], _mm_loadu_si128(reinterpret_cast<const __m128i*>(sums + 8 * r + k * BPP)));
+                }
+                for (int g = 0; g < masks_t::G; ++g)
+                {
+                    __m128i v = zero;
+                    for (int r = box_start<BPP, SPAN>(8 * g) / 8; r <= box_start<BPP, SPAN>(8 * g + 7) / 8; ++r)
+                        v = _mm_or_si128(v, _mm_shuffle_epi8(t[r], table.masks[g][r]));
+                    __m128i lo = _mm_cvttps_epi32(_mm_mul_ps(_mm_add_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(v, zero)), bias), rcp));
+                    __m128i hi = _mm_cvttps_epi32(_mm_mul_ps(_mm_add_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(v, zero)), bias), rcp));
+                    _mm_storel_epi64(reinterpret_cast<__m128i*>(out + j + 8 * g), _mm_packus_epi16(_mm_packs_epi32(lo, hi), zero));
+                }
+            }
+            for (int i = 0; j < n; ++i, ++j)
+            {
+                const uint16_t* p = sums + box_start<BPP, SPAN>(i);
+                int sum = area / 2;
+                for (int k = 0; k < SPAN; ++k)
+                    sum += p[k * BPP];
+                out[j] = uint8_t(sum / area);
+            }
+        }
+
+        template<int BPP>
+        void box_columns(const uint16_t* sums, int span, int n_rows, int width_out, uint8_t* out)
+        {
+            switch (span)
+            {
+            case 1: box_columns<BPP, 1>(sums, n_rows, width_out, out); break;
+            case 2: box_columns<BPP, 2>(sums, n_rows, width_out, out); break;
+            case 3: box_columns<BPP, 3>(sums, n_rows, width_out, out); break;
+            default: box_columns<BPP, 4>(sums, n_rows, width_out, out); break;
+            }
+        }
+
+        // Two columns blended, with the next 'BPP' values after the first, for 16-bit values up to 65280: offset to
+        // signed, so that _mm_madd_epi16 takes them, and back
+        template<int BPP>
+        inline __m128i bilinear_pixel(const uint16_t* blend, const int32_t* column)
+        {
+            __m128i const v = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(blend + column[0] * BPP)),
+                                            _mm_set1_epi16(short(0x8000)));
+            int const w1 = column[1];
+            __m128i r = _mm_madd_epi16(_mm_unpacklo_epi16(v, _mm_srli_si128(v, BPP * 2)), _mm_set1_epi32((256 - w1) | (w1 << 16)));
+            return _mm_srli_epi32(_mm_add_epi32(r, _mm_set1_epi32((1 << 23) + 32768)), 16);
+        }
+
+        // 4 pixels at a time, packed (for BPP 3, without their fourth values) and stored together
+        template<int BPP>
+        void bilinear_columns(const uint16_t* blend, const int32_t* columns, int width_out, uint8_t* out)
+        {
+            __m128i const pack = BPP == 4 ? _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15)
+                                          : _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1);
+            int x = 0;
+            for (; x + 4 <= width_out; x += 4, columns += 8, out += 4 * BPP)
+            {
+                __m128i const p01 = _mm_packs_epi32(bilinear_pixel<BPP>(blend, columns), bilinear_pixel<BPP>(blend, columns + 2));
+                __m128i const p23 = _mm_packs_epi32(bilinear_pixel<BPP>(blend, columns + 4), bilinear_pixel<BPP>(blend, columns + 6));
+                __m128i const bytes = _mm_shuffle_epi8(_mm_packus_epi16(p01, p23), pack);
+                _mm_storel_epi64(reinterpret_cast<__m128i*>(out), bytes);
+                int32_t last = _mm_cvtsi128_si32(_mm_srli_si128(bytes, 8));
+                std::memcpy(out + 8, &last, sizeof(last));
+                if (BPP == 4)
+                {
+                    last = _mm_cvtsi128_si32(_mm_srli_si128(bytes, 12));
+                    std::memcpy(out + 12, &last, sizeof(last));
+                }
+            }
+            for (; x < width_out; ++x, columns += 2, out += BPP)
+            {
+                __m128i const r = bilinear_pixel<BPP>(blend, columns);
+                int32_t const pixel = _mm_cvtsi128_si32(_mm_packus_epi16(_mm_packs_epi32(r, r), r));
+                std::memcpy(out, &pixel, BPP);
+            }
+        }
+    }
+
+    void resize_box_columns_sse(const uint16_t* sums, int bpp, int span, int n_rows, int width_out, uint8_t* out)
+    {
+        if (bpp == 4)
+            box_columns<4>(sums, span, n_rows, width_out, out);
+        else
+            box_columns<3>(sums, span, n_rows, width_out, out);
+    }
+
+    void resize_bilinear_columns_sse(const uint16_t* blend, int bpp, const int32_t* columns, int width_out,
+                                     uint8_t* out)
+    {
+        if (bpp == 4)
+            bilinear_columns<4>(blend, columns, width_out, out);
+        else
+            bilinear_columns<3>(blend, columns, width_out, out);
+    }
+}
+
+#endif
@@ -0,0 +1,207 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "../temporal-smooth.h"
+
+#ifdef RS2_USE_X86_SIMD  // compiled for SSSE3
+#include <tmmintrin.h> // For SSSE3 intrinsics
+
+namespace librealsense
+{
+    namespace
+    {
+        // The same math as temporal_smooth_generic(), 16 pixels at a time: instead of branching, every pixel gets all
+        // the possible results, and masks (all bits set where true) select between them
+
+        struct smooth_constants
+        {
+            __m128i zero, ones;
+            __m128i mask;                   // The bit of the current frame, in every byte
+            __m128i credible_lo, credible_hi;
+            __m128i bits;
+            __m128i delta16;
+            __m128 delta, alpha, one_minus_alpha;
+
+            explicit smooth_constants(const temporal_smooth_params& params)
+            {
+                zero = _mm_setzero_si128();
+                ones = _mm_cmpeq_epi8(zero, zero);
+                mask = _mm_set1_epi8(char(params.mask));
+                credible_lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(params.credible));
+                credible_hi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(params.credible + 16));
+                bits = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128);
+                delta16 = _mm_set1_epi16(params.delta);
+                delta = _mm_set1_ps(float(params.delta));
+                alpha = _mm_set1_ps(params.alpha);
+                one_minus_alpha = _mm_set1_ps(1.f - params.alpha);
+            }
+        };
+
+        inline __m128i select(__m128i mask, __m128i a, __m128i b)
+        {
+            return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+        }
+
+        // Look up the credible bit of 16 history bytes: the byte of the table is in the upper 5 bits, and the bit in
+        // the lower 3
+        inline __m128i classify(__m128i hist, const smooth_constants& k)
+        {
+            __m128i index = _mm_and_si128(_mm_srli_epi16(hist, 3), _mm_set1_epi8(0x1f));
+            __m128i byte = select(_mm_cmpgt_epi8(index, _mm_set1_epi8(15)),
+                                  _mm_shuffle_epi8(k.credible_hi, index),
+                                  _mm_shuffle_epi8(k.credible_lo, index));
+            __m128i bit = _mm_shuffle_epi8(k.bits, _mm_and_si128(hist, _mm_set1_epi8(7)));
+            return _mm_cmpeq_epi8(_mm_and_si128(byte, bit), bit);
+        }
+
+        // Byte masks of 16 pixels to those of their 8 pairs (either pixel), in the lower half
+        inline __m128i pairs_any(__m128i m, const smooth_constants& k)
+        {
+            return _mm_packus_epi16(_mm_srli_epi16(_mm_or_si128(m, _mm_slli_epi16(m, 8)), 8), k.zero);
+        }
+
+        inline __m128 blend(__m128 cur, __m128 prev, const smooth_constants& k)
+        {
+            return _mm_add_ps(_mm_mul_ps(k.alpha, cur), _mm_mul_ps(k.one_minus_alpha, prev));
+        }
+
+        void smooth8(const uint16_t* in, uint16_t* out, uint16_t* last, __m128i credible,
+                     const smooth_constants& k, __m128i& valid, __m128i& edge)
+        {
+            __m128i cur = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in));
+            __m128i prev = _mm_loadu_si128(reinterpret_cast<const __m128i*>(last));
+            __m128i cur_valid = _mm_xor_si128(_mm_cmpeq_epi16(cur, k.zero), k.ones);
+            __m128i prev_valid = _mm_xor_si128(_mm_cmpeq_epi16(prev, k.zero), k.ones);
+
+            // |cur - prev| < delta
+            __m128i diff = _mm_or_si128(_mm_subs_epu16(cur, prev), _mm_subs_epu16(prev, cur));
+            __m128i agree = _mm_xor_si128(_mm_cmpeq_epi16(_mm_subs_epu16(k.delta16, diff), k.zero), k.ones);
+            agree = _mm_and_si128(agree, _mm_and_si128(cur_valid, prev_valid));
+
+            // Truncate to integers, then pack them (all in [0, 65535]) with signed saturation by shifting to [-32768, 32767]
+            __m128i result_lo = _mm_cvttps_epi32(blend(_mm_cvtepi32_ps(_mm_unpacklo_epi16(cur, k.zero)),
+                                                       _mm_cvtepi32_ps(_mm_unpacklo_epi16(prev, k.zero)), k));
+            __m128i result_hi = _mm_cvttps_epi32(blend(_mm_cvtepi32_ps(_mm_unpackhi_epi16(cur, k.zero)),
+                                                       _mm_cvtepi32_ps(_mm_unpackhi_epi16(prev, k.zero)), k));
+            __m128i bias = _mm_set1_epi32(32768);
+            __m128i result = _mm_xor_si128(_mm_packs_epi32(_mm_sub_epi32(result_lo, bias), _mm_sub_epi32(result_hi, bias)),
+                                           _mm_set1_epi16(-32768));
+
+            __m128i fill = _mm_and_si128(_mm_andnot_si128(cur_valid, prev_valid), credible);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out), select(agree, result, select(fill, prev, cur)));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(last), select(agree, result, select(cur_valid, cur, prev)));
+
+            valid = cur_valid;
+            edge = _mm_andnot_si128(agree, cur_valid);
+        }
+
+        void smooth4(const float* in, float* out, float* last, __m128i credible,
+                     const smooth_constants& k, __m128i& valid, __m128i& edge)
+        {
+            __m128 cur = _mm_loadu_ps(in);
+            __m128 prev = _mm_loadu_ps(last);
+            __m128 cur_valid = _mm_cmpneq_ps(cur, _mm_setzero_ps());
+            __m128 prev_valid = _mm_cmpneq_ps(prev, _mm_setzero_ps());
+
+            __m128 diff = _mm_andnot_ps(_mm_set1_ps(-0.f), _mm_sub_ps(cur, prev));
+            __m128 agree = _mm_and_ps(_mm_cmplt_ps(diff, k.delta), _mm_and_ps(cur_valid, prev_valid));
+            __m128 result = blend(cur, prev, k);
+
+            __m128 fill = _mm_and_ps(_mm_andnot_ps(cur_valid, prev_valid), _mm_castsi128_ps(credible));
+            __m128 other = _mm_or_ps(_mm_and_ps(fill, prev), _mm_andnot_ps(fill, cur));
+            _mm_storeu_ps(out, _mm_or_ps(_mm_and_ps(agree, result), _mm_andnot_ps(agree, other)));
+            other = _mm_or_ps(_mm_and_ps(cur_valid, cur), _mm_andnot_ps(cur_valid, prev));
+            _mm_storeu_ps(last, _mm_or_ps(_mm_and_ps(agree, result), _mm_andnot_ps(agree, other)));
+
+            valid = _mm_castps_si128(cur_valid);
+            edge = _mm_castps_si128(_mm_andnot_ps(agree, cur_valid));
+        }
+
+        // 16 pixels, with a credible byte mask for each; returns their valid and edge byte masks
+        void smooth16(const uint16_t* in, uint16_t* out, uint16_t* last, __m128i credible,
+                      const smooth_constants& k, __m128i& valid, __m128i& edge)
+        {
+            __m128i valid0, valid1, edge0, edge1;
+            smooth8(in, out, last, _mm_unpacklo_epi8(credible, credible), k, valid0, edge0);
+            smooth8(in + 8, out + 8, last + 8, _mm_unpackhi_epi8(credible, credible), k, valid1, edge1);
+            valid = _mm_packs_epi16(valid0, valid1);
+            edge = _mm_packs_epi16(edge0, edge1);
+        }
+
+        void smooth16(const float* in, float* out, float* last, __m128i credible,
+                      const smooth_constants& k, __m128i& valid, __m128i& edge)
+        {
+            __m128i credible_lo = _mm_unpacklo_epi8(credible, credible);
+            __m128i credible_hi = _mm_unpackhi_epi8(credible, credible);
+            __m128i v[4], e[4];
+            smooth4(in, out, last, _mm_unpacklo_epi16(credible_lo, credible_lo), k, v[0], e[0]);
+            smooth4(in + 4, out + 4, last + 4, _mm_unpackhi_epi16(credible_lo, credible_lo), k, v[1], e[1]);
+            smooth4(in + 8, out + 8, last + 8, _mm_unpacklo_epi16(credible_hi, credible_hi), k, v[2], e[2]);
+            smooth4(in + 12, out + 12, last + 12, _mm_unpackhi_epi16(credible_hi, credible_hi), k, v[3], e[3]);
+            valid = _mm_packs_epi16(_mm_packs_epi32(v[0], v[1]), _mm_packs_epi32(v[2], v[3]));
+            edge = _mm_packs_epi16(_mm_packs_epi32(e[0], e[1]), _mm_packs_epi32(e[2], e[3]));
+        }
+
+        template<bool half_resolution_history, typename T>
+        void smooth(const T* in, T* out, T* last, uint8_t* history, size_t n, const temporal_smooth_params& params)
+        {
+            smooth_constants k(params);
+
+            size_t i = 0;
+            for (; i + 16 <= n; i += 16)
+            {
+                __m128i hist, credible;
+                if (half_resolution_history)
+                {
+                    hist = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(history + i / 2));
+                    credible = classify(hist, k);
+                    credible = _mm_unpacklo_epi8(credible, credible);
+                }
+                else
+                {
+                    hist = _mm_loadu_si128(reinterpret_cast<const __m128i*>(history + i));
+                    credible = classify(hist, k);
+                }
+
+                __m128i valid, edge;
+                smooth16(in + i, out + i, last + i, credible, k, valid, edge);
+
+                if (half_resolution_history)
+                {
+                    valid = pairs_any(valid, k);
+                    edge = pairs_any(edge, k);
+                }
+                // agree -> |= mask; new or changed value -> = mask; no value -> &= ~mask
+                hist = _mm_or_si128(_mm_andnot_si128(edge, _mm_andnot_si128(k.mask, hist)), _mm_and_si128(valid, k.mask));
+
+                if (half_resolution_history)
+                    _mm_storel_epi64(reinterpret_cast<__m128i*>(history + i / 2), hist);
+                else
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(history + i), hist);
+            }
+
+            if (i < n)
+                temporal_smooth_generic(in + i, out + i, last + i, history + (half_resolution_history ? i / 2 : i), n - i, params);
+        }
+    }
+
+    void temporal_smooth_sse(const uint16_t* in, uint16_t* out, uint16_t* last, uint8_t* history, size_t n,
+                             const temporal_smooth_params& params)
+    {
+        if (params.half_resolution_history)
+            smooth<true>(in, out, last, history, n, params);
+        else
+            smooth<false>(in, out, last, history, n, params);
+    }
+
+    void temporal_smooth_sse(const float* in, float* out, float* last, uint8_t* history, size_t n,
+                             const temporal_smooth_params& params)
+    {
+        if (params.half_resolution_history)
+            smooth<true>(in, out, last, history, n, params);
+        else
+            smooth<false>(in, out, last, history, n, params);
+    }
+}
+
+#endif
@@ -0,0 +1,12 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <cstdint>
+
+namespace librealsense
+{
+    // SSSE3 version of unpack_y411_native() in y411-converter.cpp; the number of pixels must be a multiple of 32.
+    void unpack_y411_sse( uint8_t * const dest, const uint8_t * const s, int w, int h, int actual_size);
+}
@@ -34,7 +34,11 @@ namespace librealsense
     processing_block::processing_block(const char* name) :
         _source_wrapper(_source)
     {
+        // We produce frames on whatever thread invokes us
+        _source.allow_blocking_producer();
         register_option(RS2_OPTION_FRAMES_QUEUE_SIZE, _source.get_published_size_option());
+        register_option( RS2_OPTION_FRAMES_QUEUE_POLICY, _source.get_publish_policy_option() );
+        register_option( RS2_OPTION_FRAMES_QUEUE_MEMORY_LIMIT, _source.get_publish_memory_limit_option() );
         register_info(RS2_CAMERA_INFO_NAME, name);
         _source.init(std::shared_ptr<metadata_parser_map>());
     }
@@ -174,6 +178,8 @@ namespace librealsense
         : generic_processing_block(name)
     {
         register_option(RS2_OPTION_FRAMES_QUEUE_SIZE, _source.get_published_size_option());
+        register_option( RS2_OPTION_FRAMES_QUEUE_POLICY, _source.get_publish_policy_option() );
+        register_option( RS2_OPTION_FRAMES_QUEUE_MEMORY_LIMIT, _source.get_publish_memory_limit_option() );
         _source.init(std::shared_ptr<metadata_parser_map>());
 
         auto stream_selector = std::make_shared<ptr_option<int>>(RS2_STREAM_ANY, RS2_STREAM_COUNT, 1, RS2_STREAM_ANY, (int*)&_stream_filter.stream, "Stream type");
@@ -8,9 +8,13 @@
 #include "environment.h"
 #include "proc/synthetic-stream.h"
 #include "proc/temporal-filter.h"
+#include "simd-dispatch.h"
 
 #include <rsutils/string/from.h>
 
+#include <algorithm>
+#include <cmath>
+
 
 namespace librealsense
 {
@@ -41,7 +45,8 @@ namespace librealsense
         _delta_param(temp_delta_default),
         _width(0), _height(0), _stride(0), _bpp(0),
         _extension_type(RS2_EXTENSION_DEPTH_FRAME),
-        _current_frm_size_pixels(0)
+        _current_frm_size_pixels(0),
+        _half_resolution_history(false)
     {
         _stream_filter.stream = RS2_STREAM_DEPTH;
         _stream_filter.format = RS2_FORMAT_Z16;
@@ -109,8 +114,20 @@ namespace librealsense
             on_set_delta(val);
         });
 
+        auto half_resolution_history = std::make_shared<ptr_option<bool>>(
+            false,
+            true,
+            true,
+            false,
+            &_half_resolution_history, "Keep the history per pair of pixels, to halve its memory traffic");
+        half_resolution_history->on_set([this](float val)
+        {
+            on_set_half_resolution_history(val != 0.f);
+        });
+
         register_option(RS2_OPTION_FILTER_SMOOTH_ALPHA, temporal_filter_alpha);
         register_option(RS2_OPTION_FILTER_SMOOTH_DELTA, temporal_filter_delta);
+        register_option(RS2_OPTION_FILTER_HALF_RESOLUTION_HISTORY, half_resolution_history);
 
         on_set_persistence_control(_persistence_param);
         on_set_delta(_delta_param);
@@ -123,14 +140,33 @@ namespace librealsense
         auto tgt = prepare_target_frame(f, source);
 
         // Temporal filter execution
+        auto params = get_smooth_params();
         if (_extension_type == RS2_EXTENSION_DISPARITY_FRAME)
-            temp_jw_smooth<float>(const_cast<void*>(tgt.get_data()), _last_frame.data(), _history.data());
+            temporal_smooth(_bands, static_cast<const float*>(f.get_data()), static_cast<float*>(const_cast<void*>(tgt.get_data())),
+                reinterpret_cast<float*>(_last_frame.data()), _history.data(), _width, _height, params);
         else
-            temp_jw_smooth<uint16_t>(const_cast<void*>(tgt.get_data()), _last_frame.data(), _history.data());
+            temporal_smooth(_bands, static_cast<const uint16_t*>(f.get_data()), static_cast<uint16_t*>(const_cast<void*>(tgt.get_data())),
+                reinterpret_cast<uint16_t*>(_last_frame.data()), _history.data(), _width, _height, params);
 
+        _cur_frame_index = (_cur_frame_index + 1) % 8;  // at end of cycle
         return tgt;
     }
 
+    temporal_smooth_params temporal_filter::get_smooth_params() const
+    {
+        temporal_smooth_params params;
+        params.alpha = _alpha_param;
+        params.delta = _delta_param;
+        params.mask = 1 << _cur_frame_index;
+        params.half_resolution_history = _half_resolution_history;
+
+        // A bit per history value, so the kernels can look up 16 at a time
+        std::fill(std::begin(params.credible), std::end(params.credible), uint8_t(0));
+        for (size_t hist = 0; hist < _persistence_map.size(); hist++)
+            if (_persistence_map[hist] & params.mask)
+                params.credible[hist >> 3] |= 1 << (hist & 7);
+        return params;
+    }
 
     void temporal_filter::on_set_persistence_control(uint8_t val)
     {
@@ -159,6 +195,15 @@ namespace librealsense
         _history.clear();
     }
 
+    void temporal_filter::on_set_half_resolution_history(bool val)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _half_resolution_history = val;
+        _cur_frame_index = 0;
+        _last_frame.clear();
+        _history.clear();
+    }
+
     void  temporal_filter::update_configuration(const rs2::frame& f)
     {
         if (f.get_profile().get() != _source_stream_profile.get())
@@ -176,28 +221,35 @@ namespace librealsense
             _current_frm_size_pixels = _width * _height;
 
             _last_frame.clear();
-            _last_frame.resize(_current_frm_size_pixels*_bpp);
-
             _history.clear();
-            _history.resize(_current_frm_size_pixels*_bpp);
-
         }
+
+        // Also after the options cleared them
+        if (_last_frame.size() != _current_frm_size_pixels * _bpp)
+            _last_frame.assign(_current_frm_size_pixels * _bpp, 0);
+
+        auto history_size = _half_resolution_history ? (_current_frm_size_pixels + 1) / 2 : _current_frm_size_pixels;
+        if (_history.size() != history_size)
+            _history.assign(history_size, 0);
     }
 
     rs2::frame temporal_filter::prepare_target_frame(const rs2::frame& f, const rs2::frame_source& source)
     {
-        // Allocate and copy the content of the original Depth data to the target
-        rs2::frame tgt = source.allocate_video_frame(_target_stream_profile, f, (int)_bpp, (int)_width, (int)_height, (int)_stride, _extension_type);
-
-        memmove(const_cast<void*>(tgt.get_data()), f.get_data(), _current_frm_size_pixels * _bpp);
-        return tgt;
+        // Allocate the target; the filter writes all of it, reading from the original Depth data
+        return source.allocate_video_frame(_target_stream_profile, f, (int)_bpp, (int)_width, (int)_height, (int)_stride, _extension_type);
     }
 
     void temporal_filter::recalc_persistence_map()
     {
-        _persistence_map.fill(0);
+        _persistence_map = calc_persistence_map(_persistence_param);
+    }
 
-        for (size_t i = 0; i < _persistence_map.size(); i++)
+    std::array<uint8_t, PRESISTENCY_LUT_SIZE> calc_persistence_map(uint8_t persistence_param)
+    {
+        std::array<uint8_t, PRESISTENCY_LUT_SIZE> persistence_map;
+        persistence_map.fill(0);
+
+        for (size_t i = 0; i < persistence_map.size(); i++)
         {
             unsigned char last_7 = !!(i & 1);  // old
             unsigned char last_6 = !!(i & 2);
@@ -208,51 +260,51 @@ namespace librealsense
             unsigned char last_1 = !!(i & 64);
             unsigned char lastFrame = !!(i & 128); // new
 
-            if (_persistence_param == 1)
+            if (persistence_param == 1)
             {
                 int sum = lastFrame + last_1 + last_2 + last_3 + last_4 + last_5 + last_6 + last_7;
                 if (sum >= 8)  // valid in eight of the last eight frames
-                    _persistence_map[i] = 1;
+                    persistence_map[i] = 1;
             }
-            else if (_persistence_param == 2) // <--- default choice in current libRS implementation
+            else if (persistence_param == 2) // <--- default choice in current libRS implementation
             {
                 int sum = lastFrame + last_1 + last_2;
                 if (sum >= 2) // valid in two of the last three frames
-                    _persistence_map[i] = 1;
+                    persistence_map[i] = 1;
             }
-            else if (_persistence_param == 3) // <--- default choice recommended
+            else if (persistence_param == 3) // <--- default choice recommended
             {
                 int sum = lastFrame + last_1 + last_2 + last_3;
                 if (sum >= 2)  // valid in two of the last four frames
-                    _persistence_map[i] = 1;
+                    persistence_map[i] = 1;
             }
-            else if (_persistence_param == 4)
+            else if (persistence_param == 4)
             {
                 int sum = lastFrame + last_1 + last_2 + last_3 + last_4 + last_5 + last_6 + last_7;
                 if (sum >= 2) // valid in two of the last eight frames
-                    _persistence_map[i] = 1;
+                    persistence_map[i] = 1;
             }
-            else if (_persistence_param == 5)
+            else if (persistence_param == 5)
             {
                 int sum = lastFrame + last_1;
                 if (sum >= 1) // valid in one of the last two frames
-                    _persistence_map[i] = 1;
+                    persistence_map[i] = 1;
             }
-            else if (_persistence_param == 6)
+            else if (persistence_param == 6)
             {
                 int sum = lastFrame + last_1 + last_2 + last_3 + last_4;
                 if (sum >= 1)  // valid in one of the last five frames
-                    _persistence_map[i] = 1;
+                    persistence_map[i] = 1;
             }
-            else if (_persistence_param == 7) //  <--- most filling
+            else if (persistence_param == 7) //  <--- most filling
             {
                 int sum = lastFrame + last_1 + last_2 + last_3 + last_4 + last_5 + last_6 + last_7;
                 if (sum >= 1) // valid in one of the last eight frames
-                    _persistence_map[i] = 1;
+                    persistence_map[i] = 1;
             }
-            else if (_persistence_param == 8) //  <--- all 1's
+            else if (persistence_param == 8) //  <--- all 1's
             {
-                _persistence_map[i] = 1;
+                persistence_map[i] = 1;
             }
             else // all others, including 0, no persistance
             {
@@ -272,11 +324,130 @@ namespace librealsense
 
             for (i = 0; i < 256; i++) {
                 unsigned char pos = (unsigned char)((i << (8 - phase)) | (i >> phase));
-                if (_persistence_map[pos])
+                if (persistence_map[pos])
                     credible_threshold[i] |= mask;
             }
         }
-        // Store results
-        _persistence_map = credible_threshold;
+        return credible_threshold;
+    }
+
+    // 'group' pixels share each history byte: all are classified by the byte as it was, then update it together
+    template<typename T, size_t group>
+    static void temp_jw_smooth(const T* in, T* out, T* last, uint8_t* history, size_t n, const temporal_smooth_params& params)
+    {
+        static_assert((std::is_arithmetic<T>::value), "temporal filter assumes numeric types");
+
+        T delta_z = static_cast<T>(params.delta);
+        unsigned char mask = params.mask;
+        float alpha = params.alpha;
+        float one_minus_alpha = 1.f - alpha;
+
+        for (size_t first = 0; first < n; first += group, ++history)
+        {
+            unsigned char hist = *history;
+            bool credible = (params.credible[hist >> 3] & (1 << (hist & 7))) != 0;
+            bool valid = false;
+            bool edge = false;
+            for (size_t i = first; i < std::min(first + group, n); i++)
+            {
+                T cur_val = in[i];
+                T prev_val = last[i];
+                T result = cur_val;
+
+                if (cur_val)
+                {
+                    valid = true;
+                    if (!prev_val)
+                    {
+                        edge = true;
+                        last[i] = cur_val;
+                    }
+                    else
+                    {  // old and new val
+                        T diff = static_cast<T>(fabs(cur_val - prev_val));
+
+                        if (diff < delta_z)
+                        {  // old and new val agree
+                            float filtered = alpha * cur_val + one_minus_alpha * prev_val;
+                            result = static_cast<T>(filtered);
+                            last[i] = result;
+                        }
+                        else
+                        {
+                            edge = true;
+                            last[i] = cur_val;
+                        }
+                    }
+                }
+                else if (prev_val && credible)
+                {  // no cur_val, but we have had enough samples lately
+                    result = prev_val;
+                }
+                out[i] = result;
+            }
+            // Per pixel, this is: agree -> |= mask; new or changed value -> = mask; no value -> &= ~mask
+            *history = (edge ? 0 : hist & ~mask) | (valid ? mask : 0);
+        }
+    }
+
+    void temporal_smooth_generic(const uint16_t* in, uint16_t* out, uint16_t* last, uint8_t* history, size_t n, const temporal_smooth_params& params)
+    {
+        if (params.half_resolution_history)
+            temp_jw_smooth<uint16_t, 2>(in, out, last, history, n, params);
+        else
+            temp_jw_smooth<uint16_t, 1>(in, out, last, history, n, params);
+    }
+
+    void temporal_smooth_generic(const float* in, float* out, float* last, uint8_t* history, size_t n, const temporal_smooth_params& params)
+    {
+        if (params.half_resolution_history)
+            temp_jw_smooth<float, 2>(in, out, last, history, n, params);
+        else
+            temp_jw_smooth<float, 1>(in, out, last, history, n, params);
+    }
+
+    template<typename T, typename Fn>
+    static void temporal_smooth_bands(row_bands& bands, Fn kernel, const T* in, T* out, T* last, uint8_t* history,
+                                      size_t width, size_t height, const temporal_smooth_params& params)
+    {
+        // Pixels are independent, but bands must not split the pixel pairs of a half-resolution history
+        size_t n = width * height;
+        auto first_pixel = [&](size_t row)
+        {
+            if (row == height)
+                return n;
+            return params.half_resolution_history ? (row * width) & ~size_t(1) : row * width;
+        };
+        bands.run(height, 32, [&](size_t first_row, size_t end_row)
+        {
+            size_t begin = first_pixel(first_row);
+            size_t end = first_pixel(end_row);
+            kernel(in + begin, out + begin, last + begin,
+                   history + (params.half_resolution_history ? begin / 2 : begin), end - begin, params);
+        });
+    }
+
+    void temporal_smooth(row_bands& bands, const uint16_t* in, uint16_t* out, uint16_t* last, uint8_t* history,
+                         size_t width, size_t height, const temporal_smooth_params& params)
+    {
+        typedef void(*smooth_fn)(const uint16_t*, uint16_t*, uint16_t*, uint8_t*, size_t, const temporal_smooth_params&);
+        static simd_kernel<smooth_fn> const kernel = simd_kernel<smooth_fn>(temporal_smooth_generic)
+#ifdef RS2_USE_X86_SIMD
+            .add(RS2_SIMD_LEVEL_SSSE3, temporal_smooth_sse)
+#endif
+            ;
+        temporal_smooth_bands(bands, kernel.get(), in, out, last, history, width, height, params);
+    }
+
+    void temporal_smooth(row_bands& bands, const float* in, float* out, float* last, uint8_t* history,
+                         size_t width, size_t height, const temporal_smooth_params& params)
+    {
+        typedef void(*smooth_fn)(const float*, float*, float*, uint8_t*, size_t, const temporal_smooth_params&);
+        static simd_kernel<smooth_fn> const kernel = simd_kernel<smooth_fn>(temporal_smooth_generic)
+#ifdef RS2_USE_X86_SIMD
+            .add(RS2_SIMD_LEVEL_SSSE3, temporal_smooth_sse)
+#endif
+            ;
+        temporal_smooth_bands(bands, kernel.get(), in, out, last, history, width, height, params);
     }
 }
@@ -3,6 +3,11 @@
 
 #pragma once
 #include "types.h"
+#include "synthetic-stream.h"
+#include "row-bands.h"
+#include "temporal-smooth.h"
+
+#include <array>
 
 namespace librealsense
 {
@@ -19,77 +24,13 @@ namespace librealsense
 
         rs2::frame prepare_target_frame(const rs2::frame& f, const rs2::frame_source& source);
 
-        template<typename T>
-        void temp_jw_smooth(void* frame_data, void * _last_frame_data, uint8_t *history)
-        {
-            static_assert((std::is_arithmetic<T>::value), "temporal filter assumes numeric types");
-
-            const bool fp = (std::is_floating_point<T>::value);
-
-            T delta_z = static_cast<T>(_delta_param);
-
-            auto frame          = reinterpret_cast<T*>(frame_data);
-            auto _last_frame    = reinterpret_cast<T*>(_last_frame_data);
-
-            unsigned char mask = 1 << _cur_frame_index;
-
-            // Copy locally, to remove need for a lock.
-            float alpha = _alpha_param;
-            float one_minus_alpha = 1.f - alpha;
-            // pass one -- go through image and update all
-            for (size_t i = 0; i < _current_frm_size_pixels; i++)
-            {
-                T cur_val = frame[i];
-                T prev_val = _last_frame[i];
-
-                if (cur_val)
-                {
-                    if (!prev_val)
-                    {
-                        _last_frame[i] = cur_val;
-                        history[i] = mask;
-                    }
-                    else
-                    {  // old and new val
-                        T diff = static_cast<T>(fabs(cur_val - prev_val));
-
-                        if (diff < delta_z)
-                        {  // old and new val agree
-                            history[i] |= mask;
-                            float filtered = alpha * cur_val + one_minus_alpha * prev_val;
-                            T result = static_cast<T>(filtered);
-                            frame[i] = result;
-                            _last_frame[i] = result;
-                        }
-                        else
-                        {
-                            _last_frame[i] = cur_val;
-                            history[i] = mask;
-                        }
-                    }
-                }
-                else
-                {  // no cur_val
-                    if (prev_val)
-                    { // only case we can help
-                        unsigned char hist = history[i];
-                        unsigned char classification = _persistence_map[hist];
-                        if (classification & mask)
-                        { // we have had enough samples lately
-                            frame[i] = prev_val;
-                        }
-                    }
-                    history[i] &= ~mask;
-                }
-            }
-
-            _cur_frame_index = (_cur_frame_index + 1) % 8;  // at end of cycle
-        }
+        temporal_smooth_params get_smooth_params() const;
 
     private:
         void on_set_persistence_control(uint8_t val);
         void on_set_alpha(float val);
         void on_set_delta(float val);
+        void on_set_half_resolution_history(bool val);
 
         void recalc_persistence_map();
         uint8_t                 _persistence_param;
@@ -104,9 +45,20 @@ namespace librealsense
         rs2::stream_profile     _target_stream_profile;
         std::vector<uint8_t>    _last_frame;                // Hold the last frame received for the current profile
         std::vector<uint8_t>    _history;                   // represents the history over the last 8 frames, 1 bit per frame
+        bool                    _half_resolution_history;   // one history byte per pair of pixels
         uint8_t                 _cur_frame_index;
         // encodes whether a particular 8 bit history is good enough for all 8 phases of storage
         std::array<uint8_t, PRESISTENCY_LUT_SIZE> _persistence_map;
+        row_bands               _bands;
     };
     MAP_EXTENSION(RS2_EXTENSION_TEMPORAL_FILTER, librealsense::temporal_filter);
+
+    // For each 8-bit history, whether it is credible enough for the given persistence mode, in each of the 8 phases
+    std::array<uint8_t, PRESISTENCY_LUT_SIZE> calc_persistence_map(uint8_t persistence_param);
+
+    // Smooth a whole frame, in row bands run in parallel, with the best kernel for the current SIMD level
+    void temporal_smooth(row_bands& bands, const uint16_t* in, uint16_t* out, uint16_t* last, uint8_t* history,
+                         size_t width, size_t height, const temporal_smooth_params& params);
+    void temporal_smooth(row_bands& bands, const float* in, float* out, float* last, uint8_t* history,
+                         size_t width, size_t height, const temporal_smooth_params& params);
 }
@@ -0,0 +1,42 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace librealsense {
+
+
+// The temporal filter's per-pixel kernels.
+
+
+// Parameters for smoothing one frame
+struct temporal_smooth_params
+{
+    float alpha;                   // The normalized weight of the current pixel
+    uint8_t delta;                 // Smooth only if the current and last values differ by less than this
+    uint8_t mask;                  // The bit of the current frame in the history
+    uint8_t credible[32];          // A bit per history value: whether it has had enough valid frames to fill a hole
+    bool half_resolution_history;  // One history byte per pair of pixels, rather than per pixel
+};
+
+
+// Smooth n pixels from 'in' into 'out' (may be the same), updating the 'last' values and the 'history' bits to match.
+// With a half-resolution history, the first pixel must be the first of its pair.
+void temporal_smooth_generic( uint16_t const * in, uint16_t * out, uint16_t * last, uint8_t * history, size_t n,
+                              temporal_smooth_params const & );
+void temporal_smooth_generic( float const * in, float * out, float * last, uint8_t * history, size_t n,
+                              temporal_smooth_params const & );
+
+#ifdef RS2_USE_X86_SIMD
+void temporal_smooth_sse( uint16_t const * in, uint16_t * out, uint16_t * last, uint8_t * history, size_t n,
+                          temporal_smooth_params const & );
+void temporal_smooth_sse( float const * in, float * out, float * last, uint8_t * history, size_t n,
+                          temporal_smooth_params const & );
+#endif
+
+
+}  // namespace librealsense
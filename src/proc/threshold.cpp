@@ -11,6 +11,7 @@
 #include "option.h"
 #include "threshold.h"
 #include "image.h"
+#include "depth-maps.h"
 
 namespace librealsense
 {
@@ -19,9 +20,9 @@ namespace librealsense
         _stream_filter.format = RS2_FORMAT_Z16;
         _stream_filter.stream = RS2_STREAM_DEPTH;
         
-        auto min_opt = std::make_shared<ptr_option<float>>(0.f, 16.f, 0.1f, 0.1f, &_min, "Min range in meters");
+        auto min_opt = std::make_shared<ptr_option<float>>(0.f, MAX_DISTANCE_RANGE, 0.1f, 0.1f, &_min, "Min range in meters");
 
-        auto max_opt = std::make_shared<ptr_option<float>>(0.f, 16.f, 0.1f, 4.f, &_max, "Max range in meters");
+        auto max_opt = std::make_shared<ptr_option<float>>(0.f, MAX_DISTANCE_RANGE, 0.1f, 4.f, &_max, "Max range in meters");
 
         register_option(RS2_OPTION_MAX_DISTANCE,
             std::make_shared<max_distance_option>(
@@ -66,12 +67,7 @@ namespace librealsense
             ptr->set_sensor(orig->get_sensor());
             auto du = orig->get_units();
 
-            memset(new_data, 0, width * height * sizeof(uint16_t));
-            for (int i = 0; i < width * height; i++)
-            {
-                auto dist = du * depth_data[i];
-                if (dist >= _min && dist <= _max) new_data[i] = depth_data[i];
-            }
+            threshold_z16(depth_data, new_data, size_t(width) * height, get_z16_range(du, _min, _max));
 
             return new_f;
         }
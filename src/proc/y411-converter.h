@@ -24,9 +24,5 @@ namespace librealsense
 
     void unpack_y411( uint8_t * const dest[], const uint8_t * const s, int w, int h, int actual_size);
 
-#if defined __SSSE3__ && ! defined ANDROID
-    void unpack_y411_sse( uint8_t * const dest, const uint8_t * const s, int w, int h, int actual_size);
-#endif
-
     void unpack_y411_native( uint8_t * const dest, const uint8_t * const s, int w, int h, int actual_size);
 }
@@ -27,6 +27,7 @@
 #include "proc/align.h"
 #include "proc/threshold.h"
 #include "proc/units-transform.h"
+#include "proc/rvl-codec.h"
 #include "proc/disparity-transform.h"
 #include "proc/syncer-processing-block.h"
 #include "proc/decimation-filter.h"
@@ -35,6 +36,7 @@
 #include "proc/hole-filling-filter.h"
 #include "proc/color-formats-converter.h"
 #include "proc/y411-converter.h"
+#include "proc/resizing-color-converter.h"
 #include "proc/rates-printer.h"
 #include "proc/hdr-merge.h"
 #include "proc/sequence-id-filter.h"
@@ -50,6 +52,7 @@
 #include "global_timestamp_reader.h"
 #include "auto-calibrated-device.h"
 #include "terminal-parser.h"
+#include "simd-dispatch.h"
 #include "firmware_logger_device.h"
 #include "device-calibration.h"
 #include <librealsense2/h/rs_internal.h>
@@ -63,6 +66,7 @@
 
 #include <src/core/time-service.h>
 #include <rsutils/string/from.h>
+#include <rsutils/codec/rvl.h>
 
 ////////////////////////
 // API implementation //
@@ -822,6 +826,13 @@ void rs2_delete_option_value( rs2_option_value const * p_value ) BEGIN_API_CALL
 }
 NOEXCEPT_RETURN( , p_value )
 
+// Sensors watching their options for changes can update right away rather than wait for the next poll
+static void notify_option_written( const rs2_options * options, rs2_option option )
+{
+    if( auto sensor = dynamic_cast< librealsense::sensor_interface * >( options->options ) )
+        sensor->on_option_written( option );
+}
+
 void rs2_set_option(const rs2_options* options, rs2_option option, float value, rs2_error** error) BEGIN_API_CALL
 {
     VALIDATE_NOT_NULL(options);
@@ -866,6 +877,7 @@ void rs2_set_option(const rs2_options* options, rs2_option option, float value,
         }
         throw not_implemented_exception("use rs2_set_option_value to set string values");
     }
+    notify_option_written( options, option );
 }
 HANDLE_EXCEPTIONS_AND_RETURN(, options, option, value)
 
@@ -877,6 +889,7 @@ void rs2_set_option_value( rs2_options const * options, rs2_option_value const *
     if( ! option_value->is_valid )
     {
         option.set_value( rsutils::null_json );
+        notify_option_written( options, option_value->id );
         return;
     }
     rs2_option_type const option_type = option.get_value_type();
@@ -914,6 +927,7 @@ void rs2_set_option_value( rs2_options const * options, rs2_option_value const *
     default:
         throw not_implemented_exception( "unexpected option type " + get_string( option_type ) );
     }
+    notify_option_written( options, option_value->id );
 }
 HANDLE_EXCEPTIONS_AND_RETURN( , options, option_value )
 
@@ -1941,6 +1955,7 @@ int rs2_is_frame_extendable_to(const rs2_frame* f, rs2_extension extension_type,
     case RS2_EXTENSION_DISPARITY_FRAME : return VALIDATE_INTERFACE_NO_THROW((frame_interface*)f, librealsense::disparity_frame) != nullptr;
     case RS2_EXTENSION_MOTION_FRAME    : return VALIDATE_INTERFACE_NO_THROW((frame_interface*)f, librealsense::motion_frame)    != nullptr;
     case RS2_EXTENSION_POSE_FRAME      : return VALIDATE_INTERFACE_NO_THROW((frame_interface*)f, librealsense::pose_frame)      != nullptr;
+    case RS2_EXTENSION_MOTION_BLOCK_FRAME: return VALIDATE_INTERFACE_NO_THROW((frame_interface*)f, librealsense::motion_block_frame) != nullptr;
 
     default:
         return false;
@@ -2051,6 +2066,24 @@ void rs2_playback_seek(const rs2_device* device, long long int time, rs2_error**
 }
 HANDLE_EXCEPTIONS_AND_RETURN(, device)
 
+void rs2_playback_seek_to_frame(const rs2_device* device, const rs2_stream_profile* profile, unsigned long long int frame_index, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(device);
+    VALIDATE_NOT_NULL(profile);
+    auto playback = VALIDATE_INTERFACE(device->device, librealsense::playback_device);
+    playback->seek_to_frame(*profile->profile, frame_index);
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, device, profile, frame_index)
+
+unsigned long long int rs2_playback_get_frame_count(const rs2_device* device, const rs2_stream_profile* profile, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(device);
+    VALIDATE_NOT_NULL(profile);
+    auto playback = VALIDATE_INTERFACE(device->device, librealsense::playback_device);
+    return playback->get_frame_count(*profile->profile);
+}
+HANDLE_EXCEPTIONS_AND_RETURN(0, device, profile)
+
 unsigned long long int rs2_playback_get_position(const rs2_device* device, rs2_error** error) BEGIN_API_CALL
 {
     VALIDATE_NOT_NULL(device);
@@ -2091,6 +2124,34 @@ int rs2_playback_device_is_real_time(const rs2_device* device, rs2_error** error
 }
 HANDLE_EXCEPTIONS_AND_RETURN(0, device)
 
+void rs2_playback_device_set_read_ahead(const rs2_device* device, int chunks, int threads, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(device);
+    VALIDATE_LE(0, chunks);
+    VALIDATE_RANGE(threads, 1, 64);
+    auto playback = VALIDATE_INTERFACE(device->device, librealsense::playback_device);
+    playback->set_read_ahead(chunks, threads);
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, device, chunks, threads)
+
+void rs2_playback_device_set_max_throughput(const rs2_device* device, int queue_size, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(device);
+    // Queued frames are held from the reader's frame pool, which is only so big
+    VALIDATE_RANGE(queue_size, 0, 16);
+    auto playback = VALIDATE_INTERFACE(device->device, librealsense::playback_device);
+    playback->set_max_throughput(queue_size);
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, device, queue_size)
+
+float rs2_playback_device_get_throughput(const rs2_device* device, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(device);
+    auto playback = VALIDATE_INTERFACE(device->device, librealsense::playback_device);
+    return float(playback->get_throughput());
+}
+HANDLE_EXCEPTIONS_AND_RETURN(0, device)
+
 void rs2_playback_device_set_status_changed_callback(const rs2_device* device, rs2_playback_status_changed_callback* callback, rs2_error** error) BEGIN_API_CALL
 {
     // Take ownership of the callback ASAP or else memory leaks could result if we throw! (the caller usually does a
@@ -2173,6 +2234,15 @@ void rs2_record_device_resume(const rs2_device* device, rs2_error** error) BEGIN
 }
 HANDLE_EXCEPTIONS_AND_RETURN(, device)
 
+void rs2_record_device_set_depth_codec(const rs2_device* device, int enabled, int trim_bits, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(device);
+    VALIDATE_RANGE(trim_bits, 0, int(rsutils::codec::rvl_max_trim_bits));
+    auto record_device = VALIDATE_INTERFACE(device->device, librealsense::record_device);
+    record_device->set_depth_codec(enabled != 0, unsigned(trim_bits));
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, device, enabled, trim_bits)
+
 const char* rs2_record_device_filename(const rs2_device* device, rs2_error** error) BEGIN_API_CALL
 {
     VALIDATE_NOT_NULL(device);
@@ -2387,6 +2457,14 @@ rs2_pipeline_profile* rs2_pipeline_get_active_profile(rs2_pipeline* pipe, rs2_er
 }
 HANDLE_EXCEPTIONS_AND_RETURN(nullptr, pipe)
 
+const rs2_raw_data_buffer* rs2_get_pipeline_statistics(rs2_pipeline* pipe, rs2_error ** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(pipe);
+    auto str = pipe->pipeline->get_statistics().dump();
+    return new rs2_raw_data_buffer{ std::vector< uint8_t >( str.begin(), str.end() ) };
+}
+HANDLE_EXCEPTIONS_AND_RETURN(nullptr, pipe)
+
 rs2_device* rs2_pipeline_profile_get_device(rs2_pipeline_profile* profile, rs2_error ** error) BEGIN_API_CALL
 {
     VALIDATE_NOT_NULL(profile);
@@ -2732,6 +2810,14 @@ int rs2_get_frame_points_count(const rs2_frame* frame, rs2_error** error) BEGIN_
 }
 HANDLE_EXCEPTIONS_AND_RETURN(0, frame)
 
+int rs2_get_motion_block_size(const rs2_frame* frame, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(frame);
+    auto block = VALIDATE_INTERFACE((frame_interface*)frame, librealsense::motion_block_frame);
+    return static_cast<int>(block->get_sample_count());
+}
+HANDLE_EXCEPTIONS_AND_RETURN(0, frame)
+
 rs2_processing_block* rs2_create_pointcloud(rs2_error** error) BEGIN_API_CALL
 {
     return new rs2_processing_block { pointcloud::create() };
@@ -2750,6 +2836,13 @@ rs2_processing_block* rs2_create_y411_decoder(rs2_error** error) BEGIN_API_CALL
 }
 NOARGS_HANDLE_EXCEPTIONS_AND_RETURN(nullptr)
 
+rs2_processing_block* rs2_create_resizing_color_converter(rs2_format target_format, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_ENUM(target_format);
+    return new rs2_processing_block { std::make_shared<resizing_color_converter>(target_format) };
+}
+HANDLE_EXCEPTIONS_AND_RETURN(nullptr, target_format)
+
 rs2_processing_block* rs2_create_threshold(rs2_error** error) BEGIN_API_CALL
 {
     return new rs2_processing_block { std::make_shared<threshold>() };
@@ -2762,6 +2855,19 @@ rs2_processing_block* rs2_create_units_transform(rs2_error** error) BEGIN_API_CA
 }
 NOARGS_HANDLE_EXCEPTIONS_AND_RETURN(nullptr)
 
+rs2_processing_block* rs2_create_rvl_encoder_block(int trim_bits, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_RANGE(trim_bits, 0, int(rsutils::codec::rvl_max_trim_bits));
+    return new rs2_processing_block { std::make_shared<rvl_encoder>(unsigned(trim_bits)) };
+}
+HANDLE_EXCEPTIONS_AND_RETURN(nullptr, trim_bits)
+
+rs2_processing_block* rs2_create_rvl_decoder_block(rs2_error** error) BEGIN_API_CALL
+{
+    return new rs2_processing_block { std::make_shared<rvl_decoder>() };
+}
+NOARGS_HANDLE_EXCEPTIONS_AND_RETURN(nullptr)
+
 rs2_processing_block* rs2_create_align(rs2_stream align_to, rs2_error** error) BEGIN_API_CALL
 {
     VALIDATE_ENUM(align_to);
@@ -3297,6 +3403,14 @@ rs2_processing_block_list* rs2_get_recommended_processing_blocks(rs2_sensor* sen
 }
 HANDLE_EXCEPTIONS_AND_RETURN(nullptr, sensor)
 
+const rs2_raw_data_buffer* rs2_get_sensor_statistics(const rs2_sensor* sensor, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(sensor);
+    auto str = sensor->sensor->get_statistics().dump();
+    return new rs2_raw_data_buffer{ std::vector< uint8_t >( str.begin(), str.end() ) };
+}
+HANDLE_EXCEPTIONS_AND_RETURN(nullptr, sensor)
+
 rs2_processing_block* rs2_get_processing_block(const rs2_processing_block_list* list, int index, rs2_error** error) BEGIN_API_CALL
 {
     VALIDATE_NOT_NULL(list);
@@ -4049,6 +4163,19 @@ rs2_raw_data_buffer* rs2_terminal_parse_response(rs2_terminal_parser* terminal_p
 }
 HANDLE_EXCEPTIONS_AND_RETURN(nullptr, terminal_parser, command, response)
 
+rs2_simd_level rs2_get_simd_level(rs2_error** error) BEGIN_API_CALL
+{
+    return librealsense::get_simd_level();
+}
+NOARGS_HANDLE_EXCEPTIONS_AND_RETURN(RS2_SIMD_LEVEL_GENERIC)
+
+rs2_simd_level rs2_set_simd_level(rs2_simd_level level, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_RANGE(level, RS2_SIMD_LEVEL_GENERIC, RS2_SIMD_LEVEL_COUNT - 1);
+    return librealsense::set_simd_level(level);
+}
+HANDLE_EXCEPTIONS_AND_RETURN(RS2_SIMD_LEVEL_GENERIC, level)
+
 void rs2_project_point_to_pixel(float pixel[2], const struct rs2_intrinsics* intrin, const float point[3]) BEGIN_API_CALL
 {
     float x = point[0] / point[2], y = point[1] / point[2];
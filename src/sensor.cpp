@@ -65,6 +65,7 @@ void log_callback_end( uint32_t fps,
     , _on_open( nullptr )
     , _metadata_modifier( nullptr )
     , _metadata_parsers( std::make_shared< metadata_parser_map >() )
+    , _statistics( std::make_shared< frame_statistics >() )
     , _owner( dev )
     , _profiles(
           [this]()
@@ -75,6 +76,10 @@ void log_callback_end( uint32_t fps,
           } )
     {
         register_option(RS2_OPTION_FRAMES_QUEUE_SIZE, _source.get_published_size_option());
+        register_option( RS2_OPTION_FRAMES_QUEUE_POLICY, _source.get_publish_policy_option() );
+        register_option( RS2_OPTION_FRAMES_QUEUE_MEMORY_LIMIT, _source.get_publish_memory_limit_option() );
+        _source.set_statistics( _statistics );
+        _source.set_notifications_processor( _notifications_processor );
 
         register_metadata( RS2_FRAME_METADATA_TIME_OF_ARRIVAL,
                            make_additional_data_parser_unless( &frame_additional_data::system_time, rs2_time_t( 0 ) ) );
@@ -214,6 +219,33 @@ void log_callback_end( uint32_t fps,
     void sensor_base::set_source_owner(sensor_base* owner)
     {
         _source_owner = owner;
+        // Our frames are counted as our owner's; it delivers them, after conversion
+        _source.set_statistics( owner->_statistics, owner == this );
+        _source.set_notifications_processor( owner->_notifications_processor );
+        if( owner != this )
+        {
+            // Our frames are the ones the user holds on to, so the owner's frame queue options are really ours
+            owner->sensor_base::register_option( RS2_OPTION_FRAMES_QUEUE_SIZE, _source.get_published_size_option() );
+            owner->sensor_base::register_option( RS2_OPTION_FRAMES_QUEUE_POLICY, _source.get_publish_policy_option() );
+            owner->sensor_base::register_option( RS2_OPTION_FRAMES_QUEUE_MEMORY_LIMIT,
+                                                 _source.get_publish_memory_limit_option() );
+        }
+    }
+
+    rsutils::json sensor_base::get_statistics() const
+    {
+        auto streams = _statistics->to_json();
+        auto archives = get_archive_statistics();
+        for( auto & archive : archives.items() )
+            streams[archive.key()]["archive"] = std::move( archive.value() );
+        rsutils::json j = rsutils::json::object();
+        j["streams"] = std::move( streams );
+        return j;
+    }
+
+    rsutils::json sensor_base::get_archive_statistics() const
+    {
+        return _source.get_archive_statistics();
     }
 
     stream_profiles sensor_base::get_stream_profiles( int tag ) const
@@ -415,12 +447,8 @@ void log_callback_end( uint32_t fps,
         , _raw_sensor( raw_sensor )
         , _options_watcher( _raw_sensor )
     {
-        rsutils::json const & settings = device->get_context()->get_settings();
-        if( auto interval_j = settings.nested( std::string( "options-update-interval", 23 ) ) )
-        {
-            auto interval = interval_j.get< uint32_t >();  // NOTE: can throw!
-            _options_watcher.set_update_interval( std::chrono::milliseconds( interval ) );
-        }
+        _options_watcher.configure( device->get_context()->get_settings() );
+        _formats_converter.set_statistics( _statistics );
 
         // synthetic sensor and its raw sensor will share the formats and streams mapping
         auto& raw_fourcc_to_rs2_format_map = _raw_sensor->get_fourcc_to_rs2_format_map();
@@ -535,6 +563,19 @@ void log_callback_end( uint32_t fps,
         });
     }
 
+    rsutils::json synthetic_sensor::get_statistics() const
+    {
+        auto j = sensor_base::get_statistics();
+        j["options"] = _options_watcher.get_statistics().to_json();
+        return j;
+    }
+
+    rsutils::json synthetic_sensor::get_archive_statistics() const
+    {
+        // The frames we receive are allocated by the raw sensor; ours come from the conversion blocks
+        return _raw_sensor->get_archive_statistics();
+    }
+
     void synthetic_sensor::register_processing_block_options(const processing_block & pb)
     {
         // Register the missing processing block's options to the sensor
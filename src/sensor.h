@@ -115,6 +115,10 @@ namespace librealsense
             throw not_implemented_exception( "Registering options value changed callback is not implemented for this sensor" );
         }
 
+        rsutils::json get_statistics() const override;
+        // Where our frames were allocated
+        virtual rsutils::json get_archive_statistics() const;
+
     protected:
         // Since _profiles is private, we need a way to get the final profiles
         stream_profiles const & initialized_profiles() const { return *_profiles; }
@@ -153,6 +157,7 @@ namespace librealsense
         std::shared_ptr<metadata_parser_map> _metadata_parsers = nullptr;
 
         sensor_base* _source_owner = nullptr;
+        std::shared_ptr< frame_statistics > _statistics;  // shared with our raw sensor, if we're synthetic
         frame_source _source;
         device* _owner;
 
@@ -257,12 +262,16 @@ namespace librealsense
         bool is_opened() const override;
 
         rsutils::subscription register_options_changed_callback( options_watcher::callback && cb ) override;
+        void on_option_written( rs2_option id ) override { _options_watcher.option_written( id ); }
         virtual void register_option_to_update( rs2_option id, std::shared_ptr< option > option );
         virtual void unregister_option_from_update( rs2_option id );
 
         void prepare_for_bulk_operation() override { _raw_sensor->prepare_for_bulk_operation(); }
         void finished_bulk_operation() override { _raw_sensor->finished_bulk_operation(); }
 
+        rsutils::json get_statistics() const override;
+        rsutils::json get_archive_statistics() const override;
+
     private:
         void register_processing_block_options(const processing_block& pb);
         void unregister_processing_block_options(const processing_block& pb);
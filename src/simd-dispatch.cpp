@@ -0,0 +1,115 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "simd-dispatch.h"
+
+#include <rsutils/easylogging/easyloggingpp.h>
+#include <rsutils/string/string-utilities.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+
+#if defined( RS2_USE_X86_SIMD ) && defined( _MSC_VER )
+#include <intrin.h>
+#include <immintrin.h>  // _xgetbv
+#endif
+
+
+namespace librealsense {
+
+
+const char * get_string( rs2_simd_level level )
+{
+    switch( level )
+    {
+    case RS2_SIMD_LEVEL_GENERIC: return "generic";
+    case RS2_SIMD_LEVEL_SSSE3: return "ssse3";
+    case RS2_SIMD_LEVEL_AVX2: return "avx2";
+    default: return "unknown";
+    }
+}
+
+
+static rs2_simd_level detect_simd_level()
+{
+#if defined( RS2_USE_X86_SIMD ) && defined( _MSC_VER )
+    int info[4];
+    __cpuid( info, 0 );
+    int const n_ids = info[0];
+    __cpuid( info, 1 );
+    bool const ssse3 = ( info[2] & ( 1 << 9 ) ) != 0;
+    // AVX registers must also be enabled by the OS (OSXSAVE, then XCR0 says it saves them)
+    bool const avx = ( info[2] & ( 1 << 27 ) ) && ( info[2] & ( 1 << 28 ) ) && ( _xgetbv( 0 ) & 6 ) == 6;
+    bool avx2 = false;
+    if( avx && n_ids >= 7 )
+    {
+        __cpuidex( info, 7, 0 );
+        avx2 = ( info[1] & ( 1 << 5 ) ) != 0;
+    }
+#elif defined( RS2_USE_X86_SIMD )
+    // Takes OS support for the AVX registers into account, too
+    __builtin_cpu_init();
+    bool const ssse3 = __builtin_cpu_supports( "ssse3" );
+    bool const avx2 = __builtin_cpu_supports( "avx2" );
+#else
+    bool const ssse3 = false;
+    bool const avx2 = false;
+#endif
+    if( avx2 && ssse3 )
+        return RS2_SIMD_LEVEL_AVX2;
+    if( ssse3 )
+        return RS2_SIMD_LEVEL_SSSE3;
+    return RS2_SIMD_LEVEL_GENERIC;
+}
+
+
+rs2_simd_level get_supported_simd_level()
+{
+    static rs2_simd_level const supported = detect_simd_level();
+    return supported;
+}
+
+
+static rs2_simd_level initial_simd_level()
+{
+    auto const supported = get_supported_simd_level();
+    auto level = supported;
+    if( auto const env = std::getenv( "LRS_SIMD_LEVEL" ) )
+    {
+        auto const name = rsutils::string::to_lower( env );
+        int l = 0;
+        while( l < RS2_SIMD_LEVEL_COUNT && name != get_string( rs2_simd_level( l ) ) )
+            ++l;
+        if( l < RS2_SIMD_LEVEL_COUNT )
+            level = std::min( supported, rs2_simd_level( l ) );
+        else
+            LOG_WARNING( "Ignoring invalid LRS_SIMD_LEVEL '" << env << "'; expecting generic, ssse3 or avx2" );
+    }
+    LOG_DEBUG( "SIMD level: " << get_string( level ) << " (supported: " << get_string( supported ) << ")" );
+    return level;
+}
+
+
+static std::atomic< int > & simd_level()
+{
+    static std::atomic< int > level( initial_simd_level() );
+    return level;
+}
+
+
+rs2_simd_level get_simd_level()
+{
+    return rs2_simd_level( simd_level().load( std::memory_order_relaxed ) );
+}
+
+
+rs2_simd_level set_simd_level( rs2_simd_level level )
+{
+    level = std::min( level, get_supported_simd_level() );
+    simd_level() = level;
+    return level;
+}
+
+
+}  // namespace librealsense
@@ -0,0 +1,70 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <librealsense2/h/rs_internal.h>
+
+#include <cstddef>
+
+
+namespace librealsense {
+
+
+// SIMD kernels (format conversions, etc.) are compiled into separate translation units, one per instruction set, each
+// with its own compiler flags; the rest of the library targets the baseline CPU. Which kernel runs is decided at
+// runtime according to what the CPU supports. RS2_USE_X86_SIMD is defined when the x86 kernels are built.
+//
+// The kernels are declared in headers that the SIMD translation units include, too: keep them light (see
+// src/CMakeLists.txt). The _sse and _avx2 functions may only be called once the CPU is known to support them, i.e.
+// through simd_kernel below.
+
+
+const char * get_string( rs2_simd_level );
+
+// The highest level both the CPU and this build support; detected once
+rs2_simd_level get_supported_simd_level();
+
+// The highest level kernels should use: the supported level, unless limited by the LRS_SIMD_LEVEL environment variable
+// or set_simd_level()
+rs2_simd_level get_simd_level();
+
+// Limit the level kernels use, e.g. for testing; returns the level now in effect (never more than supported)
+rs2_simd_level set_simd_level( rs2_simd_level );
+
+
+// The implementations of a single kernel, per SIMD level. Only the generic one is required; get() returns the best
+// one for the current level:
+//
+//     static simd_kernel< convert_fn > const kernel
+//         = simd_kernel< convert_fn >( convert_generic ).add( RS2_SIMD_LEVEL_SSSE3, convert_sse );
+//     kernel.get()( ... );
+//
+template< class Fn >
+class simd_kernel
+{
+    Fn _impl[RS2_SIMD_LEVEL_COUNT] = {};
+
+public:
+    explicit simd_kernel( Fn generic ) { _impl[RS2_SIMD_LEVEL_GENERIC] = generic; }
+
+    simd_kernel & add( rs2_simd_level level, Fn impl )
+    {
+        _impl[level] = impl;
+        return *this;
+    }
+
+    // The highest implementation that does not exceed the given level
+    Fn get( rs2_simd_level level ) const
+    {
+        for( int l = level; l > RS2_SIMD_LEVEL_GENERIC; --l )
+            if( _impl[l] )
+                return _impl[l];
+        return _impl[RS2_SIMD_LEVEL_GENERIC];
+    }
+
+    Fn get() const { return get( get_simd_level() ); }
+};
+
+
+}  // namespace librealsense
@@ -74,6 +74,9 @@ software_sensor::software_sensor( std::string const & name, software_device * ow
     // also share their parsers:
     static auto software_metadata_parser_map = create_software_metadata_parser_map();
     _metadata_parsers = software_metadata_parser_map;
+
+    // Frames are produced when the user calls on_video_frame() etc., so the user is the one who'd wait
+    _source.allow_blocking_producer();
 }
 
 
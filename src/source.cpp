@@ -3,11 +3,13 @@
 
 #include <src/source.h>
 
+#include <src/core/enum-helpers.h>  // before option.h, for enum_option's get_string()
 #include <src/option.h>
 #include <src/core/frame-holder.h>
-#include <src/core/enum-helpers.h>
+#include <src/core/notification.h>
 
 #include <rsutils/string/from.h>
+#include <rsutils/json.h>
 #include <src/core/stream-profile-interface.h>
 
 namespace librealsense
@@ -42,14 +44,96 @@ namespace librealsense
         std::atomic<uint32_t>* _ptr;
     };
 
+    class frame_queue_policy
+        : public option_base
+        , public enum_option< rs2_frames_queue_policy >
+    {
+    public:
+        frame_queue_policy( frame_publish_limits * limits )
+            : option_base( option_range{ 0, RS2_FRAMES_QUEUE_POLICY_COUNT - 1, 1, RS2_FRAMES_QUEUE_POLICY_DROP_NEWEST } )
+            , _limits( limits )
+        {
+        }
+
+        void set( float value ) override
+        {
+            if( ! is_valid( value ) )
+                throw invalid_value_exception( rsutils::string::from() << "set(frame_queue_policy) failed! Given value "
+                                                                       << value << " is out of range." );
+            if( static_cast< int >( value ) == RS2_FRAMES_QUEUE_POLICY_BLOCK && ! _limits->producer_may_block )
+                throw invalid_value_exception( "set(frame_queue_policy) failed! The Block policy is only available "
+                                               "to software sensors and processing blocks: this sensor's frames "
+                                               "arrive on a backend thread, which must not wait" );
+
+            _limits->policy = static_cast< int >( value );
+            _recording_function( *this );
+        }
+
+        float query() const override { return static_cast< float >( _limits->policy.load() ); }
+
+        bool is_enabled() const override { return true; }
+
+        const char * get_description() const override
+        {
+            return "What to do with new frames when older ones are not released or handled fast enough: drop the new "
+                   "ones, keep only the latest, block, or limit the memory held rather than the number of frames";
+        }
+
+    private:
+        frame_publish_limits * _limits;
+    };
+
+    class frame_queue_memory_limit : public option_base
+    {
+    public:
+        frame_queue_memory_limit( std::atomic< uint32_t > * ptr )
+            : option_base( option_range{ 1, 4096, 1, 256 } )
+            , _ptr( ptr )
+        {
+        }
+
+        void set( float value ) override
+        {
+            if( ! is_valid( value ) )
+                throw invalid_value_exception( rsutils::string::from()
+                                               << "set(frame_queue_memory_limit) failed! Given value " << value
+                                               << " is out of range." );
+
+            *_ptr = static_cast< uint32_t >( value );
+            _recording_function( *this );
+        }
+
+        float query() const override { return static_cast< float >( _ptr->load() ); }
+
+        bool is_enabled() const override { return true; }
+
+        const char * get_description() const override
+        {
+            return "Max megabytes of frames you can hold at a given time, with the Memory Limit frames queue policy";
+        }
+
+    private:
+        std::atomic< uint32_t > * _ptr;
+    };
+
     std::shared_ptr<option> frame_source::get_published_size_option()
     {
-        return std::make_shared<frame_queue_size>(&_max_publish_list_size, option_range{ 0, 32, 1, 16 });
+        return std::make_shared<frame_queue_size>(&_publish_limits.max_frames, option_range{ 0, 32, 1, 16 });
+    }
+
+    std::shared_ptr< option > frame_source::get_publish_policy_option()
+    {
+        return std::make_shared< frame_queue_policy >( &_publish_limits );
+    }
+
+    std::shared_ptr< option > frame_source::get_publish_memory_limit_option()
+    {
+        return std::make_shared< frame_queue_memory_limit >( &_publish_limits.max_megabytes );
     }
 
     frame_source::frame_source( uint32_t max_publish_list_size )
         : _callback( nullptr, []( rs2_frame_callback * ) {} )
-        , _max_publish_list_size( max_publish_list_size )
+        , _publish_limits( max_publish_list_size )
     {}
 
     void frame_source::init(std::shared_ptr<metadata_parser_map> metadata_parsers)
@@ -62,6 +146,7 @@ namespace librealsense
                                   RS2_EXTENSION_DEPTH_FRAME,
                                   RS2_EXTENSION_DISPARITY_FRAME,
                                   RS2_EXTENSION_MOTION_FRAME,
+                                  RS2_EXTENSION_MOTION_BLOCK_FRAME,
                                   RS2_EXTENSION_POSE_FRAME };
 
         _metadata_parsers = metadata_parsers;
@@ -77,7 +162,7 @@ namespace librealsense
         if( it == _supported_extensions.end() )
             throw wrong_api_call_sequence_exception( "Requested frame type is not supported!" );
 
-        auto ret = _archive.insert( { id, make_archive( ex, &_max_publish_list_size, _metadata_parsers ) } );
+        auto ret = _archive.insert( { id, make_archive( ex, &_publish_limits, _metadata_parsers ) } );
         if( ! ret.second || ! ret.first->second ) // Check insertion success and allocation success
             throw std::runtime_error( rsutils::string::from() << "Failed to create archive of type " << get_string( ex ) );
 
@@ -103,6 +188,7 @@ namespace librealsense
 
     void frame_source::reset()
     {
+        stop_delivering_latest();
         std::lock_guard< std::recursive_mutex > lock( _mutex );
 
         _callback.reset();
@@ -125,7 +211,71 @@ namespace librealsense
         if( it == _archive.end() )
             it = create_archive( id );
 
-        return it->second->alloc_and_track( size, std::move( additional_data ), requires_memory );
+        auto frame = it->second->alloc_and_track( size, std::move( additional_data ), requires_memory );
+        if( _statistics )
+            stream_frame_counters::add(
+                _statistics->get( std::get< rs2_stream >( id ), std::get< int >( id ) ).received );
+        if( ! frame )
+            on_frame_dropped( std::get< rs2_stream >( id ), std::get< int >( id ), frame_drop_reason::archive_full );
+        return frame;
+    }
+
+    void frame_source::on_frame_dropped( rs2_stream stream, int index, frame_drop_reason reason ) const
+    {
+        if( _statistics )
+            _statistics->get( stream, index ).add_dropped( reason );
+
+        auto notifications = _notifications.lock();
+        if( ! notifications )
+            return;
+
+        // A consumer that cannot keep up drops frames continuously: we don't want to flood it with notifications, too
+        std::lock_guard< std::mutex > lock( _drops_mutex );
+        ++_n_unreported_drops;
+        auto const now = std::chrono::steady_clock::now();
+        if( now - _last_drops_notification < std::chrono::seconds( 1 ) )
+            return;
+
+        std::string stream_name = get_string( stream );
+        if( index )
+            stream_name += ' ' + std::to_string( index );
+        notifications->raise_notification( notification( RS2_NOTIFICATION_CATEGORY_FRAMES_DROPPED,
+                                                         0,
+                                                         RS2_LOG_SEVERITY_WARN,
+                                                         rsutils::string::from()
+                                                             << _n_unreported_drops << " frame(s) dropped; last was "
+                                                             << stream_name << " (" << get_string( reason ) << ")" ) );
+        _n_unreported_drops = 0;
+        _last_drops_notification = now;
+    }
+
+    void frame_source::set_statistics( std::shared_ptr< frame_statistics > const & statistics, bool count_delivered )
+    {
+        std::lock_guard< std::recursive_mutex > lock( _mutex );
+        _statistics = statistics;
+        _count_delivered = count_delivered;
+    }
+
+    rsutils::json frame_source::get_archive_statistics() const
+    {
+        rsutils::json j = rsutils::json::object();
+
+        std::lock_guard< std::recursive_mutex > lock( _mutex );
+        for( auto & kvp : _archive )
+        {
+            auto const stream = std::get< rs2_stream >( kvp.first );
+            if( ! kvp.second || stream == RS2_STREAM_COUNT )  // extensions
+                continue;
+            std::string name = get_string( stream );
+            if( auto index = std::get< int >( kvp.first ) )
+                name += ' ' + std::to_string( index );
+            // A stream may have more than one archive (e.g., video and depth frames); we add them up
+            auto & a = j[name];
+            a["in-use"] = a.nested( "in-use" ).default_value( 0u ) + kvp.second->get_published_count();
+            a["high-water"] = a.nested( "high-water" ).default_value( 0u ) + kvp.second->get_published_high_water();
+            a["capacity"] = kvp.second->get_published_capacity();
+        }
+        return j;
     }
 
     void frame_source::set_sensor( const std::weak_ptr< sensor_interface > & s )
@@ -153,6 +303,42 @@ namespace librealsense
     }
 
     void frame_source::invoke_callback(frame_holder frame) const
+    {
+        if( _publish_limits.policy == RS2_FRAMES_QUEUE_POLICY_KEEP_LATEST )
+            deliver_latest( std::move( frame ) );
+        else
+            deliver( std::move( frame ) );
+    }
+
+    void frame_source::deliver_latest( frame_holder frame ) const
+    {
+        if( ! frame || ! frame->get_stream() )
+            return;
+
+        auto const stream = frame->get_stream()->get_stream_type();
+        auto const index = frame->get_stream()->get_stream_index();
+        std::shared_ptr< dispatcher > stream_dispatcher;
+        {
+            std::lock_guard< std::recursive_mutex > lock( _mutex );
+            auto & d = _latest_dispatchers[{ stream, index }];
+            if( ! d )
+            {
+                // Room for one waiting frame: a newer one replaces it
+                d = std::make_shared< dispatcher >(
+                    1,
+                    [this, stream, index]( dispatcher::action )
+                    { on_frame_dropped( stream, index, frame_drop_reason::queue_full ); } );
+                d->start();
+            }
+            stream_dispatcher = d;
+        }
+
+        //TODO: remove usage of shared_ptr when frame_holder is copyable
+        auto pf = std::make_shared< frame_holder >( std::move( frame ) );
+        stream_dispatcher->invoke( [this, pf]( dispatcher::cancellable_timer ) { deliver( std::move( *pf ) ); } );
+    }
+
+    void frame_source::deliver( frame_holder frame ) const
     {
         if (frame && frame.frame && frame.frame->get_owner())
         {
@@ -160,6 +346,8 @@ namespace librealsense
             {
                 if (_callback)
                 {
+                    if( _statistics && _count_delivered )
+                        _statistics->add( frame.frame, &stream_frame_counters::delivered );
                     frame_interface* ref = nullptr;
                     std::swap(frame.frame, ref);
                     _callback->on_frame((rs2_frame*)ref);
@@ -176,8 +364,22 @@ namespace librealsense
         }
     }
 
+    void frame_source::stop_delivering_latest() const
+    {
+        // Once stopped, a dispatcher is done calling its callback and discards the frames still waiting. This must be
+        // done without the lock, which the callback may need.
+        std::map< std::pair< rs2_stream, int >, std::shared_ptr< dispatcher > > latest_dispatchers;
+        {
+            std::lock_guard< std::recursive_mutex > lock( _mutex );
+            latest_dispatchers.swap( _latest_dispatchers );
+        }
+        for( auto & d : latest_dispatchers )
+            d.second->stop();
+    }
+
     void frame_source::flush() const
     {
+        stop_delivering_latest();
         std::lock_guard< std::recursive_mutex > lock( _mutex );
 
         for( auto & kvp : _archive )
@@ -6,7 +6,13 @@
 
 #include <librealsense2/hpp/rs_types.hpp>
 #include <src/frame-archive.h>
+#include <src/core/frame-statistics.h>
 
+#include <rsutils/json-fwd.h>
+#include <rsutils/concurrency/concurrency.h>
+
+#include <chrono>
+#include <map>
 #include <tuple>
 
 namespace librealsense
@@ -14,6 +20,7 @@ namespace librealsense
     class option;
     class frame_holder;
     class archive_interface;
+    class notifications_processor;
 
     class LRS_EXTENSION_API frame_source
     {
@@ -28,7 +35,11 @@ namespace librealsense
 
         void reset();
 
+        // RS2_OPTION_FRAMES_QUEUE_SIZE, RS2_OPTION_FRAMES_QUEUE_POLICY and RS2_OPTION_FRAMES_QUEUE_MEMORY_LIMIT, which
+        // apply to each of our streams separately
         std::shared_ptr< option > get_published_size_option();
+        std::shared_ptr< option > get_publish_policy_option();
+        std::shared_ptr< option > get_publish_memory_limit_option();
 
         frame_interface * alloc_frame( archive_id id,
                                        size_t size,
@@ -60,10 +71,33 @@ namespace librealsense
             // We use a special index for extensions since we don't know the stream type here.
             // We can't wait with the allocation because we need the type T in the creation.
             archive_id special_index = { RS2_STREAM_COUNT, 0, ex };
-            _archive[special_index] = std::make_shared< frame_archive< T > >( &_max_publish_list_size, _metadata_parsers );
+            _archive[special_index] = std::make_shared< frame_archive< T > >( &_publish_limits, _metadata_parsers );
         }
 
-        void set_max_publish_list_size( int qsize ) { _max_publish_list_size = qsize; }
+        void set_max_publish_list_size( int qsize ) { _publish_limits.max_frames = qsize; }
+
+        // Allow the BLOCK frames queue policy, which makes whoever allocates our frames wait for the user to release
+        // some. Only for sources whose frames are produced on the user's thread (software sensors, processing blocks):
+        // a backend thread that waits loses the frames the device sends meanwhile. Call before the options are used.
+        void allow_blocking_producer() { _publish_limits.producer_may_block = true; }
+
+        // Count a frame that never made it to the user, and report it if we have somewhere to do so; for frames that
+        // are dropped before we could allocate them
+        void on_frame_dropped( rs2_stream, int index, frame_drop_reason ) const;
+
+        // Where to report frames we drop; without it, they're only counted
+        void set_notifications_processor( std::weak_ptr< notifications_processor > const & notifications )
+        {
+            _notifications = notifications;
+        }
+
+        // Count frames received, dropped, and (unless someone downstream does it) delivered by us. Without these, we
+        // do not count anything.
+        void set_statistics( std::shared_ptr< frame_statistics > const & statistics, bool count_delivered = true );
+        frame_statistics * get_statistics() const { return _statistics.get(); }
+
+        // Archive utilisation, by stream name: { "Depth": { "in-use": 2, "high-water": 5, "capacity": 16 }, ... }
+        rsutils::json get_archive_statistics() const;
 
         static rs2_extension stream_to_frame_types( rs2_stream stream );
 
@@ -72,14 +106,29 @@ namespace librealsense
 
         std::map< archive_id, std::shared_ptr< archive_interface > >::iterator create_archive( archive_id id );
 
+        void deliver( frame_holder frame ) const;
+        void deliver_latest( frame_holder frame ) const;
+        void stop_delivering_latest() const;
+
         mutable std::recursive_mutex _mutex;
 
         std::map< archive_id, std::shared_ptr< archive_interface > > _archive;
         std::vector< rs2_extension > _supported_extensions;
 
-        std::atomic< uint32_t > _max_publish_list_size;
+        frame_publish_limits _publish_limits;
         rs2_frame_callback_sptr _callback;
         std::shared_ptr< metadata_parser_map > _metadata_parsers;
         std::weak_ptr< sensor_interface > _sensor;
+        std::shared_ptr< frame_statistics > _statistics;
+        bool _count_delivered = false;
+
+        std::weak_ptr< notifications_processor > _notifications;
+        mutable std::mutex _drops_mutex;
+        mutable uint64_t _n_unreported_drops = 0;
+        mutable std::chrono::steady_clock::time_point _last_drops_notification;
+
+        // With the KEEP_LATEST policy, each stream is delivered from its own thread, where at most one frame waits.
+        // Last, so these are stopped before anything they use is destroyed.
+        mutable std::map< std::pair< rs2_stream, int >, std::shared_ptr< dispatcher > > _latest_dispatchers;
     };
 }
@@ -0,0 +1,76 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "target-ncc.h"
+
+#ifdef RS2_USE_X86_SIMD  // compiled for SSSE3
+#include <tmmintrin.h> // For SSSE3 intrinsics
+
+namespace librealsense
+{
+    namespace
+    {
+        // V vectors of 2 positions at a time, starting with position q: each template value is loaded once for all of
+        // them, and their sums do not wait on each other
+        template<int V>
+        inline void correlate(const double* const* planes, int stride, int step, const double* templ, int tsize, int q,
+                              double* out)
+        {
+            __m128d acc[V];
+            for (int v = 0; v < V; ++v)
+                acc[v] = _mm_setzero_pd();
+
+            for (int m = 0; m < tsize; ++m)
+            {
+                const double* t = templ + m * tsize;
+                int r = 0, o = m * stride + q;
+                for (int k = 0; k < tsize; ++k)
+                {
+                    __m128d w = _mm_set1_pd(t[k]);
+                    const double* src = planes[r] + o;
+                    for (int v = 0; v < V; ++v)
+                        acc[v] = _mm_add_pd(acc[v], _mm_mul_pd(w, _mm_loadu_pd(src + 2 * v)));
+                    if (++r == step)
+                    {
+                        r = 0;
+                        ++o;
+                    }
+                }
+            }
+
+            for (int v = 0; v < V; ++v)
+                _mm_storeu_pd(out + 2 * v, acc[v]);
+        }
+    }
+
+    void target_correlate_row_sse(const double* const* planes, int stride, int step, const double* templ, int tsize,
+                                  double* out, int n)
+    {
+        int q = 0;
+        for (; q + 8 <= n; q += 8)
+            correlate<4>(planes, stride, step, templ, tsize, q, out + q);
+        for (; q + 2 <= n; q += 2)
+            correlate<1>(planes, stride, step, templ, tsize, q, out + q);
+        for (; q < n; ++q)
+        {
+            double acc = 0;
+            for (int m = 0; m < tsize; ++m)
+            {
+                const double* t = templ + m * tsize;
+                int r = 0, o = m * stride + q;
+                for (int k = 0; k < tsize; ++k)
+                {
+                    acc += t[k] * planes[r][o];
+                    if (++r == step)
+                    {
+                        r = 0;
+                        ++o;
+                    }
+                }
+            }
+            out[q] = acc;
+        }
+    }
+}
+
+#endif
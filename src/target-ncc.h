@@ -0,0 +1,28 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+
+namespace librealsense
+{
+    // Correlates a tsize x tsize template with the image, for a row of n template positions every 'step' columns:
+    //     out[q] = sum over m, k of templ[m * tsize + k] * image[m][q * step + k]
+    // The image is given as 'step' planes of interleaved columns, plane r holding columns r, r + step, r + 2 * step...
+    // (with step 1, the image itself); planes[r] points to the first position's plane column on the template's top
+    // row, and each plane row is 'stride' values after the one above it.
+    // Each sum is accumulated in the order written, in all kernels, so all give the same bits.
+    void target_correlate_row_generic( const double * const * planes, int stride, int step, const double * templ,
+                                       int tsize, double * out, int n );
+
+#ifdef RS2_USE_X86_SIMD
+    void target_correlate_row_sse( const double * const * planes, int stride, int step, const double * templ,
+                                   int tsize, double * out, int n );
+    void target_correlate_row_avx2( const double * const * planes, int stride, int step, const double * templ,
+                                    int tsize, double * out, int n );
+#endif
+
+    // With the best kernel for the current SIMD level
+    void target_correlate_row( const double * const * planes, int stride, int step, const double * templ, int tsize,
+                               double * out, int n );
+}
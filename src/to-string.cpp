@@ -252,6 +252,22 @@ const char * get_string( rs2_gyro_sensitivity value )
 #undef CASE
 }
 
+const char * get_string( rs2_frames_queue_policy value )
+{
+#define CASE( X ) STRCASE( FRAMES_QUEUE_POLICY, X )
+    switch( value )
+    {
+    CASE( DROP_NEWEST )
+    CASE( KEEP_LATEST )
+    CASE( BLOCK )
+    CASE( MEMORY_LIMIT )
+    default:
+        assert( ! is_valid( value ) );
+        return UNKNOWN_VALUE;
+    }
+#undef CASE
+}
+
 const char * get_string( rs2_extension value )
 {
 #define CASE( X ) STRCASE( EXTENSION, X )
@@ -314,6 +330,7 @@ const char * get_string( rs2_extension value )
     CASE( DEBUG_STREAM_SENSOR )
     CASE( CALIBRATION_CHANGE_DEVICE )
     CASE( ROTATION_FILTER )
+    CASE( MOTION_BLOCK_FRAME )
     default:
         assert( ! is_valid( value ) );
         return UNKNOWN_VALUE;
@@ -462,6 +479,17 @@ std::string const & get_string_( rs2_option value )
         CASE( GYRO_SENSITIVITY )
         CASE( ROTATION )
         arr[RS2_OPTION_REGION_OF_INTEREST] = "Region of Interest";
+        CASE( FRAMES_QUEUE_POLICY )
+        CASE( FRAMES_QUEUE_MEMORY_LIMIT )
+        CASE( MOTION_BLOCK_SIZE )
+        CASE( MOTION_THREAD_PRIORITY )
+        CASE( MOTION_THREAD_AFFINITY )
+        CASE( FILTER_HALF_RESOLUTION_HISTORY )
+        CASE( AUTO_EXPOSURE_SUBSAMPLING )
+        CASE( AUTO_EXPOSURE_SKIP_UNAPPLIED )
+        CASE( RESIZE_WIDTH )
+        CASE( RESIZE_HEIGHT )
+        CASE( RESIZE_FILTER )
 #undef CASE
         return arr;
     }();
@@ -546,6 +574,7 @@ const char * get_string( rs2_format value )
     CASE( Y411 )
     CASE( Y16I )
     CASE( M420 )
+    CASE( Z16RVL )
     default:
         assert( ! is_valid( value ) );
         return UNKNOWN_VALUE;
@@ -698,6 +727,7 @@ const char * get_string( rs2_notification_category value )
     CASE( UNKNOWN_ERROR )
     CASE( FIRMWARE_UPDATE_RECOMMENDED )
     CASE( POSE_RELOCALIZATION )
+    CASE( FRAMES_DROPPED )
     default:
         assert( ! is_valid( value ) );
         return UNKNOWN_VALUE;
@@ -808,3 +838,4 @@ const char * rs2_host_perf_mode_to_string( rs2_host_perf_mode mode ) { return li
 const char * rs2_emitter_frequency_mode_to_string( rs2_emitter_frequency_mode mode ) { return librealsense::get_string( mode ); }
 const char * rs2_depth_auto_exposure_mode_to_string( rs2_depth_auto_exposure_mode mode ) { return librealsense::get_string( mode ); }
 const char * rs2_gyro_sensitivity_to_string( rs2_gyro_sensitivity mode ){return librealsense::get_string( mode );}
+const char * rs2_frames_queue_policy_to_string( rs2_frames_queue_policy policy ) { return librealsense::get_string( policy ); }
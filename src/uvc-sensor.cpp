@@ -129,6 +129,9 @@ void uvc_sensor::open( const stream_profiles & requests )
 
                     if( ! this->is_streaming() )
                     {
+                        if( auto statistics = _source.get_statistics() )
+                            statistics->get( req_profile_base->get_stream_type(), req_profile_base->get_stream_index() )
+                                .add_dropped( frame_drop_reason::inactive );
                         LOG_WARNING( "Frame received with streaming inactive,"
                                      << librealsense::get_string( req_profile_base->get_stream_type() )
                                      << req_profile_base->get_stream_index() << ", Arrived," << std::fixed
@@ -175,6 +178,13 @@ void uvc_sensor::open( const stream_profiles & requests )
 
                     if( frame_counter <= last_frame_number )
                         LOG_INFO( "Frame counter reset" );
+                    else if( last_frame_number && frame_counter > last_frame_number + 1 )
+                    {
+                        // Lost before it got to us (e.g., in the kernel or USB)
+                        if( auto statistics = _source.get_statistics() )
+                            statistics->get( req_profile_base->get_stream_type(), req_profile_base->get_stream_index() )
+                                .add_dropped( frame_drop_reason::missed, frame_counter - last_frame_number - 1 );
+                    }
 
                     last_frame_number = frame_counter;
                     last_timestamp = timestamp;
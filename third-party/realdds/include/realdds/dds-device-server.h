@@ -11,6 +11,7 @@
 #include <rsutils/json-fwd.h>
 #include <rsutils/string/slice.h>
 
+#include <atomic>
 #include <map>
 #include <vector>
 #include <memory>
@@ -25,6 +26,8 @@ namespace realdds {
 namespace topics {
 class flexible_msg;
 class device_info;
+class metadata_msg;
+class metadata_keys;
 namespace raw {
 class device_info;
 }  // namespace raw
@@ -69,6 +72,19 @@ public:
     std::string const & topic_root() const { return _topic_root; }
     rsutils::string::slice debug_name() const;
 
+    // Metadata values can be sent in a compact binary form that refers to them by index into a list of keys that
+    // is sent once, with the device-header. Binary metadata goes on a topic of its own, next to the JSON one, so
+    // each client reads the form it understands; each form is sent only while it has readers. Must be called before
+    // init().
+    void set_metadata_keys( std::vector< std::string > keys );
+    std::shared_ptr< const topics::metadata_keys > const & metadata_keys() const { return _metadata_keys; }
+
+    // Depth images can be sent RVL-compressed, dropping trim_bits least-significant bits from each pixel (0 is
+    // lossless). This is offered in the device-header and used only if all clients ask for it when opening streams,
+    // as they all share the depth topic. Must be called before init().
+    void set_depth_compression( bool enabled, unsigned trim_bits = 0 );
+    bool is_depth_compressed() const { return _depth_compressed; }
+
     // A server is not valid until init() is called with a list of streams that we want to publish.
     // On successful return from init(), each of the streams will be alive so clients will be able
     // to subscribe.
@@ -90,6 +106,8 @@ public:
 
     void publish_notification( topics::flexible_msg && );
     void publish_metadata( rsutils::json && );
+    // Published in binary form to binary readers and converted to JSON for JSON readers
+    void publish_metadata( topics::metadata_msg && );
 
     bool has_metadata_readers() const;
 
@@ -111,6 +129,7 @@ private:
     struct control_sample;
 
     void on_control_message_received();
+    void on_open_streams( control_sample const & );
     void on_set_option( control_sample const &, rsutils::json & reply );
     void on_query_option( control_sample const &, rsutils::json & reply );
     void on_query_options( control_sample const &, rsutils::json & reply );
@@ -125,6 +144,11 @@ private:
     std::shared_ptr< dds_notification_server > _notification_server;
     std::shared_ptr< dds_topic_reader > _control_reader;
     std::shared_ptr< dds_topic_writer > _metadata_writer;
+    std::shared_ptr< dds_topic_writer > _binary_metadata_writer;  // only with metadata keys
+    std::shared_ptr< const topics::metadata_keys > _metadata_keys;
+    int _depth_trim_bits = -1;  // when depth compression is not offered
+    std::atomic< bool > _depth_compressed{ false };
+    bool _raw_depth_requested = false;  // sticky; once a client wants raw depth, we no longer compress
     std::shared_ptr< dds_device_broadcaster > _broadcaster;
     dispatcher _control_dispatcher;
 
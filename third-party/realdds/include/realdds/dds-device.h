@@ -18,6 +18,7 @@ namespace realdds {
 
 namespace topics {
 class device_info;
+class metadata_msg;
 }  // namespace topics
 
 
@@ -91,6 +92,11 @@ public:
     typedef std::function< void( std::shared_ptr< const rsutils::json > const & md ) > on_metadata_available_callback;
     rsutils::subscription on_metadata_available( on_metadata_available_callback && );
 
+    // Same metadata, but without going through JSON: when the server sends binary metadata this avoids any parsing
+    typedef std::function< void( std::shared_ptr< const topics::metadata_msg > const & md ) >
+        on_metadata_msg_available_callback;
+    rsutils::subscription on_metadata_msg_available( on_metadata_msg_available_callback && );
+
     typedef std::function< void(
         dds_nsec timestamp, char type, std::string const & text, rsutils::json const & data ) >
         on_device_log_callback;
@@ -4,7 +4,7 @@
 
 #include <rsutils/json.h>
 
-#include <deque>
+#include <vector>
 #include <memory>
 #include <mutex>
 #include <functional>
@@ -12,26 +12,34 @@
 
 
 namespace realdds {
+namespace topics {
+class metadata_msg;
+}  // namespace topics
 
 
 // Frame data and metadata are sent as two seperate streams which may need synchronizing and joining together.
 // 
-// This mechanism takes a generic "frame" (as a void*) and "metadata" (any json) and issues a callback whenever a match
-// occurs.
+// This mechanism takes a generic "frame" (as a void*) and "metadata" (any json, or a binary topics::metadata_msg) and
+// issues a callback whenever a match occurs.
 // 
 // Note this means:
 //     - the callback is only called when a frame/metadata is fed to it (enqueued)
-//     - callbacks are called on the same thread as the enqueue
+//     - callbacks are called on the thread of an enqueue, but not necessarily the one that caused them (see below)
 //     - frames may be issued without metadata if none is found
 //     - metadata by itself is never issued
 //
 // A few assumptions are made:
 //     - metadata and frames arrive from different threads, so can happen concurrently
 //     - frames are enqueued in strictly increasing order (keys) from the same thread
-//          - else no guarantee is made to callback ordering!
 //     - metadata is likely to arrive first because the messages are much smaller
 //
-class dds_metadata_syncer
+// Both queues are fixed-capacity rings ordered by key, so matching only ever looks at their fronts. Matches (and
+// drops) are collected under the lock and then delivered in a batch outside it, by one thread at a time: a thread that
+// enqueues while another is delivering leaves its results for the other to deliver, rather than waiting for it. This
+// means callbacks are never concurrent and are always in key order, and enqueueing never waits on a callback.
+//
+template< class Metadata >
+class basic_metadata_syncer
 {
 public:
     // We don't want the queue to get large, it means lots of drops and data that we store to (probably) throw later
@@ -53,8 +61,8 @@ public:
     typedef void ( *on_frame_release_callback )( frame_type * );
     typedef std::unique_ptr< frame_type, on_frame_release_callback > frame_holder;
 
-    // Metadata is intended to be JSON
-    typedef std::shared_ptr< const rsutils::json > metadata_type;
+    // Metadata is held by shared pointer so it can be passed around without copying
+    typedef std::shared_ptr< const Metadata > metadata_type;
 
     // So our main callback gets this generic frame and metadata:
     typedef std::function< void( frame_holder &&, metadata_type const & metadata ) > on_frame_ready_callback;
@@ -62,12 +70,85 @@ public:
     // And we provide other callbacks, for control, testing, etc.
     typedef std::function< void( key_type, metadata_type const & ) > on_metadata_dropped_callback;
 
+    // Counters since construction, for tuning and debugging
+    struct statistics
+    {
+        size_t n_frames = 0;                  // enqueued
+        size_t n_matched = 0;                 // frames issued with metadata
+        size_t n_frames_without_metadata = 0; // issued without
+        size_t n_metadata = 0;                // enqueued
+        size_t n_metadata_dropped = 0;
+        size_t n_batches = 0;                 // of callbacks, each delivered outside the lock
+        size_t max_batch_size = 0;
+        // From a frame being enqueued until its batch is taken for delivery, in nanoseconds:
+        uint64_t total_latency = 0;
+        uint64_t max_latency = 0;
+    };
+
 private:
-    using key_frame = std::pair< key_type, frame_holder >;
-    using key_metadata = std::pair< key_type, metadata_type >;
+    // A fixed-capacity circular buffer; we keep items in increasing key order
+    template< class T >
+    class ring
+    {
+        std::vector< T > _items;
+        size_t _head = 0;
+        size_t _size = 0;
+
+    public:
+        explicit ring( size_t capacity ) : _items( capacity ) {}
+
+        size_t size() const { return _size; }
+        bool empty() const { return ! _size; }
+        bool full() const { return _size == _items.size(); }
+
+        T & front() { return _items[_head]; }
+        T & back() { return _items[( _head + _size - 1 ) % _items.size()]; }
+
+        void push_back( T && item )  // must not be full
+        {
+            _items[( _head + _size ) % _items.size()] = std::move( item );
+            ++_size;
+        }
+        T pop_front()  // must not be empty
+        {
+            T item = std::move( _items[_head] );
+            _head = ( _head + 1 ) % _items.size();
+            --_size;
+            return item;
+        }
+        void clear()
+        {
+            while( _size )
+                pop_front();
+        }
+    };
+
+    struct key_frame
+    {
+        key_type key = 0;
+        frame_holder frame{ nullptr, nullptr };
+        uint64_t enqueue_ns = 0;  // for latency
+    };
+    struct key_metadata
+    {
+        key_type key = 0;
+        metadata_type md;
+    };
 
-    std::deque< key_frame > _frame_queue;
-    std::deque< key_metadata > _metadata_queue;
+    // A callback to make: a frame (with or without metadata) or dropped metadata if there's no frame
+    struct event
+    {
+        key_type key;
+        frame_holder frame;  // null for dropped metadata
+        metadata_type md;
+        uint64_t enqueue_ns;
+    };
+
+    ring< key_frame > _frame_queue;
+    ring< key_metadata > _metadata_queue;
+    std::vector< event > _pending;  // to be delivered by whoever is delivering
+    bool _delivering = false;
+    statistics _statistics;
     std::mutex _queues_lock;
 
     on_frame_release_callback _on_frame_release;
@@ -77,8 +158,8 @@ private:
     std::shared_ptr< bool > _is_alive; // Ensures object can be accessed
 
 public:
-    dds_metadata_syncer();
-    virtual ~dds_metadata_syncer();
+    basic_metadata_syncer();
+    virtual ~basic_metadata_syncer();
 
     void enqueue_frame( key_type, frame_holder && );
     void enqueue_metadata( key_type, metadata_type const & );
@@ -97,15 +178,28 @@ public:
     void start() { _started = true; }
     void stop() { _started = false; }
 
+    statistics get_statistics();
+
 private:
     // Call these under lock:
-    void search_for_match( std::unique_lock< std::mutex > & );
-    bool handle_match( std::unique_lock< std::mutex > & );
-    bool handle_frame_without_metadata( std::unique_lock< std::mutex > & );
-    bool drop_metadata( std::unique_lock< std::mutex > & );
+    void search_for_match();
+    void handle_match();
+    void handle_frame_without_metadata();
+    void drop_metadata();
+    void add_frame_event( key_frame &&, metadata_type && );
+
+    // Issue pending callbacks, with the lock released around them; call with the lock held
+    void deliver( std::unique_lock< std::mutex > & );
 
     std::atomic< bool > _started;
 };
 
 
+extern template class basic_metadata_syncer< rsutils::json >;
+extern template class basic_metadata_syncer< topics::metadata_msg >;
+
+// The original JSON-based syncer
+using dds_metadata_syncer = basic_metadata_syncer< rsutils::json >;
+
+
 }  // namespace realdds
@@ -12,6 +12,7 @@
 #include <string>
 #include <list>
 #include <atomic>
+#include <mutex>
 
 
 namespace eprosima {
@@ -46,6 +47,7 @@ namespace realdds {
 
 
 class dds_network_adapter_watcher;
+class dds_reader_pool;
 
 
 // The starting point for any DDS interaction, a participant has a name and is the focal point for creating, destroying,
@@ -64,6 +66,9 @@ class dds_participant
     rsutils::json _settings;
     std::shared_ptr< dds_network_adapter_watcher > _adapter_watcher;
 
+    std::mutex _reader_pool_mutex;
+    std::shared_ptr< dds_reader_pool > _reader_pool;
+
 public:
     dds_participant() = default;
     dds_participant( const dds_participant & ) = delete;
@@ -109,6 +114,11 @@ public:
 
     rsutils::json const & settings() const { return _settings; }
 
+    // Topic readers (dds_topic_reader_thread) each get a thread of their own, unless the settings ask for a pool of
+    // "reader-threads" for them to share. Returns null if there's no pool.
+    //
+    std::shared_ptr< dds_reader_pool > reader_pool();
+
     // RTPS 8.2.4.2 "Every Participant has GUID <prefix, ENTITYID_PARTICIPANT>, where the constant ENTITYID_PARTICIPANT
     //     is a special value defined by the RTPS protocol. Its actual value depends on the PSM."
     // In FastDDS, this constant is ENTITYID_RTPSParticipant = 0x1c1.
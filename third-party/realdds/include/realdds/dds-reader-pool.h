@@ -0,0 +1,49 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+#pragma once
+
+#include <memory>
+#include <vector>
+
+
+namespace realdds {
+
+
+class dds_topic_reader_thread;
+
+
+// Threads, each with a wait-set, that are shared by many topic readers rather than each reader having a thread of its
+// own (see dds_topic_reader_thread).
+//
+// With many devices, each with several streams, we'd otherwise have that many threads doing nothing but waiting, and
+// the context switches when they all wake up. Instead, each reader is assigned to the thread with the fewest readers,
+// and its callbacks are called from that thread. A reader's callbacks are never called concurrently, but a lengthy
+// callback does delay the other readers on the same thread: see dds_topic_reader_thread::statistics.
+//
+// A participant creates a pool according to its settings, and readers use it automatically.
+//
+class dds_reader_pool
+{
+    struct worker;
+    std::vector< std::shared_ptr< worker > > _workers;
+
+    bool is_pool_thread() const;
+
+public:
+    dds_reader_pool( size_t n_threads );
+    ~dds_reader_pool();
+
+    size_t size() const { return _workers.size(); }
+
+    // Start calling the reader's callbacks when its status changes
+    void add( std::shared_ptr< dds_topic_reader_thread > const & );
+
+    // Once this returns, the reader's callbacks will not be called again. It can be called from inside a callback.
+    // Returns true if they are not running, either: the reader can then be stopped. From one of the pool's threads, we
+    // do not wait for a callback of the reader that is running on another (which may be waiting for us, in turn, to
+    // remove one of its readers): false is returned, and the pool stops the reader once its callback returns.
+    bool remove( dds_topic_reader_thread * );
+};
+
+
+}  // namespace realdds
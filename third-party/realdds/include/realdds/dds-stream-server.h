@@ -7,9 +7,11 @@
 #include <realdds/dds-stream-base.h>
 #include <realdds/dds-trinsics.h>
 
+#include <atomic>
 #include <memory>
 #include <string>
 #include <set>
+#include <vector>
 #include <functional>
 
 
@@ -94,11 +96,18 @@ public:
 
     virtual void publish_image( topics::image_msg & );
 
+    // Publish images RVL-compressed (16-bit images only, i.e. depth), dropping trim_bits least-significant bits from
+    // each pixel; negative to publish them as-is. Can be changed while streaming.
+    void set_rvl_compression( int trim_bits );
+    bool is_rvl_compressed() const { return _rvl_trim_bits >= 0; }
+
 private:
     void check_profile( std::shared_ptr< dds_stream_profile > const & ) const override;
 
     std::set< video_intrinsics > _intrinsics;
     image_header _image_header;
+    std::atomic< int > _rvl_trim_bits{ -1 };
+    std::vector< uint8_t > _rvl_buffer;  // valid until the next publish_image()
 };
 
 
@@ -4,6 +4,7 @@
 
 #include "dds-topic-reader.h"
 
+#include <mutex>
 #include <thread>
 
 
@@ -19,6 +20,9 @@ class GuardCondition;
 namespace realdds {
 
 
+class dds_reader_pool;
+
+
 // A topic-reader that calls its callback from a separate thread.
 // 
 // This is the recommended way, according to eProsima:
@@ -34,12 +38,16 @@ namespace realdds {
 // See also:
 //      https://fast-dds.docs.eprosima.com/en/latest/fastdds/dds_layer/subscriber/dataReader/readingData.html#accessing-data-with-a-waiting-thread
 //
+// If the participant has a reader pool (see the "reader-threads" setting), the thread is one of the pool's, shared
+// with other readers.
+//
 class dds_topic_reader_thread : public dds_topic_reader
 {
     typedef dds_topic_reader super;
 
     std::shared_ptr< eprosima::fastdds::dds::GuardCondition > _stopped;
     std::thread _th;
+    std::shared_ptr< dds_reader_pool > _pool;
 
 public:
     dds_topic_reader_thread( std::shared_ptr< dds_topic > const & topic );
@@ -49,6 +57,33 @@ public:
 
     void run( qos const & ) override;
     void stop() override;
+
+    bool is_pooled() const { return _pool != nullptr; }
+
+    // How long it took to handle status changes (i.e., call our callbacks), and how long they waited for it: with a
+    // pool, a callback waits for those of other readers that were triggered at the same time
+    struct statistics
+    {
+        size_t n_wakeups = 0;
+        dds_nsec total_delay = 0;  // from the thread waking up to calling our callbacks
+        dds_nsec max_delay = 0;
+        dds_nsec total_duration = 0;  // in our callbacks
+        dds_nsec max_duration = 0;
+    };
+    statistics get_statistics() const;
+
+private:
+    friend class dds_reader_pool;
+
+    static dds_nsec steady_now();
+
+    // Calls our callbacks for whatever status changed since the thread woke up; returns false if stopped
+    bool handle_status_changes( dds_nsec wake_time );
+    // The rest of stop(), once the pool is done with us
+    void stop_reader() { super::stop(); }
+
+    mutable std::mutex _statistics_mutex;
+    statistics _statistics;
 };
 
 
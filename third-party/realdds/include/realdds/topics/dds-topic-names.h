@@ -23,6 +23,7 @@ constexpr char const * DEVICE_INFO_TOPIC_NAME = "realsense/device-info";
 constexpr char const * NOTIFICATION_TOPIC_NAME = "/notification";
 constexpr char const * CONTROL_TOPIC_NAME = "/control";
 constexpr char const * METADATA_TOPIC_NAME = "/metadata";
+constexpr char const * BINARY_METADATA_TOPIC_NAME = "/metadata/binary";
 constexpr char const * DFU_TOPIC_NAME = "/dfu";
 
 
@@ -58,6 +59,8 @@ namespace notification {
         namespace key {
             extern std::string const n_streams;
             extern std::string const extrinsics;
+            extern std::string const metadata_keys;
+            extern std::string const depth_encodings;
         }
     }
     namespace device_options {
@@ -166,6 +169,7 @@ namespace control {
             extern std::string const stream_profiles;
             extern std::string const reset;
             extern std::string const commit;
+            extern std::string const depth_encoding;
         }
     }
     namespace hwm {
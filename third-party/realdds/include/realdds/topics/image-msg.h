@@ -25,6 +25,7 @@ namespace realdds {
 class dds_participant;
 class dds_topic;
 class dds_topic_reader;
+class dds_topic_writer;
 
 
 namespace topics {
@@ -34,7 +35,15 @@ class image_msg
 {
     sensor_msgs::msg::Image _raw;
 
+    // When set, the data is not in _raw but in a buffer we do not own
+    uint8_t const * _data_view = nullptr;
+    size_t _data_view_size = 0;
+
+    friend class image_msg_type;
+
 public:
+    // The samples in topics created by create_topic() are image_msg objects, but the type is the same as (and can be
+    // matched with) a ROS2 Image
     using type = sensor_msgs::msg::ImagePubSubType;
 
     image_msg() = default;
@@ -49,8 +58,23 @@ public:
     image_msg & operator=( image_msg && ) = default;
     image_msg & operator=( sensor_msgs::msg::Image && );
 
-    bool is_valid() const { return ! _raw.data().empty(); }
-    void invalidate() { _raw.data().clear(); }
+    bool is_valid() const { return _data_view || ! _raw.data().empty(); }
+    void invalidate()
+    {
+        _raw.data().clear();
+        _data_view = nullptr;
+        _data_view_size = 0;
+    }
+
+    // Point to image data without copying it: it is serialized directly from the given buffer when written, so the
+    // buffer must stay valid until then. Any data in raw() is ignored.
+    void set_data_view( uint8_t const * data, size_t size )
+    {
+        _data_view = data;
+        _data_view_size = size;
+    }
+    uint8_t const * data() const { return _data_view ? _data_view : _raw.data().data(); }
+    size_t data_size() const { return _data_view ? _data_view_size : _raw.data().size(); }
 
     sensor_msgs::msg::Image & raw() { return _raw; }
     sensor_msgs::msg::Image const & raw() const { return _raw; }
@@ -77,10 +101,23 @@ public:
     }
     dds_time timestamp() const { return { _raw.header().stamp().sec(), _raw.header().stamp().nanosec() }; }
 
+    // Depth can be sent RVL-compressed (see rsutils/codec/rvl.h), as negotiated with the device: the encoding is then
+    // suffixed with ";rvl" (e.g., "16UC1;rvl")
+    static std::string const rvl_encoding;  // "rvl"
+    bool is_rvl() const;
+    // Compresses the (16-bit) data into the buffer, and points to it as with set_data_view(); the encoding and step
+    // must already be set
+    void rvl_encode( std::vector< uint8_t > & buffer, unsigned trim_bits );
+    // Decompresses the data back into raw(), and removes the suffix from the encoding; throws if malformed
+    void rvl_decode();
+
 
     static std::shared_ptr< dds_topic > create_topic( std::shared_ptr< dds_participant > const & participant,
                                                       char const * topic_name );
 
+    // Write to the topic; the topic must have been created with create_topic()
+    void write_to( dds_topic_writer & );
+
     // This helper method will take the next sample from a reader. 
     // 
     // Returns true if successful. Make sure you still check is_valid() in case the sample info isn't!
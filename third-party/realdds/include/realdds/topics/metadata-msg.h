@@ -0,0 +1,99 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+#pragma once
+
+#include <realdds/dds-defines.h>
+
+#include <rsutils/json-fwd.h>
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+
+namespace realdds {
+namespace topics {
+
+
+class flexible_msg;
+
+
+// The names of the metadata fields, as referred to (by index) by binary metadata messages.
+// The server sends these once, in the device-header, rather than with every message.
+//
+class metadata_keys
+{
+    std::vector< std::string > _names;
+    std::map< std::string, uint16_t > _indices;
+
+public:
+    metadata_keys() = default;
+    explicit metadata_keys( std::vector< std::string > names );
+
+    bool empty() const { return _names.empty(); }
+    size_t size() const { return _names.size(); }
+    std::vector< std::string > const & names() const { return _names; }
+
+    // Throws if out of range
+    std::string const & name( uint16_t index ) const;
+    // Returns -1 if not found
+    int index_of( std::string const & name ) const;
+    // Adds the name if not already there; returns its index
+    uint16_t add( std::string const & name );
+};
+
+
+// The metadata for a single frame, in a form that's cheap to encode and decode.
+//
+// On the wire, this is either the JSON metadata message (see 'metadata' in dds-topic-names.h) or, on its own topic
+// (BINARY_METADATA_TOPIC_NAME), a compact binary encoding sent as a CUSTOM flexible message:
+//
+//     u8      version (1)
+//     u8      flags: which of the optional header fields follow
+//     u16     number of values
+//     u8      stream-name length, followed by the name
+//     i64     timestamp (nsec; the syncer key, must match the image timestamp bit-for-bit)
+//     [u64    frame-number]
+//     [i32    timestamp-domain]
+//     [f32    depth-units]
+//     { u16 key-index, i64 value } * number of values
+//
+// All values are little-endian.
+//
+class metadata_msg
+{
+public:
+    static constexpr uint8_t VERSION = 1;
+
+    std::string stream_name;
+    dds_nsec timestamp = 0;
+
+    bool has_frame_number = false;
+    uint64_t frame_number = 0;
+    bool has_timestamp_domain = false;
+    int32_t timestamp_domain = 0;
+    bool has_depth_units = false;
+    float depth_units = 0.f;
+
+    // Values, by key index
+    std::vector< std::pair< uint16_t, int64_t > > values;
+
+    // The keys the values refer to
+    std::shared_ptr< const metadata_keys > keys;
+
+    void encode( std::vector< uint8_t > & ) const;
+    // Throws on invalid data or unsupported version
+    void decode( uint8_t const * data, size_t size );
+
+    flexible_msg to_flexible() const;
+
+    rsutils::json to_json() const;
+    // Fields not already in 'keys' are added to a copy, which then replaces 'keys' (existing messages still point to
+    // the original, so keys can be shared between threads without locking)
+    static metadata_msg from_json( rsutils::json const &, std::shared_ptr< const metadata_keys > & keys );
+};
+
+
+}  // namespace topics
+}  // namespace realdds
@@ -26,6 +26,7 @@
 #include <realdds/dds-time.h>
 #include <realdds/dds-topic.h>
 #include <realdds/dds-topic-reader.h>
+#include <realdds/dds-topic-reader-thread.h>
 #include <realdds/dds-topic-writer.h>
 #include <realdds/dds-publisher.h>
 #include <realdds/dds-subscriber.h>
@@ -483,6 +484,20 @@ PYBIND11_MODULE(NAME, m) {
         .def( "qos", []() { return reader_qos(); } )
         .def( "qos", []( reliability r, durability d ) { return reader_qos( r, d ); } );
 
+    using realdds::dds_topic_reader_thread;
+    py::class_< dds_topic_reader_thread, std::shared_ptr< dds_topic_reader_thread >, dds_topic_reader >
+        reader_thread( m, "topic_reader_thread" );
+    py::class_< dds_topic_reader_thread::statistics >( reader_thread, "statistics" )
+        .def_readonly( "n_wakeups", &dds_topic_reader_thread::statistics::n_wakeups )
+        .def_readonly( "total_delay", &dds_topic_reader_thread::statistics::total_delay )
+        .def_readonly( "max_delay", &dds_topic_reader_thread::statistics::max_delay )
+        .def_readonly( "total_duration", &dds_topic_reader_thread::statistics::total_duration )
+        .def_readonly( "max_duration", &dds_topic_reader_thread::statistics::max_duration );
+    reader_thread  //
+        .def( py::init< std::shared_ptr< dds_topic > const & >() )
+        .def( "is_pooled", &dds_topic_reader_thread::is_pooled )
+        .def( "get_statistics", &dds_topic_reader_thread::get_statistics );
+
     using writer_qos = realdds::dds_topic_writer::qos;
     py::class_< writer_qos >( m, "writer_qos" )  //
         .def_property_readonly( "flow_controller",
@@ -665,7 +680,7 @@ PYBIND11_MODULE(NAME, m) {
         .def_static( "create_topic", &image_msg::create_topic )
         .def_property(
             "data",
-            []( image_msg const & self ) { return py::memoryview::from_memory( self.raw().data().data(), self.raw().data().size() ); },
+            []( image_msg const & self ) { return py::memoryview::from_memory( self.data(), self.data_size() ); },
             []( image_msg & self, std::vector< uint8_t > bytes ) { self.raw().data( std::move( bytes ) ); } )
         .def_property( "width", &image_msg::width, &image_msg::set_width )
         .def_property( "height", &image_msg::height, &image_msg::set_height )
@@ -691,8 +706,8 @@ PYBIND11_MODULE(NAME, m) {
                           os << " STEP 0";
                       else if( self.step() % self.width() )
                           os << " STEP " << self.step();
-                      else if( self.raw().data().size() % self.step() )
-                          os << " SIZE " << self.raw().data().size();
+                      else if( self.data_size() % self.step() )
+                          os << " SIZE " << self.data_size();
                       //else
                       //    os << ' ' << ( self.raw().data().size() / ( self.width() * self.height() ) ) << " Bpp";
                       if( self.is_bigendian() )
@@ -717,7 +732,7 @@ PYBIND11_MODULE(NAME, m) {
             py::arg( "reader" ),
             py::arg( "sample" ) = nullptr,
             py::call_guard< py::gil_scoped_release >() )
-        /*.def("write_to", &image_msg::write_to, py::call_guard< py::gil_scoped_release >())*/;
+        .def( "write_to", &image_msg::write_to, py::call_guard< py::gil_scoped_release >() );
 
 
     using participant_entities_info_msg = realdds::topics::ros2::participant_entities_info_msg;
@@ -999,7 +1014,9 @@ PYBIND11_MODULE(NAME, m) {
               []( dds_video_stream_server & self, dds_video_encoding encoding, int width, int height ) {
                   self.start_streaming( { encoding, height, width } );
               } )
-        .def( "publish_image", &dds_video_stream_server::publish_image );
+        .def( "publish_image", &dds_video_stream_server::publish_image )
+        .def( "set_rvl_compression", &dds_video_stream_server::set_rvl_compression )
+        .def( "is_rvl_compressed", &dds_video_stream_server::is_rvl_compressed );
 
     using realdds::dds_depth_stream_server;
     py::class_< dds_depth_stream_server, std::shared_ptr< dds_depth_stream_server > >( m, "depth_stream_server", video_stream_server_base )
@@ -1052,7 +1069,13 @@ PYBIND11_MODULE(NAME, m) {
             "publish_notification",
             []( dds_device_server & self, json const & j ) { self.publish_notification( j ); },
             py::call_guard< py::gil_scoped_release >() )
-        .def( "publish_metadata", &dds_device_server::publish_metadata, py::call_guard< py::gil_scoped_release >() )
+        .def(
+            "publish_metadata",
+            []( dds_device_server & self, json const & j ) { self.publish_metadata( json( j ) ); },
+            py::call_guard< py::gil_scoped_release >() )
+        .def( "set_metadata_keys", &dds_device_server::set_metadata_keys )
+        .def( "set_depth_compression", &dds_device_server::set_depth_compression, "enabled"_a, "trim_bits"_a = 0 )
+        .def( "is_depth_compressed", &dds_device_server::is_depth_compressed )
         .def( "broadcast", &dds_device_server::broadcast )
         .def( "broadcast_disconnect", &dds_device_server::broadcast_disconnect, py::arg( "ack-timeout" ) = dds_time() )
         .def( FN_FWD( dds_device_server, on_set_option,
@@ -1324,6 +1347,16 @@ PYBIND11_MODULE(NAME, m) {
     };
 
     py::class_< dds_metadata_syncer > metadata_syncer( m, "metadata_syncer" );
+    py::class_< dds_metadata_syncer::statistics >( metadata_syncer, "statistics" )
+        .def_readonly( "n_frames", &dds_metadata_syncer::statistics::n_frames )
+        .def_readonly( "n_matched", &dds_metadata_syncer::statistics::n_matched )
+        .def_readonly( "n_frames_without_metadata", &dds_metadata_syncer::statistics::n_frames_without_metadata )
+        .def_readonly( "n_metadata", &dds_metadata_syncer::statistics::n_metadata )
+        .def_readonly( "n_metadata_dropped", &dds_metadata_syncer::statistics::n_metadata_dropped )
+        .def_readonly( "n_batches", &dds_metadata_syncer::statistics::n_batches )
+        .def_readonly( "max_batch_size", &dds_metadata_syncer::statistics::max_batch_size )
+        .def_readonly( "total_latency", &dds_metadata_syncer::statistics::total_latency )
+        .def_readonly( "max_latency", &dds_metadata_syncer::statistics::max_latency );
     metadata_syncer  //
         .def( py::init<>() )
         .def( FN_FWD( dds_metadata_syncer,
@@ -1339,7 +1372,8 @@ PYBIND11_MODULE(NAME, m) {
         .def( "enqueue_frame", &dds_metadata_syncer::enqueue_frame )
         .def( "enqueue_metadata",
               []( dds_metadata_syncer & self, dds_metadata_syncer::key_type key, json const & j )
-              { self.enqueue_metadata( key, std::make_shared< const json >( j ) ); } );
+              { self.enqueue_metadata( key, std::make_shared< const json >( j ) ); } )
+        .def( "get_statistics", &dds_metadata_syncer::get_statistics );
     metadata_syncer.attr( "max_frame_queue_size" ) = dds_metadata_syncer::max_frame_queue_size;
     metadata_syncer.attr( "max_md_queue_size" ) = dds_metadata_syncer::max_md_queue_size;
 }
@@ -10,6 +10,7 @@
 #include <realdds/dds-option.h>
 #include <realdds/topics/dds-topic-names.h>
 #include <realdds/topics/flexible-msg.h>
+#include <realdds/topics/image-msg.h>
 #include <realdds/dds-guid.h>
 #include <realdds/dds-time.h>
 
@@ -116,6 +117,9 @@ void dds_device::impl::reset()
     _streams.clear();
     _options.clear();
     _extrinsics_map.clear();
+    std::atomic_store( &_metadata_keys, std::shared_ptr< const topics::metadata_keys >() );
+    _server_supports_binary_metadata = false;
+    _server_supports_rvl_depth = false;
     if( _metadata_reader )
         _metadata_reader->stop();
     _metadata_reader.reset();
@@ -409,6 +413,8 @@ void dds_device::impl::open( const dds_stream_profiles & profiles )
         { topics::control::key::id, topics::control::open_streams::id },
         { topics::control::open_streams::key::stream_profiles, std::move( stream_profiles ) },
     };
+    if( _server_supports_rvl_depth )
+        j[topics::control::open_streams::key::depth_encoding] = topics::image_msg::rvl_encoding;
 
     json reply;
     write_control_message( j, &reply );
@@ -529,7 +535,12 @@ void dds_device::impl::create_metadata_reader()
     if( _metadata_reader ) // We can be called multiple times, once per stream
         return;
 
-    auto topic = topics::flexible_msg::create_topic( _participant, _info.topic_root() + topics::METADATA_TOPIC_NAME );
+    // When the server offers binary metadata, we read it from its own topic rather than the JSON one
+    auto topic = topics::flexible_msg::create_topic( _participant,
+                                                     _info.topic_root()
+                                                         + ( _server_supports_binary_metadata
+                                                                 ? topics::BINARY_METADATA_TOPIC_NAME
+                                                                 : topics::METADATA_TOPIC_NAME ) );
     _metadata_reader = std::make_shared< dds_topic_reader_thread >( topic, _subscriber );
     _metadata_reader->on_data_available(
         [this]()
@@ -537,18 +548,47 @@ void dds_device::impl::create_metadata_reader()
             topics::flexible_msg message;
             while( topics::flexible_msg::take_next( *_metadata_reader, &message ) )
             {
-                if( message.is_valid() && _on_metadata_available.size() )
+                if( ! message.is_valid() )
+                    continue;
+                bool const want_json = _on_metadata_available.size() > 0;
+                bool const want_msg = _on_metadata_msg_available.size() > 0;
+                if( ! want_json && ! want_msg )
+                    continue;
+                try
                 {
-                    try
+                    if( message._data_format == topics::flexible_msg::data_format::CUSTOM )
                     {
-                        auto sptr = std::make_shared< const json >( message.json_data() );
-                        _on_metadata_available.raise( sptr );
+                        // Binary metadata: values are indices into the keys we got with the device-header
+                        auto md = std::make_shared< topics::metadata_msg >();
+                        md->decode( message._data.data(), message._data.size() );
+                        md->keys = std::atomic_load( &_metadata_keys );
+                        if( want_msg )
+                            _on_metadata_msg_available.raise( md );
+                        if( want_json )
+                            _on_metadata_available.raise( std::make_shared< const json >( md->to_json() ) );
                     }
-                    catch( std::exception const & e )
+                    else
                     {
-                        LOG_DEBUG( "[" << debug_name() << "] metadata exception: " << e.what() );
+                        auto j = std::make_shared< const json >( message.json_data() );
+                        if( want_json )
+                            _on_metadata_available.raise( j );
+                        if( want_msg )  // throws if there's no timestamp
+                        {
+                            // New keys may be learned from the message; they replace ours unless reset() got there
+                            auto keys = std::atomic_load( &_metadata_keys );
+                            auto prev_keys = keys;
+                            auto md = std::make_shared< const topics::metadata_msg >(
+                                topics::metadata_msg::from_json( *j, keys ) );
+                            if( keys != prev_keys )
+                                std::atomic_compare_exchange_strong( &_metadata_keys, &prev_keys, keys );
+                            _on_metadata_msg_available.raise( md );
+                        }
                     }
                 }
+                catch( std::exception const & e )
+                {
+                    LOG_DEBUG( "[" << debug_name() << "] metadata exception: " << e.what() );
+                }
             }
         } );
 
@@ -599,6 +639,22 @@ void dds_device::impl::on_device_header( json const & j, dds_sample const & samp
         }
     }
 
+    if( auto keys_j = j.nested( topics::notification::device_header::key::metadata_keys, &json::is_array ) )
+    {
+        auto keys = std::make_shared< const topics::metadata_keys >( keys_j.get< std::vector< std::string > >() );
+        std::atomic_store( &_metadata_keys, keys );
+        _server_supports_binary_metadata = true;
+        LOG_DEBUG( "[" << debug_name() << "] ... " << keys->size() << " metadata keys" );
+    }
+
+    // The streams decode RVL depth themselves
+    if( auto encodings_j = j.nested( topics::notification::device_header::key::depth_encodings, &json::is_array ) )
+    {
+        for( auto & encoding : encodings_j )
+            if( encoding.is_string() && encoding.string_ref() == topics::image_msg::rvl_encoding )
+                _server_supports_rvl_depth = true;
+    }
+
     set_state( state_t::WAIT_FOR_DEVICE_OPTIONS );
 }
 
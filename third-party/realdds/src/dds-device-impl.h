@@ -7,6 +7,7 @@
 #include <realdds/dds-utilities.h>
 #include <realdds/dds-option.h>
 #include <realdds/topics/device-info-msg.h>
+#include <realdds/topics/metadata-msg.h>
 
 #include <fastdds/rtps/common/Guid.h>
 
@@ -66,6 +67,13 @@ public:
 
     extrinsics_map _extrinsics_map; // <from stream, to stream> to extrinsics
 
+    // Sent by the server in the device-header if it can send binary metadata; otherwise learned from the JSON
+    // metadata as it comes in, on the metadata thread. Always accessed with std::atomic_load/store, as the device-header
+    // (or a reset) may replace it while the metadata thread is using it.
+    std::shared_ptr< const topics::metadata_keys > _metadata_keys;
+    bool _server_supports_binary_metadata = false;
+    bool _server_supports_rvl_depth = false;
+
     impl( std::shared_ptr< dds_participant > const & participant,
           topics::device_info const & info );
     ~impl();
@@ -93,6 +101,13 @@ public:
         return _on_metadata_available.subscribe( std::move( cb ) );
     }
 
+    using on_metadata_msg_available_signal = rsutils::signal< std::shared_ptr< const topics::metadata_msg > const & >;
+    using on_metadata_msg_available_callback = on_metadata_msg_available_signal::callback;
+    rsutils::subscription on_metadata_msg_available( on_metadata_msg_available_callback && cb )
+    {
+        return _on_metadata_msg_available.subscribe( std::move( cb ) );
+    }
+
     using on_device_log_signal = rsutils::signal< dds_nsec,                  // timestamp
                                                   char,                      // type
                                                   std::string const &,       // text
@@ -135,6 +150,7 @@ private:
     void on_notification( rsutils::json &&, dds_sample const & );
 
     on_metadata_available_signal _on_metadata_available;
+    on_metadata_msg_available_signal _on_metadata_msg_available;
     on_device_log_signal _on_device_log;
     on_notification_signal _on_notification;
     on_calibration_changed_signal _on_calibration_changed;
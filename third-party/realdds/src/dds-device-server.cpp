@@ -15,12 +15,15 @@
 #include <realdds/topics/dds-topic-names.h>
 #include <realdds/topics/device-info-msg.h>
 #include <realdds/topics/flexible-msg.h>
+#include <realdds/topics/metadata-msg.h>
+#include <realdds/topics/image-msg.h>
 #include <realdds/dds-topic.h>
 #include <realdds/dds-topic-writer.h>
 #include <realdds/dds-option.h>
 #include <realdds/dds-guid.h>
 #include <realdds/dds-sample.h>
 
+#include <rsutils/codec/rvl.h>
 #include <rsutils/string/from.h>
 #include <rsutils/string/shorten-json-string.h>
 #include <rsutils/json.h>
@@ -74,6 +77,8 @@ dds_device_server::~dds_device_server()
 static void on_discovery_device_header( size_t const n_streams,
                                         const dds_options & options,
                                         const extrinsics_map & extr,
+                                        std::shared_ptr< const topics::metadata_keys > const & metadata_keys,
+                                        bool const depth_compression,
                                         dds_notification_server & notifications )
 {
     auto extrinsics_json = json::array();
@@ -85,6 +90,11 @@ static void on_discovery_device_header( size_t const n_streams,
         { topics::notification::device_header::key::n_streams, n_streams },
         { topics::notification::device_header::key::extrinsics, std::move( extrinsics_json ) }
     };
+    if( metadata_keys && ! metadata_keys->empty() )
+        j_device_header[topics::notification::device_header::key::metadata_keys] = metadata_keys->names();
+    if( depth_compression )
+        j_device_header[topics::notification::device_header::key::depth_encodings]
+            = json::array( { topics::image_msg::rvl_encoding } );
     topics::flexible_msg device_header( j_device_header );
     LOG_DEBUG( "device-header " << std::setw( 4 ) << j_device_header << " size " << device_header._data.size() );
     notifications.add_discovery_notification( std::move( device_header ) );
@@ -205,7 +215,12 @@ void dds_device_server::init( std::vector< std::shared_ptr< dds_stream_server >
         _stream_name_to_server.clear();
 
         _options = options;
-        on_discovery_device_header( streams.size(), options, extr, *_notification_server );
+        on_discovery_device_header( streams.size(),
+                                    options,
+                                    extr,
+                                    _metadata_keys,
+                                    _depth_trim_bits >= 0,
+                                    *_notification_server );
         for( auto & stream : streams )
         {
             std::string topic_name = ros_friendly_topic_name( _topic_root + '/' + stream->name() );
@@ -215,13 +230,20 @@ void dds_device_server::init( std::vector< std::shared_ptr< dds_stream_server >
 
             if( stream->metadata_enabled() && ! _metadata_writer )
             {
-                auto topic = topics::flexible_msg::create_topic( _publisher->get_participant(),
-                                                                 _topic_root + topics::METADATA_TOPIC_NAME );
-                _metadata_writer = std::make_shared< dds_topic_writer >( topic, _publisher );
                 dds_topic_writer::qos wqos( eprosima::fastdds::dds::BEST_EFFORT_RELIABILITY_QOS );
                 wqos.history().depth = 10;  // default is 1
-                _metadata_writer->override_qos_from_json( wqos, _subscriber->get_participant()->settings().nested( "device", "metadata" ) );
-                _metadata_writer->run( wqos );
+                auto make_writer = [&]( char const * topic_name )
+                {
+                    auto topic = topics::flexible_msg::create_topic( _publisher->get_participant(),
+                                                                     _topic_root + topic_name );
+                    auto writer = std::make_shared< dds_topic_writer >( topic, _publisher );
+                    writer->override_qos_from_json( wqos, _subscriber->get_participant()->settings().nested( "device", "metadata" ) );
+                    writer->run( wqos );
+                    return writer;
+                };
+                _metadata_writer = make_writer( topics::METADATA_TOPIC_NAME );
+                if( _metadata_keys )
+                    _binary_metadata_writer = make_writer( topics::BINARY_METADATA_TOPIC_NAME );
             }
         }
 
@@ -301,9 +323,48 @@ void dds_device_server::publish_metadata( json && md )
 }
 
 
+void dds_device_server::set_metadata_keys( std::vector< std::string > keys )
+{
+    if( is_valid() )
+        DDS_THROW( runtime_error, "metadata keys must be set before init()" );
+    if( keys.empty() )
+        _metadata_keys.reset();
+    else
+        _metadata_keys = std::make_shared< const topics::metadata_keys >( std::move( keys ) );
+}
+
+
+void dds_device_server::set_depth_compression( bool enabled, unsigned trim_bits )
+{
+    if( is_valid() )
+        DDS_THROW( runtime_error, "depth compression must be set before init()" );
+    if( trim_bits > rsutils::codec::rvl_max_trim_bits )
+        DDS_THROW( runtime_error, "RVL trim bits (" << trim_bits << ") must be <= " << rsutils::codec::rvl_max_trim_bits );
+    _depth_trim_bits = enabled ? int( trim_bits ) : -1;
+}
+
+
+void dds_device_server::publish_metadata( topics::metadata_msg && md )
+{
+    if( ! _metadata_writer )
+        DDS_THROW( runtime_error, "device '" + _topic_root + "' has no stream with enabled metadata" );
+
+    // Clients that know the keys read the binary topic, and others the JSON one; both may be in use at once
+    if( _binary_metadata_writer && _binary_metadata_writer->has_readers() )
+        md.to_flexible().write_to( *_binary_metadata_writer );
+    if( _metadata_writer->has_readers() )
+    {
+        if( ! md.keys )
+            md.keys = _metadata_keys;
+        publish_metadata( md.to_json() );
+    }
+}
+
+
 bool dds_device_server::has_metadata_readers() const
 {
-    return _metadata_writer && _metadata_writer->has_readers();
+    return ( _metadata_writer && _metadata_writer->has_readers() )
+        || ( _binary_metadata_writer && _binary_metadata_writer->has_readers() );
 }
 
 
@@ -348,6 +409,9 @@ void dds_device_server::on_control_message_received()
                     //reply[topics::reply::key::id] = id;  // Not needed: included with the control
                     reply[topics::reply::key::control] = control.json;
 
+                    if( id == topics::control::open_streams::id )
+                        on_open_streams( control );  // and pass it on to our owner
+
                     auto it = _control_handlers.find( id );
                     if( it != _control_handlers.end() )
                     {
@@ -377,6 +441,29 @@ void dds_device_server::on_control_message_received()
 }
 
 
+void dds_device_server::on_open_streams( control_sample const & control )
+{
+    // Called from the control dispatcher, so no locking is needed.
+    // All clients share the depth topic: it is compressed only while every client that opened streams asked for it
+    if( _depth_trim_bits >= 0 && ! _raw_depth_requested )
+    {
+        auto & encoding = control.json.nested( topics::control::open_streams::key::depth_encoding ).string_ref_or_empty();
+        bool const compressed = encoding == topics::image_msg::rvl_encoding;
+        if( ! compressed )
+            _raw_depth_requested = true;
+        if( compressed != _depth_compressed )
+        {
+            LOG_DEBUG( "[" << debug_name() << "] " << ( compressed ? "switching to" : "falling back from" )
+                           << " RVL depth" );
+            _depth_compressed = compressed;
+            for( auto & name_server : _stream_name_to_server )
+                if( auto depth = std::dynamic_pointer_cast< dds_depth_stream_server >( name_server.second ) )
+                    depth->set_rvl_compression( compressed ? _depth_trim_bits : -1 );
+        }
+    }
+}
+
+
 void dds_device_server::on_set_option( control_sample const & control, json & reply )
 {
     auto & option_name  // mandatory; throws
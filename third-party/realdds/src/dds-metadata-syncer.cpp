@@ -3,55 +3,90 @@
 
 #include <realdds/dds-metadata-syncer.h>
 #include <realdds/dds-utilities.h>
+#include <realdds/topics/metadata-msg.h>
+
+#include <algorithm>
+#include <chrono>
 
 
 namespace realdds {
 
 
-const size_t dds_metadata_syncer::max_md_queue_size = 8;
-const size_t dds_metadata_syncer::max_frame_queue_size = 2;
+template< class Metadata >
+const size_t basic_metadata_syncer< Metadata >::max_md_queue_size = 8;
+template< class Metadata >
+const size_t basic_metadata_syncer< Metadata >::max_frame_queue_size = 2;
+
+
+namespace {
+
+
+uint64_t steady_now_ns()
+{
+    return std::chrono::duration_cast< std::chrono::nanoseconds >(
+               std::chrono::steady_clock::now().time_since_epoch() )
+        .count();
+}
 
 
-dds_metadata_syncer::dds_metadata_syncer()
-    : _is_alive( std::make_shared< bool >( true ) )
+}  // namespace
+
+
+template< class Metadata >
+basic_metadata_syncer< Metadata >::basic_metadata_syncer()
+    : _frame_queue( max_frame_queue_size )
+    , _metadata_queue( max_md_queue_size )
+    , _is_alive( std::make_shared< bool >( true ) )
     , _on_frame_release( nullptr )
 {
 }
 
 
-dds_metadata_syncer::~dds_metadata_syncer()
+template< class Metadata >
+basic_metadata_syncer< Metadata >::~basic_metadata_syncer()
 {
     _is_alive.reset();
 
     std::lock_guard< std::mutex > lock( _queues_lock );
     _frame_queue.clear();
     _metadata_queue.clear();
+    _pending.clear();
 }
 
 
-void dds_metadata_syncer::enqueue_frame( key_type id, frame_holder && frame )
+template< class Metadata >
+typename basic_metadata_syncer< Metadata >::statistics basic_metadata_syncer< Metadata >::get_statistics()
+{
+    std::lock_guard< std::mutex > lock( _queues_lock );
+    return _statistics;
+}
+
+
+template< class Metadata >
+void basic_metadata_syncer< Metadata >::enqueue_frame( key_type id, frame_holder && frame )
 {
     std::weak_ptr< bool > alive = _is_alive;
     if( ! alive.lock() ) // Check if was destructed by another thread
         return;
 
+    auto const now = steady_now_ns();
     std::unique_lock< std::mutex > lock( _queues_lock );
     // Expect increasing order
-    if( ! _frame_queue.empty() && _frame_queue.back().first >= id )
-        DDS_THROW( runtime_error, "frame " << id << " cannot be enqueued after " << _frame_queue.back().first );
-
-    // We must push the new one before releasing the lock, else someone else may push theirs ahead of ours
-    _frame_queue.push_back( key_frame{ id, std::move( frame ) } );
+    if( ! _frame_queue.empty() && _frame_queue.back().key >= id )
+        DDS_THROW( runtime_error, "frame " << id << " cannot be enqueued after " << _frame_queue.back().key );
 
-    while( _frame_queue.size() > max_frame_queue_size )
-        if( ! handle_frame_without_metadata( lock ) ) // Lock released and aquired around callbacks, check we are alive
-            return;
+    ++_statistics.n_frames;
+    if( _frame_queue.full() )
+        handle_frame_without_metadata();
+    _frame_queue.push_back( key_frame{ id, std::move( frame ), now } );
 
-    search_for_match( lock );
+    search_for_match();
+    deliver( lock );
 }
 
 
-void dds_metadata_syncer::enqueue_metadata( key_type id, metadata_type const & md )
+template< class Metadata >
+void basic_metadata_syncer< Metadata >::enqueue_metadata( key_type id, metadata_type const & md )
 {
     std::weak_ptr< bool > alive = _is_alive;
     if( ! alive.lock() )  // Check if was destructed by another thread
@@ -59,110 +94,141 @@ void dds_metadata_syncer::enqueue_metadata( key_type id, metadata_type const & m
 
     std::unique_lock< std::mutex > lock( _queues_lock );
     // Expect increasing order
-    if( ! _metadata_queue.empty() && _metadata_queue.back().first >= id )
-        DDS_THROW( runtime_error, "metadata " << id << " cannot be enqueued after " << _metadata_queue.back().first );
+    if( ! _metadata_queue.empty() && _metadata_queue.back().key >= id )
+        DDS_THROW( runtime_error, "metadata " << id << " cannot be enqueued after " << _metadata_queue.back().key );
 
-    // We must push the new one before releasing the lock, else someone else may push theirs ahead of ours
+    ++_statistics.n_metadata;
+    if( _metadata_queue.full() )
+        drop_metadata();
     _metadata_queue.push_back( key_metadata{ id, md } );
 
-    while( _metadata_queue.size() > max_md_queue_size )
-        if( ! drop_metadata( lock ) ) // Lock released and aquired around callbacks, check we are alive
-            return;
-
-    search_for_match( lock );
+    search_for_match();
+    deliver( lock );
 }
 
 
-void dds_metadata_syncer::search_for_match( std::unique_lock< std::mutex > & lock )
+template< class Metadata >
+void basic_metadata_syncer< Metadata >::search_for_match()
 {
     // Wait for frame + metadata set
     while( ! _frame_queue.empty() && ! _metadata_queue.empty() )
     {
         // We're looking for metadata with the same ID as the next frame
-        auto const frame_key = _frame_queue.front().first;
-        auto const md_key = _metadata_queue.front().first;
+        auto const frame_key = _frame_queue.front().key;
+        auto const md_key = _metadata_queue.front().key;
 
         if( frame_key < md_key )
         {
             // Newer metadata: we can release the frame
-            if( ! handle_frame_without_metadata( lock ) )
-                return;
+            handle_frame_without_metadata();
         }
         else if( frame_key == md_key )
         {
-            if( ! handle_match( lock ) )
-                return;
+            handle_match();
         }
         else
         {
             // Throw away any old metadata (with ID < the frame) since the frame ID will keep increasing
-            if( ! drop_metadata( lock ) )
-                return;
+            drop_metadata();
         }
     }
 }
 
 
-bool dds_metadata_syncer::handle_match( std::unique_lock< std::mutex > & lock )
+template< class Metadata >
+void basic_metadata_syncer< Metadata >::handle_match()
 {
-    std::weak_ptr< bool > alive = _is_alive;
-
-    frame_holder fh = std::move( _frame_queue.front().second );
-    metadata_type md = std::move( _metadata_queue.front().second );
-    _metadata_queue.pop_front();
-    _frame_queue.pop_front();
+    ++_statistics.n_matched;
+    auto md = _metadata_queue.pop_front().md;
+    add_frame_event( _frame_queue.pop_front(), std::move( md ) );
+}
 
-    if( _on_frame_ready && _started )
-    {
-        lock.unlock();
-        _on_frame_ready( std::move( fh ), md );
-        if( ! alive.lock() )  // Check if was destructed by another thread during callback
-            return false;
-        lock.lock();
-    }
 
-    return true;
+template< class Metadata >
+void basic_metadata_syncer< Metadata >::handle_frame_without_metadata()
+{
+    ++_statistics.n_frames_without_metadata;
+    add_frame_event( _frame_queue.pop_front(), metadata_type() );
 }
 
 
-bool dds_metadata_syncer::handle_frame_without_metadata( std::unique_lock< std::mutex > & lock )
+template< class Metadata >
+void basic_metadata_syncer< Metadata >::add_frame_event( key_frame && kf, metadata_type && md )
 {
-    std::weak_ptr< bool > alive = _is_alive;
-
-    frame_holder fh = std::move( _frame_queue.front().second );
-    _frame_queue.pop_front();
+    _pending.push_back( event{ kf.key, std::move( kf.frame ), std::move( md ), kf.enqueue_ns } );
+}
 
-    if( _on_frame_ready && _started )
-    {
-        lock.unlock();
-        _on_frame_ready( std::move( fh ), metadata_type() );
-        if( ! alive.lock() )  // Check if was destructed by another thread during callback
-            return false;
-        lock.lock();
-    }
 
-    return true;
+template< class Metadata >
+void basic_metadata_syncer< Metadata >::drop_metadata()
+{
+    ++_statistics.n_metadata_dropped;
+    auto kmd = _metadata_queue.pop_front();  // Throw oldest
+    _pending.push_back( event{ kmd.key, frame_holder( nullptr, nullptr ), std::move( kmd.md ), 0 } );
 }
 
 
-bool dds_metadata_syncer::drop_metadata( std::unique_lock< std::mutex > & lock )
+template< class Metadata >
+void basic_metadata_syncer< Metadata >::deliver( std::unique_lock< std::mutex > & lock )
 {
-    std::weak_ptr< bool > alive = _is_alive;
+    // Only one thread delivers at a time, so callbacks are in order; if it's not us, it will deliver ours, too
+    if( _delivering )
+        return;
+    _delivering = true;
 
-    auto key = _metadata_queue.front().first;
-    auto md = std::move( _metadata_queue.front().second );
-    _metadata_queue.pop_front();  // Throw oldest
-    if( _on_metadata_dropped )
+    std::weak_ptr< bool > alive = _is_alive;
+    std::vector< event > batch;
+    while( ! _pending.empty() )
     {
+        batch.swap( _pending );
+
+        auto const now = steady_now_ns();
+        ++_statistics.n_batches;
+        _statistics.max_batch_size = std::max( _statistics.max_batch_size, batch.size() );
+        for( auto const & e : batch )
+        {
+            if( ! e.frame )
+                continue;
+            auto const latency = now - e.enqueue_ns;
+            _statistics.total_latency += latency;
+            _statistics.max_latency = std::max( _statistics.max_latency, latency );
+        }
+
         lock.unlock();
-        _on_metadata_dropped( key, md );
-        if( ! alive.lock() )  // Check if was destructed by another thread during callback
-            return false;
+        try
+        {
+            for( auto & e : batch )
+            {
+                if( ! e.frame )
+                {
+                    if( _on_metadata_dropped )
+                        _on_metadata_dropped( e.key, e.md );
+                }
+                else if( _on_frame_ready && _started )
+                    _on_frame_ready( std::move( e.frame ), e.md );
+            }
+        }
+        catch( ... )
+        {
+            batch.clear();
+            if( alive.lock() )
+            {
+                lock.lock();
+                _delivering = false;
+            }
+            throw;
+        }
+        batch.clear();  // Release any frames not passed on
+        if( ! alive.lock() )  // Check if was destructed by another thread during callbacks
+            return;
         lock.lock();
     }
-
-    return true;
+    _delivering = false;
 }
 
 
+template class basic_metadata_syncer< rsutils::json >;
+template class basic_metadata_syncer< topics::metadata_msg >;
+
+
 }  // namespace realdds
@@ -7,6 +7,7 @@
 #include <realdds/dds-time.h>
 #include <realdds/dds-serialization.h>
 #include <realdds/dds-network-adapter-watcher.h>
+#include <realdds/dds-reader-pool.h>
 
 #include <fastdds/dds/domain/DomainParticipantFactory.hpp>
 #include <fastdds/dds/domain/DomainParticipantListener.hpp>
@@ -293,6 +294,24 @@ dds_participant::~dds_participant()
 }
 
 
+std::shared_ptr< dds_reader_pool > dds_participant::reader_pool()
+{
+    std::lock_guard< std::mutex > lock( _reader_pool_mutex );
+    if( ! _reader_pool )
+    {
+        int const n_threads = _settings.nested( "reader-threads" ).default_value( 0 );
+        if( n_threads < 0 )
+            DDS_THROW( runtime_error, "invalid reader-threads setting: " << n_threads );
+        if( n_threads > 0 )
+        {
+            LOG_DEBUG( name() << ": " << n_threads << " reader threads" );
+            _reader_pool = std::make_shared< dds_reader_pool >( n_threads );
+        }
+    }
+    return _reader_pool;
+}
+
+
 dds_guid const & dds_participant::guid() const
 {
     return get()->guid();
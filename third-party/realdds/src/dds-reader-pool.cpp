@@ -0,0 +1,226 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include <realdds/dds-reader-pool.h>
+#include <realdds/dds-topic-reader-thread.h>
+#include <realdds/dds-utilities.h>
+
+#include <fastdds/dds/subscriber/DataReader.hpp>
+#include <fastdds/dds/core/condition/GuardCondition.hpp>
+#include <fastdds/dds/core/condition/WaitSet.hpp>
+
+#include <algorithm>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <thread>
+
+
+namespace realdds {
+
+
+struct dds_reader_pool::worker
+{
+    struct entry
+    {
+        std::weak_ptr< dds_topic_reader_thread > reader;
+        eprosima::fastdds::dds::Condition * condition;
+    };
+
+    std::mutex mutex;
+    std::condition_variable removed_cv;
+    std::map< dds_topic_reader_thread *, entry > readers;  // attached to the wait-set
+    std::map< dds_topic_reader_thread *, entry > to_add;
+    std::vector< dds_topic_reader_thread * > to_remove;
+    dds_topic_reader_thread * in_callback = nullptr;
+    bool stop_after_callback = false;  // removed from another pool thread while in its callback
+    bool stopping = false;
+
+    // Attaching and detaching are done from our thread, while it does not wait, except that other pool threads, which
+    // may not wait for us, detach right away: Fast-DDS wait-sets allow it
+    eprosima::fastdds::dds::WaitSet wait_set;
+    eprosima::fastdds::dds::GuardCondition wake;
+    std::thread th;
+
+    size_t n_readers() const { return readers.size() + to_add.size() - to_remove.size(); }
+
+    void detach( dds_topic_reader_thread * reader )  // with the mutex locked
+    {
+        auto it = readers.find( reader );
+        if( it != readers.end() )
+        {
+            wait_set.detach_condition( *it->second.condition );
+            readers.erase( it );
+        }
+    }
+
+    void run()
+    {
+        wait_set.attach_condition( wake );
+        std::vector< std::shared_ptr< dds_topic_reader_thread > > ready;
+        while( true )
+        {
+            {
+                std::lock_guard< std::mutex > lock( mutex );
+                if( stopping )
+                    break;
+                for( auto & added : to_add )
+                {
+                    wait_set.attach_condition( *added.second.condition );
+                    readers.emplace( added );
+                }
+                to_add.clear();
+                if( ! to_remove.empty() )
+                {
+                    for( auto reader : to_remove )
+                        detach( reader );
+                    to_remove.clear();
+                    removed_cv.notify_all();
+                }
+                wake.set_trigger_value( false );
+            }
+
+            eprosima::fastdds::dds::ConditionSeq active_conditions;
+            wait_set.wait( active_conditions, eprosima::fastrtps::c_TimeInfinite );
+            auto const wake_time = dds_topic_reader_thread::steady_now();
+
+            {
+                std::lock_guard< std::mutex > lock( mutex );
+                for( auto & r : readers )
+                {
+                    if( std::find( active_conditions.begin(), active_conditions.end(), r.second.condition )
+                        == active_conditions.end() )
+                        continue;
+                    // A reader that is already destructing is waiting for us to remove it
+                    if( auto reader = r.second.reader.lock() )
+                        ready.push_back( std::move( reader ) );
+                }
+            }
+            for( auto & reader : ready )
+            {
+                {
+                    // Maybe removed from a callback of another reader
+                    std::lock_guard< std::mutex > lock( mutex );
+                    if( ! readers.count( reader.get() ) )
+                        continue;
+                    in_callback = reader.get();
+                }
+                reader->handle_status_changes( wake_time );
+                bool stop_reader;
+                {
+                    std::lock_guard< std::mutex > lock( mutex );
+                    in_callback = nullptr;
+                    stop_reader = stop_after_callback;
+                    stop_after_callback = false;
+                }
+                if( stop_reader )
+                    reader->stop_reader();
+            }
+            ready.clear();  // may destroy a reader, which removes itself
+        }
+        for( auto & r : readers )
+            wait_set.detach_condition( *r.second.condition );
+        wait_set.detach_condition( wake );
+    }
+};
+
+
+dds_reader_pool::dds_reader_pool( size_t n_threads )
+{
+    for( size_t i = 0; i < std::max( n_threads, size_t( 1 ) ); ++i )
+    {
+        auto w = std::make_shared< worker >();
+        // The thread keeps its worker alive, in case the pool is destroyed from it (by the last reader to go)
+        w->th = std::thread( [w]() { w->run(); } );
+        _workers.push_back( std::move( w ) );
+    }
+}
+
+
+dds_reader_pool::~dds_reader_pool()
+{
+    // Readers keep us alive, so there are none left
+    for( auto & w : _workers )
+    {
+        {
+            std::lock_guard< std::mutex > lock( w->mutex );
+            w->stopping = true;
+            w->wake.set_trigger_value( true );
+        }
+        if( w->th.get_id() != std::this_thread::get_id() )
+            w->th.join();
+        else
+            w->th.detach();
+    }
+}
+
+
+void dds_reader_pool::add( std::shared_ptr< dds_topic_reader_thread > const & reader )
+{
+    if( ! reader || ! reader->get() )
+        DDS_THROW( runtime_error, "reader must be running to be added to a pool" );
+
+    std::shared_ptr< worker > least_busy;
+    size_t least_readers = 0;
+    for( auto & w : _workers )
+    {
+        std::lock_guard< std::mutex > lock( w->mutex );
+        if( ! least_busy || w->n_readers() < least_readers )
+        {
+            least_busy = w;
+            least_readers = w->n_readers();
+        }
+    }
+
+    std::lock_guard< std::mutex > lock( least_busy->mutex );
+    least_busy->to_add.emplace( reader.get(), worker::entry{ reader, &reader->get()->get_statuscondition() } );
+    least_busy->wake.set_trigger_value( true );
+}
+
+
+bool dds_reader_pool::is_pool_thread() const
+{
+    auto const id = std::this_thread::get_id();
+    return std::any_of( _workers.begin(),
+                        _workers.end(),
+                        [id]( std::shared_ptr< worker > const & w ) { return w->th.get_id() == id; } );
+}
+
+
+bool dds_reader_pool::remove( dds_topic_reader_thread * reader )
+{
+    for( auto & w : _workers )
+    {
+        std::unique_lock< std::mutex > lock( w->mutex );
+        if( w->to_add.erase( reader ) )
+            return true;  // never attached
+        if( ! w->readers.count( reader ) )
+            continue;
+        if( w->th.get_id() == std::this_thread::get_id() )
+        {
+            // From a callback (or when its last reference was released by the worker): the thread is not waiting, so
+            // we can detach right away
+            w->detach( reader );
+            return true;
+        }
+        if( is_pool_thread() )
+        {
+            // From a callback on another of our threads: if we waited for this thread and it, in a callback, for us
+            // to remove one of ours, neither would ever return
+            w->detach( reader );
+            if( w->in_callback != reader )
+                return true;
+            w->stop_after_callback = true;
+            return false;
+        }
+        w->to_remove.push_back( reader );
+        w->wake.set_trigger_value( true );
+        // Once removed, the thread is done with whatever callbacks it was calling
+        w->removed_cv.wait( lock, [&]() { return w->stopping || ! w->readers.count( reader ); } );
+        return true;
+    }
+    return true;
+}
+
+
+}  // namespace realdds
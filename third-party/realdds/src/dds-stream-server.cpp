@@ -13,6 +13,8 @@
 #include <realdds/topics/flexible-msg.h>
 #include <realdds/dds-time.h>
 
+#include <rsutils/codec/rvl.h>
+
 #include <fastdds/dds/topic/Topic.hpp>
 #include <fastdds/dds/publisher/DataWriter.hpp>
 
@@ -236,12 +238,25 @@ void dds_video_stream_server::publish_image( topics::image_msg & image )
                                       << _image_header.encoding.to_string() << ")" );
 
     if( ! image.step() )
-        image.set_step( uint32_t( image.raw().data().size() / image.height() ) );
+        image.set_step( uint32_t( image.data_size() / image.height() ) );
 
     assert( ! image.is_bigendian() );
 
+    int const rvl_trim_bits = _rvl_trim_bits;
+    if( rvl_trim_bits >= 0 )
+        image.rvl_encode( _rvl_buffer, unsigned( rvl_trim_bits ) );
+
     LOG_DEBUG( "publishing '" << name() << "' " << image.encoding() << " frame @ " << time_to_string( image.timestamp() ) );
-    DDS_API_CALL( _writer->get()->write( &image.raw() ) );
+    image.write_to( *_writer );
+}
+
+
+void dds_video_stream_server::set_rvl_compression( int trim_bits )
+{
+    if( trim_bits > int( rsutils::codec::rvl_max_trim_bits ) )
+        DDS_THROW( runtime_error,
+                   "RVL trim bits (" << trim_bits << ") must be <= " << rsutils::codec::rvl_max_trim_bits );
+    _rvl_trim_bits = trim_bits < 0 ? -1 : trim_bits;
 }
 
 
@@ -98,7 +98,21 @@ void dds_video_stream::handle_data()
             continue;
 
         if( is_streaming() && _on_data_available )
+        {
+            if( frame.is_rvl() )
+            {
+                try
+                {
+                    frame.rvl_decode();
+                }
+                catch( std::exception const & e )
+                {
+                    LOG_ERROR( "[" << name() << "] dropping frame: " << e.what() );
+                    continue;
+                }
+            }
             _on_data_available( std::move( frame ), std::move( sample ) );
+        }
     }
 }
 
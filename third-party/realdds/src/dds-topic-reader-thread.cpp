@@ -2,6 +2,8 @@
 // Copyright(c) 2023-4 Intel Corporation. All Rights Reserved.
 
 #include <realdds/dds-topic-reader-thread.h>
+#include <realdds/dds-reader-pool.h>
+#include <realdds/dds-participant.h>
 #include <realdds/dds-topic.h>
 #include <realdds/dds-subscriber.h>
 #include <realdds/dds-utilities.h>
@@ -13,6 +15,9 @@
 #include <fastdds/dds/core/condition/GuardCondition.hpp>
 #include <fastdds/dds/core/condition/WaitSet.hpp>
 
+#include <algorithm>
+#include <chrono>
+
 namespace realdds {
 
 
@@ -43,7 +48,19 @@ void dds_topic_reader_thread::run( qos const & rqos )
 
     _reader = DDS_API_CALL( _subscriber->get()->create_datareader( _topic->get(), rqos ) );
     _stopped = std::make_shared< eprosima::fastdds::dds::GuardCondition >();
-    
+
+    auto & condition = _reader->get_statuscondition();
+    condition.set_enabled_statuses( eprosima::fastdds::dds::StatusMask::data_available()
+                                    << eprosima::fastdds::dds::StatusMask::subscription_matched()
+                                    << eprosima::fastdds::dds::StatusMask::sample_lost() );
+
+    _pool = _topic->get_participant()->reader_pool();
+    if( _pool )
+    {
+        _pool->add( std::static_pointer_cast< dds_topic_reader_thread >( shared_from_this() ) );
+        return;
+    }
+
     _th = std::thread(
         [this,
          weak = std::weak_ptr< dds_topic_reader >( shared_from_this() ),  // detect lifetime
@@ -53,12 +70,7 @@ void dds_topic_reader_thread::run( qos const & rqos )
             eprosima::fastdds::dds::WaitSet wait_set;
             if( auto strong = weak.lock() )
             {
-                auto & condition = _reader->get_statuscondition();
-                condition.set_enabled_statuses( eprosima::fastdds::dds::StatusMask::data_available()
-                                                << eprosima::fastdds::dds::StatusMask::subscription_matched()
-                                                << eprosima::fastdds::dds::StatusMask::sample_lost() );
-                wait_set.attach_condition( condition );
-
+                wait_set.attach_condition( _reader->get_statuscondition() );
                 wait_set.attach_condition( *stopped );
             }
             // We'll keep locking the object so it cannot destruct mid-callback, and exit out if we detect destruction
@@ -68,38 +80,84 @@ void dds_topic_reader_thread::run( qos const & rqos )
                 wait_set.wait( active_conditions, eprosima::fastrtps::c_TimeInfinite );
                 if( stopped->get_trigger_value() )
                     break;
-
-                auto & changed = _reader->get_status_changes();
-                if( changed.is_active( eprosima::fastdds::dds::StatusMask::sample_lost() ) )
-                {
-                    eprosima::fastdds::dds::SampleLostStatus status;
-                    _reader->get_sample_lost_status( status );
-                    on_sample_lost( _reader, status );
-                    if( stopped->get_trigger_value() )
-                        break;
-                }
-                if( changed.is_active( eprosima::fastdds::dds::StatusMask::data_available() ) )
-                {
-                    on_data_available( _reader );
-                    if( stopped->get_trigger_value() )
-                        break;
-                }
-                if( changed.is_active( eprosima::fastdds::dds::StatusMask::subscription_matched() ) )
-                {
-                    eprosima::fastdds::dds::SubscriptionMatchedStatus status;
-                    _reader->get_subscription_matched_status( status );
-                    on_subscription_matched( _reader, status );
-                    if( stopped->get_trigger_value() )
-                        break;
-                }
+                if( ! handle_status_changes( steady_now() ) )
+                    break;
             }
         } );
 }
 
 
+dds_nsec dds_topic_reader_thread::steady_now()
+{
+    return std::chrono::duration_cast< std::chrono::nanoseconds >(
+               std::chrono::steady_clock::now().time_since_epoch() )
+        .count();
+}
+
+
+bool dds_topic_reader_thread::handle_status_changes( dds_nsec const wake_time )
+{
+    auto const start = steady_now();
+
+    bool still_running = [&]
+    {
+        auto & changed = _reader->get_status_changes();
+        if( changed.is_active( eprosima::fastdds::dds::StatusMask::sample_lost() ) )
+        {
+            eprosima::fastdds::dds::SampleLostStatus status;
+            _reader->get_sample_lost_status( status );
+            on_sample_lost( _reader, status );
+            if( _stopped->get_trigger_value() )
+                return false;
+        }
+        if( changed.is_active( eprosima::fastdds::dds::StatusMask::data_available() ) )
+        {
+            on_data_available( _reader );
+            if( _stopped->get_trigger_value() )
+                return false;
+        }
+        if( changed.is_active( eprosima::fastdds::dds::StatusMask::subscription_matched() ) )
+        {
+            eprosima::fastdds::dds::SubscriptionMatchedStatus status;
+            _reader->get_subscription_matched_status( status );
+            on_subscription_matched( _reader, status );
+            if( _stopped->get_trigger_value() )
+                return false;
+        }
+        return true;
+    }();
+
+    auto const delay = start - wake_time;
+    auto const duration = steady_now() - start;
+    std::lock_guard< std::mutex > lock( _statistics_mutex );
+    ++_statistics.n_wakeups;
+    _statistics.total_delay += delay;
+    _statistics.max_delay = std::max( _statistics.max_delay, delay );
+    _statistics.total_duration += duration;
+    _statistics.max_duration = std::max( _statistics.max_duration, duration );
+    return still_running;
+}
+
+
+dds_topic_reader_thread::statistics dds_topic_reader_thread::get_statistics() const
+{
+    std::lock_guard< std::mutex > lock( _statistics_mutex );
+    return _statistics;
+}
+
+
 void dds_topic_reader_thread::stop()
 {
-    if( _th.joinable() )
+    if( _pool )
+    {
+        _stopped->set_trigger_value( true );
+        // Like below, this may be from within a callback: the pool handles it. If our callback is running on another
+        // of its threads, the pool stops us once it returns.
+        auto pool = std::move( _pool );
+        if( ! pool->remove( this ) )
+            return;
+    }
+    else if( _th.joinable() )
     {
         _stopped->set_trigger_value( true );
         // If we try to stop from within the thread (e.g., inside on_data_available), join() will terminate!
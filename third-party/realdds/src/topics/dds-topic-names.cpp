@@ -17,6 +17,8 @@ namespace notification {
         namespace key {
             std::string const n_streams( "n-streams", 9 );
             std::string const extrinsics( "extrinsics", 10 );
+            std::string const metadata_keys( "metadata-keys", 13 );
+            std::string const depth_encodings( "depth-encodings", 15 );
         }
     }
     namespace device_options {
@@ -126,6 +128,7 @@ namespace control {
             std::string const stream_profiles( "stream-profiles", 15 );
             std::string const reset( "reset", 5 );
             std::string const commit( "commit", 6 );
+            std::string const depth_encoding( "depth-encoding", 14 );
         }
     }
     namespace hwm {
@@ -6,16 +6,90 @@
 
 #include <realdds/dds-topic.h>
 #include <realdds/dds-topic-reader.h>
+#include <realdds/dds-topic-writer.h>
 #include <realdds/dds-utilities.h>
 
+#include <rsutils/codec/rvl.h>
+
 #include <fastdds/dds/subscriber/DataReader.hpp>
+#include <fastdds/dds/publisher/DataWriter.hpp>
 #include <fastdds/dds/topic/Topic.hpp>
 
+#include <fastcdr/FastBuffer.h>
+#include <fastcdr/Cdr.h>
+
 
 namespace realdds {
 namespace topics {
 
 
+// Same as a sensor_msgs::msg::Image on the wire, but the samples are image_msg objects. This lets us serialize the
+// image data directly from a user buffer (see image_msg::set_data_view), rather than first copying it into the Image.
+//
+class image_msg_type : public sensor_msgs::msg::ImagePubSubType
+{
+    using super = sensor_msgs::msg::ImagePubSubType;
+
+public:
+    bool serialize( void * data, eprosima::fastrtps::rtps::SerializedPayload_t * payload ) override
+    {
+        auto image = static_cast< image_msg * >( data );
+        auto const & raw = image->raw();
+
+        eprosima::fastcdr::FastBuffer fastbuffer( reinterpret_cast< char * >( payload->data ), payload->max_size );
+        eprosima::fastcdr::Cdr ser( fastbuffer,
+                                    eprosima::fastcdr::Cdr::DEFAULT_ENDIAN,
+                                    eprosima::fastcdr::Cdr::DDS_CDR );
+        payload->encapsulation = ser.endianness() == eprosima::fastcdr::Cdr::BIG_ENDIANNESS ? CDR_BE : CDR_LE;
+        ser.serialize_encapsulation();
+
+        try
+        {
+            // Must match sensor_msgs::msg::Image::serialize()
+            ser << raw.header();
+            ser << raw.height();
+            ser << raw.width();
+            ser << raw.encoding().c_str();
+            ser << raw.is_bigendian();
+            ser << raw.step();
+            ser << static_cast< uint32_t >( image->data_size() );
+            ser.serializeArray( image->data(), image->data_size() );
+        }
+        catch( eprosima::fastcdr::exception::NotEnoughMemoryException const & )
+        {
+            return false;
+        }
+
+        payload->length = static_cast< uint32_t >( ser.getSerializedDataLength() );
+        return true;
+    }
+
+    bool deserialize( eprosima::fastrtps::rtps::SerializedPayload_t * payload, void * data ) override
+    {
+        auto image = static_cast< image_msg * >( data );
+        image->_data_view = nullptr;
+        image->_data_view_size = 0;
+        return super::deserialize( payload, &image->_raw );
+    }
+
+    std::function< uint32_t() > getSerializedSizeProvider( void * data ) override
+    {
+        return [data]() -> uint32_t
+        {
+            auto image = static_cast< image_msg * >( data );
+            // With a data view, the raw data is empty and not part of the calculation
+            auto size = sensor_msgs::msg::Image::getCdrSerializedSize( image->raw() );
+            if( image->_data_view )
+                size += image->_data_view_size - image->raw().data().size();
+            return static_cast< uint32_t >( size ) + 4u /*encapsulation*/;
+        };
+    }
+
+    void * createData() override { return new image_msg(); }
+    void deleteData( void * data ) override { delete static_cast< image_msg * >( data ); }
+};
+
+
 image_msg::image_msg( sensor_msgs::msg::Image && rhs )
     : _raw( std::move( rhs ) )
 {
@@ -33,7 +107,7 @@ image_msg & image_msg::operator=( sensor_msgs::msg::Image && rhs )
 image_msg::create_topic( std::shared_ptr< dds_participant > const & participant, char const * topic_name )
 {
     return std::make_shared< dds_topic >( participant,
-                                          eprosima::fastdds::dds::TypeSupport( new image_msg::type ),
+                                          eprosima::fastdds::dds::TypeSupport( new image_msg_type ),
                                           topic_name );
 }
 
@@ -47,7 +121,7 @@ image_msg::take_next( dds_topic_reader & reader, image_msg * output, dds_sample
     dds_sample sample_;
     if( ! sample )
         sample = &sample_;  // use the local copy if the user hasn't provided their own
-    auto status = reader->take_next_sample( &output->raw(), sample );
+    auto status = reader->take_next_sample( output, sample );
     if( status == ReturnCode_t::RETCODE_OK )
     {
         // Only samples for which valid_data is true should be accessed
@@ -66,5 +140,59 @@ image_msg::take_next( dds_topic_reader & reader, image_msg * output, dds_sample
     DDS_API_CALL_THROW( "image_msg::take_next", status );
 }
 
+
+void image_msg::write_to( dds_topic_writer & writer )
+{
+    DDS_API_CALL( writer.get()->write( this ) );
+}
+
+
+/*static*/ std::string const image_msg::rvl_encoding( "rvl", 3 );
+
+
+bool image_msg::is_rvl() const
+{
+    auto const & e = encoding();
+    auto const n = rvl_encoding.length();
+    return e.length() > n + 1 && e[e.length() - n - 1] == ';' && e.compare( e.length() - n, n, rvl_encoding ) == 0;
+}
+
+
+void image_msg::rvl_encode( std::vector< uint8_t > & buffer, unsigned trim_bits )
+{
+    size_t const n_pixels = size_t( width() ) * height();
+    if( step() != 2 * width() || data_size() < 2 * n_pixels )
+        DDS_THROW( runtime_error, "RVL expects 16-bit pixels; got step " << step() << " for width " << width() );
+
+    buffer.resize( rsutils::codec::rvl_max_encoded_size( n_pixels ) );
+    auto const size = rsutils::codec::rvl_encode( reinterpret_cast< uint16_t const * >( data() ),
+                                                  n_pixels,
+                                                  buffer.data(),
+                                                  trim_bits );
+    set_data_view( buffer.data(), size );
+    set_encoding( encoding() + ';' + rvl_encoding );
+}
+
+
+void image_msg::rvl_decode()
+{
+    size_t const n_pixels = size_t( width() ) * height();
+    std::vector< uint8_t > decoded( 2 * n_pixels );
+    try
+    {
+        rsutils::codec::rvl_decode( data(), data_size(), reinterpret_cast< uint16_t * >( decoded.data() ), n_pixels );
+    }
+    catch( std::exception const & e )
+    {
+        DDS_THROW( runtime_error, "failed to decode " << width() << "x" << height() << " image: " << e.what() );
+    }
+    _raw.data().swap( decoded );
+    _data_view = nullptr;
+    _data_view_size = 0;
+    auto e = encoding();
+    e.resize( e.length() - rvl_encoding.length() - 1 );
+    set_encoding( std::move( e ) );
+}
+
 }  // namespace topics
 }  // namespace realdds
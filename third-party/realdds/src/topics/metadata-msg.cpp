@@ -0,0 +1,283 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include <realdds/topics/metadata-msg.h>
+#include <realdds/topics/flexible-msg.h>
+#include <realdds/topics/dds-topic-names.h>
+#include <realdds/dds-exceptions.h>
+
+#include <rsutils/json.h>
+
+#include <cstring>
+#include <limits>
+
+using rsutils::json;
+
+
+namespace realdds {
+namespace topics {
+
+
+metadata_keys::metadata_keys( std::vector< std::string > names )
+    : _names( std::move( names ) )
+{
+    if( _names.size() > std::numeric_limits< uint16_t >::max() )
+        DDS_THROW( runtime_error, "too many metadata keys (" << _names.size() << ")" );
+    for( uint16_t i = 0; i < _names.size(); ++i )
+        _indices.emplace( _names[i], i );
+}
+
+
+std::string const & metadata_keys::name( uint16_t index ) const
+{
+    if( index >= _names.size() )
+        DDS_THROW( runtime_error, "invalid metadata key index " << index );
+    return _names[index];
+}
+
+
+int metadata_keys::index_of( std::string const & name ) const
+{
+    auto it = _indices.find( name );
+    if( it == _indices.end() )
+        return -1;
+    return it->second;
+}
+
+
+uint16_t metadata_keys::add( std::string const & name )
+{
+    auto it = _indices.find( name );
+    if( it != _indices.end() )
+        return it->second;
+    if( _names.size() >= std::numeric_limits< uint16_t >::max() )
+        DDS_THROW( runtime_error, "too many metadata keys" );
+    auto index = static_cast< uint16_t >( _names.size() );
+    _names.push_back( name );
+    _indices.emplace( name, index );
+    return index;
+}
+
+
+namespace {
+
+
+enum flags : uint8_t
+{
+    FRAME_NUMBER = 1,
+    TIMESTAMP_DOMAIN = 2,
+    DEPTH_UNITS = 4,
+};
+
+
+// Values are sent little-endian, whatever the host: they go through the unsigned type of the same size
+template< size_t N > struct uint_of_size;
+template<> struct uint_of_size< 1 > { typedef uint8_t type; };
+template<> struct uint_of_size< 2 > { typedef uint16_t type; };
+template<> struct uint_of_size< 4 > { typedef uint32_t type; };
+template<> struct uint_of_size< 8 > { typedef uint64_t type; };
+
+
+template< class T >
+void put( uint8_t *& p, T value )
+{
+    typename uint_of_size< sizeof( T ) >::type u;
+    std::memcpy( &u, &value, sizeof( u ) );
+    for( size_t i = 0; i < sizeof( u ); ++i )
+        *p++ = static_cast< uint8_t >( u >> ( 8 * i ) );
+}
+
+
+class reader
+{
+    uint8_t const * _p;
+    uint8_t const * const _end;
+
+public:
+    reader( uint8_t const * data, size_t size )
+        : _p( data )
+        , _end( data + size )
+    {
+    }
+
+    void check( size_t size ) const
+    {
+        if( _p + size > _end )
+            DDS_THROW( runtime_error, "binary metadata is truncated" );
+    }
+
+    template< class T >
+    T get()
+    {
+        check( sizeof( T ) );
+        typename uint_of_size< sizeof( T ) >::type u = 0;
+        for( size_t i = 0; i < sizeof( u ); ++i )
+            u |= static_cast< decltype( u ) >( _p[i] ) << ( 8 * i );
+        _p += sizeof( u );
+        T value;
+        std::memcpy( &value, &u, sizeof( value ) );
+        return value;
+    }
+
+    void get( std::string & s, size_t size )
+    {
+        check( size );
+        s.assign( reinterpret_cast< char const * >( _p ), size );
+        _p += size;
+    }
+};
+
+
+}  // namespace
+
+
+void metadata_msg::encode( std::vector< uint8_t > & data ) const
+{
+    if( values.size() > std::numeric_limits< uint16_t >::max() )
+        DDS_THROW( runtime_error, "too many metadata values (" << values.size() << ")" );
+    if( stream_name.length() > std::numeric_limits< uint8_t >::max() )
+        DDS_THROW( runtime_error, "stream name '" << stream_name << "' is too long" );
+
+    uint8_t flags = 0;
+    size_t size = 1 + 1 + 2 + 1 + stream_name.length() + sizeof( timestamp );
+    if( has_frame_number )
+    {
+        flags |= FRAME_NUMBER;
+        size += sizeof( frame_number );
+    }
+    if( has_timestamp_domain )
+    {
+        flags |= TIMESTAMP_DOMAIN;
+        size += sizeof( timestamp_domain );
+    }
+    if( has_depth_units )
+    {
+        flags |= DEPTH_UNITS;
+        size += sizeof( depth_units );
+    }
+    size += values.size() * ( sizeof( uint16_t ) + sizeof( int64_t ) );
+
+    data.resize( size );
+    uint8_t * p = data.data();
+    put( p, VERSION );
+    put( p, flags );
+    put( p, static_cast< uint16_t >( values.size() ) );
+    put( p, static_cast< uint8_t >( stream_name.length() ) );
+    std::memcpy( p, stream_name.data(), stream_name.length() );
+    p += stream_name.length();
+    put( p, timestamp );
+    if( has_frame_number )
+        put( p, frame_number );
+    if( has_timestamp_domain )
+        put( p, timestamp_domain );
+    if( has_depth_units )
+        put( p, depth_units );
+    for( auto & kv : values )
+    {
+        put( p, kv.first );
+        put( p, kv.second );
+    }
+}
+
+
+void metadata_msg::decode( uint8_t const * data, size_t size )
+{
+    reader r( data, size );
+    auto version = r.get< uint8_t >();
+    if( version != VERSION )
+        DDS_THROW( runtime_error, "unsupported binary metadata version " << int( version ) );
+    auto flags = r.get< uint8_t >();
+    auto n_values = r.get< uint16_t >();
+    r.get( stream_name, r.get< uint8_t >() );
+    timestamp = r.get< dds_nsec >();
+    has_frame_number = ( flags & FRAME_NUMBER ) != 0;
+    if( has_frame_number )
+        frame_number = r.get< uint64_t >();
+    has_timestamp_domain = ( flags & TIMESTAMP_DOMAIN ) != 0;
+    if( has_timestamp_domain )
+        timestamp_domain = r.get< int32_t >();
+    has_depth_units = ( flags & DEPTH_UNITS ) != 0;
+    if( has_depth_units )
+        depth_units = r.get< float >();
+    r.check( n_values * ( sizeof( uint16_t ) + sizeof( int64_t ) ) );
+    values.resize( n_values );
+    for( auto & kv : values )
+    {
+        kv.first = r.get< uint16_t >();
+        kv.second = r.get< int64_t >();
+    }
+}
+
+
+flexible_msg metadata_msg::to_flexible() const
+{
+    flexible_msg msg;
+    msg._data_format = flexible_msg::data_format::CUSTOM;
+    msg._version = VERSION;
+    encode( msg._data );
+    return msg;
+}
+
+
+json metadata_msg::to_json() const
+{
+    json header = json::object( { { metadata::header::key::timestamp, timestamp } } );
+    if( has_frame_number )
+        header[metadata::header::key::frame_number] = frame_number;
+    if( has_timestamp_domain )
+        header[metadata::header::key::timestamp_domain] = timestamp_domain;
+    if( has_depth_units )
+        header[metadata::header::key::depth_units] = depth_units;
+
+    json md = json::object();
+    for( auto & kv : values )
+        md[keys ? keys->name( kv.first ) : std::to_string( kv.first )] = kv.second;
+
+    return json::object( {
+        { metadata::key::stream_name, stream_name },
+        { metadata::key::header, std::move( header ) },
+        { metadata::key::metadata, std::move( md ) },
+    } );
+}
+
+
+/*static*/ metadata_msg metadata_msg::from_json( json const & j, std::shared_ptr< const metadata_keys > & keys )
+{
+    metadata_msg msg;
+    msg.stream_name = j.nested( metadata::key::stream_name ).string_ref_or_empty();
+
+    auto header = j.nested( metadata::key::header );
+    if( ! header.nested( metadata::header::key::timestamp ).get_ex( msg.timestamp ) )
+        DDS_THROW( runtime_error, "missing metadata header/timestamp" );
+    msg.has_frame_number = header.nested( metadata::header::key::frame_number ).get_ex( msg.frame_number );
+    msg.has_timestamp_domain
+        = header.nested( metadata::header::key::timestamp_domain ).get_ex( msg.timestamp_domain );
+    msg.has_depth_units = header.nested( metadata::header::key::depth_units ).get_ex( msg.depth_units );
+
+    if( auto md = j.nested( metadata::key::metadata, &json::is_object ) )
+    {
+        std::shared_ptr< metadata_keys > new_keys;
+        msg.values.reserve( md.size() );
+        for( auto it = md.begin(); it != md.end(); ++it )
+        {
+            if( ! it.value().is_number_integer() )
+                continue;
+            int index = keys ? keys->index_of( it.key() ) : -1;
+            if( index < 0 )
+            {
+                if( ! new_keys )
+                    new_keys = keys ? std::make_shared< metadata_keys >( *keys ) : std::make_shared< metadata_keys >();
+                index = new_keys->add( it.key() );
+            }
+            msg.values.emplace_back( static_cast< uint16_t >( index ), it.value().get< int64_t >() );
+        }
+        if( new_keys )
+            keys = std::move( new_keys );
+    }
+    msg.keys = keys;
+    return msg;
+}
+
+
+}  // namespace topics
+}  // namespace realdds
@@ -39,6 +39,7 @@
 #include "macros.h"
 
 #include "buffer.h"
+#include "chunk_prefetcher.h"
 #include "chunked_file.h"
 #include "constants.h"
 #include "exceptions.h"
@@ -52,6 +53,7 @@
 
 #include <ios>
 #include <map>
+#include <memory>
 #include <queue>
 #include <set>
 #include <stdexcept>
@@ -119,6 +121,14 @@ public:
     void            setChunkThreshold(uint32_t chunk_threshold);  //!< Set the threshold for creating new chunks
     uint32_t        getChunkThreshold() const;                    //!< Get the threshold for creating new chunks
 
+    //! Read and decompress up to 'chunks' chunks ahead of the one being read, on 'threads' worker threads
+    /*!
+     * Applies to reading only, and stays in effect when the bag is reopened. Set chunks to 0 to disable.
+     */
+    void            setReadAhead(uint32_t chunks, uint32_t threads);
+    //! Like above, but on the threads of a pool that can be shared with other bags
+    void            setReadAhead(uint32_t chunks, std::shared_ptr<ReadAheadPool> pool);
+
     //! Write a message into the bag file
     /*!
      * \param topic The topic name
@@ -223,9 +233,12 @@ private:
     void readMessageDataIntoStream(IndexEntry const& index_entry, Stream& stream) const;
 
     void     decompressChunk(uint64_t chunk_pos) const;
-    void     decompressRawChunk(ChunkHeader const& chunk_header) const;
-    void     decompressBz2Chunk(ChunkHeader const& chunk_header) const;
-    void     decompressLz4Chunk(ChunkHeader const& chunk_header) const;
+    //! Safe to call from any thread, as long as each uses its own file and buffers
+    void     readChunk(ChunkedFile& file, uint64_t chunk_pos, Buffer& chunk_buffer, Buffer& decompress_buffer) const;
+    void     decompressRawChunk(ChunkedFile& file, ChunkHeader const& chunk_header, Buffer& decompress_buffer) const;
+    void     decompressBz2Chunk(ChunkedFile& file, ChunkHeader const& chunk_header, Buffer& chunk_buffer, Buffer& decompress_buffer) const;
+    void     decompressLz4Chunk(ChunkedFile& file, ChunkHeader const& chunk_header, Buffer& chunk_buffer, Buffer& decompress_buffer) const;
+    void     startReadAhead();
     uint32_t getChunkOffset() const;
 
     // Record header I/O
@@ -305,6 +318,10 @@ private:
     mutable Buffer*  current_buffer_;
 
     mutable uint64_t decompressed_chunk_;      //!< position of decompressed chunk
+
+    uint32_t read_ahead_chunks_;
+    std::shared_ptr<ReadAheadPool> read_ahead_pool_;
+    mutable std::unique_ptr<ChunkPrefetcher> prefetcher_;  //!< decompresses the chunks that follow, when reading
 };
 
 } // namespace rosbag
@@ -0,0 +1,93 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#ifndef ROSBAG_CHUNK_PREFETCHER_H
+#define ROSBAG_CHUNK_PREFETCHER_H
+
+#include "buffer.h"
+#include "chunked_file.h"
+#include "macros.h"
+#include "read_ahead_pool.h"
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace rosbag {
+
+//! Reads and decompresses the chunks that follow the one being read, on the threads of a ReadAheadPool
+/*!
+ * Each chunk is read through a handle to the file of its own (reused from one chunk to the next), so the bag's own
+ * handle (and its single-chunk cache) are never touched from another thread. At most 'chunks' chunks are kept ahead
+ * of the one last taken; anything else is dropped as soon as the reader moves somewhere else (e.g., on a seek).
+ *
+ * The pool may be shared with other prefetchers (of other bags); it must outlive this one.
+ */
+class ROSBAG_DECL ChunkPrefetcher
+{
+public:
+    //! Reads the chunk at chunk_pos from file into decompress_buffer, using chunk_buffer for the compressed data
+    typedef std::function< void( ChunkedFile & file, uint64_t chunk_pos, Buffer & chunk_buffer, Buffer & decompress_buffer ) >
+        ChunkLoader;
+
+    ChunkPrefetcher( std::string const & filename,
+                     std::vector< uint64_t > chunk_positions,
+                     uint32_t chunks,
+                     std::shared_ptr< ReadAheadPool > pool,
+                     ChunkLoader loader );
+    ~ChunkPrefetcher();
+
+    //! Swaps the chunk into buffer if it was prefetched, waiting for it if it is being read right now
+    /*!
+     * Either way, the chunks that follow it are scheduled. Returns false if the chunk was not prefetched (or failed to
+     * read), in which case the caller should read it itself.
+     */
+    bool take( uint64_t chunk_pos, Buffer & buffer );
+
+private:
+    enum State
+    {
+        QUEUED,
+        LOADING,
+        READY,
+        FAILED
+    };
+    struct Entry
+    {
+        State state;
+        std::unique_ptr< Buffer > buffer;
+    };
+    struct Reader
+    {
+        ChunkedFile file;
+        Buffer chunk_buffer;
+    };
+
+    void load_next();
+    std::unique_ptr< Buffer > get_free_buffer();
+    std::unique_ptr< Reader > get_free_reader();
+
+    std::string filename_;
+    std::vector< uint64_t > positions_;  //!< sorted, i.e. in the order the chunks appear in the file
+    uint32_t chunks_;
+    std::shared_ptr< ReadAheadPool > pool_;
+    ChunkLoader loader_;
+
+    std::mutex mutex_;
+    std::condition_variable ready_cv_;
+    std::map< uint64_t, Entry > cache_;
+    std::deque< uint64_t > queue_;
+    std::vector< std::unique_ptr< Buffer > > free_buffers_;
+    std::vector< std::unique_ptr< Reader > > free_readers_;
+    uint32_t posted_;  //!< jobs posted to the pool that did not run yet
+    bool stopping_;
+};
+
+}  // namespace rosbag
+
+#endif
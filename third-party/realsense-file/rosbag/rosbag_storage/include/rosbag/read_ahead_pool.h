@@ -0,0 +1,48 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#ifndef ROSBAG_READ_AHEAD_POOL_H
+#define ROSBAG_READ_AHEAD_POOL_H
+
+#include "macros.h"
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace rosbag {
+
+//! Worker threads that read (and decompress) chunks ahead, for one bag or shared by many
+/*!
+ * Jobs run in the order they are posted. A job must not wait on another, as all threads may be busy with jobs of
+ * other bags; whoever posted it must make sure it stays valid until it ran.
+ */
+class ROSBAG_DECL ReadAheadPool
+{
+public:
+    explicit ReadAheadPool( uint32_t threads );
+    ~ReadAheadPool();
+
+    ReadAheadPool( ReadAheadPool const & ) = delete;
+    ReadAheadPool & operator=( ReadAheadPool const & ) = delete;
+
+    uint32_t size() const { return uint32_t( threads_.size() ); }
+
+    void post( std::function< void() > job );
+
+private:
+    void work();
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque< std::function< void() > > jobs_;
+    bool stopping_;
+    std::vector< std::thread > threads_;
+};
+
+}  // namespace rosbag
+
+#endif
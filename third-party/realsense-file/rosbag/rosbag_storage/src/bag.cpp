@@ -69,7 +69,8 @@ Bag::Bag() :
     chunk_open_(false),
     curr_chunk_data_pos_(0),
     current_buffer_(0),
-    decompressed_chunk_(0)
+    decompressed_chunk_(0),
+    read_ahead_chunks_(0)
 {
 }
 
@@ -85,7 +86,8 @@ Bag::Bag(string const& filename, uint32_t mode) :
     chunk_open_(false),
     curr_chunk_data_pos_(0),
     current_buffer_(0),
-    decompressed_chunk_(0)
+    decompressed_chunk_(0),
+    read_ahead_chunks_(0)
 {
     open(filename, mode);
 }
@@ -125,6 +127,8 @@ void Bag::openRead(string const& filename) {
         throw BagException( "Unsupported bag file version: " + std::to_string( getMajorVersion() ) + '.'
                             + std::to_string( getMinorVersion() ) );
     }
+
+    startReadAhead();
 }
 
 void Bag::openWrite(string const& filename) {
@@ -160,6 +164,9 @@ void Bag::close() {
     if (!file_.isOpen())
         return;
 
+    prefetcher_.reset();
+    decompressed_chunk_ = 0;
+
     if (mode_ & bagmode::Write || mode_ & bagmode::Append)
         closeWrite();
 
@@ -192,6 +199,36 @@ void Bag::setChunkThreshold(uint32_t chunk_threshold) {
     chunk_threshold_ = chunk_threshold;
 }
 
+void Bag::setReadAhead(uint32_t chunks, uint32_t threads) {
+    setReadAhead(chunks, chunks ? std::make_shared<ReadAheadPool>(threads) : nullptr);
+}
+
+void Bag::setReadAhead(uint32_t chunks, std::shared_ptr<ReadAheadPool> pool) {
+    if (chunks && !pool)
+        throw BagException("Read-ahead requires a pool");
+    // Any prefetcher must go before the pool it uses
+    prefetcher_.reset();
+    read_ahead_chunks_ = chunks;
+    read_ahead_pool_ = std::move(pool);
+    if (file_.isOpen())
+        startReadAhead();
+}
+
+void Bag::startReadAhead() {
+    prefetcher_.reset();
+    if (!read_ahead_chunks_ || mode_ != bagmode::Read || version_ != 200 || chunks_.size() < 2)
+        return;
+
+    std::vector<uint64_t> chunk_positions;
+    chunk_positions.reserve(chunks_.size());
+    for (ChunkInfo const& chunk_info : chunks_)
+        chunk_positions.push_back(chunk_info.pos);
+    prefetcher_.reset(new ChunkPrefetcher(file_.getFileName(), std::move(chunk_positions), read_ahead_chunks_, read_ahead_pool_,
+        [this](ChunkedFile& file, uint64_t chunk_pos, Buffer& chunk_buffer, Buffer& decompress_buffer) {
+            readChunk(file, chunk_pos, chunk_buffer, decompress_buffer);
+        }));
+}
+
 CompressionType Bag::getCompression() const { return compression_; }
 
 std::tuple<std::string, uint64_t, uint64_t> Bag::getCompressionInfo() const
@@ -793,24 +830,43 @@ void Bag::decompressChunk(uint64_t chunk_pos) const {
     if (decompressed_chunk_ == chunk_pos)
         return;
 
+    if (!prefetcher_ || !prefetcher_->take(chunk_pos, decompress_buffer_))
+        readChunk(file_, chunk_pos, chunk_buffer_, decompress_buffer_);
+
+    decompressed_chunk_ = chunk_pos;
+}
+
+void Bag::readChunk(ChunkedFile& file, uint64_t chunk_pos, Buffer& chunk_buffer, Buffer& decompress_buffer) const {
     // Seek to the start of the chunk
-    seek(chunk_pos);
+    file.seek(chunk_pos);
 
-    // Read the chunk header
+    // Read the chunk header (like readChunkHeader, but without the bag's own file and header buffer)
     ChunkHeader chunk_header;
-    readChunkHeader(chunk_header);
+    uint32_t header_len;
+    file.read(&header_len, 4);
+    chunk_buffer.setSize(header_len);
+    file.read(chunk_buffer.getData(), header_len);
+    rs2rosinternal::Header header;
+    string error_msg;
+    if (!header.parse(chunk_buffer.getData(), header_len, error_msg))
+        throw BagFormatException("Error reading CHUNK record");
+    file.read(&chunk_header.compressed_size, 4);
+
+    M_string& fields = *header.getValues();
+    if (!isOp(fields, OP_CHUNK))
+        throw BagFormatException("Expected CHUNK op not found");
+    readField(fields, COMPRESSION_FIELD_NAME, true, chunk_header.compression);
+    readField(fields, SIZE_FIELD_NAME,        true, &chunk_header.uncompressed_size);
 
     // Read and decompress the chunk.  These assume we are at the right place in the stream already
     if (chunk_header.compression == COMPRESSION_NONE)
-        decompressRawChunk(chunk_header);
+        decompressRawChunk(file, chunk_header, decompress_buffer);
     else if (chunk_header.compression == COMPRESSION_BZ2)
-        decompressBz2Chunk(chunk_header);
+        decompressBz2Chunk(file, chunk_header, chunk_buffer, decompress_buffer);
     else if (chunk_header.compression == COMPRESSION_LZ4)
-        decompressLz4Chunk(chunk_header);
+        decompressLz4Chunk(file, chunk_header, chunk_buffer, decompress_buffer);
     else
         throw BagFormatException("Unknown compression: " + chunk_header.compression);
-
-    decompressed_chunk_ = chunk_pos;
 }
 
 void Bag::readMessageDataRecord102(uint64_t offset, rs2rosinternal::Header& header) const {
@@ -836,35 +892,35 @@ void Bag::readMessageDataRecord102(uint64_t offset, rs2rosinternal::Header& head
 }
 
 // Reading this into a buffer isn't completely necessary, but we do it anyways for now
-void Bag::decompressRawChunk(ChunkHeader const& chunk_header) const {
+void Bag::decompressRawChunk(ChunkedFile& file, ChunkHeader const& chunk_header, Buffer& decompress_buffer) const {
     assert(chunk_header.compression == COMPRESSION_NONE);
     assert(chunk_header.compressed_size == chunk_header.uncompressed_size);
 
     CONSOLE_BRIDGE_logDebug("compressed_size: %d uncompressed_size: %d", chunk_header.compressed_size, chunk_header.uncompressed_size);
 
-    decompress_buffer_.setSize(chunk_header.compressed_size);
-    file_.read((char*) decompress_buffer_.getData(), chunk_header.compressed_size);
+    decompress_buffer.setSize(chunk_header.compressed_size);
+    file.read((char*) decompress_buffer.getData(), chunk_header.compressed_size);
 
     // todo check read was successful
 }
 
-void Bag::decompressBz2Chunk(ChunkHeader const& chunk_header) const {
+void Bag::decompressBz2Chunk(ChunkedFile& file, ChunkHeader const& chunk_header, Buffer& chunk_buffer, Buffer& decompress_buffer) const {
     assert(chunk_header.compression == COMPRESSION_BZ2);
 
     CompressionType compression = compression::BZ2;
 
     CONSOLE_BRIDGE_logDebug("compressed_size: %d uncompressed_size: %d", chunk_header.compressed_size, chunk_header.uncompressed_size);
 
-    chunk_buffer_.setSize(chunk_header.compressed_size);
-    file_.read((char*) chunk_buffer_.getData(), chunk_header.compressed_size);
+    chunk_buffer.setSize(chunk_header.compressed_size);
+    file.read((char*) chunk_buffer.getData(), chunk_header.compressed_size);
 
-    decompress_buffer_.setSize(chunk_header.uncompressed_size);
-    file_.decompress(compression, decompress_buffer_.getData(), decompress_buffer_.getSize(), chunk_buffer_.getData(), chunk_buffer_.getSize());
+    decompress_buffer.setSize(chunk_header.uncompressed_size);
+    file.decompress(compression, decompress_buffer.getData(), decompress_buffer.getSize(), chunk_buffer.getData(), chunk_buffer.getSize());
 
     // todo check read was successful
 }
 
-void Bag::decompressLz4Chunk(ChunkHeader const& chunk_header) const {
+void Bag::decompressLz4Chunk(ChunkedFile& file, ChunkHeader const& chunk_header, Buffer& chunk_buffer, Buffer& decompress_buffer) const {
     assert(chunk_header.compression == COMPRESSION_LZ4);
 
     CompressionType compression = compression::LZ4;
@@ -872,11 +928,11 @@ void Bag::decompressLz4Chunk(ChunkHeader const& chunk_header) const {
     CONSOLE_BRIDGE_logDebug("lz4 compressed_size: %d uncompressed_size: %d",
              chunk_header.compressed_size, chunk_header.uncompressed_size);
 
-    chunk_buffer_.setSize(chunk_header.compressed_size);
-    file_.read((char*) chunk_buffer_.getData(), chunk_header.compressed_size);
+    chunk_buffer.setSize(chunk_header.compressed_size);
+    file.read((char*) chunk_buffer.getData(), chunk_header.compressed_size);
 
-    decompress_buffer_.setSize(chunk_header.uncompressed_size);
-    file_.decompress(compression, decompress_buffer_.getData(), decompress_buffer_.getSize(), chunk_buffer_.getData(), chunk_buffer_.getSize());
+    decompress_buffer.setSize(chunk_header.uncompressed_size);
+    file.decompress(compression, decompress_buffer.getData(), decompress_buffer.getSize(), chunk_buffer.getData(), chunk_buffer.getSize());
 
     // todo check read was successful
 }
@@ -0,0 +1,155 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "rosbag/chunk_prefetcher.h"
+
+#include <algorithm>
+
+namespace rosbag {
+
+ChunkPrefetcher::ChunkPrefetcher( std::string const & filename,
+                                  std::vector< uint64_t > chunk_positions,
+                                  uint32_t chunks,
+                                  std::shared_ptr< ReadAheadPool > pool,
+                                  ChunkLoader loader )
+    : filename_( filename )
+    , positions_( std::move( chunk_positions ) )
+    , chunks_( chunks )
+    , pool_( std::move( pool ) )
+    , loader_( std::move( loader ) )
+    , posted_( 0 )
+    , stopping_( false )
+{
+    std::sort( positions_.begin(), positions_.end() );
+}
+
+ChunkPrefetcher::~ChunkPrefetcher()
+{
+    // Jobs still in the pool refer to us; once stopping, they return as soon as they run
+    std::unique_lock< std::mutex > lock( mutex_ );
+    stopping_ = true;
+    ready_cv_.wait( lock, [this]() { return ! posted_; } );
+}
+
+bool ChunkPrefetcher::take( uint64_t chunk_pos, Buffer & buffer )
+{
+    std::unique_lock< std::mutex > lock( mutex_ );
+
+    bool taken = false;
+    auto it = cache_.find( chunk_pos );
+    if( it != cache_.end() )
+    {
+        if( it->second.state == QUEUED )
+        {
+            // No worker got to it yet: the caller can read it just as fast
+            queue_.erase( std::find( queue_.begin(), queue_.end(), chunk_pos ) );
+        }
+        else
+        {
+            ready_cv_.wait( lock, [&]() { return it->second.state != LOADING; } );
+            if( it->second.state == READY )
+            {
+                buffer.swap( *it->second.buffer );
+                taken = true;
+            }
+            free_buffers_.push_back( std::move( it->second.buffer ) );
+        }
+        cache_.erase( it );
+    }
+
+    // Keep (or schedule) only the chunks that follow
+    auto first = std::upper_bound( positions_.begin(), positions_.end(), chunk_pos );
+    auto last = first + std::min< size_t >( chunks_, positions_.end() - first );
+    for( auto e = cache_.begin(); e != cache_.end(); )
+    {
+        if( e->second.state == LOADING || std::binary_search( first, last, e->first ) )
+        {
+            ++e;
+            continue;
+        }
+        if( e->second.state == QUEUED )
+            queue_.erase( std::find( queue_.begin(), queue_.end(), e->first ) );
+        else
+            free_buffers_.push_back( std::move( e->second.buffer ) );
+        e = cache_.erase( e );
+    }
+    uint32_t n_scheduled = 0;
+    for( auto p = first; p != last; ++p )
+    {
+        Entry entry = { QUEUED, nullptr };
+        if( cache_.emplace( *p, std::move( entry ) ).second )
+        {
+            queue_.push_back( *p );
+            ++n_scheduled;
+        }
+    }
+    // Don't hold on to more memory than the cache can ever need
+    if( free_buffers_.size() > chunks_ + pool_->size() )
+        free_buffers_.resize( chunks_ + pool_->size() );
+    posted_ += n_scheduled;
+
+    lock.unlock();
+    // One job per queued chunk; a job whose chunk was dropped from the queue meanwhile loads the next one, or nothing
+    for( uint32_t i = 0; i < n_scheduled; ++i )
+        pool_->post( [this]() { load_next(); } );
+    return taken;
+}
+
+std::unique_ptr< Buffer > ChunkPrefetcher::get_free_buffer()
+{
+    if( free_buffers_.empty() )
+        return std::unique_ptr< Buffer >( new Buffer() );
+    auto buffer = std::move( free_buffers_.back() );
+    free_buffers_.pop_back();
+    return buffer;
+}
+
+std::unique_ptr< ChunkPrefetcher::Reader > ChunkPrefetcher::get_free_reader()
+{
+    if( free_readers_.empty() )
+        return std::unique_ptr< Reader >( new Reader() );
+    auto reader = std::move( free_readers_.back() );
+    free_readers_.pop_back();
+    return reader;
+}
+
+void ChunkPrefetcher::load_next()
+{
+    std::unique_lock< std::mutex > lock( mutex_ );
+    if( stopping_ || queue_.empty() )
+    {
+        --posted_;
+        ready_cv_.notify_all();
+        return;
+    }
+
+    uint64_t chunk_pos = queue_.front();
+    queue_.pop_front();
+    cache_[chunk_pos].state = LOADING;  // LOADING entries are never removed by anyone else
+    auto buffer = get_free_buffer();
+    auto reader = get_free_reader();
+    lock.unlock();
+
+    bool ok = true;
+    try
+    {
+        if( ! reader->file.isOpen() )
+            reader->file.openRead( filename_ );
+        loader_( reader->file, chunk_pos, reader->chunk_buffer, *buffer );
+    }
+    catch( ... )
+    {
+        // The caller will read it again, and get the error
+        ok = false;
+    }
+
+    lock.lock();
+    auto & entry = cache_[chunk_pos];
+    entry.state = ok ? READY : FAILED;
+    entry.buffer = std::move( buffer );
+    free_readers_.push_back( std::move( reader ) );
+    --posted_;
+    ready_cv_.notify_all();
+}
+
+}  // namespace rosbag
@@ -0,0 +1,55 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "rosbag/read_ahead_pool.h"
+
+#include <algorithm>
+
+namespace rosbag {
+
+ReadAheadPool::ReadAheadPool( uint32_t threads )
+    : stopping_( false )
+{
+    for( uint32_t i = 0; i < std::max( threads, 1u ); ++i )
+        threads_.emplace_back( [this]() { work(); } );
+}
+
+ReadAheadPool::~ReadAheadPool()
+{
+    {
+        std::lock_guard< std::mutex > lock( mutex_ );
+        stopping_ = true;
+    }
+    cv_.notify_all();
+    for( auto & thread : threads_ )
+        thread.join();
+}
+
+void ReadAheadPool::post( std::function< void() > job )
+{
+    {
+        std::lock_guard< std::mutex > lock( mutex_ );
+        jobs_.push_back( std::move( job ) );
+    }
+    cv_.notify_one();
+}
+
+void ReadAheadPool::work()
+{
+    std::unique_lock< std::mutex > lock( mutex_ );
+    while( true )
+    {
+        // Whatever was posted is run, even when stopping: its poster may be waiting for it
+        cv_.wait( lock, [this]() { return stopping_ || ! jobs_.empty(); } );
+        if( jobs_.empty() )
+            break;
+
+        auto job = std::move( jobs_.front() );
+        jobs_.pop_front();
+        lock.unlock();
+        job();
+        lock.lock();
+    }
+}
+
+}  // namespace rosbag
@@ -0,0 +1,56 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+#pragma once
+
+#include <cstdint>
+#include <stddef.h>
+
+
+namespace rsutils {
+namespace codec {
+
+
+// RVL (Run-length, Variable-Length) compression of 16-bit depth images, after A. Wilson, "Fast Lossless Depth Image
+// Compression" (2017).
+//
+// Pixels are scanned in order, as runs of zeros (invalid depth) followed by runs of non-zeros. The length of each run
+// and the zigzag-encoded difference of every non-zero pixel from the previous one are written as variable-length
+// codes of 3-bit nibbles (with a continuation bit), packed eight to a 32-bit little-endian word, first nibble in the
+// low bits. Depth is smooth, so most differences fit in a single nibble.
+//
+// The encoded buffer starts with a small header (magic, pixel count, trim bits) so it can be decoded on its own.
+//
+// Trimming drops the given number of least-significant bits from each depth value before encoding. This is lossy
+// (values decode to the middle of their trimmed range, so are off by up to half of it) but compresses further. Values
+// that trim to zero decode as zero (invalid).
+
+
+constexpr unsigned rvl_max_trim_bits = 8;
+
+
+// Size of a buffer big enough to hold any encoding of that many pixels
+size_t rvl_max_encoded_size( size_t n_pixels );
+
+// Encodes the pixels into 'encoded', which must have room for rvl_max_encoded_size( n_pixels ) bytes.
+// Returns the number of bytes actually written.
+// Throws std::invalid_argument if trim_bits > rvl_max_trim_bits.
+size_t rvl_encode( uint16_t const * pixels, size_t n_pixels, uint8_t * encoded, unsigned trim_bits = 0 );
+
+// Like above, but into a buffer of only 'size' bytes: returns 0, with the buffer partly written, if the encoding does
+// not fit. Lets the caller encode straight into a smaller buffer (e.g., of the decoded size) when that is enough.
+size_t rvl_encode( uint16_t const * pixels, size_t n_pixels, uint8_t * encoded, size_t size, unsigned trim_bits );
+
+// Returns true if the buffer starts with an RVL header
+bool is_rvl( uint8_t const * encoded, size_t size );
+
+// Returns the number of pixels the buffer decodes to, per its header; throws std::runtime_error if not RVL
+size_t rvl_decoded_pixels( uint8_t const * encoded, size_t size );
+
+// Decodes the buffer into exactly n_pixels pixels.
+// Throws std::runtime_error if the buffer is not RVL, is for a different number of pixels, or is malformed. The buffer
+// may come from the network, so it is never read out of bounds.
+void rvl_decode( uint8_t const * encoded, size_t size, uint16_t * pixels, size_t n_pixels );
+
+
+}  // namespace codec
+}  // namespace rsutils
@@ -320,6 +320,7 @@ public:
     ~dispatcher();
 
     bool empty() const { return _queue.empty(); }
+    size_t size() const { return _queue.size(); }
 
     // Main invocation of an action: this will be called from any thread, and basically just queues
     // up the actions for our dispatching thread to handle them.
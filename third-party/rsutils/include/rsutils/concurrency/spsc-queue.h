@@ -0,0 +1,168 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+
+namespace rsutils {
+namespace concurrency {
+
+
+// A bounded queue for exactly one producer thread and one consumer thread, that neither locks nor allocates.
+//
+// Items live in a ring allocated up-front and are written and read in place: pushing and popping are an atomic load
+// and store each (plus whatever copying the caller does). This is meant for hand-offs where the producer must never
+// block, e.g. a backend thread passing high-rate samples to a delivery thread.
+//
+// The consumer may wait for items: the producer only takes a lock to wake it if it's actually waiting, so while items
+// keep coming there is no locking at all.
+//
+template< class T >
+class spsc_queue
+{
+    std::vector< T > _ring;
+    size_t const _mask;
+
+    // Written by the consumer only; kept away from the producer's index so they don't share a cache line
+    std::atomic< size_t > _head;  // the next item to pop
+    char _pad1[64];
+    std::atomic< size_t > _tail;  // the next slot to push to; written by the producer only
+    char _pad2[64];
+
+    std::atomic< bool > _waiting;
+    std::atomic< bool > _stopped;
+    std::mutex _mutex;
+    std::condition_variable _cv;
+
+    static size_t round_up( size_t capacity )
+    {
+        size_t n = 2;
+        while( n < capacity )
+            n <<= 1;
+        return n;
+    }
+
+public:
+    // The capacity is rounded up to a power of 2
+    explicit spsc_queue( size_t capacity )
+        : _ring( round_up( capacity ) )
+        , _mask( _ring.size() - 1 )
+        , _head( 0 )
+        , _tail( 0 )
+        , _waiting( false )
+        , _stopped( false )
+    {
+    }
+
+    spsc_queue( spsc_queue const & ) = delete;
+    spsc_queue & operator=( spsc_queue const & ) = delete;
+
+    size_t capacity() const { return _ring.size(); }
+    size_t size() const { return _tail.load( std::memory_order_acquire ) - _head.load( std::memory_order_acquire ); }
+    bool empty() const { return size() == 0; }
+
+    // Producer: the slot to fill with the next item, or null if the queue is full. The item is not visible to the
+    // consumer until push() is called.
+    T * reserve()
+    {
+        auto const tail = _tail.load( std::memory_order_relaxed );
+        if( tail - _head.load( std::memory_order_acquire ) > _mask )
+            return nullptr;
+        return &_ring[tail & _mask];
+    }
+
+    // Producer: make the reserved slot visible to the consumer
+    void push()
+    {
+        _tail.fetch_add( 1, std::memory_order_seq_cst );
+        if( _waiting.load( std::memory_order_seq_cst ) )
+        {
+            std::lock_guard< std::mutex > lock( _mutex );
+            _cv.notify_one();
+        }
+    }
+
+    // Producer: copy an item in; false if the queue is full
+    bool try_push( T const & item )
+    {
+        auto slot = reserve();
+        if( ! slot )
+            return false;
+        *slot = item;
+        push();
+        return true;
+    }
+
+    // Consumer: the next item, left in place until pop(), or null if the queue is empty
+    T * front()
+    {
+        auto const head = _head.load( std::memory_order_relaxed );
+        if( head == _tail.load( std::memory_order_acquire ) )
+            return nullptr;
+        return &_ring[head & _mask];
+    }
+
+    // Consumer: done with the front item; its slot may now be reused by the producer
+    void pop() { _head.fetch_add( 1, std::memory_order_release ); }
+
+    // Consumer: copy the next item out; false if the queue is empty
+    bool try_pop( T & item )
+    {
+        auto slot = front();
+        if( ! slot )
+            return false;
+        item = std::move( *slot );
+        pop();
+        return true;
+    }
+
+    // Consumer: wait until there is something to pop or we're stopped; false on timeout or stop
+    template< class Duration >
+    bool wait_for( Duration const & timeout )
+    {
+        if( front() )
+            return true;
+        std::unique_lock< std::mutex > lock( _mutex );
+        _waiting.store( true, std::memory_order_seq_cst );
+        // Any push from here on sees us waiting, so we can't miss it
+        bool const ready = _cv.wait_for( lock,
+                                         timeout,
+                                         [&]()
+                                         {
+                                             return _stopped.load()
+                                                 || _head.load( std::memory_order_relaxed )
+                                                        != _tail.load( std::memory_order_seq_cst );
+                                         } );
+        _waiting.store( false, std::memory_order_relaxed );
+        return ready && ! _stopped;
+    }
+
+    // Wake the consumer, and have any further waits return right away; items already in the queue are kept
+    void stop()
+    {
+        {
+            std::lock_guard< std::mutex > lock( _mutex );
+            _stopped = true;
+        }
+        _cv.notify_all();
+    }
+
+    bool is_stopped() const { return _stopped; }
+
+    // Empty the queue and undo stop(); only while neither producer nor consumer are active!
+    void reset()
+    {
+        _head = _tail.load();
+        _stopped = false;
+    }
+};
+
+
+}  // namespace concurrency
+}  // namespace rsutils
@@ -0,0 +1,28 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+
+namespace rsutils {
+namespace os {
+
+
+enum class thread_priority
+{
+    normal,
+    high,      // ahead of normal threads, but still time-shared
+    realtime,  // pre-empts normal threads; usually requires privileges (CAP_SYS_NICE on Linux)
+};
+
+
+// Change the scheduling priority of the calling thread; false if not allowed or not supported
+bool set_current_thread_priority( thread_priority );
+
+// Pin the calling thread to a single CPU, or let it run on any CPU if negative; false if not allowed or not supported
+// (e.g., on macOS)
+bool set_current_thread_affinity( int cpu );
+
+
+}  // namespace os
+}  // namespace rsutils
@@ -0,0 +1,368 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include <rsutils/codec/rvl.h>
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+
+namespace rsutils {
+namespace codec {
+
+
+namespace {
+
+
+// Header: "RVL1", number of pixels (32-bit little-endian), trim bits, 3 reserved bytes
+uint8_t const rvl_magic[4] = { 'R', 'V', 'L', '1' };
+constexpr size_t rvl_header_size = 12;
+
+
+inline void store_le32( uint8_t * p, uint32_t word )
+{
+    p[0] = uint8_t( word );
+    p[1] = uint8_t( word >> 8 );
+    p[2] = uint8_t( word >> 16 );
+    p[3] = uint8_t( word >> 24 );
+}
+
+
+inline uint32_t load_le32( uint8_t const * p )
+{
+    return uint32_t( p[0] ) | ( uint32_t( p[1] ) << 8 ) | ( uint32_t( p[2] ) << 16 ) | ( uint32_t( p[3] ) << 24 );
+}
+
+
+// Variable-length codes of all values that fit in three nibbles or less: the nibbles (one per byte, in the order
+// they are written) in the three low bytes, and their number in the top byte
+struct vle_table
+{
+    static constexpr uint32_t size = 1 << 9;
+    uint32_t codes[size];
+
+    vle_table()
+    {
+        for( uint32_t value = 0; value < size; ++value )
+        {
+            uint32_t code = 0, n_nibbles = 0, v = value;
+            do
+            {
+                uint32_t nibble = v & 0x7;
+                v >>= 3;
+                if( v )
+                    nibble |= 0x8;
+                code |= nibble << ( 8 * n_nibbles++ );
+            }
+            while( v );
+            codes[value] = code | ( n_nibbles << 24 );
+        }
+    }
+};
+vle_table const vle_codes;
+
+
+// Writing variable-length codes straight into words makes every value wait for the one before it (to know where it
+// goes) and branch on whether a word is full. Instead, the encoder writes nibbles one per byte into a small block,
+// and packs them into words eight at a time whenever the block fills up.
+constexpr size_t nibble_block_size = 256;
+constexpr size_t nibble_chunk_size = 16;  // pixels encoded together; each is <= 6 nibbles
+
+
+// Writes the variable-length code of the value (3 bits per nibble, the top bit set if more nibbles follow), one
+// nibble per byte; returns where the next one goes
+inline uint8_t * put_nibbles( uint8_t * nibbles, uint32_t value )
+{
+    if( value < vle_table::size )
+    {
+        uint32_t const code = vle_codes.codes[value];
+        std::memcpy( nibbles, &code, 4 );  // the extra (count) byte is overwritten by whatever comes next
+        return nibbles + ( code >> 24 );
+    }
+    do
+    {
+        uint32_t nibble = value & 0x7;
+        value >>= 3;
+        if( value )
+            nibble |= 0x8;
+        *nibbles++ = uint8_t( nibble );
+    }
+    while( value );
+    return nibbles;
+}
+
+
+// Packs whole words of nibbles (first nibble in the low bits) to 'out', and moves any that are left to the start of
+// the block; returns where the next word goes
+inline uint8_t * pack_nibbles( uint8_t * nibbles, uint8_t *& end, uint8_t * out )
+{
+    size_t const n_words = ( end - nibbles ) / 8;
+    for( size_t w = 0; w < n_words; ++w )
+    {
+        uint64_t x;
+        std::memcpy( &x, nibbles + 8 * w, 8 );
+        x = ( x | ( x >> 4 ) ) & 0x00ff00ff00ff00ffull;
+        x = ( x | ( x >> 8 ) ) & 0x0000ffff0000ffffull;
+        x = ( x | ( x >> 16 ) );
+        store_le32( out, uint32_t( x ) );
+        out += 4;
+    }
+    size_t const left = ( end - nibbles ) - 8 * n_words;
+    std::memmove( nibbles, nibbles + 8 * n_words, left );
+    end = nibbles + left;
+    return out;
+}
+
+
+// Likewise, the decoder turns words into values a block at a time: words with eight single-nibble values (as most
+// are, with smooth depth) need no per-nibble work
+constexpr size_t value_block_size = 64;
+
+
+class value_reader
+{
+    uint8_t const * _in;
+    uint8_t const * const _end;
+    uint64_t _partial = 0;  // of a value that continues in the next word
+    unsigned _partial_shift = 0;
+
+public:
+    value_reader( uint8_t const * in, uint8_t const * end )
+        : _in( in )
+        , _end( end )
+    {
+    }
+
+    // Decodes at least one value, and at most value_block_size + 7; returns the number decoded
+    size_t read( uint32_t * values )
+    {
+        // Work on locals: the values could otherwise be members, as far as the compiler knows
+        uint8_t const * in = _in;
+        uint64_t partial = _partial;
+        unsigned partial_shift = _partial_shift;
+        size_t n = 0;
+        while( n < value_block_size && _end - in >= 4 )
+        {
+            uint32_t const word = load_le32( in );
+            in += 4;
+            if( ! partial_shift && ! ( word & 0x88888888u ) )
+            {
+                for( unsigned i = 0; i < 8; ++i )
+                    values[n + i] = ( word >> ( 4 * i ) ) & 0x7;
+                n += 8;
+                continue;
+            }
+            // Without branches, as it is unpredictable where values end; shifting 64 bits, a value can run on for a
+            // whole word before we check it is not too long
+            for( unsigned i = 0; i < 8; ++i )
+            {
+                uint32_t const nibble = ( word >> ( 4 * i ) ) & 0xf;
+                partial |= uint64_t( nibble & 0x7 ) << partial_shift;
+                values[n] = uint32_t( partial );
+                uint32_t const more = nibble >> 3;  // 1 or 0
+                n += 1 - more;
+                partial &= 0ull - more;
+                partial_shift = ( partial_shift + 3 ) & ( 0u - more );
+            }
+            if( partial_shift > 30 )
+                throw std::runtime_error( "RVL data is malformed" );
+        }
+        if( ! n )
+            throw std::runtime_error( "RVL data is truncated" );
+        _in = in;
+        _partial = partial;
+        _partial_shift = partial_shift;
+        return n;
+    }
+};
+
+
+}  // namespace
+
+
+size_t rvl_max_encoded_size( size_t n_pixels )
+{
+    // Each run of Z zeros and K non-zeros takes at most max(1,Z) + K nibbles for the two lengths, and each non-zero at
+    // most 6 more; with at most K+1 runs this adds up to less than 8 nibbles (one word) per pixel, plus the last run
+    return rvl_header_size + 4 * ( n_pixels + 1 );
+}
+
+
+size_t rvl_encode( uint16_t const * pixels, size_t n_pixels, uint8_t * encoded, unsigned trim_bits )
+{
+    return rvl_encode( pixels, n_pixels, encoded, rvl_max_encoded_size( n_pixels ), trim_bits );
+}
+
+
+size_t rvl_encode( uint16_t const * pixels, size_t n_pixels, uint8_t * encoded, size_t size, unsigned trim_bits )
+{
+    if( trim_bits > rvl_max_trim_bits )
+        throw std::invalid_argument( "RVL trim bits (" + std::to_string( trim_bits ) + ") must be <= "
+                                     + std::to_string( rvl_max_trim_bits ) );
+    if( n_pixels > UINT32_MAX )
+        throw std::invalid_argument( "too many pixels for RVL" );
+
+    if( size < rvl_header_size )
+        return 0;
+    std::copy( std::begin( rvl_magic ), std::end( rvl_magic ), encoded );
+    store_le32( encoded + 4, uint32_t( n_pixels ) );
+    encoded[8] = uint8_t( trim_bits );
+    encoded[9] = encoded[10] = encoded[11] = 0;
+    uint8_t * out = encoded + rvl_header_size;
+    uint8_t * const out_end = encoded + size;
+
+    // Room for a chunk of pixels, two run lengths, and the extra byte put_nibbles() writes, past the block size
+    uint8_t nibbles[nibble_block_size + 6 * nibble_chunk_size + 2 * 11 + 4];
+    uint8_t * next = nibbles;
+    // Packs (only) whole words, as long as they fit
+    auto const pack = [&]()
+    {
+        if( size_t( ( next - nibbles ) / 8 * 4 ) > size_t( out_end - out ) )
+            return false;
+        out = pack_nibbles( nibbles, next, out );
+        return true;
+    };
+
+    // A pixel is zero if nothing is left of it after trimming
+    uint32_t const threshold = 1u << trim_bits;
+    uint16_t const * p = pixels;
+    uint16_t const * const end = pixels + n_pixels;
+    int previous = 0;
+    while( p < end )
+    {
+        uint16_t const * const zeros = p;
+        while( p < end && *p < threshold )
+            ++p;
+        next = put_nibbles( next, uint32_t( p - zeros ) );
+
+        uint16_t const * const nonzeros = p;
+        while( p < end && *p >= threshold )
+            ++p;
+        next = put_nibbles( next, uint32_t( p - nonzeros ) );
+
+        for( uint16_t const * q = nonzeros; q < p; )
+        {
+            if( next >= nibbles + nibble_block_size && ! pack() )
+                return 0;
+            size_t const n = std::min< size_t >( nibble_chunk_size, p - q );
+
+            // Zigzag deltas (small magnitudes are small values) of each pixel from the one before: written like this,
+            // without carrying 'previous' from one iteration to the next, the loop vectorizes
+            uint32_t zigzags[nibble_chunk_size];
+            int const first_delta = ( q[0] >> trim_bits ) - previous;
+            zigzags[0] = ( uint32_t( first_delta ) << 1 ) ^ uint32_t( first_delta >> 31 );
+            uint32_t any_long = zigzags[0];
+            for( size_t i = 1; i < n; ++i )
+            {
+                int const delta = ( q[i] >> trim_bits ) - ( q[i - 1] >> trim_bits );
+                zigzags[i] = ( uint32_t( delta ) << 1 ) ^ uint32_t( delta >> 31 );
+                any_long |= zigzags[i];
+            }
+            previous = q[n - 1] >> trim_bits;
+            q += n;
+
+            if( any_long < 8 )
+            {
+                // All single nibbles, as is common with smooth depth
+                for( size_t i = 0; i < n; ++i )
+                    next[i] = uint8_t( zigzags[i] );
+                next += n;
+            }
+            else
+            {
+                for( size_t i = 0; i < n; ++i )
+                    next = put_nibbles( next, zigzags[i] );
+            }
+        }
+        if( next >= nibbles + nibble_block_size && ! pack() )
+            return 0;
+    }
+    // Pad the last word
+    while( ( next - nibbles ) % 8 )
+        *next++ = 0;
+    if( ! pack() )
+        return 0;
+    return out - encoded;
+}
+
+
+bool is_rvl( uint8_t const * encoded, size_t size )
+{
+    return size >= rvl_header_size && std::equal( std::begin( rvl_magic ), std::end( rvl_magic ), encoded );
+}
+
+
+size_t rvl_decoded_pixels( uint8_t const * encoded, size_t size )
+{
+    if( ! is_rvl( encoded, size ) )
+        throw std::runtime_error( "not RVL data" );
+    return load_le32( encoded + 4 );
+}
+
+
+void rvl_decode( uint8_t const * encoded, size_t size, uint16_t * pixels, size_t n_pixels )
+{
+    auto const n_encoded = rvl_decoded_pixels( encoded, size );
+    if( n_encoded != n_pixels )
+        throw std::runtime_error( "RVL data is for " + std::to_string( n_encoded ) + " pixels; expecting "
+                                  + std::to_string( n_pixels ) );
+    unsigned const trim_bits = encoded[8];
+    if( trim_bits > rvl_max_trim_bits )
+        throw std::runtime_error( "RVL data is malformed" );
+    // Trimmed values decode to the middle of their range
+    uint32_t const half = trim_bits ? ( 1u << ( trim_bits - 1 ) ) : 0;
+
+    value_reader reader( encoded + rvl_header_size, encoded + size );
+    uint32_t values[value_block_size + 8];
+    uint32_t const * value = values;
+    uint32_t const * values_end = values;
+
+    uint16_t * p = pixels;
+    uint16_t * const end = pixels + n_pixels;
+    uint32_t previous = 0;
+    while( p < end )
+    {
+        if( value == values_end )
+        {
+            values_end = values + reader.read( values );
+            value = values;
+        }
+        uint32_t const zeros = *value++;
+        if( zeros > size_t( end - p ) )
+            throw std::runtime_error( "RVL data is malformed" );
+        std::fill_n( p, zeros, uint16_t( 0 ) );
+        p += zeros;
+
+        if( value == values_end )
+        {
+            values_end = values + reader.read( values );
+            value = values;
+        }
+        uint32_t const nonzeros = *value++;
+        if( nonzeros > size_t( end - p ) )
+            throw std::runtime_error( "RVL data is malformed" );
+        uint16_t * const nonzeros_end = p + nonzeros;
+        while( p < nonzeros_end )
+        {
+            if( value == values_end )
+            {
+                values_end = values + reader.read( values );
+                value = values;
+            }
+            // Straight from the block, as far as it goes
+            uint32_t const * const block_end = std::min( values_end, value + ( nonzeros_end - p ) );
+            for( ; value < block_end; ++value )
+            {
+                uint32_t const zigzag = *value;
+                previous += ( zigzag >> 1 ) ^ ( 0u - ( zigzag & 1 ) );
+                *p++ = uint16_t( ( previous << trim_bits ) | half );
+            }
+        }
+    }
+}
+
+
+}  // namespace codec
+}  // namespace rsutils
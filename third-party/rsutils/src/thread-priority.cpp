@@ -0,0 +1,100 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include <rsutils/os/thread-priority.h>
+
+#if defined( _WIN32 )
+#include <Windows.h>
+#else
+#include <pthread.h>
+#include <sched.h>
+#if defined( __linux__ )
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+#endif
+
+
+namespace rsutils {
+namespace os {
+
+
+bool set_current_thread_priority( thread_priority priority )
+{
+#if defined( _WIN32 )
+
+    int win_priority = THREAD_PRIORITY_NORMAL;
+    switch( priority )
+    {
+    case thread_priority::high: win_priority = THREAD_PRIORITY_ABOVE_NORMAL; break;
+    case thread_priority::realtime: win_priority = THREAD_PRIORITY_TIME_CRITICAL; break;
+    default: break;
+    }
+    return SetThreadPriority( GetCurrentThread(), win_priority ) != 0;
+
+#else
+
+    sched_param param{};
+    if( priority == thread_priority::realtime )
+    {
+        // Low in the real-time range: above any normal thread, below whatever the system itself may need
+        param.sched_priority = sched_get_priority_min( SCHED_FIFO ) + 1;
+        return pthread_setschedparam( pthread_self(), SCHED_FIFO, &param ) == 0;
+    }
+    if( pthread_setschedparam( pthread_self(), SCHED_OTHER, &param ) != 0 )
+        return false;
+#if defined( __linux__ )
+    // Linux threads each have their own nice value
+    int const nice = priority == thread_priority::high ? -10 : 0;
+    return setpriority( PRIO_PROCESS, static_cast< id_t >( syscall( SYS_gettid ) ), nice ) == 0;
+#else
+    return priority == thread_priority::normal;
+#endif
+
+#endif
+}
+
+
+bool set_current_thread_affinity( int cpu )
+{
+#if defined( _WIN32 )
+
+    DWORD_PTR mask;
+    if( cpu < 0 )
+    {
+        DWORD_PTR system_mask;
+        if( ! GetProcessAffinityMask( GetCurrentProcess(), &mask, &system_mask ) )
+            return false;
+    }
+    else if( cpu < int( sizeof( DWORD_PTR ) * 8 ) )
+        mask = DWORD_PTR( 1 ) << cpu;
+    else
+        return false;
+    return SetThreadAffinityMask( GetCurrentThread(), mask ) != 0;
+
+#elif defined( __linux__ )
+
+    cpu_set_t set;
+    CPU_ZERO( &set );
+    if( cpu < 0 )
+    {
+        for( int i = 0; i < CPU_SETSIZE; ++i )
+            CPU_SET( i, &set );
+    }
+    else if( cpu < CPU_SETSIZE )
+        CPU_SET( cpu, &set );
+    else
+        return false;
+    return pthread_setaffinity_np( pthread_self(), sizeof( set ), &set ) == 0;
+
+#else
+
+    return cpu < 0;
+
+#endif
+}
+
+
+}  // namespace os
+}  // namespace rsutils
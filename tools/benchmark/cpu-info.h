@@ -0,0 +1,73 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2015-24 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <string>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+#if (defined(_WIN32) || defined(_WIN64))
+#include <intrin.h>
+
+inline std::string get_cpu()
+{
+    // Based on: https://weseetips.wordpress.com/tag/c-get-cpu-name/
+    // Get extended ids.
+    int CPUInfo[4] = { -1 };
+    __cpuid(CPUInfo, 0x80000000);
+    unsigned int nExIds = CPUInfo[0];
+
+    // Get the information associated with each extended ID.
+    char CPUBrandString[0x40] = { 0 };
+    for (unsigned int i = 0x80000000; i <= nExIds; ++i)
+    {
+        __cpuid(CPUInfo, i);
+
+        // Interpret CPU brand string and cache information.
+        if (i == 0x80000002)
+        {
+            memcpy(CPUBrandString,
+                CPUInfo,
+                sizeof(CPUInfo));
+        }
+        else if (i == 0x80000003)
+        {
+            memcpy(CPUBrandString + 16,
+                CPUInfo,
+                sizeof(CPUInfo));
+        }
+        else if (i == 0x80000004)
+        {
+            memcpy(CPUBrandString + 32, CPUInfo, sizeof(CPUInfo));
+        }
+    }
+
+    char* ptr = CPUBrandString;
+    while (*ptr == ' ') ptr++;
+    return ptr;
+}
+
+#elif defined __linux__ || defined(__linux__)
+inline std::string get_cpu() {
+    // Based on: http://forums.codeguru.com/showthread.php?472578-How-to-get-the-cpu-information-on-linux
+    std::string line;
+    std::ifstream finfo("/proc/cpuinfo");
+    while(getline(finfo,line))
+    {
+        std::stringstream str(line);
+        std::string itype;
+        std::string info;
+        if (getline(str, itype, ':') && getline(str, info) && itype.substr(0, 10) == "model name")
+        {
+            return info;
+        }
+    }
+    return "unknown";
+}
+#elif __APPLE__
+inline std::string get_cpu() { return "unknown"; }
+#else
+inline std::string get_cpu() { return "unknown"; }
+#endif
@@ -0,0 +1,845 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+// Benchmarks the processing blocks without a camera or a GPU: frames are synthetic (or read from a bag) and injected
+// through a software_device, so this can run on build servers and track regressions across releases
+
+#include <librealsense2/rs.hpp>
+#include <librealsense2/hpp/rs_internal.hpp>
+
+#include <common/cli.h>
+#include <rsutils/json.h>
+#include "cpu-info.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <new>
+#include <numeric>
+#include <random>
+#include <sstream>
+#include <vector>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+using rsutils::json;
+
+
+//
+// Allocations: every operator new in the process is counted (on Windows, only those in this executable, as the
+// library has its own CRT)
+//
+static std::atomic< size_t > n_allocations( 0 );
+static std::atomic< size_t > allocated_bytes( 0 );
+
+void * operator new( size_t size )
+{
+    ++n_allocations;
+    allocated_bytes += size;
+    if( auto p = std::malloc( size ? size : 1 ) )
+        return p;
+    throw std::bad_alloc();
+}
+void * operator new[]( size_t size ) { return operator new( size ); }
+void operator delete( void * p ) noexcept { std::free( p ); }
+void operator delete[]( void * p ) noexcept { std::free( p ); }
+void operator delete( void * p, size_t ) noexcept { std::free( p ); }
+void operator delete[]( void * p, size_t ) noexcept { std::free( p ); }
+
+
+static double peak_rss_mb()
+{
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS pmc;
+    if( ! GetProcessMemoryInfo( GetCurrentProcess(), &pmc, sizeof( pmc ) ) )
+        return 0;
+    return pmc.PeakWorkingSetSize / ( 1024. * 1024. );
+#else
+    rusage usage;
+    if( getrusage( RUSAGE_SELF, &usage ) )
+        return 0;
+#ifdef __APPLE__
+    return usage.ru_maxrss / ( 1024. * 1024. );  // bytes
+#else
+    return usage.ru_maxrss / 1024.;  // KB
+#endif
+#endif
+}
+
+
+static char const * const simd_level_names[] = { "generic", "ssse3", "avx2" };
+
+
+static rs2_format parse_format( std::string const & name )
+{
+    for( int f = RS2_FORMAT_ANY; f < RS2_FORMAT_COUNT; ++f )
+        if( name == rs2_format_to_string( rs2_format( f ) ) )
+            return rs2_format( f );
+    throw std::runtime_error( "invalid format '" + name + "'" );
+}
+
+
+// Bits per pixel of the color formats we can generate
+static int get_bpp( rs2_format format )
+{
+    switch( format )
+    {
+    case RS2_FORMAT_Y8: return 8;
+    case RS2_FORMAT_Y411: return 12;
+    case RS2_FORMAT_YUYV:
+    case RS2_FORMAT_UYVY:
+    case RS2_FORMAT_Y16: return 16;
+    case RS2_FORMAT_RGB8:
+    case RS2_FORMAT_BGR8: return 24;
+    case RS2_FORMAT_RGBA8:
+    case RS2_FORMAT_BGRA8: return 32;
+    default:
+        throw std::runtime_error( std::string( "unsupported color format " ) + rs2_format_to_string( format ) );
+    }
+}
+
+
+// The raw images we inject, and how to describe them to the software_device
+struct stream_images
+{
+    int width = 0;
+    int height = 0;
+    rs2_format format = RS2_FORMAT_ANY;
+    int bpp = 0;  // bits
+    rs2_intrinsics intrinsics = {};
+    std::vector< std::vector< uint8_t > > images;
+
+    int stride() const { return width * bpp / 8; }
+    explicit operator bool() const { return ! images.empty(); }
+};
+
+struct source_images
+{
+    stream_images depth;
+    stream_images color;
+    stream_images infrared;  // Y8, the size of the depth; for HDR
+    float depth_units = 0.001f;
+    rs2_extrinsics depth_to_color = { { 1, 0, 0, 0, 1, 0, 0, 0, 1 }, { 0.015f, 0, 0 } };
+    std::string description;
+};
+
+
+static rs2_intrinsics make_intrinsics( int width, int height )
+{
+    rs2_intrinsics intr = {};
+    intr.width = width;
+    intr.height = height;
+    intr.ppx = width / 2.f;
+    intr.ppy = height / 2.f;
+    intr.fx = intr.fy = width * 0.75f;  // ~90 degree horizontal FOV
+    intr.model = RS2_DISTORTION_BROWN_CONRADY;
+    return intr;
+}
+
+
+// Infrared the size of the depth, all over the range: some of it is under or over saturated
+static void generate_infrared( source_images & src )
+{
+    auto & ir = src.infrared;
+    ir.width = src.depth.width;
+    ir.height = src.depth.height;
+    ir.format = RS2_FORMAT_Y8;
+    ir.bpp = 8;
+    ir.intrinsics = src.depth.intrinsics;
+    std::mt19937 rng( 7 );
+    std::uniform_int_distribution< int > byte_noise( -16, 16 );
+    for( size_t i = 0; i < src.depth.images.size(); ++i )
+    {
+        std::vector< uint8_t > image( ir.stride() * ir.height );
+        auto p = image.data();
+        for( int y = 0; y < ir.height; ++y )
+            for( int x = 0; x < ir.width; ++x )
+                *p++ = uint8_t( std::min( 255, std::max( 0, ( x + y ) * 300 / ( ir.width + ir.height ) + byte_noise( rng ) ) ) );
+        ir.images.push_back( std::move( image ) );
+    }
+}
+
+
+// A few different images, cycled through, so stateful filters (temporal) have changes to work on without holding
+// hundreds of MB of frames
+static source_images generate_images( int depth_width,
+                                      int depth_height,
+                                      int color_width,
+                                      int color_height,
+                                      rs2_format color_format )
+{
+    int const n_images = 8;
+    std::mt19937 rng( 42 );
+    source_images src;
+    src.description = "synthetic";
+
+    auto & depth = src.depth;
+    depth.width = depth_width;
+    depth.height = depth_height;
+    depth.format = RS2_FORMAT_Z16;
+    depth.bpp = 16;
+    depth.intrinsics = make_intrinsics( depth_width, depth_height );
+    std::normal_distribution< float > noise( 0.f, 4.f );
+    std::uniform_real_distribution< float > uniform( 0.f, 1.f );
+    for( int i = 0; i < n_images; ++i )
+    {
+        // A slanted plane with some bumps, noise and ~2% holes
+        std::vector< uint8_t > image( depth.stride() * depth.height );
+        auto z = reinterpret_cast< uint16_t * >( image.data() );
+        for( int y = 0; y < depth.height; ++y )
+            for( int x = 0; x < depth.width; ++x )
+            {
+                float mm = 800.f + 2000.f * y / depth.height
+                         + 150.f * std::sin( ( x + 4 * i ) * 0.05f ) * std::cos( y * 0.03f ) + noise( rng );
+                *z++ = uniform( rng ) < 0.02f ? 0 : uint16_t( mm );
+            }
+        depth.images.push_back( std::move( image ) );
+    }
+
+    auto & color = src.color;
+    color.width = color_width;
+    color.height = color_height;
+    color.format = color_format;
+    color.bpp = get_bpp( color_format );
+    color.intrinsics = make_intrinsics( color_width, color_height );
+    std::uniform_int_distribution< int > byte_noise( -8, 8 );
+    for( int i = 0; i < n_images; ++i )
+    {
+        // Gradients, whatever the format
+        std::vector< uint8_t > image( color.stride() * color.height );
+        auto p = image.data();
+        for( int y = 0; y < color.height; ++y )
+            for( int b = 0; b < color.stride(); ++b )
+                *p++ = uint8_t( ( b / 3 + y + 8 * i ) / 4 + byte_noise( rng ) );
+        color.images.push_back( std::move( image ) );
+    }
+
+    generate_infrared( src );
+    return src;
+}
+
+
+static void copy_image( stream_images & images, rs2::video_frame const & vf )
+{
+    if( ! images )
+    {
+        auto profile = vf.get_profile().as< rs2::video_stream_profile >();
+        images.width = vf.get_width();
+        images.height = vf.get_height();
+        images.format = profile.format();
+        images.bpp = vf.get_bits_per_pixel();
+        images.intrinsics = profile.get_intrinsics();
+    }
+    // Drop the stride padding, if any
+    std::vector< uint8_t > image( images.stride() * images.height );
+    auto src = static_cast< const uint8_t * >( vf.get_data() );
+    for( int y = 0; y < images.height; ++y )
+        std::memcpy( image.data() + y * images.stride(), src + y * vf.get_stride_in_bytes(), images.stride() );
+    images.images.push_back( std::move( image ) );
+}
+
+
+static source_images read_images( rs2::context & ctx, std::string const & filename, size_t max_frames )
+{
+    source_images src;
+    src.description = "bag: " + filename;
+
+    rs2::config cfg;
+    cfg.enable_device_from_file( filename, false );  // no repeat
+    rs2::pipeline pipe( ctx );
+    auto profile = pipe.start( cfg );
+    profile.get_device().as< rs2::playback >().set_real_time( false );
+
+    rs2::frameset fs;
+    while( ( src.depth.images.size() < max_frames || src.color.images.size() < max_frames )
+           && pipe.try_wait_for_frames( &fs, 1000 ) )
+    {
+        auto depth = fs.get_depth_frame();
+        if( depth && src.depth.images.size() < max_frames )
+        {
+            copy_image( src.depth, depth );
+            src.depth_units = depth.get_units();
+        }
+        auto color = fs.get_color_frame();
+        if( color && src.color.images.size() < max_frames )
+            copy_image( src.color, color );
+    }
+
+    if( ! src.depth )
+        throw std::runtime_error( "no depth frames in " + filename );
+    if( src.color )
+    {
+        for( auto && sp : profile.get_streams() )
+            if( sp.stream_type() == RS2_STREAM_DEPTH )
+                for( auto && sp2 : profile.get_streams() )
+                    if( sp2.stream_type() == RS2_STREAM_COLOR )
+                    {
+                        try
+                        {
+                            src.depth_to_color = sp.get_extrinsics_to( sp2 );
+                        }
+                        catch( rs2::error const & )
+                        {
+                            // Not recorded: keep the default
+                        }
+                    }
+        get_bpp( src.color.format );  // throws if we cannot handle it
+    }
+    pipe.stop();
+    generate_infrared( src );
+    return src;
+}
+
+
+struct results
+{
+    std::vector< double > latencies_ms;
+    double wall_ms = 0;
+    size_t allocations = 0;
+    size_t allocated_bytes = 0;
+
+    json to_json( std::string const & name ) const
+    {
+        auto n = latencies_ms.size();
+        auto sorted = latencies_ms;
+        std::sort( sorted.begin(), sorted.end() );
+        auto percentile = [&]( double p ) { return sorted[std::min( n - 1, size_t( p * ( n - 1 ) + 0.5 ) )]; };
+        double mean = std::accumulate( sorted.begin(), sorted.end(), 0. ) / n;
+        double sq_sum = std::inner_product( sorted.begin(), sorted.end(), sorted.begin(), 0. );
+        double stdev = std::sqrt( std::max( 0., sq_sum / n - mean * mean ) );
+
+        json j;
+        j["name"] = name;
+        j["frames"] = n;
+        j["latency-ms"] = json::object( { { "mean", mean },
+                                          { "stdev", stdev },
+                                          { "min", sorted.front() },
+                                          { "p50", percentile( 0.5 ) },
+                                          { "p90", percentile( 0.9 ) },
+                                          { "p99", percentile( 0.99 ) },
+                                          { "max", sorted.back() } } );
+        j["throughput-fps"] = wall_ms > 0 ? n * 1000. / wall_ms : 0.;
+        j["allocations-per-frame"] = double( allocations ) / n;
+        j["allocated-bytes-per-frame"] = double( allocated_bytes ) / n;
+        return j;
+    }
+};
+
+
+// A processing block, or a chain of them. The input it needs is taken from each frameset by 'prepare', which is not
+// timed; 'process' is. Framesets 'prepare' returns nothing for are skipped.
+struct bench_test
+{
+    std::string name;
+    std::function< rs2::frame( rs2::frameset const & ) > prepare;
+    std::function< rs2::frame( rs2::frame ) > process;
+};
+
+
+static rs2::frame get_depth( rs2::frameset const & fs ) { return fs.get_depth_frame(); }
+static rs2::frame get_color( rs2::frameset const & fs ) { return fs.get_color_frame(); }
+static rs2::frame get_frameset( rs2::frameset const & fs ) { return fs; }
+
+
+template< class T >
+static bench_test depth_test( std::string name, T block )
+{
+    return { std::move( name ), get_depth, [block]( rs2::frame f ) { return block.process( f ); } };
+}
+
+
+static std::vector< bench_test > make_tests( source_images const & src )
+{
+    std::vector< bench_test > tests;
+
+    tests.push_back( depth_test( "colorizer", rs2::colorizer() ) );
+    tests.push_back( depth_test( "pointcloud", rs2::pointcloud() ) );
+    // The default scale (2), then the rest: 3 is a median too, larger ones a mean
+    tests.push_back( depth_test( "decimation_filter", rs2::decimation_filter() ) );
+    for( int scale = 3; scale <= 8; ++scale )
+        tests.push_back( depth_test( "decimation_filter_x" + std::to_string( scale ), rs2::decimation_filter( float( scale ) ) ) );
+    tests.push_back( depth_test( "threshold_filter", rs2::threshold_filter() ) );
+    tests.push_back( depth_test( "disparity_transform", rs2::disparity_transform( true ) ) );
+    {
+        // With the threshold filter's range, in the same pass
+        rs2::disparity_transform to_disparity( true );
+        to_disparity.set_option( RS2_OPTION_MIN_DISTANCE, 0.3f );
+        to_disparity.set_option( RS2_OPTION_MAX_DISTANCE, 4.f );
+        tests.push_back( depth_test( "disparity_transform_threshold", to_disparity ) );
+    }
+    {
+        rs2::disparity_transform to_disparity( true );
+        rs2::disparity_transform to_depth( false );
+        tests.push_back( { "disparity_to_depth",
+                           [to_disparity]( rs2::frameset const & fs ) { return to_disparity.process( fs.get_depth_frame() ); },
+                           [to_depth]( rs2::frame f ) { return to_depth.process( f ); } } );
+    }
+    tests.push_back( depth_test( "spatial_filter", rs2::spatial_filter() ) );
+    tests.push_back( depth_test( "temporal_filter", rs2::temporal_filter() ) );
+    // The default mode (farest from around), then the other two
+    tests.push_back( depth_test( "hole_filling_filter", rs2::hole_filling_filter() ) );
+    tests.push_back( depth_test( "hole_filling_filter_left", rs2::hole_filling_filter( 0 ) ) );
+    tests.push_back( depth_test( "hole_filling_filter_nearest", rs2::hole_filling_filter( 2 ) ) );
+    tests.push_back( depth_test( "units_transform", rs2::units_transform() ) );
+    rs2::rotation_filter rotation;
+    rotation.set_option( RS2_OPTION_ROTATION, 90.f );
+    tests.push_back( depth_test( "rotation_filter", rotation ) );
+    tests.push_back( depth_test( "rvl_encoder", rs2::rvl_encoder() ) );
+    {
+        rs2::rvl_encoder encoder;
+        rs2::rvl_decoder decoder;
+        tests.push_back( { "rvl_decoder",
+                           [encoder]( rs2::frameset const & fs ) { return encoder.process( fs.get_depth_frame() ); },
+                           [decoder]( rs2::frame f ) { return decoder.process( f ); } } );
+    }
+    {
+        // The order the viewer applies them in
+        rs2::decimation_filter decimation;
+        rs2::threshold_filter threshold;
+        rs2::disparity_transform to_disparity( true );
+        rs2::spatial_filter spatial;
+        rs2::temporal_filter temporal;
+        rs2::disparity_transform to_depth( false );
+        rs2::hole_filling_filter hole_filling;
+        tests.push_back( { "post_processing_chain",
+                           get_depth,
+                           [=]( rs2::frame f )
+                           {
+                               f = decimation.process( f );
+                               f = threshold.process( f );
+                               f = to_disparity.process( f );
+                               f = spatial.process( f );
+                               f = temporal.process( f );
+                               f = to_depth.process( f );
+                               return hole_filling.process( f );
+                           } } );
+    }
+
+    if( src.color )
+    {
+        // The format conversions that have a public processing block
+        if( src.color.format == RS2_FORMAT_YUYV )
+        {
+            rs2::yuy_decoder decoder;
+            tests.push_back( { "yuy_decoder", get_color, [decoder]( rs2::frame f ) { return decoder.process( f ); } } );
+            // What the resizing color converter replaces: a full-resolution conversion, then a decimation of it
+            for( int scale : { 2, 4 } )
+            {
+                rs2::decimation_filter decimation{ float( scale ) };
+                decimation.set_option( RS2_OPTION_STREAM_FILTER, float( RS2_STREAM_COLOR ) );
+                decimation.set_option( RS2_OPTION_STREAM_FORMAT_FILTER, float( RS2_FORMAT_RGB8 ) );
+                tests.push_back( { "yuy_decoder_decimation_x" + std::to_string( scale ),
+                                   get_color,
+                                   [decoder, decimation]( rs2::frame f )
+                                   { return decimation.process( decoder.process( f ) ); } } );
+            }
+        }
+        if( src.color.format == RS2_FORMAT_Y411 )
+        {
+            rs2::y411_decoder decoder;
+            tests.push_back( { "y411_decoder", get_color, [decoder]( rs2::frame f ) { return decoder.process( f ); } } );
+        }
+        if( src.color.format == RS2_FORMAT_YUYV || src.color.format == RS2_FORMAT_UYVY
+            || src.color.format == RS2_FORMAT_Y411 )
+        {
+            for( int scale : { 2, 4 } )
+            {
+                rs2::resizing_color_converter resizer( RS2_FORMAT_RGB8, float( scale ) );
+                tests.push_back( { "resizing_color_converter_x" + std::to_string( scale ),
+                                   get_color,
+                                   [resizer]( rs2::frame f ) { return resizer.process( f ); } } );
+            }
+            rs2::resizing_color_converter bilinear;
+            bilinear.set_option( RS2_OPTION_RESIZE_WIDTH, 640.f );
+            bilinear.set_option( RS2_OPTION_RESIZE_FILTER, 1.f );
+            tests.push_back( { "resizing_color_converter_bilinear",
+                               get_color,
+                               [bilinear]( rs2::frame f ) { return bilinear.process( f ); } } );
+        }
+
+        rs2::align to_color( RS2_STREAM_COLOR );
+        tests.push_back( { "align_to_color",
+                           get_frameset,
+                           [to_color]( rs2::frame f ) mutable { return to_color.process( rs2::frameset( f ) ); } } );
+        rs2::align to_depth( RS2_STREAM_DEPTH );
+        tests.push_back( { "align_to_depth",
+                           get_frameset,
+                           [to_depth]( rs2::frame f ) mutable { return to_depth.process( rs2::frameset( f ) ); } } );
+
+        rs2::pointcloud pc;
+        tests.push_back( { "pointcloud_textured",
+                           get_frameset,
+                           [pc]( rs2::frame f ) mutable
+                           {
+                               rs2::frameset fs( f );
+                               pc.map_to( fs.get_color_frame() );
+                               return pc.calculate( fs.get_depth_frame() );
+                           } } );
+        rs2::align align( RS2_STREAM_COLOR );
+        rs2::pointcloud pc2;
+        tests.push_back( { "align_pointcloud_chain",
+                           get_frameset,
+                           [align, pc2]( rs2::frame f ) mutable
+                           {
+                               auto aligned = align.process( rs2::frameset( f ) );
+                               pc2.map_to( aligned.get_color_frame() );
+                               return pc2.calculate( aligned.get_depth_frame() );
+                           } } );
+    }
+
+    return tests;
+}
+
+
+// HDR: each input is the second frameset of a pair, both of which go through the block, until the merged depth is out
+static bench_test hdr_test( std::string name, rs2::hdr_merge block )
+{
+    // The first frameset of each pair, by the frame number of the second
+    auto firsts = std::make_shared< std::map< unsigned long long, rs2::frameset > >();
+    return { std::move( name ),
+             [firsts]( rs2::frameset const & fs ) -> rs2::frame
+             {
+                 auto depth = fs.get_depth_frame();
+                 if( depth.get_frame_metadata( RS2_FRAME_METADATA_SEQUENCE_ID ) == 0 )
+                 {
+                     ( *firsts )[depth.get_frame_number() + 1] = fs;
+                     return {};
+                 }
+                 if( ! firsts->count( depth.get_frame_number() ) )
+                     return {};
+                 return fs;
+             },
+             [block, firsts]( rs2::frame f )
+             {
+                 block.process( firsts->at( f.get_frame_number() ) );
+                 return block.process( f );
+             } };
+}
+
+
+static std::vector< bench_test > make_hdr_tests()
+{
+    std::vector< bench_test > tests;
+    tests.push_back( hdr_test( "hdr_merge", rs2::hdr_merge() ) );
+    return tests;
+}
+
+
+static results run_test( bench_test const & test, std::vector< rs2::frameset > const & framesets, size_t n_warmup )
+{
+    std::vector< rs2::frame > inputs;
+    inputs.reserve( framesets.size() );
+    for( auto & fs : framesets )
+    {
+        // Blocks have a limited pool of frames to hand out, unless we keep them
+        auto input = test.prepare( fs );
+        if( ! input )
+            continue;
+        input.keep();
+        inputs.push_back( input );
+    }
+
+    for( size_t i = 0; i < n_warmup; ++i )
+        test.process( inputs[i % inputs.size()] );
+
+    results r;
+    r.latencies_ms.reserve( inputs.size() );
+    auto const allocations_before = n_allocations.load();
+    auto const bytes_before = allocated_bytes.load();
+    auto const start = std::chrono::steady_clock::now();
+    for( auto & input : inputs )
+    {
+        auto t0 = std::chrono::steady_clock::now();
+        test.process( input );  // and release the result
+        auto t1 = std::chrono::steady_clock::now();
+        r.latencies_ms.push_back( std::chrono::duration< double, std::milli >( t1 - t0 ).count() );
+    }
+    r.wall_ms = std::chrono::duration< double, std::milli >( std::chrono::steady_clock::now() - start ).count();
+    r.allocations = n_allocations - allocations_before;
+    r.allocated_bytes = allocated_bytes - bytes_before;
+    return r;
+}
+
+
+// Injects the images through a software_device and a syncer, which is itself measured: from the first frame of each
+// pair until the frameset is out. The framesets are kept as the inputs of all the other tests; the device must outlive
+// them, as some blocks query its sensors (e.g., for the depth units).
+// With 'hdr', depth comes with infrared rather than color, from the same sensor, and the frames alternate between the
+// two sequence ids of an HDR sequence, as the hdr_merge block expects.
+static results capture_framesets( rs2::software_device & dev,
+                                  source_images const & src,
+                                  size_t n_frames,
+                                  size_t n_warmup,
+                                  std::vector< rs2::frameset > & framesets,
+                                  bool hdr = false )
+{
+    int const fps = 30;
+    auto depth_sensor = dev.add_sensor( "Depth" );
+    depth_sensor.add_read_only_option( RS2_OPTION_DEPTH_UNITS, src.depth_units );
+    depth_sensor.add_read_only_option( RS2_OPTION_STEREO_BASELINE, 50.f );
+    auto depth_stream = depth_sensor.add_video_stream( { RS2_STREAM_DEPTH, 0, 0,
+                                                         src.depth.width, src.depth.height, fps, src.depth.bpp / 8,
+                                                         RS2_FORMAT_Z16, src.depth.intrinsics } );
+    // The other stream: color, or infrared
+    auto const & other = hdr ? src.infrared : src.color;
+    rs2::software_sensor other_sensor = hdr ? depth_sensor : dev.add_sensor( "Color" );
+    rs2::stream_profile other_stream;
+    if( hdr )
+    {
+        other_stream = depth_sensor.add_video_stream( { RS2_STREAM_INFRARED, 1, 1,
+                                                        other.width, other.height, fps, other.bpp / 8,
+                                                        other.format, other.intrinsics } );
+    }
+    else if( other )
+    {
+        other_stream = other_sensor.add_video_stream( { RS2_STREAM_COLOR, 0, 1,
+                                                        other.width, other.height, fps, other.bpp / 8,
+                                                        other.format, other.intrinsics } );
+        depth_stream.register_extrinsics_to( other_stream, src.depth_to_color );
+    }
+    dev.create_matcher( RS2_MATCHER_DEFAULT );
+
+    rs2::syncer sync( int( n_frames + n_warmup ) );
+    if( hdr )
+    {
+        depth_sensor.set_metadata( RS2_FRAME_METADATA_SEQUENCE_SIZE, 2 );
+        depth_sensor.open( { depth_stream, other_stream } );
+        depth_sensor.start( sync );
+    }
+    else
+    {
+        depth_sensor.open( depth_stream );
+        depth_sensor.start( sync );
+        if( other_stream )
+        {
+            other_sensor.open( other_stream );
+            other_sensor.start( sync );
+        }
+    }
+
+    results r;
+    size_t allocations_before = 0, bytes_before = 0;
+    std::chrono::steady_clock::time_point start;
+    for( size_t i = 0; i < n_warmup + n_frames; ++i )
+    {
+        if( i == n_warmup )
+        {
+            allocations_before = n_allocations;
+            bytes_before = allocated_bytes;
+            start = std::chrono::steady_clock::now();
+        }
+        if( hdr )
+        {
+            // For both the depth and the infrared
+            depth_sensor.set_metadata( RS2_FRAME_METADATA_FRAME_COUNTER, rs2_metadata_type( i ) );
+            depth_sensor.set_metadata( RS2_FRAME_METADATA_SEQUENCE_ID, rs2_metadata_type( i % 2 ) );
+        }
+        auto const timestamp = double( i ) * 1000 / fps;
+        auto & depth = src.depth.images[i % src.depth.images.size()];
+        auto t0 = std::chrono::steady_clock::now();
+        depth_sensor.on_video_frame( { (void *)depth.data(), []( void * ) {}, src.depth.stride(), src.depth.bpp / 8,
+                                       timestamp, RS2_TIMESTAMP_DOMAIN_HARDWARE_CLOCK, int( i ),
+                                       depth_stream, src.depth_units } );
+        if( other_stream )
+        {
+            auto & image = other.images[i % other.images.size()];
+            other_sensor.on_video_frame( { (void *)image.data(), []( void * ) {}, other.stride(), other.bpp / 8,
+                                           timestamp, RS2_TIMESTAMP_DOMAIN_HARDWARE_CLOCK, int( i ),
+                                           other_stream } );
+        }
+        // Until the syncer has seen all the streams, the frames may come out separately
+        rs2::frameset fs, complete;
+        bool got_depth = false, got_other = ! other_stream;
+        while( ! ( got_depth && got_other ) && sync.try_wait_for_frames( &fs, 1000 ) )
+        {
+            auto d = fs.get_depth_frame();
+            rs2::frame o = hdr ? rs2::frame( fs.get_infrared_frame() ) : rs2::frame( fs.get_color_frame() );
+            got_depth = got_depth || ( d && d.get_frame_number() == i );
+            got_other = got_other || ( o && o.get_frame_number() == i );
+            if( d && ( o || ! other_stream ) )
+                complete = fs;
+        }
+        auto t1 = std::chrono::steady_clock::now();
+        if( ! ( got_depth && got_other ) )
+            throw std::runtime_error( "syncer did not output frame " + std::to_string( i ) );
+        if( i >= n_warmup )
+        {
+            r.latencies_ms.push_back( std::chrono::duration< double, std::milli >( t1 - t0 ).count() );
+            if( complete )
+            {
+                complete.keep();
+                framesets.push_back( complete );
+            }
+        }
+    }
+    r.wall_ms = std::chrono::duration< double, std::milli >( std::chrono::steady_clock::now() - start ).count();
+    r.allocations = n_allocations - allocations_before;
+    r.allocated_bytes = allocated_bytes - bytes_before;
+    if( framesets.empty() )
+        throw std::runtime_error( "syncer did not output any complete framesets; try more warmup frames" );
+
+    depth_sensor.stop();
+    depth_sensor.close();
+    if( other_stream && ! hdr )
+    {
+        other_sensor.stop();
+        other_sensor.close();
+    }
+    return r;
+}
+
+
+static json describe( stream_images const & images )
+{
+    return json::object( { { "width", images.width },
+                           { "height", images.height },
+                           { "format", rs2_format_to_string( images.format ) } } );
+}
+
+
+static bool is_selected( std::string const & name, std::string const & selection )
+{
+    if( selection.empty() )
+        return true;
+    std::istringstream ss( selection );
+    std::string word;
+    while( std::getline( ss, word, ',' ) )
+        if( ! word.empty() && name.find( word ) != std::string::npos )
+            return true;
+    return false;
+}
+
+
+int main( int argc, char ** argv ) try
+{
+    using cli = rs2::cli_no_context;
+
+    cli::value< int > width_arg( "width", "pixels", 848, "Depth width (synthetic frames)" );
+    cli::value< int > height_arg( "height", "pixels", 480, "Depth height (synthetic frames)" );
+    cli::value< int > color_width_arg( "color-width", "pixels", 1280, "Color width (synthetic frames)" );
+    cli::value< int > color_height_arg( "color-height", "pixels", 720, "Color height (synthetic frames)" );
+    cli::value< std::string > color_format_arg( "color-format", "format", "YUYV", "Color format (synthetic frames): YUYV, UYVY, Y411, RGB8, BGRA8, ..." );
+    cli::value< std::string > bag_arg( 'b', "bag", "filename", "", "Read depth and color frames from a bag instead of generating them" );
+    cli::value< size_t > frames_arg( 'n', "frames", "count", 100, "Number of frames each test measures" );
+    cli::value< size_t > warmup_arg( "warmup", "count", 10, "Number of frames each test processes before measuring" );
+    cli::value< std::string > tests_arg( 't', "tests", "names", "", "Only run tests whose names contain one of these (comma-separated)" );
+    cli::value< std::string > simd_arg( "simd", "level", "", "Limit SIMD kernels to: generic, ssse3 or avx2" );
+    cli::value< std::string > output_arg( 'o', "output", "filename", "", "Write the JSON results to this file rather than stdout" );
+
+    auto settings = cli( "rs-headless-benchmark tool" )
+                        .default_log_level( RS2_LOG_SEVERITY_NONE )  // keep stdout for the JSON
+                        .arg( width_arg )
+                        .arg( height_arg )
+                        .arg( color_width_arg )
+                        .arg( color_height_arg )
+                        .arg( color_format_arg )
+                        .arg( bag_arg )
+                        .arg( frames_arg )
+                        .arg( warmup_arg )
+                        .arg( tests_arg )
+                        .arg( simd_arg )
+                        .arg( output_arg )
+                        .process( argc, argv );
+
+    if( ! simd_arg.getValue().empty() )
+    {
+        int level = RS2_SIMD_LEVEL_GENERIC;
+        while( level < RS2_SIMD_LEVEL_COUNT && simd_arg.getValue() != simd_level_names[level] )
+            ++level;
+        if( level == RS2_SIMD_LEVEL_COUNT )
+            throw std::runtime_error( "invalid SIMD level '" + simd_arg.getValue() + "'" );
+        rs2_error * e = nullptr;
+        rs2_set_simd_level( rs2_simd_level( level ), &e );
+        rs2::error::handle( e );
+    }
+
+    auto const n_frames = std::max< size_t >( 1, frames_arg.getValue() );
+    auto const n_warmup = warmup_arg.getValue();
+
+    rs2::context ctx( settings.dump() );
+    source_images src = bag_arg.isSet()
+                          ? read_images( ctx, bag_arg.getValue(), n_frames )
+                          : generate_images( width_arg.getValue(),
+                                             height_arg.getValue(),
+                                             color_width_arg.getValue(),
+                                             color_height_arg.getValue(),
+                                             parse_format( color_format_arg.getValue() ) );
+
+    json output;
+    output["version"] = RS2_API_FULL_VERSION_STR;
+    output["cpu"] = get_cpu();
+    rs2_error * e = nullptr;
+    auto const simd_level = rs2_get_simd_level( &e );
+    rs2::error::handle( e );
+    output["simd-level"] = simd_level_names[simd_level];
+    output["source"] = src.description;
+    output["depth"] = describe( src.depth );
+    if( src.color )
+        output["color"] = describe( src.color );
+    output["frames"] = n_frames;
+    output["warmup"] = n_warmup;
+    auto & tests_output = output["tests"] = json::array();
+
+    rs2::software_device dev;
+    std::vector< rs2::frameset > framesets;
+    auto syncer_results = capture_framesets( dev, src, n_frames, n_warmup, framesets );
+    if( is_selected( "syncer", tests_arg.getValue() ) )
+        tests_output.push_back( syncer_results.to_json( "syncer" ) );
+
+    for( auto & test : make_tests( src ) )
+    {
+        if( ! is_selected( test.name, tests_arg.getValue() ) )
+            continue;
+        std::cerr << test.name << "..." << std::endl;
+        tests_output.push_back( run_test( test, framesets, n_warmup ).to_json( test.name ) );
+    }
+
+    // HDR needs framesets of its own: depth and infrared, alternating between two sequence ids
+    std::vector< bench_test > hdr_tests;
+    for( auto & test : make_hdr_tests() )
+        if( is_selected( test.name, tests_arg.getValue() ) )
+            hdr_tests.push_back( test );
+    if( ! hdr_tests.empty() )
+    {
+        rs2::software_device hdr_dev;
+        std::vector< rs2::frameset > hdr_framesets;
+        capture_framesets( hdr_dev, src, 2 * n_frames, n_warmup, hdr_framesets, true );  // n_frames pairs
+        for( auto & test : hdr_tests )
+        {
+            std::cerr << test.name << "..." << std::endl;
+            tests_output.push_back( run_test( test, hdr_framesets, n_warmup ).to_json( test.name ) );
+        }
+    }
+
+    // Process-wide: what the run as a whole needed at its peak, the framesets included
+    output["peak-rss-mb"] = peak_rss_mb();
+
+    if( output_arg.isSet() )
+        std::ofstream( output_arg.getValue() ) << output.dump( 4 ) << std::endl;
+    else
+        std::cout << output.dump( 4 ) << std::endl;
+
+    return EXIT_SUCCESS;
+}
+catch( const rs2::error & e )
+{
+    std::cerr << "RealSense error calling " << e.get_failed_function() << "(" << e.get_failed_args() << "):\n    " << e.what() << std::endl;
+    return EXIT_FAILURE;
+}
+catch( const std::exception & e )
+{
+    std::cerr << e.what() << std::endl;
+    return EXIT_FAILURE;
+}
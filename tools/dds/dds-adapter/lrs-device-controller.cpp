@@ -10,6 +10,7 @@
 #include <realdds/topics/blob-msg.h>
 #include <realdds/topics/dds-topic-names.h>
 #include <realdds/topics/flexible-msg.h>
+#include <realdds/topics/metadata-msg.h>
 #include <realdds/topics/dds-topic-names.h>
 #include <realdds/dds-device-server.h>
 #include <realdds/dds-stream-server.h>
@@ -343,8 +344,12 @@ std::vector< std::shared_ptr< realdds::dds_stream_server > > lrs_device_controll
                 for( auto option_id : supported_options )
                 {
                     // Certain options are automatically added by librealsense and shouldn't actually be shared
-                    if( option_id == RS2_OPTION_FRAMES_QUEUE_SIZE )
+                    if( option_id == RS2_OPTION_FRAMES_QUEUE_SIZE || option_id == RS2_OPTION_FRAMES_QUEUE_POLICY
+                        || option_id == RS2_OPTION_FRAMES_QUEUE_MEMORY_LIMIT )
                         continue;  // Added automatically for every sensor_base
+                    if( option_id == RS2_OPTION_MOTION_BLOCK_SIZE || option_id == RS2_OPTION_MOTION_THREAD_PRIORITY
+                        || option_id == RS2_OPTION_MOTION_THREAD_AFFINITY )
+                        continue;  // Affect only local delivery; motion blocks are not streamed over DDS
 
                     std::string option_name = sensor.get_option_name( option_id );
                     try
@@ -747,8 +752,8 @@ lrs_device_controller::lrs_device_controller( rs2::device dev, std::shared_ptr<
                         image.set_height( video->get_image_header().height );
                         image.set_width( video->get_image_header().width );
                         image.set_timestamp( timestamp );
-                        auto data = static_cast< const uint8_t * >( f.get_data() );
-                        image.raw().data().assign( data, data + f.get_data_size() );
+                        // No copy: the frame data is serialized directly, and the frame outlives the publish
+                        image.set_data_view( static_cast< const uint8_t * >( f.get_data() ), f.get_data_size() );
                         video->publish_image( image );
 
                         publish_frame_metadata( f, timestamp );
@@ -795,6 +800,14 @@ lrs_device_controller::lrs_device_controller( rs2::device dev, std::shared_ptr<
 
     extrinsics = get_extrinsics_map( dev );
 
+    // Metadata values are referred to by their index in this list, so clients that understand binary metadata do not
+    // need to parse the names with every frame
+    std::vector< std::string > metadata_keys;
+    metadata_keys.reserve( RS2_FRAME_METADATA_COUNT );
+    for( int i = 0; i < static_cast< int >( RS2_FRAME_METADATA_COUNT ); ++i )
+        metadata_keys.emplace_back( rs2_frame_metadata_to_string( static_cast< rs2_frame_metadata_value >( i ) ) );
+    _dds_device_server->set_metadata_keys( std::move( metadata_keys ) );
+
     // Initialize the DDS device server with the supported streams
     _dds_device_server->init( supported_streams, options, extrinsics );
 
@@ -1095,28 +1108,29 @@ void lrs_device_controller::publish_frame_metadata( const rs2::frame & f, realdd
     if( ! _dds_device_server->has_metadata_readers() )
         return;
 
-    json md_header = json::object( {
-        { topics::metadata::header::key::frame_number, f.get_frame_number() },               // communicated; up to client to pick up
-        { topics::metadata::header::key::timestamp, timestamp.to_ns() },                     // syncer key: needs to match the image timestamp, bit-for-bit!
-        { topics::metadata::header::key::timestamp_domain, f.get_frame_timestamp_domain() }  // needed if we're dealing with different domains!
-    } );
+    topics::metadata_msg md;
+    md.stream_name = stream_name_from_rs2( f.get_profile() );
+    md.timestamp = timestamp.to_ns();  // syncer key: needs to match the image timestamp, bit-for-bit!
+    md.has_frame_number = true;        // communicated; up to client to pick up
+    md.frame_number = f.get_frame_number();
+    md.has_timestamp_domain = true;    // needed if we're dealing with different domains!
+    md.timestamp_domain = f.get_frame_timestamp_domain();
     if( f.is< rs2::depth_frame >() )
-        md_header[topics::metadata::header::key::depth_units] = f.as< rs2::depth_frame >().get_units();
+    {
+        md.has_depth_units = true;
+        md.depth_units = f.as< rs2::depth_frame >().get_units();
+    }
 
-    json metadata = json::object();
-    for( size_t i = 0; i < static_cast< size_t >( RS2_FRAME_METADATA_COUNT ); ++i )
+    // Key indices are the rs2_frame_metadata_value (see set_metadata_keys above)
+    md.values.reserve( RS2_FRAME_METADATA_COUNT );
+    for( int i = 0; i < static_cast< int >( RS2_FRAME_METADATA_COUNT ); ++i )
     {
         rs2_frame_metadata_value val = static_cast< rs2_frame_metadata_value >( i );
         if( f.supports_frame_metadata( val ) )
-            metadata[rs2_frame_metadata_to_string( val )] = f.get_frame_metadata( val );
+            md.values.emplace_back( static_cast< uint16_t >( i ), f.get_frame_metadata( val ) );
     }
 
-    json md_msg = json::object( {
-        { topics::metadata::key::stream_name, stream_name_from_rs2( f.get_profile() ) },
-        { topics::metadata::key::header, std::move( md_header ) },
-        { topics::metadata::key::metadata, std::move( metadata ) },
-    } );
-    _dds_device_server->publish_metadata( std::move( md_msg ) );
+    _dds_device_server->publish_metadata( std::move( md ) );
 }
 
 
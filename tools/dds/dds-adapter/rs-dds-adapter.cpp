@@ -129,9 +129,12 @@ try
 {
     using cli = rs2::cli_no_dds;  // no --eth, --no-eth, --eth-only, --domain-id
     cli::value< dds_domain_id > domain_arg( "domain-id", "0-232", 0, "Select domain ID to publish on" );
+    cli::value< int > depth_rvl_arg( "depth-rvl", "0-8", 0,
+                                     "Offer RVL-compressed depth to clients, dropping this many low bits (0=lossless)" );
     cli cmd( "librealsense rs-dds-adapter tool: use USB devices as network devices" );
     auto settings = cmd  // in order we want listed:
         .arg( domain_arg )
+        .arg( depth_rvl_arg )
         .process( argc, argv );
 
     // Configure the same logger as librealsense
@@ -156,6 +159,12 @@ try
         }
     }
 
+    if( depth_rvl_arg.isSet() && ( depth_rvl_arg.getValue() < 0 || depth_rvl_arg.getValue() > 8 ) )
+    {
+        std::cerr << "Invalid depth-rvl value, enter a value in the range [0, 8]" << std::endl;
+        return EXIT_FAILURE;
+    }
+
     std::cout << "Starting RS DDS Adapter on domain " << domain << " ..." << std::endl;
 
     // Create a DDS participant
@@ -252,6 +261,8 @@ try
             // Create a dds-device-server for this device
             auto dds_device_server
                 = std::make_shared< realdds::dds_device_server >( participant, dev_info.topic_root() );
+            if( depth_rvl_arg.isSet() )
+                dds_device_server->set_depth_compression( true, unsigned( depth_rvl_arg.getValue() ) );
  
             // Create a lrs_device_manager for this device
             auto lrs_device_controller = std::make_shared< tools::lrs_device_controller >( dev, dds_device_server );
@@ -0,0 +1,327 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+//#cmake: static!
+
+#include <unit-tests/test.h>
+#include <src/core/advanced_mode.h>
+#include <src/context.h>
+#include <src/software-device.h>
+#include <src/software-device-info.h>
+#include <src/ds/d400/d400-private.h>
+
+#include <map>
+#include <mutex>
+
+using namespace librealsense;
+
+
+namespace {
+
+
+// What the device was sent, in order: "SET_ADV <group>" for each advanced-mode struct written and "AWB <value>"
+// for each write of the depth auto-white-balance control
+struct event_log
+{
+    std::mutex mutex;
+    std::vector< std::string > events;
+
+    void add( std::string const & e )
+    {
+        std::lock_guard< std::mutex > lock( mutex );
+        events.push_back( e );
+    }
+
+    std::vector< std::string > take()
+    {
+        std::lock_guard< std::mutex > lock( mutex );
+        return std::move( events );
+    }
+};
+
+
+std::string set_adv( int group )
+{
+    return "SET_ADV " + std::to_string( group );
+}
+
+
+// Advanced-mode FW: keeps each struct as written and replies to UAMG (enabled), GET_ADV and SET_ADV
+class mock_fw : public platform::command_transfer
+{
+public:
+    explicit mock_fw( event_log & log )
+        : _log( log )
+    {
+    }
+
+    std::vector< uint8_t > send_receive( uint8_t const * pb, size_t cb, int, bool ) override
+    {
+        uint32_t opcode, group;
+        std::memcpy( &opcode, pb + 4, sizeof( opcode ) );
+        std::memcpy( &group, pb + 8, sizeof( group ) );
+        std::vector< uint8_t > res( sizeof( opcode ) );
+        std::memcpy( res.data(), &opcode, sizeof( opcode ) );
+
+        std::lock_guard< std::mutex > lock( _mutex );
+        switch( opcode )
+        {
+        case ds::fw_cmd::UAMG:
+            res.push_back( 1 );
+            break;
+        case ds::fw_cmd::GET_ADV:
+        {
+            auto & s = _structs[group];
+            s.resize( 64 );  // larger than any struct
+            res.insert( res.end(), s.begin(), s.end() );
+            break;
+        }
+        case ds::fw_cmd::SET_ADV:
+            // The data follows the opcode and four parameters
+            _structs[group].assign( pb + 24, pb + cb );
+            _log.add( set_adv( group ) );
+            break;
+        default:
+            res.clear();
+            break;
+        }
+        return res;
+    }
+
+    template< class T >
+    void load( T & s )
+    {
+        std::lock_guard< std::mutex > lock( _mutex );
+        auto & bytes = _structs[advanced_mode_traits< T >::group];
+        bytes.resize( std::max( bytes.size(), sizeof( T ) ) );
+        std::memcpy( &s, bytes.data(), sizeof( T ) );
+    }
+
+    // The advanced-mode structs only
+    preset state()
+    {
+        preset p;
+        std::memset( &p, 0, sizeof( p ) );
+        load( p.depth_controls );
+        load( p.rsm );
+        load( p.rsvc );
+        load( p.color_control );
+        load( p.rctc );
+        load( p.sctc );
+        load( p.spc );
+        load( p.hdad );
+        load( p.cc );
+        load( p.depth_table );
+        load( p.ae );
+        load( p.census );
+        return p;
+    }
+
+private:
+    event_log & _log;
+    std::mutex _mutex;
+    std::map< uint32_t, std::vector< uint8_t > > _structs;
+};
+
+
+class mock_hwmon_response : public hwmon_response_interface
+{
+public:
+    std::string hwmon_error2str( int ) const override { return "mock error"; }
+    hwmon_response_type success_value() const override { return 0; }
+};
+
+
+class mock_raw_sensor : public raw_sensor_base
+{
+public:
+    explicit mock_raw_sensor( device * owner )
+        : raw_sensor_base( "raw", owner )
+    {
+    }
+
+    stream_profiles init_stream_profiles() override { return {}; }
+    void open( const stream_profiles & ) override {}
+    void close() override {}
+    void start( rs2_frame_callback_sptr ) override {}
+    void stop() override {}
+};
+
+
+class mock_awb_option : public float_option
+{
+public:
+    explicit mock_awb_option( event_log & log )
+        : float_option( option_range{ 0, 1, 1, 1 } )
+        , _log( log )
+    {
+    }
+
+    void set( float value ) override
+    {
+        _log.add( "AWB " + std::to_string( int( value ) ) );
+        float_option::set( value );
+    }
+
+private:
+    event_log & _log;
+};
+
+
+// A D430 in advanced mode, as far as the advanced-mode commands and the depth auto-white-balance control go
+struct mock_device
+{
+    event_log log;
+    std::shared_ptr< mock_fw > fw = std::make_shared< mock_fw >( log );
+    std::shared_ptr< software_device > dev;
+    std::shared_ptr< synthetic_sensor > depth;
+    std::shared_ptr< mock_awb_option > awb = std::make_shared< mock_awb_option >( log );
+    std::shared_ptr< ds_advanced_mode_base > advanced;
+
+    mock_device()
+    {
+        auto ctx = context::make( rsutils::json::object( { { "dds", false } } ) );
+        auto dev_info = std::make_shared< software_device_info >( ctx );
+        dev = std::make_shared< software_device >( dev_info );
+        dev_info->set_device( dev );
+        dev->register_info( RS2_CAMERA_INFO_PRODUCT_LINE, "D400" );
+
+        depth = std::make_shared< synthetic_sensor >( "Stereo Module",
+                                                      std::make_shared< mock_raw_sensor >( dev.get() ),
+                                                      dev.get() );
+        depth->register_option( RS2_OPTION_ENABLE_AUTO_WHITE_BALANCE, awb );
+
+        auto hwm = std::make_shared< hw_monitor >( std::make_shared< locked_transfer >( fw, nullptr ),
+                                                   std::make_shared< mock_hwmon_response >() );
+        advanced = std::make_shared< ds_advanced_mode_base >( hwm, *depth );
+    }
+
+    void apply( rs2_rs400_visual_preset p )
+    {
+        advanced->apply_preset( {}, p, ds::RS430_PID, firmware_version( "5.16.0.1" ) );
+    }
+};
+
+
+std::vector< std::string > expected_writes( uint32_t groups )
+{
+    std::vector< std::string > writes;
+    for( int g = 0; g < etLastAdvancedModeGroup; ++g )
+        if( groups & ( 1u << g ) )
+            writes.push_back( set_adv( g ) );
+    return writes;
+}
+
+
+std::vector< std::string > sorted( std::vector< std::string > v )
+{
+    std::sort( v.begin(), v.end() );
+    return v;
+}
+
+
+std::vector< std::pair< rs2_rs400_visual_preset, void ( * )( preset & ) > > const visual_presets = {
+    { RS2_RS400_VISUAL_PRESET_DEFAULT, default_430 },
+    { RS2_RS400_VISUAL_PRESET_HIGH_ACCURACY, high_accuracy },
+    { RS2_RS400_VISUAL_PRESET_HIGH_DENSITY, high_density },
+    { RS2_RS400_VISUAL_PRESET_MEDIUM_DENSITY, mid_density },
+    { RS2_RS400_VISUAL_PRESET_HAND, hand_gesture },
+};
+
+
+}  // namespace
+
+
+TEST_CASE( "a single field change writes a single struct" )
+{
+    preset p;
+    std::memset( &p, 0, sizeof( p ) );
+    high_accuracy( p );
+    auto changed = p;
+
+    changed.depth_table.depthUnits += 1;
+    CHECK( changed_advanced_mode_groups( p, changed ) == 1u << etDepthTableControl );
+
+    changed.census.uDiameter += 1;
+    CHECK( changed_advanced_mode_groups( p, changed ) == ( ( 1u << etDepthTableControl ) | ( 1u << etCencusRadius9 ) ) );
+
+    // Non-struct controls are not part of the diff
+    changed = p;
+    changed.laser_power.laser_power += 30;
+    CHECK( changed_advanced_mode_groups( p, changed ) == 0 );
+}
+
+TEST_CASE( "preset switch writes only the structs that changed" )
+{
+    mock_device d;
+    d.apply( RS2_RS400_VISUAL_PRESET_DEFAULT );
+    d.log.take();
+
+    // Cycle through the visual presets, each twice in a row, as a user switching between them would
+    for( size_t i = 0; i <= visual_presets.size(); ++i )
+    {
+        auto & vp = visual_presets[i % visual_presets.size()];
+        for( int again = 0; again < 2; ++again )
+        {
+            CAPTURE( vp.first, again );
+            auto const before = d.fw->state();
+            auto expected = before;
+            vp.second( expected );
+
+            d.apply( vp.first );
+            auto const writes = d.log.take();
+            // The amplitude factor is not supported by this device, and never written
+            uint32_t const groups = changed_advanced_mode_groups( before, expected ) & ~( 1u << etAFactor );
+            CHECK( sorted( writes ) == sorted( expected_writes( groups ) ) );
+            if( again )
+                CHECK( writes.empty() );
+            CHECK( ( changed_advanced_mode_groups( d.fw->state(), expected ) & ~( 1u << etAFactor ) ) == 0 );
+        }
+    }
+}
+
+TEST_CASE( "loading json writes only the structs that changed" )
+{
+    mock_device d;
+    d.apply( RS2_RS400_VISUAL_PRESET_HIGH_ACCURACY );
+    auto const depth_units = d.fw->state().depth_table.depthUnits;
+    d.log.take();
+
+    // The same values, as the device already has them
+    d.advanced->load_json( "{ \"param-depthunits\": " + std::to_string( depth_units ) + " }" );
+    CHECK( d.log.take().empty() );
+
+    d.advanced->load_json( "{ \"param-depthunits\": " + std::to_string( depth_units + 100 ) + " }" );
+    std::vector< std::string > const depth_table = { set_adv( etDepthTableControl ) };
+    CHECK( d.log.take() == depth_table );
+    CHECK( d.fw->state().depth_table.depthUnits == depth_units + 100 );
+}
+
+TEST_CASE( "depth auto-white-balance is written only when changed, and followed by the color correction" )
+{
+    mock_device d;
+    d.apply( RS2_RS400_VISUAL_PRESET_DEFAULT );
+    d.log.take();
+    REQUIRE( d.awb->query() == 1 );
+
+    // Unchanged: neither it nor the color correction is written
+    d.advanced->load_json( "{ \"controls-depth-white-balance-auto\": \"True\" }" );
+    CHECK( d.log.take().empty() );
+
+    // Changed: the FW changes the color correction with it, so that is written again after it even though it
+    // did not change
+    d.advanced->load_json( "{ \"controls-depth-white-balance-auto\": \"False\" }" );
+    std::vector< std::string > const awb_then_cc = { "AWB 0", set_adv( etColorCorrection ) };
+    CHECK( d.log.take() == awb_then_cc );
+    CHECK( d.awb->query() == 0 );
+
+    // Along with other changes, still before the color correction
+    auto const depth_units = d.fw->state().depth_table.depthUnits;
+    d.advanced->load_json( "{ \"controls-depth-white-balance-auto\": \"True\", \"param-depthunits\": "
+                           + std::to_string( depth_units + 1 ) + " }" );
+    auto const writes = d.log.take();
+    CHECK( sorted( writes )
+           == sorted( { "AWB 1", set_adv( etColorCorrection ), set_adv( etDepthTableControl ) } ) );
+    auto const awb = std::find( writes.begin(), writes.end(), "AWB 1" );
+    CHECK( std::find( awb, writes.end(), set_adv( etColorCorrection ) ) != writes.end() );
+}
@@ -0,0 +1,35 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <unit-tests/test.h>
+#include <src/simd-dispatch.h>
+
+
+// Restores the SIMD level when going out of scope
+struct simd_level_guard
+{
+    rs2_simd_level const level = librealsense::get_simd_level();
+    ~simd_level_guard() { librealsense::set_simd_level( level ); }
+};
+
+
+// Runs fn() at each SIMD level the CPU supports, from 'first' up, then restores the level
+template< class Fn >
+void for_each_simd_level( rs2_simd_level first, Fn fn )
+{
+    simd_level_guard guard;
+    for( int l = first; l <= librealsense::get_supported_simd_level(); ++l )
+    {
+        CAPTURE( librealsense::get_string( rs2_simd_level( l ) ) );
+        REQUIRE( librealsense::set_simd_level( rs2_simd_level( l ) ) == l );
+        fn();
+    }
+}
+
+template< class Fn >
+void for_each_simd_level( Fn fn )
+{
+    for_each_simd_level( RS2_SIMD_LEVEL_GENERIC, fn );
+}
@@ -0,0 +1,63 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+//#cmake: static!
+
+#include <unit-tests/test.h>
+#include <unit-tests/algo/simd-levels.h>
+#include <src/ae-histogram.h>
+
+#include <random>
+#include <vector>
+
+using namespace librealsense;
+
+
+namespace {
+
+
+// auto_exposure_algorithm::im_hist as it was, with the column step (then always 1) applied to the rows, too
+std::vector< int > reference_hist( uint8_t const * data, int row_step, int min_x, int max_x, int min_y, int max_y,
+                                   int step )
+{
+    std::vector< int > h( 256, 0 );
+    uint8_t const * row_data = data + ( min_y * row_step );
+    for( int i = min_y; i < max_y; i += step, row_data += step * row_step )
+        for( int j = min_x; j < max_x; j += step )
+            ++h[row_data[j]];
+    return h;
+}
+
+
+}  // namespace
+
+
+TEST_CASE( "auto-exposure histogram matches the reference" )
+{
+    int const width = 848, height = 100;
+    std::mt19937 gen( 1234 );
+    std::uniform_int_distribution< int > value( 0, 255 ), percent( 0, 99 );
+    std::vector< uint8_t > image( width * height );
+    for( auto & p : image )
+        p = uint8_t( value( gen ) );
+    // Long runs of a single value, as in saturated or dark areas
+    for( int y = 10; y < 30; ++y )
+        for( int x = 100; x < 700; ++x )
+            image[y * width + x] = percent( gen ) < 90 ? 255 : 0;
+
+    struct roi { int min_x, max_x, min_y, max_y; };
+    for( auto r : { roi{ 0, width - 1, 0, height - 1 }, roi{ 3, 531, 7, 95 }, roi{ 200, 215, 5, 6 }, roi{ 5, 5, 0, 10 } } )
+        for( int step = 1; step <= 8; ++step )
+        {
+            CAPTURE( r.min_x );
+            CAPTURE( r.max_x );
+            CAPTURE( step );
+            auto expected = reference_hist( image.data(), width, r.min_x, r.max_x, r.min_y, r.max_y, step );
+            for_each_simd_level( [&]
+            {
+                std::vector< int > h( 256, -1 );
+                ae_histogram( image.data(), width, r.min_x, r.max_x, r.min_y, r.max_y, step, h.data() );
+                CHECK( h == expected );
+            } );
+        }
+}
@@ -0,0 +1,245 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+//#cmake: static!
+
+#include <unit-tests/test.h>
+#include <unit-tests/algo/simd-levels.h>
+#include <src/proc/decimation-filter.h>
+#include <src/image.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+using namespace librealsense;
+
+
+namespace {
+
+
+// Depth with holes: mostly smooth surfaces, some of them at the far end of the range
+std::vector< uint16_t > make_depth( size_t w, size_t h )
+{
+    std::mt19937 gen( 1234 );
+    std::uniform_int_distribution< int > base( 300, 65535 );
+    std::uniform_int_distribution< int > noise( -30, 30 );
+    std::uniform_int_distribution< int > percent( 0, 99 );
+    std::vector< uint16_t > depth( w * h );
+    int z = base( gen );
+    for( auto & d : depth )
+    {
+        auto const p = percent( gen );
+        if( p < 30 )
+            d = 0;
+        else if( p < 35 )
+            d = uint16_t( z = base( gen ) );
+        else
+            d = uint16_t( std::min( std::max( z + noise( gen ), 1 ), 65535 ) );
+    }
+    return depth;
+}
+
+
+// The median (the lower of the middle two) or mean of the valid pixels of each patch
+std::vector< uint16_t > reference_decimate( std::vector< uint16_t > const & in, size_t w, size_t scale,
+                                            size_t real_width, size_t real_height, size_t padded_width,
+                                            size_t padded_height )
+{
+    std::vector< uint16_t > out( padded_width * padded_height );
+    for( size_t j = 0; j < real_height; ++j )
+        for( size_t i = 0; i < real_width; ++i )
+        {
+            std::vector< uint16_t > valid;
+            for( size_t n = 0; n < scale; ++n )
+                for( size_t m = 0; m < scale; ++m )
+                    if( auto d = in[( j * scale + n ) * w + i * scale + m] )
+                        valid.push_back( d );
+            uint16_t result = 0;
+            if( ! valid.empty() )
+            {
+                std::sort( valid.begin(), valid.end() );
+                if( scale <= 3 )
+                    result = valid[( valid.size() - 1 ) / 2];
+                else
+                {
+                    int sum = 0;
+                    for( auto d : valid )
+                        sum += d;
+                    result = uint16_t( sum / int( valid.size() ) );
+                }
+            }
+            out[j * padded_width + i] = result;
+        }
+    return out;
+}
+
+
+void check_matches_reference( size_t w, size_t h )
+{
+    auto const in = make_depth( w, h );
+    row_bands bands( 3 );
+
+    for( size_t scale = 2; scale <= 8; ++scale )
+    {
+        CAPTURE( scale );
+        decimate_depth_params params;
+        params.in = in.data();
+        params.width_in = w;
+        params.scale = scale;
+        params.real_width = w / scale;
+        params.padded_width = params.real_width + 5;
+        size_t const real_height = h / scale;
+        size_t const padded_height = real_height + 3;
+        auto const expected = reference_decimate( in, w, scale, params.real_width, real_height, params.padded_width,
+                                                  padded_height );
+
+        for_each_simd_level( [&]
+        {
+            // Garbage to start with, to make sure the padding is written
+            std::vector< uint16_t > out( expected.size(), 0xbad );
+            params.out = out.data();
+            decimate_depth( bands, params, real_height, padded_height );
+            CHECK( out == expected );
+        } );
+    }
+}
+
+
+// The mean of each patch, per channel; for YUYV and UYVY, the chroma of each pair of output pixels is the mean chroma
+// of the first one's patch (that of each of its pixels)
+std::vector< uint8_t > reference_decimate_others( rs2_format format, std::vector< uint8_t > const & in, size_t w,
+                                                  size_t scale, size_t real_width, size_t real_height,
+                                                  size_t padded_width, size_t padded_height )
+{
+    size_t const bpp = get_image_bpp( format ) / 8;
+    size_t const patch_size = scale * scale;
+    std::vector< uint8_t > out( padded_width * padded_height * bpp );
+    auto const at = [&]( size_t x, size_t y, size_t byte ) { return int( in[( y * w + x ) * bpp + byte] ); };
+    for( size_t j = 0; j < real_height; ++j )
+    {
+        if( format == RS2_FORMAT_YUYV || format == RS2_FORMAT_UYVY )
+        {
+            size_t const luma = format == RS2_FORMAT_YUYV ? 0 : 1, chroma = 1 - luma;
+            for( size_t i = 0; i + 1 < real_width; i += 2 )
+            {
+                int y[2] = {}, c[2] = {};
+                for( size_t n = 0; n < scale; ++n )
+                    for( size_t m = 0; m < 2 * scale; ++m )
+                    {
+                        size_t const x = i * scale + m, row = j * scale + n;
+                        y[m / scale] += at( x, row, luma );
+                        // The U of a pixel is in its pair's first pixel, the V in the second
+                        if( m < scale )
+                        {
+                            c[0] += at( x & ~size_t( 1 ), row, chroma );
+                            c[1] += at( x | 1, row, chroma );
+                        }
+                    }
+                uint8_t * q = &out[( j * padded_width + i ) * 2];
+                q[luma] = uint8_t( y[0] / patch_size );
+                q[luma + 2] = uint8_t( y[1] / patch_size );
+                q[chroma] = uint8_t( c[0] / patch_size );
+                q[chroma + 2] = uint8_t( c[1] / patch_size );
+            }
+            continue;
+        }
+        for( size_t i = 0; i < real_width; ++i )
+            for( size_t k = 0; k < bpp; k += ( format == RS2_FORMAT_Y16 ? 2 : 1 ) )
+            {
+                int sum = 0;
+                for( size_t n = 0; n < scale; ++n )
+                    for( size_t m = 0; m < scale; ++m )
+                        sum += format == RS2_FORMAT_Y16
+                                 ? at( i * scale + m, j * scale + n, k ) | at( i * scale + m, j * scale + n, k + 1 ) << 8
+                                 : at( i * scale + m, j * scale + n, k );
+                auto const mean = sum / int( patch_size );
+                out[( j * padded_width + i ) * bpp + k] = uint8_t( mean );
+                if( format == RS2_FORMAT_Y16 )
+                    out[( j * padded_width + i ) * bpp + k + 1] = uint8_t( mean >> 8 );
+            }
+    }
+    return out;
+}
+
+
+void check_others_match_reference( rs2_format format, size_t w, size_t h )
+{
+    CAPTURE( rs2_format_to_string( format ), w, h );
+    std::mt19937 gen( 1234 );
+    std::uniform_int_distribution< int > byte( 0, 255 );
+    std::vector< uint8_t > in( w * h * get_image_bpp( format ) / 8 );
+    for( auto & b : in )
+        b = uint8_t( byte( gen ) );
+    row_bands bands( 3 );
+    std::vector< std::vector< uint8_t > > buffers;
+
+    for( size_t scale = 2; scale <= 8; ++scale )
+    {
+        CAPTURE( scale );
+        decimate_others_params params;
+        params.format = format;
+        params.in = in.data();
+        params.width_in = w;
+        params.scale = scale;
+        params.real_width = w / scale;
+        params.padded_width = params.real_width + 6;
+        size_t const real_height = h / scale;
+        size_t const padded_height = real_height + 3;
+        auto const expected = reference_decimate_others( format, in, w, scale, params.real_width, real_height,
+                                                         params.padded_width, padded_height );
+
+        for_each_simd_level( [&]
+        {
+            std::vector< uint8_t > out( expected.size(), 0xba );
+            params.out = out.data();
+            decimate_others( bands, buffers, params, real_height, padded_height );
+            CHECK( out == expected );
+        } );
+    }
+}
+
+
+}  // namespace
+
+
+TEST_CASE( "decimation filter matches the reference at all scales" )
+{
+    check_matches_reference( 848, 480 );
+    // Rows not a multiple of the SIMD width, with partial patches at the edges
+    check_matches_reference( 101, 67 );
+    check_matches_reference( 7, 9 );
+}
+
+TEST_CASE( "decimation filter ignores holes" )
+{
+    row_bands bands( 1 );
+    // 2x2 patches: all holes; one valid; two (the lower); all valid (the second); a 3x3 patch with 4 valid ones
+    uint16_t const in2[] = { 0, 0, 0, 7, 0, 9, 1, 2,
+                             0, 0, 0, 0, 5, 0, 4, 3 };
+    uint16_t out[4];
+    decimate_depth_params params = { in2, 8, 2, out, 4, 4 };
+    decimate_depth( bands, params, 1, 1 );
+    CHECK( out[0] == 0 );
+    CHECK( out[1] == 7 );
+    CHECK( out[2] == 5 );
+    CHECK( out[3] == 2 );
+
+    uint16_t const in3[] = { 0, 8, 0,
+                             6, 0, 0,
+                             0, 2, 4 };
+    params = { in3, 3, 3, out, 1, 1 };
+    decimate_depth( bands, params, 1, 1 );
+    CHECK( out[0] == 4 );
+}
+
+TEST_CASE( "decimation filter averages the other formats as the reference" )
+{
+    for( auto format : { RS2_FORMAT_YUYV, RS2_FORMAT_UYVY, RS2_FORMAT_RGB8, RS2_FORMAT_BGRA8, RS2_FORMAT_Y8,
+                         RS2_FORMAT_Y16 } )
+    {
+        check_others_match_reference( format, 848, 480 );
+        // Rows not a multiple of the SIMD width, with partial patches at the edges
+        check_others_match_reference( format, 102, 67 );
+    }
+}
@@ -0,0 +1,118 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+//#cmake: static!
+
+#include <unit-tests/test.h>
+#include <unit-tests/algo/simd-levels.h>
+#include <src/proc/depth-maps.h>
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+using namespace librealsense;
+
+
+namespace {
+
+
+std::vector< uint16_t > all_z16()
+{
+    std::vector< uint16_t > z( Z16_LUT_SIZE );
+    for( size_t i = 0; i < z.size(); ++i )
+        z[i] = uint16_t( i );
+    return z;
+}
+
+
+}  // namespace
+
+
+TEST_CASE( "threshold matches comparing each distance" )
+{
+    auto const in = all_z16();
+    float const infinity = std::numeric_limits< float >::infinity();
+    for( float du : { 0.001f, 0.0001f, 0.000125f, 0.01f } )
+        for( float min : { 0.f, 0.1f, 0.3f, 1.f, 2.5f } )
+            for( float max : { 0.f, 0.1f, 0.5f, 4.f, 16.f, infinity } )
+            {
+                CAPTURE( du );
+                CAPTURE( min );
+                CAPTURE( max );
+                std::vector< uint16_t > expected( in.size(), 0 );
+                for( size_t i = 0; i < in.size(); i++ )
+                {
+                    auto dist = du * in[i];
+                    if( dist >= min && dist <= max )
+                        expected[i] = in[i];
+                }
+
+                std::vector< uint16_t > out( in.size(), 0xbad );
+                threshold_z16( in.data(), out.data(), in.size(), get_z16_range( du, min, max ) );
+                CHECK( out == expected );
+            }
+}
+
+TEST_CASE( "depth to disparity table matches dividing each pixel" )
+{
+    auto const in = all_z16();
+    std::vector< float > lut( Z16_LUT_SIZE );
+    for( float factor : { 608000.f, 12345.678f, 1.f } )
+    {
+        CAPTURE( factor );
+        std::vector< float > expected( in.size() );
+        for( size_t i = 0; i < in.size(); i++ )
+        {
+            float input = in[i];
+            expected[i] = std::isnormal( input ) ? static_cast< float >( ( factor / input ) + 0.f ) : 0;
+        }
+
+        make_disparity_lut( lut.data(), factor, get_z16_range( 0.001f, 0.f, std::numeric_limits< float >::infinity() ) );
+        std::vector< float > out( in.size() );
+        z16_to_float( in.data(), out.data(), in.size(), lut.data() );
+        CHECK( std::memcmp( out.data(), expected.data(), out.size() * sizeof( float ) ) == 0 );
+
+        // With a range, out of it is 0
+        auto const range = get_z16_range( 0.001f, 0.5f, 2.f );
+        make_disparity_lut( lut.data(), factor, range );
+        z16_to_float( in.data(), out.data(), in.size(), lut.data() );
+        for( size_t i = 0; i < in.size(); i++ )
+            if( i < range.first || i > range.last )
+                expected[i] = 0;
+        CHECK( std::memcmp( out.data(), expected.data(), out.size() * sizeof( float ) ) == 0 );
+    }
+}
+
+TEST_CASE( "disparity to depth matches dividing each pixel" )
+{
+    float const factor = 608000.f;
+
+    // Disparities of all depths, and ones that are not normal
+    std::mt19937 gen( 1234 );
+    std::uniform_real_distribution< float > disparity( factor / 65535.f, factor );
+    std::vector< float > in( 1001 );
+    for( auto & d : in )
+        d = disparity( gen );
+    float const others[] = { 0.f, -0.f, std::numeric_limits< float >::denorm_min(),
+                             std::numeric_limits< float >::min() / 2, std::numeric_limits< float >::infinity(),
+                             std::numeric_limits< float >::quiet_NaN() };
+    for( size_t i = 0; i < sizeof( others ) / sizeof( others[0] ); ++i )
+        in[i * 7 + 3] = others[i];
+
+    std::vector< uint16_t > expected( in.size() );
+    for( size_t i = 0; i < in.size(); i++ )
+    {
+        float input = in[i];
+        expected[i] = std::isnormal( input ) ? static_cast< uint16_t >( ( factor / input ) + 0.5f ) : 0;
+    }
+
+    for_each_simd_level( [&]
+    {
+        std::vector< uint16_t > out( in.size(), 0xbad );
+        disparity_to_z16( in.data(), out.data(), in.size(), factor );
+        CHECK( out == expected );
+    } );
+}
@@ -0,0 +1,241 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+//#cmake: static!
+
+#include <unit-tests/test.h>
+#include <unit-tests/algo/simd-levels.h>
+#include <src/algo.h>
+
+#include <cmath>
+#include <cstring>
+#include <random>
+#include <vector>
+
+using namespace librealsense;
+
+
+namespace {
+
+
+class test_calculator : public rect_gaussian_dots_target_calculator
+{
+public:
+    using rect_gaussian_dots_target_calculator::rect_gaussian_dots_target_calculator;
+
+    std::vector< double > const & ncc() const { return _ncc; }
+
+    // The calculator as it was: normalize() and calculate_ncc(), verbatim, then the same corner search
+    bool calculate_reference( const uint8_t * img, float * target_dims )
+    {
+        std::vector< double > imgt( _tsize2 );
+        std::vector< double > ncc( _size, 0. );
+
+        // normalize()
+        uint8_t min_val = 255;
+        uint8_t max_val = 0;
+
+        int jumper = _full_width - _width;
+        const uint8_t * p = img + _roi_start_y * _full_width + _roi_start_x;
+        for( int j = 0; j < _height; ++j )
+        {
+            for( int i = 0; i < _width; ++i )
+            {
+                if( *p < min_val )
+                    min_val = *p;
+
+                if( *p > max_val )
+                    max_val = *p;
+
+                ++p;
+            }
+
+            p += jumper;
+        }
+
+        if( max_val > min_val )
+        {
+            double factor = 1.0 / ( max_val - min_val );
+
+            p = img;
+            double * q = _img.data();
+            p = img + _roi_start_y * _full_width + _roi_start_x;
+            for( int j = 0; j < _height; ++j )
+            {
+                for( int i = 0; i < _width; ++i )
+                    *q++ = 1.0f - ( *p++ - min_val ) * factor;
+
+                p += jumper;
+            }
+        }
+
+        // calculate_ncc()
+        double * pncc = ncc.data() + ( _htsize * _width + _htsize );
+        double * pi = _img.data();
+        double * pit = imgt.data();
+
+        const double * pt = nullptr;
+        const double * qi = nullptr;
+
+        double sum = 0.0;
+        double mean = 0.0;
+        double norm = 0.0;
+
+        double min_ncc = 2.0;
+        double max_ncc = -2.0;
+        double tmp = 0.0;
+
+        for( int j = 0; j < _ht; ++j )
+        {
+            for( int i = 0; i < _wt; ++i )
+            {
+                qi = pi;
+                sum = 0.0f;
+                for( int m = 0; m < _tsize; ++m )
+                {
+                    for( int n = 0; n < _tsize; ++n )
+                        sum += *qi++;
+
+                    qi += _wt;
+                }
+
+                mean = sum / _tsize2;
+
+                qi = pi;
+                sum = 0.0f;
+                pit = imgt.data();
+                for( int m = 0; m < _tsize; ++m )
+                {
+                    for( int n = 0; n < _tsize; ++n )
+                    {
+                        *pit = *qi++ - mean;
+                        sum += *pit * *pit;
+                        ++pit;
+                    }
+                    qi += _wt;
+                }
+
+                norm = sqrt( sum );
+
+                pt = _template.data();
+                pit = imgt.data();
+                sum = 0.0;
+                for( int k = 0; k < _tsize2; ++k )
+                    sum += *pit++ * *pt++;
+
+                tmp = sum / norm;
+                if( tmp < min_ncc )
+                    min_ncc = tmp;
+
+                if( tmp > max_ncc )
+                    max_ncc = tmp;
+
+                *pncc++ = tmp;
+                ++pi;
+            }
+
+            pncc += _tsize;
+            pi += _tsize;
+        }
+
+        if( max_ncc > min_ncc )
+        {
+            double factor = 1.0 / ( max_ncc - min_ncc );
+            double div = 1.0 - _thresh;
+            pncc = ncc.data();
+            for( int i = 0; i < _size; ++i )
+            {
+                tmp = ( *pncc - min_ncc ) * factor;
+                *pncc++ = ( tmp < _thresh ? 0 : ( tmp - _thresh ) / div );
+            }
+        }
+
+        _ncc = ncc;
+        if( ! find_corners() || ! validate_corners( img ) )
+            return false;
+        calculate_rect_sides( target_dims );
+        return true;
+    }
+};
+
+
+// An IR image of the target: four dark Gaussian dots, at the corners of a rectangle, on a noisy background
+std::vector< uint8_t > make_target( int width, int height, float const ( &dots )[4][2] )
+{
+    std::mt19937 gen( 1234 );
+    std::uniform_int_distribution< int > noise( -8, 8 );
+    std::vector< uint8_t > image( width * height );
+    for( int y = 0; y < height; ++y )
+        for( int x = 0; x < width; ++x )
+        {
+            double v = 190 + noise( gen );
+            for( auto & dot : dots )
+            {
+                double dx = x - dot[0], dy = y - dot[1];
+                v -= 160 * std::exp( -( dx * dx + dy * dy ) / ( 2 * 4.5 * 4.5 ) );
+            }
+            image[y * width + x] = uint8_t( std::max( 0., std::min( 255., std::round( v ) ) ) );
+        }
+    return image;
+}
+
+
+}  // namespace
+
+
+TEST_CASE( "dots target NCC and corners match the reference" )
+{
+    int const width = 848, height = 480;
+    float const dots[4][2] = { { 560.3f, 300.6f }, { 721.8f, 301.2f }, { 559.4f, 421.5f }, { 722.6f, 420.9f } };
+    auto const image = make_target( width, height, dots );
+
+    test_calculator reference( width, height, _roi_ws, _roi_hs, _roi_we - _roi_ws, _roi_he - _roi_hs );
+    float expected[4];
+    REQUIRE( reference.calculate_reference( image.data(), expected ) );
+    auto const expected_ncc = reference.ncc();
+
+    std::vector< double > first_ncc;
+    for_each_simd_level( [&]
+    {
+        test_calculator calculator( width, height, _roi_ws, _roi_hs, _roi_we - _roi_ws, _roi_he - _roi_hs );
+        float dims[4];
+        REQUIRE( calculator.calculate( image.data(), dims, 4 ) );
+        for( int i = 0; i < 4; ++i )
+            CHECK( std::abs( dims[i] - expected[i] ) < 1e-4f );
+
+        // Only rounding differs from the reference; all kernels give the same bits
+        auto const & ncc = calculator.ncc();
+        REQUIRE( ncc.size() == expected_ncc.size() );
+        size_t mismatches = 0;
+        for( size_t i = 0; i < ncc.size(); ++i )
+            if( std::abs( ncc[i] - expected_ncc[i] ) > 1e-9 )
+                ++mismatches;
+        CHECK( mismatches == 0 );
+        if( first_ncc.empty() )
+            first_ncc = ncc;
+        else
+            CHECK( std::memcmp( ncc.data(), first_ncc.data(), ncc.size() * sizeof( double ) ) == 0 );
+    } );
+}
+
+TEST_CASE( "dots target coarse search finds the same corners" )
+{
+    int const width = 848, height = 480;
+    float const dots[4][2] = { { 561.7f, 299.2f }, { 719.5f, 300.4f }, { 560.6f, 420.8f }, { 720.3f, 419.1f } };
+    auto const image = make_target( width, height, dots );
+
+    test_calculator reference( width, height, _roi_ws, _roi_hs, _roi_we - _roi_ws, _roi_he - _roi_hs );
+    float expected[4];
+    REQUIRE( reference.calculate_reference( image.data(), expected ) );
+
+    for( int step = 2; step <= 3; ++step )
+        for_each_simd_level( [&]
+        {
+            CAPTURE( step );
+            test_calculator calculator( width, height, _roi_ws, _roi_hs, _roi_we - _roi_ws, _roi_he - _roi_hs, step );
+            float dims[4];
+            REQUIRE( calculator.calculate( image.data(), dims, 4 ) );
+            for( int i = 0; i < 4; ++i )
+                CHECK( std::abs( dims[i] - expected[i] ) < 0.01f );
+        } );
+}
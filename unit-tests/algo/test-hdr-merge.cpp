@@ -0,0 +1,108 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+//#cmake: static!
+
+#include <unit-tests/test.h>
+#include <unit-tests/algo/simd-levels.h>
+#include <src/proc/hdr-merge-depth.h>
+
+#include <limits>
+#include <random>
+#include <vector>
+
+using namespace librealsense;
+
+
+namespace {
+
+
+// The merges as they were
+void reference_merge( uint16_t * new_data, uint16_t const * d0, uint16_t const * d1, size_t n )
+{
+    for( size_t i = 0; i < n; i++ )
+    {
+        if( d0[i] )
+            new_data[i] = d0[i];
+        else if( d1[i] )
+            new_data[i] = d1[i];
+        else
+            new_data[i] = 0;
+    }
+}
+
+template< typename T >
+void reference_merge( uint16_t * new_data, uint16_t const * d0, uint16_t const * d1, T const * i0, T const * i1,
+                      int under, int over, size_t n )
+{
+    auto is_infrared_valid = [&]( T ir_value ) { return ( ir_value > under ) && ( ir_value < over ); };
+    for( size_t i = 0; i < n; i++ )
+    {
+        if( is_infrared_valid( i0[i] ) && d0[i] )
+            new_data[i] = d0[i];
+        else if( is_infrared_valid( i1[i] ) && d1[i] )
+            new_data[i] = d1[i];
+        else
+            new_data[i] = 0;
+    }
+}
+
+
+// Some holes, and infrared all over the range, including the thresholds and those next to them
+template< typename T >
+std::vector< T > make_data( size_t n, std::vector< T > const & specials, unsigned seed )
+{
+    std::mt19937 gen( seed );
+    std::uniform_int_distribution< int > value( 0, std::numeric_limits< T >::max() ), percent( 0, 99 );
+    std::uniform_int_distribution< size_t > special( 0, specials.size() - 1 );
+    std::vector< T > data( n );
+    for( auto & v : data )
+        v = percent( gen ) < 20 ? specials[special( gen )] : T( value( gen ) );
+    return data;
+}
+
+
+}  // namespace
+
+
+TEST_CASE( "hdr merge matches the reference" )
+{
+    // Not a multiple of any SIMD width
+    size_t const n = 848 * 3 + 7;
+    auto const d0 = make_data< uint16_t >( n, { 0 }, 1 );
+    auto const d1 = make_data< uint16_t >( n, { 0 }, 2 );
+    int const under8 = 5, over8 = 250, under16 = 20, over16 = 1003;
+    auto const ir8_0 = make_data< uint8_t >( n, { 0, 4, 5, 6, 249, 250, 251, 255 }, 3 );
+    auto const ir8_1 = make_data< uint8_t >( n, { 0, 4, 5, 6, 249, 250, 251, 255 }, 4 );
+    // 10 bits, but any 16-bit value must work
+    auto const ir16_0 = make_data< uint16_t >( n, { 0, 19, 20, 21, 500, 1002, 1003, 1004, 1023 }, 5 );
+    auto const ir16_1 = make_data< uint16_t >( n, { 0, 19, 20, 21, 500, 1002, 1003, 1004, 1023 }, 6 );
+
+    std::vector< uint16_t > expected( n ), expected_ir8( n ), expected_ir16( n );
+    reference_merge( expected.data(), d0.data(), d1.data(), n );
+    reference_merge( expected_ir8.data(), d0.data(), d1.data(), ir8_0.data(), ir8_1.data(), under8, over8, n );
+    reference_merge( expected_ir16.data(), d0.data(), d1.data(), ir16_0.data(), ir16_1.data(), under16, over16, n );
+
+    for_each_simd_level( [&]
+    {
+        std::vector< uint16_t > out( n, 0xbad );
+        hdr_merge_depth( d0.data(), d1.data(), out.data(), n );
+        CHECK( out == expected );
+
+        out.assign( n, 0xbad );
+        hdr_merge_depth( d0.data(), d1.data(), ir8_0.data(), ir8_1.data(), uint8_t( under8 ), uint8_t( over8 ),
+                         out.data(), n );
+        CHECK( out == expected_ir8 );
+
+        out.assign( n, 0xbad );
+        hdr_merge_depth( d0.data(), d1.data(), ir16_0.data(), ir16_1.data(), uint16_t( under16 ), uint16_t( over16 ),
+                         out.data(), n );
+        CHECK( out == expected_ir16 );
+
+        // In place, over the first depth
+        auto in_place = d0;
+        hdr_merge_depth( in_place.data(), d1.data(), ir8_0.data(), ir8_1.data(), uint8_t( under8 ), uint8_t( over8 ),
+                         in_place.data(), n );
+        CHECK( in_place == expected_ir8 );
+    } );
+}
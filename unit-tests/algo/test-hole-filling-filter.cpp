@@ -0,0 +1,199 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+//#cmake: static!
+
+#include <unit-tests/test.h>
+#include <unit-tests/algo/simd-levels.h>
+#include <src/proc/hole-filling-filter.h>
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <random>
+#include <vector>
+
+using namespace librealsense;
+
+
+namespace {
+
+
+// The filter as it was: a single pass, in place
+template< typename T >
+void reference_fill_left( T * image_data, size_t width, size_t height )
+{
+    std::function< bool( T * ) > fp_oper = []( T * ptr ) { return ! *( (int *)ptr ); };
+    std::function< bool( T * ) > uint_oper = []( T * ptr ) { return ! ( *ptr ); };
+    auto empty = ( std::is_floating_point< T >::value ) ? fp_oper : uint_oper;
+
+    T * p = image_data;
+    for( size_t j = 0; j < height; ++j )
+    {
+        ++p;
+        for( size_t i = 1; i < width; ++i )
+        {
+            if( empty( p ) )
+                *p = *( p - 1 );
+            ++p;
+        }
+    }
+}
+
+template< typename T >
+void reference_fill_farest( T * image_data, size_t width, size_t height )
+{
+    std::function< bool( T * ) > fp_oper = []( T * ptr ) { return ! *( (int *)ptr ); };
+    std::function< bool( T * ) > uint_oper = []( T * ptr ) { return ! ( *ptr ); };
+    auto empty = ( std::is_floating_point< T >::value ) ? fp_oper : uint_oper;
+
+    T tmp = 0;
+    T * p = image_data + width;
+    T * q = nullptr;
+    for( int j = 1; j < height - 1; ++j )
+    {
+        ++p;
+        for( size_t i = 1; i < width; ++i )
+        {
+            if( empty( p ) )
+            {
+                tmp = *( p - width );
+                q = p - width - 1;
+                if( *q > tmp )
+                    tmp = *q;
+                q = p - 1;
+                if( *q > tmp )
+                    tmp = *q;
+                q = p + width - 1;
+                if( *q > tmp )
+                    tmp = *q;
+                q = p + width;
+                if( *q > tmp )
+                    tmp = *q;
+                *p = tmp;
+            }
+            p++;
+        }
+    }
+}
+
+template< typename T >
+void reference_fill_nearest( T * image_data, size_t width, size_t height )
+{
+    std::function< bool( T * ) > fp_oper = []( T * ptr ) { return ! *( (int *)ptr ); };
+    std::function< bool( T * ) > uint_oper = []( T * ptr ) { return ! ( *ptr ); };
+    auto empty = ( std::is_floating_point< T >::value ) ? fp_oper : uint_oper;
+
+    T tmp = 0;
+    T * p = image_data + width;
+    T * q = nullptr;
+    for( int j = 1; j < height - 1; ++j )
+    {
+        ++p;
+        for( size_t i = 1; i < width; ++i )
+        {
+            if( empty( p ) )
+            {
+                tmp = *( p - width );
+                q = p - width - 1;
+                if( ! empty( q ) && ( *q < tmp ) )
+                    tmp = *q;
+                q = p - 1;
+                if( ! empty( q ) && ( *q < tmp ) )
+                    tmp = *q;
+                q = p + width - 1;
+                if( ! empty( q ) && ( *q < tmp ) )
+                    tmp = *q;
+                q = p + width;
+                if( ! empty( q ) && ( *q < tmp ) )
+                    tmp = *q;
+                *p = tmp;
+            }
+            p++;
+        }
+    }
+}
+
+
+// Values with holes: single ones, runs along rows, and blocks spanning rows
+template< typename T >
+std::vector< T > make_frame( size_t w, size_t h, T max_value )
+{
+    std::mt19937 gen( 1234 );
+    std::uniform_real_distribution< double > value( 0.01, 1. );
+    std::uniform_int_distribution< int > percent( 0, 99 );
+    std::vector< T > frame( w * h );
+    for( auto & v : frame )
+        v = percent( gen ) < 10 ? T( 0 ) : T( value( gen ) * max_value );
+
+    std::uniform_int_distribution< size_t > x( 0, w - 1 ), y( 0, h - 1 ), length( 1, 40 );
+    for( size_t n = 0; n < w * h / 100; ++n )
+    {
+        size_t const row = y( gen ), col = x( gen ), run = length( gen );
+        for( size_t i = col; i < std::min( w, col + run ); ++i )
+            frame[row * w + i] = 0;
+    }
+    for( size_t n = 0; n < w * h / 2000; ++n )
+    {
+        size_t const row = y( gen ), col = x( gen ), size = length( gen );
+        for( size_t j = row; j < std::min( h, row + size ); ++j )
+            for( size_t i = col; i < std::min( w, col + size ); ++i )
+                frame[j * w + i] = 0;
+    }
+    return frame;
+}
+
+
+template< typename T >
+void check_matches_reference( size_t w, size_t h, T max_value )
+{
+    auto const in = make_frame< T >( w, h, max_value );
+    row_bands one_band( 1 ), bands( 3 );
+
+    for( uint8_t mode = hf_fill_from_left; mode < hf_max_value; ++mode )
+    {
+        CAPTURE( int( mode ) );
+        auto expected = in;
+        if( mode == hf_fill_from_left )
+            reference_fill_left( expected.data(), w, h );
+        else if( mode == hf_farest_from_around )
+            reference_fill_farest( expected.data(), w, h );
+        else
+            reference_fill_nearest( expected.data(), w, h );
+
+        for_each_simd_level( [&]
+        {
+            for( auto b : { &one_band, &bands } )
+            {
+                CAPTURE( b->get_max_bands() );
+                // Compare the bits
+                std::vector< T > out( in.size(), T( 1 ) );
+                hole_fill( *b, mode, in.data(), out.data(), w, h );
+                CHECK( std::memcmp( out.data(), expected.data(), in.size() * sizeof( T ) ) == 0 );
+
+                auto in_place = in;
+                hole_fill( *b, mode, in_place.data(), in_place.data(), w, h );
+                CHECK( std::memcmp( in_place.data(), expected.data(), in.size() * sizeof( T ) ) == 0 );
+            }
+        } );
+    }
+}
+
+
+}  // namespace
+
+
+TEST_CASE( "hole filling matches the reference in all modes, depth" )
+{
+    // Wider than a wavefront step; and rows not a multiple of the SIMD width
+    check_matches_reference< uint16_t >( 848, 100, 65535 );
+    check_matches_reference< uint16_t >( 101, 67, 65535 );
+    check_matches_reference< uint16_t >( 3, 3, 65535 );
+}
+
+TEST_CASE( "hole filling matches the reference in all modes, disparity" )
+{
+    check_matches_reference< float >( 848, 100, 200.f );
+    check_matches_reference< float >( 101, 67, 200.f );
+    check_matches_reference< float >( 3, 3, 200.f );
+}
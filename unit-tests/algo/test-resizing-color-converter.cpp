@@ -0,0 +1,205 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+//#cmake: static!
+
+#include <unit-tests/test.h>
+#include <unit-tests/algo/simd-levels.h>
+#include <src/image.h>
+#include <src/proc/resizing-color-converter.h>
+#include <src/proc/color-formats-converter.h>
+#include <src/proc/y411-converter.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+using namespace librealsense;
+
+
+namespace {
+
+
+size_t input_size( rs2_format format, int w, int h )
+{
+    return format == RS2_FORMAT_M420 || format == RS2_FORMAT_Y411 ? size_t( w ) * h * 3 / 2 : size_t( w ) * h * 2;
+}
+
+
+std::vector< uint8_t > make_input( rs2_format format, int w, int h )
+{
+    std::mt19937 gen( 1234 );
+    std::uniform_int_distribution< int > byte( 0, 255 );
+    std::vector< uint8_t > in( input_size( format, w, h ) );
+    for( auto & b : in )
+        b = uint8_t( byte( gen ) );
+    return in;
+}
+
+
+// The whole frame converted at full resolution, as the converters do
+std::vector< uint8_t > convert( rs2_format source, rs2_format target, std::vector< uint8_t > const & in, int w, int h )
+{
+    int const bpp = get_image_bpp( target ) / 8;
+    std::vector< uint8_t > out( size_t( w ) * h * bpp );
+    uint8_t * const d[] = { out.data() };
+    switch( source )
+    {
+    case RS2_FORMAT_YUYV: unpack_yuy2( target, RS2_STREAM_COLOR, d, in.data(), w, h, int( out.size() ) ); break;
+    case RS2_FORMAT_UYVY: unpack_uyvyc( target, RS2_STREAM_COLOR, d, in.data(), w, h, int( out.size() ) ); break;
+    case RS2_FORMAT_M420: unpack_m420( target, RS2_STREAM_COLOR, d, in.data(), w, h, int( out.size() ) ); break;
+    case RS2_FORMAT_Y411: unpack_y411( d, in.data(), w, h, int( out.size() ) ); break;
+    default: break;
+    }
+    return out;
+}
+
+
+// The mean of the box of each output pixel, rounded to nearest
+std::vector< uint8_t > reference_box( std::vector< uint8_t > const & rgb, int bpp, int w, int h, int w_out, int h_out )
+{
+    std::vector< uint8_t > out( size_t( w_out ) * h_out * bpp );
+    for( int y = 0; y < h_out; ++y )
+    {
+        int const r0 = int( int64_t( y ) * h / h_out );
+        int const r1 = std::max( r0 + 1, int( int64_t( y + 1 ) * h / h_out ) );
+        for( int x = 0; x < w_out; ++x )
+        {
+            int const c0 = int( int64_t( x ) * w / w_out );
+            int const c1 = std::max( c0 + 1, int( int64_t( x + 1 ) * w / w_out ) );
+            int const area = ( r1 - r0 ) * ( c1 - c0 );
+            for( int c = 0; c < bpp; ++c )
+            {
+                int sum = 0;
+                for( int r = r0; r < r1; ++r )
+                    for( int k = c0; k < c1; ++k )
+                        sum += rgb[( size_t( r ) * w + k ) * bpp + c];
+                out[( size_t( y ) * w_out + x ) * bpp + c] = uint8_t( ( sum + area / 2 ) / area );
+            }
+        }
+    }
+    return out;
+}
+
+
+// ( i + 0.5 ) * n_in / n_out - 0.5, in 1/256 of a pixel, rounded and clamped to the input
+int center( int i, int n_in, int n_out )
+{
+    int64_t const t = ( ( 2 * int64_t( i ) + 1 ) * n_in * 256 + n_out ) / ( 2 * int64_t( n_out ) ) - 128;
+    return int( std::min( std::max( t, int64_t( 0 ) ), int64_t( n_in - 1 ) * 256 ) );
+}
+
+
+std::vector< uint8_t > reference_bilinear( std::vector< uint8_t > const & rgb, int bpp, int w, int h, int w_out,
+                                           int h_out )
+{
+    std::vector< uint8_t > out( size_t( w_out ) * h_out * bpp );
+    for( int y = 0; y < h_out; ++y )
+    {
+        int const ty = center( y, h, h_out );
+        int const r0 = ty / 256, r1 = std::min( r0 + 1, h - 1 ), wy = ty % 256;
+        for( int x = 0; x < w_out; ++x )
+        {
+            int const tx = center( x, w, w_out );
+            int const c0 = tx / 256, c1 = std::min( c0 + 1, w - 1 ), wx = tx % 256;
+            for( int c = 0; c < bpp; ++c )
+            {
+                auto const at = [&]( int r, int k ) { return int( rgb[( size_t( r ) * w + k ) * bpp + c] ); };
+                int const left = at( r0, c0 ) * ( 256 - wy ) + at( r1, c0 ) * wy;
+                int const right = at( r0, c1 ) * ( 256 - wy ) + at( r1, c1 ) * wy;
+                out[( size_t( y ) * w_out + x ) * bpp + c]
+                    = uint8_t( ( left * ( 256 - wx ) + right * wx + 32768 ) >> 16 );
+            }
+        }
+    }
+    return out;
+}
+
+
+void check_matches_reference( rs2_format source, rs2_format target, int w, int h, uint8_t filter, int w_out,
+                              int h_out )
+{
+    CAPTURE( rs2_format_to_string( source ), rs2_format_to_string( target ), w, h, int( filter ), w_out, h_out );
+    auto const in = make_input( source, w, h );
+    int const bpp = get_image_bpp( target ) / 8;
+    row_bands bands( 3 );
+    std::vector< std::vector< uint8_t > > buffers;
+
+    for_each_simd_level( [&]
+    {
+        auto const rgb = convert( source, target, in, w, h );
+        auto const expected = filter == rf_box ? reference_box( rgb, bpp, w, h, w_out, h_out )
+                                               : reference_bilinear( rgb, bpp, w, h, w_out, h_out );
+
+        std::vector< uint8_t > out( expected.size(), 0xba );
+        resize_color_params params = { source, target, filter, in.data(), w, h, out.data(), w_out, h_out };
+        resize_color( bands, buffers, params );
+        CHECK( out == expected );
+    } );
+}
+
+
+}  // namespace
+
+
+TEST_CASE( "resizing color converter boxes match the reference" )
+{
+    for( int scale = 2; scale <= 4; ++scale )
+    {
+        check_matches_reference( RS2_FORMAT_YUYV, RS2_FORMAT_RGB8, 64, 48, rf_box, 64 / scale, 48 / scale );
+        // Four rows to a conversion
+        check_matches_reference( RS2_FORMAT_YUYV, RS2_FORMAT_BGR8, 424, 240, rf_box, 424 / scale, 240 / scale );
+    }
+    check_matches_reference( RS2_FORMAT_UYVY, RS2_FORMAT_BGRA8, 320, 180, rf_box, 160, 90 );
+    check_matches_reference( RS2_FORMAT_M420, RS2_FORMAT_RGBA8, 640, 480, rf_box, 160, 120 );
+    check_matches_reference( RS2_FORMAT_Y411, RS2_FORMAT_RGB8, 320, 240, rf_box, 106, 80 );
+    // Boxes of different sizes
+    check_matches_reference( RS2_FORMAT_YUYV, RS2_FORMAT_RGB8, 424, 240, rf_box, 100, 57 );
+    check_matches_reference( RS2_FORMAT_M420, RS2_FORMAT_RGB8, 320, 240, rf_box, 319, 239 );
+    // Boxes a single column wide
+    check_matches_reference( RS2_FORMAT_YUYV, RS2_FORMAT_RGBA8, 64, 48, rf_box, 64, 24 );
+    check_matches_reference( RS2_FORMAT_YUYV, RS2_FORMAT_RGB8, 64, 48, rf_box, 64, 16 );
+    // Three columns wide, four values to a pixel
+    check_matches_reference( RS2_FORMAT_UYVY, RS2_FORMAT_RGBA8, 96, 48, rf_box, 32, 16 );
+    // More rows to a box than 16-bit sums can take
+    check_matches_reference( RS2_FORMAT_YUYV, RS2_FORMAT_RGB8, 64, 600, rf_box, 16, 2 );
+    // Rows that cannot be split into conversions: converted all at once
+    check_matches_reference( RS2_FORMAT_YUYV, RS2_FORMAT_RGB8, 24, 6, rf_box, 12, 3 );
+}
+
+TEST_CASE( "resizing color converter interpolates as the reference" )
+{
+    check_matches_reference( RS2_FORMAT_YUYV, RS2_FORMAT_RGB8, 64, 48, rf_bilinear, 32, 24 );
+    check_matches_reference( RS2_FORMAT_YUYV, RS2_FORMAT_RGBA8, 424, 240, rf_bilinear, 100, 57 );
+    check_matches_reference( RS2_FORMAT_UYVY, RS2_FORMAT_BGR8, 320, 180, rf_bilinear, 213, 120 );
+    check_matches_reference( RS2_FORMAT_M420, RS2_FORMAT_BGRA8, 640, 480, rf_bilinear, 333, 250 );
+    check_matches_reference( RS2_FORMAT_Y411, RS2_FORMAT_RGB8, 320, 240, rf_bilinear, 80, 60 );
+    // The same size: a copy
+    check_matches_reference( RS2_FORMAT_YUYV, RS2_FORMAT_RGB8, 64, 48, rf_bilinear, 64, 48 );
+}
+
+TEST_CASE( "resizing color converter keeps a single color" )
+{
+    // Black in YUYV (Y 16, U and V 128) stays black at any size, with either filter
+    std::vector< uint8_t > in( 320 * 240 * 2 );
+    for( size_t i = 0; i < in.size(); i += 2 )
+    {
+        in[i] = 16;
+        in[i + 1] = 128;
+    }
+    row_bands bands( 1 );
+    std::vector< std::vector< uint8_t > > buffers;
+    for( uint8_t filter : { uint8_t( rf_box ), uint8_t( rf_bilinear ) } )
+    {
+        std::vector< uint8_t > out( 77 * 31 * 4, 0xba );
+        resize_color_params params = { RS2_FORMAT_YUYV, RS2_FORMAT_RGBA8, filter, in.data(), 320, 240, out.data(), 77, 31 };
+        resize_color( bands, buffers, params );
+        for( size_t i = 0; i < out.size(); i += 4 )
+        {
+            CHECK( out[i] == 0 );
+            CHECK( out[i + 1] == 0 );
+            CHECK( out[i + 2] == 0 );
+            CHECK( out[i + 3] == 255 );
+        }
+    }
+}
@@ -0,0 +1,276 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+//#cmake: static!
+
+#include <unit-tests/test.h>
+#include <unit-tests/algo/simd-levels.h>
+#include <src/proc/color-formats-converter.h>
+#include <src/proc/y411-converter.h>
+#include <librealsense2/hpp/rs_internal.hpp>
+#include <librealsense2/hpp/rs_processing.hpp>
+
+#include <cmath>
+#include <cstdlib>
+#include <functional>
+#include <vector>
+
+using namespace librealsense;
+
+
+namespace {
+
+
+typedef std::function< void( uint8_t * const d[], const uint8_t * s, int w, int h ) > conversion;
+
+
+std::vector< uint8_t > random_bytes( size_t size )
+{
+    std::vector< uint8_t > bytes( size );
+    std::srand( 1234 );
+    for( auto & b : bytes )
+        b = uint8_t( std::rand() );
+    return bytes;
+}
+
+
+// The SIMD kernels approximate the generic fixed-point math with 16-bit multiplies; they may differ by a little
+void check_levels_match( conversion const & convert,
+                         int w,
+                         int h,
+                         size_t in_bpp_x2,
+                         size_t out_bpp,
+                         int tolerance = 2 )
+{
+    simd_level_guard guard;
+    auto const in = random_bytes( w * h * in_bpp_x2 / 2 );
+
+    std::vector< uint8_t > expected( w * h * out_bpp );
+    uint8_t * d[] = { expected.data() };
+    set_simd_level( RS2_SIMD_LEVEL_GENERIC );
+    convert( d, in.data(), w, h );
+
+    for_each_simd_level( rs2_simd_level( RS2_SIMD_LEVEL_GENERIC + 1 ), [&]
+    {
+        std::vector< uint8_t > actual( expected.size() );
+        d[0] = actual.data();
+        convert( d, in.data(), w, h );
+        int max_diff = 0;
+        for( size_t i = 0; i < actual.size(); ++i )
+            max_diff = std::max( max_diff, std::abs( int( actual[i] ) - int( expected[i] ) ) );
+        CHECK( max_diff <= tolerance );
+    } );
+}
+
+
+conversion yuy2( rs2_format format )
+{
+    return [format]( uint8_t * const d[], const uint8_t * s, int w, int h )
+    {
+        unpack_yuy2( format, RS2_STREAM_COLOR, d, s, w, h, 0 );
+    };
+}
+
+conversion uyvy( rs2_format format )
+{
+    return [format]( uint8_t * const d[], const uint8_t * s, int w, int h )
+    {
+        unpack_uyvyc( format, RS2_STREAM_COLOR, d, s, w, h, 0 );
+    };
+}
+
+conversion m420( rs2_format format )
+{
+    return [format]( uint8_t * const d[], const uint8_t * s, int w, int h )
+    {
+        unpack_m420( format, RS2_STREAM_COLOR, d, s, w, h, 0 );
+    };
+}
+
+
+// A depth frame of a slanted wall (with holes) and a color frame of gradients it aligns to, from a software device.
+// Both change slowly from one pixel to the next, so a pixel mapped one over still has about the same value.
+struct depth_and_color
+{
+    static int const depth_w = 640, depth_h = 480, color_w = 1280, color_h = 720;
+
+    std::vector< uint16_t > depth_pixels = std::vector< uint16_t >( depth_w * depth_h );
+    std::vector< uint8_t > color_pixels = std::vector< uint8_t >( color_w * color_h * 3 );
+    rs2::software_device dev;
+    rs2::frame depth, color;
+    rs2::frameset frames;
+
+    depth_and_color()
+    {
+        for( int y = 0; y < depth_h; ++y )
+            for( int x = 0; x < depth_w; ++x )
+                depth_pixels[y * depth_w + x] = ( x / 16 + y / 16 ) % 7 ? uint16_t( 1000 + x + y / 2 ) : 0;
+        for( int y = 0; y < color_h; ++y )
+            for( int x = 0; x < color_w; ++x )
+            {
+                auto rgb = &color_pixels[( y * color_w + x ) * 3];
+                rgb[0] = uint8_t( x / 5 );
+                rgb[1] = uint8_t( y / 3 );
+                rgb[2] = uint8_t( ( x + y ) / 8 );
+            }
+
+        auto sensor = dev.add_sensor( "Camera" );
+        rs2_intrinsics depth_intrinsics
+            = { depth_w, depth_h, 320.5f, 239.5f, 385.f, 385.f, RS2_DISTORTION_BROWN_CONRADY, { 0, 0, 0, 0, 0 } };
+        rs2_intrinsics color_intrinsics = { color_w, color_h, 641.f, 362.f, 910.f, 908.f,
+                                            RS2_DISTORTION_MODIFIED_BROWN_CONRADY, { -0.05f, 0.06f, 0.001f, -0.001f, -0.02f } };
+        auto depth_profile = sensor.add_video_stream(
+            { RS2_STREAM_DEPTH, 0, 0, depth_w, depth_h, 30, 2, RS2_FORMAT_Z16, depth_intrinsics } );
+        auto color_profile = sensor.add_video_stream(
+            { RS2_STREAM_COLOR, 0, 1, color_w, color_h, 30, 3, RS2_FORMAT_RGB8, color_intrinsics } );
+        depth_profile.register_extrinsics_to( color_profile, { { 1, 0, 0, 0, 1, 0, 0, 0, 1 }, { 0.015f, 0.f, 0.001f } } );
+        sensor.add_read_only_option( RS2_OPTION_DEPTH_UNITS, 0.001f );
+
+        sensor.open( { depth_profile, color_profile } );
+        sensor.start( [this]( rs2::frame f ) { ( f.get_profile().stream_type() == RS2_STREAM_DEPTH ? depth : color ) = f; } );
+        sensor.on_video_frame( { depth_pixels.data(), []( void * ) {}, depth_w * 2, 2, 0., RS2_TIMESTAMP_DOMAIN_HARDWARE_CLOCK,
+                                 1, depth_profile, 0.001f } );
+        sensor.on_video_frame( { color_pixels.data(), []( void * ) {}, color_w * 3, 3, 0., RS2_TIMESTAMP_DOMAIN_HARDWARE_CLOCK,
+                                 1, color_profile } );
+        sensor.stop();
+
+        rs2::filter combine( [this]( rs2::frame f, rs2::frame_source & source )
+                             { source.frame_ready( source.allocate_composite_frame( { f, color } ) ); } );
+        frames = combine.process( depth );
+    }
+};
+
+
+// The fraction of elements that differ by more than 'tolerance'
+template< class T >
+double mismatch_ratio( T const * expected, T const * actual, size_t n, double tolerance )
+{
+    size_t n_mismatches = 0;
+    for( size_t i = 0; i < n; ++i )
+        if( std::abs( double( actual[i] ) - double( expected[i] ) ) > tolerance )
+            ++n_mismatches;
+    return double( n_mismatches ) / n;
+}
+
+
+}  // namespace
+
+
+TEST_CASE( "simd level" )
+{
+    simd_level_guard guard;
+    auto const supported = get_supported_simd_level();
+    test::log.d( "supported SIMD level:", get_string( supported ) );
+
+    CHECK( set_simd_level( RS2_SIMD_LEVEL_GENERIC ) == RS2_SIMD_LEVEL_GENERIC );
+    CHECK( get_simd_level() == RS2_SIMD_LEVEL_GENERIC );
+    // Cannot go above what the CPU supports
+    CHECK( set_simd_level( RS2_SIMD_LEVEL_AVX2 ) == supported );
+    CHECK( get_simd_level() == supported );
+}
+
+TEST_CASE( "simd_kernel picks the highest implementation up to the level" )
+{
+    typedef int ( *fn )();
+    auto const kernel = simd_kernel< fn >( [] { return 0; } ).add( RS2_SIMD_LEVEL_SSSE3, [] { return 1; } );
+    CHECK( kernel.get( RS2_SIMD_LEVEL_GENERIC )() == 0 );
+    CHECK( kernel.get( RS2_SIMD_LEVEL_SSSE3 )() == 1 );
+    CHECK( kernel.get( RS2_SIMD_LEVEL_AVX2 )() == 1 );
+}
+
+TEST_CASE( "YUY2 conversions match at all levels" )
+{
+    // 16x2 pixels is not a multiple of 32, so AVX2 falls back to SSSE3
+    for( int w : { 640, 16 } )
+    {
+        CAPTURE( w );
+        int const h = w == 16 ? 3 : 480;
+        check_levels_match( yuy2( RS2_FORMAT_Y8 ), w, h, 4, 1 );
+        check_levels_match( yuy2( RS2_FORMAT_Y16 ), w, h, 4, 2 );
+        check_levels_match( yuy2( RS2_FORMAT_RGB8 ), w, h, 4, 3 );
+        check_levels_match( yuy2( RS2_FORMAT_RGBA8 ), w, h, 4, 4 );
+        check_levels_match( yuy2( RS2_FORMAT_BGR8 ), w, h, 4, 3 );
+        check_levels_match( yuy2( RS2_FORMAT_BGRA8 ), w, h, 4, 4 );
+    }
+}
+
+TEST_CASE( "UYVY conversions match at all levels" )
+{
+    check_levels_match( uyvy( RS2_FORMAT_RGB8 ), 640, 480, 4, 3 );
+    check_levels_match( uyvy( RS2_FORMAT_RGBA8 ), 640, 480, 4, 4 );
+    check_levels_match( uyvy( RS2_FORMAT_BGR8 ), 640, 480, 4, 3 );
+    check_levels_match( uyvy( RS2_FORMAT_BGRA8 ), 640, 480, 4, 4 );
+}
+
+TEST_CASE( "M420 conversions match at all levels" )
+{
+    check_levels_match( m420( RS2_FORMAT_Y8 ), 640, 480, 3, 1 );
+    check_levels_match( m420( RS2_FORMAT_Y16 ), 640, 480, 3, 2 );
+    check_levels_match( m420( RS2_FORMAT_RGB8 ), 640, 480, 3, 3 );
+    check_levels_match( m420( RS2_FORMAT_RGBA8 ), 640, 480, 3, 4 );
+    check_levels_match( m420( RS2_FORMAT_BGR8 ), 640, 480, 3, 3 );
+    check_levels_match( m420( RS2_FORMAT_BGRA8 ), 640, 480, 3, 4 );
+}
+
+TEST_CASE( "Y411 conversion matches at all levels" )
+{
+    check_levels_match(
+        []( uint8_t * const d[], const uint8_t * s, int w, int h ) { unpack_y411( d, s, w, h, 0 ); },
+        640, 480, 3, 3 );
+}
+
+// The SSE align is not the generic one vectorized: it rounds the corners of each depth pixel's footprint where the
+// generic truncates them, at some resolutions it takes a single corner rather than the whole footprint, and it clips
+// footprints at the border instead of dropping them. So pixels may come from a neighbor (about the same value here),
+// and a few around the holes and the borders may be filled by one and not the other.
+TEST_CASE( "align matches at all levels" )
+{
+    simd_level_guard guard;
+    depth_and_color const in;
+    REQUIRE( in.frames.size() == 2 );
+
+    for( rs2_stream to : { RS2_STREAM_COLOR, RS2_STREAM_DEPTH } )
+    {
+        CAPTURE( to );
+        set_simd_level( RS2_SIMD_LEVEL_GENERIC );
+        auto const expected = rs2::align( to ).process( in.frames ).first( to == RS2_STREAM_COLOR ? RS2_STREAM_DEPTH
+                                                                                                    : RS2_STREAM_COLOR );
+        for_each_simd_level( rs2_simd_level( RS2_SIMD_LEVEL_GENERIC + 1 ), [&]
+        {
+            auto const actual = rs2::align( to ).process( in.frames ).first( expected.get_profile().stream_type() );
+            REQUIRE( actual.get_data_size() == expected.get_data_size() );
+            if( to == RS2_STREAM_COLOR )
+                CHECK( mismatch_ratio( (uint16_t const *)expected.get_data(), (uint16_t const *)actual.get_data(),
+                                       expected.get_data_size() / 2, 3 ) < 0.02 );
+            else
+                CHECK( mismatch_ratio( (uint8_t const *)expected.get_data(), (uint8_t const *)actual.get_data(),
+                                       expected.get_data_size(), 2 ) < 0.02 );
+        } );
+    }
+}
+
+TEST_CASE( "pointcloud matches at all levels" )
+{
+    simd_level_guard guard;
+    depth_and_color const in;
+
+    set_simd_level( RS2_SIMD_LEVEL_GENERIC );
+    rs2::pointcloud generic;
+    generic.map_to( in.color );
+    rs2::points const expected = generic.calculate( in.depth );
+    size_t const n = expected.size();
+    auto const expected_xyz = (float const *)expected.get_vertices();
+    auto const expected_uv = (float const *)expected.get_texture_coordinates();
+
+    for_each_simd_level( rs2_simd_level( RS2_SIMD_LEVEL_GENERIC + 1 ), [&]
+    {
+        rs2::pointcloud pc;
+        pc.map_to( in.color );
+        rs2::points const actual = pc.calculate( in.depth );
+        REQUIRE( actual.size() == n );
+        // Vertices within a micrometer; texture coordinates within a hundredth of a color pixel
+        CHECK( mismatch_ratio( expected_xyz, (float const *)actual.get_vertices(), n * 3, 1e-6 ) == 0 );
+        CHECK( mismatch_ratio( expected_uv, (float const *)actual.get_texture_coordinates(), n * 2, 0.01 / 1280 )
+               == 0 );
+    } );
+}
@@ -0,0 +1,230 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+//#cmake: static!
+
+#include <unit-tests/test.h>
+#include <unit-tests/algo/simd-levels.h>
+#include <src/proc/temporal-filter.h>
+
+#include <cmath>
+#include <cstring>
+#include <random>
+#include <vector>
+
+using namespace librealsense;
+
+
+namespace {
+
+
+// Consecutive frames of a noisy scene, with holes coming and going, and some edges that move
+template< class T >
+std::vector< std::vector< T > > make_frames( size_t n, size_t n_frames, T scale )
+{
+    std::mt19937 gen( 1234 );
+    std::uniform_int_distribution< int > base( 300, 3000 );
+    std::uniform_int_distribution< int > noise( -30, 30 );
+    std::uniform_int_distribution< int > percent( 0, 99 );
+    std::vector< int > scene( n );
+    for( auto & z : scene )
+        z = base( gen );
+
+    std::vector< std::vector< T > > frames( n_frames, std::vector< T >( n ) );
+    for( auto & frame : frames )
+        for( size_t i = 0; i < n; ++i )
+        {
+            auto const p = percent( gen );
+            if( p < 30 )
+                frame[i] = 0;
+            else if( p < 35 )
+                frame[i] = T( base( gen ) ) / scale;
+            else
+                frame[i] = T( scene[i] + noise( gen ) ) / scale;
+        }
+    return frames;
+}
+
+
+// The filter as it was, pixel by pixel, with a full-resolution history
+template< class T >
+void reference_smooth( T * frame, T * last_frame, uint8_t * history, size_t n, uint8_t persistence, float alpha,
+                       uint8_t delta, size_t frame_index )
+{
+    auto const persistence_map = calc_persistence_map( persistence );
+    T delta_z = static_cast< T >( delta );
+    unsigned char mask = 1 << frame_index;
+    float one_minus_alpha = 1.f - alpha;
+    for( size_t i = 0; i < n; i++ )
+    {
+        T cur_val = frame[i];
+        T prev_val = last_frame[i];
+        if( cur_val )
+        {
+            if( ! prev_val )
+            {
+                last_frame[i] = cur_val;
+                history[i] = mask;
+            }
+            else
+            {
+                T diff = static_cast< T >( fabs( cur_val - prev_val ) );
+                if( diff < delta_z )
+                {
+                    history[i] |= mask;
+                    float filtered = alpha * cur_val + one_minus_alpha * prev_val;
+                    T result = static_cast< T >( filtered );
+                    frame[i] = result;
+                    last_frame[i] = result;
+                }
+                else
+                {
+                    last_frame[i] = cur_val;
+                    history[i] = mask;
+                }
+            }
+        }
+        else
+        {
+            if( prev_val && ( persistence_map[history[i]] & mask ) )
+                frame[i] = prev_val;
+            history[i] &= ~mask;
+        }
+    }
+}
+
+
+temporal_smooth_params make_params( uint8_t persistence, float alpha, uint8_t delta, size_t frame_index, bool half )
+{
+    auto const persistence_map = calc_persistence_map( persistence );
+    temporal_smooth_params params;
+    params.alpha = alpha;
+    params.delta = delta;
+    params.mask = uint8_t( 1 << frame_index );
+    params.half_resolution_history = half;
+    std::memset( params.credible, 0, sizeof( params.credible ) );
+    for( size_t h = 0; h < persistence_map.size(); ++h )
+        if( persistence_map[h] & params.mask )
+            params.credible[h >> 3] |= 1 << ( h & 7 );
+    return params;
+}
+
+
+// Runs the frames through the filter at the current SIMD level; returns the outputs, followed by the last values
+template< class T >
+std::vector< std::vector< T > > smooth( std::vector< std::vector< T > > const & frames, size_t w, size_t h,
+                                        uint8_t persistence, bool half, row_bands & bands )
+{
+    size_t const n = w * h;
+    std::vector< std::vector< T > > outputs;
+    std::vector< T > last( n );
+    std::vector< uint8_t > history( half ? ( n + 1 ) / 2 : n );
+    for( size_t f = 0; f < frames.size(); ++f )
+    {
+        std::vector< T > out( n );
+        temporal_smooth( bands, frames[f].data(), out.data(), last.data(), history.data(), w, h,
+                         make_params( persistence, 0.4f, 20, f % 8, half ) );
+        outputs.push_back( std::move( out ) );
+    }
+    outputs.push_back( last );
+    return outputs;
+}
+
+
+template< class T >
+void check_matches_reference( size_t w, size_t h, T scale )
+{
+    size_t const n = w * h;
+    auto const frames = make_frames< T >( n, 20, scale );
+    row_bands bands( 3 );
+
+    for( uint8_t persistence = 0; persistence <= 8; ++persistence )
+    {
+        CAPTURE( int( persistence ) );
+        std::vector< std::vector< T > > expected;
+        std::vector< T > last( n );
+        std::vector< uint8_t > history( n );
+        for( size_t f = 0; f < frames.size(); ++f )
+        {
+            auto frame = frames[f];
+            reference_smooth( frame.data(), last.data(), history.data(), n, persistence, 0.4f, 20, f % 8 );
+            expected.push_back( std::move( frame ) );
+        }
+        expected.push_back( last );
+
+        std::vector< std::vector< T > > expected_half;
+        for_each_simd_level( [&]
+        {
+            // Compare the bits: NaNs and the sign of zeros, too
+            auto const actual = smooth( frames, w, h, persistence, false, bands );
+            for( size_t f = 0; f < expected.size(); ++f )
+            {
+                CAPTURE( f );
+                CHECK( std::memcmp( actual[f].data(), expected[f].data(), n * sizeof( T ) ) == 0 );
+            }
+
+            // No reference for a half-resolution history: all levels must agree with the generic one
+            auto const half = smooth( frames, w, h, persistence, true, bands );
+            if( expected_half.empty() )
+                expected_half = half;
+            for( size_t f = 0; f < expected_half.size(); ++f )
+            {
+                CAPTURE( f );
+                CHECK( std::memcmp( half[f].data(), expected_half[f].data(), n * sizeof( T ) ) == 0 );
+            }
+        } );
+    }
+}
+
+
+}  // namespace
+
+
+TEST_CASE( "temporal filter matches the reference in all persistence modes, depth" )
+{
+    // Widths that are not a multiple of the SIMD width, odd, and an odd number of rows per band
+    check_matches_reference< uint16_t >( 640, 96, 1 );
+    check_matches_reference< uint16_t >( 101, 67, 1 );
+}
+
+TEST_CASE( "temporal filter matches the reference in all persistence modes, disparity" )
+{
+    check_matches_reference< float >( 640, 96, 32.f );
+    check_matches_reference< float >( 101, 67, 32.f );
+}
+
+TEST_CASE( "half-resolution history fills holes of credible pairs" )
+{
+    // Two pixels sharing a history: one always valid, the other only at first
+    size_t const w = 2, h = 1;
+    row_bands bands( 1 );
+    std::vector< uint16_t > last( 2 );
+    std::vector< uint8_t > history( 1 );
+    uint16_t const valid[] = { 1000, 1000 };
+    uint16_t const hole[] = { 1000, 0 };
+    uint16_t out[2];
+    for( size_t f = 0; f < 8; ++f )
+    {
+        // Mode 3: valid in 2 of the last 4
+        temporal_smooth( bands, f < 2 ? valid : hole, out, last.data(), history.data(), w, h,
+                         make_params( 3, 0.4f, 20, f, true ) );
+        CHECK( out[1] == 1000 );
+    }
+}
+
+TEST_CASE( "row_bands covers all rows once" )
+{
+    row_bands bands( 4 );
+    for( size_t rows : { 0, 1, 31, 64, 130, 1000 } )
+    {
+        CAPTURE( rows );
+        std::vector< int > count( rows );
+        bands.run( rows, 16, [&]( size_t first, size_t end )
+        {
+            for( size_t row = first; row < end; ++row )
+                ++count[row];
+        } );
+        for( auto c : count )
+            CHECK( c == 1 );
+    }
+}
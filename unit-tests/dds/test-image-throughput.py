@@ -0,0 +1,85 @@
+# License: Apache 2.0. See LICENSE file in root directory.
+# Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#test:donotrun:!dds
+
+import pyrealdds as dds
+from rspy import log, test
+import threading
+import time
+
+dds.debug( log.is_debug_on(), 'C  ' )
+log.nested = 'C  '
+
+
+# Writer and reader on the same (loopback) participant: this measures the cost of the image publish path itself
+participant = dds.participant()
+participant.init( 123, "test-image-throughput" )
+
+width, height, bpp = 1280, 720, 2
+n_images = 200
+
+topic = dds.message.image.create_topic( participant, 'throughput/image' )
+
+n_received = 0
+n_bytes = 0
+received = threading.Semaphore( 0 )
+def on_data_available( reader ):
+    global n_received, n_bytes
+    while True:
+        image = dds.message.image.take_next( reader )
+        if not image:
+            break
+        n_received += 1
+        n_bytes += len( image.data )
+        received.release()
+
+reader = dds.topic_reader( topic )
+reader.on_data_available( on_data_available )
+reader.run( dds.topic_reader.qos() )
+
+n_readers = 0
+def on_publication_matched( writer, d_readers ):
+    global n_readers
+    n_readers += d_readers
+
+writer = dds.topic_writer( topic )
+writer.on_publication_matched( on_publication_matched )
+writer.run( dds.topic_writer.qos() )
+for _ in range( 12 ):
+    if n_readers:
+        break
+    time.sleep( 0.25 )
+
+
+with test.closure( 'publish images' ):
+    test.check( n_readers > 0, on_fail=test.ABORT )
+    image = dds.message.image()
+    image.width = width
+    image.height = height
+    image.step = width * bpp
+    image.encoding = '16UC1'
+    image.data = bytearray( width * height * bpp )
+
+    # One image at a time, so none are dropped (the default history depth is 1)
+    publishing = 0.
+    start = time.perf_counter()
+    for i in range( n_images ):
+        image.timestamp = dds.now()
+        t = time.perf_counter()
+        image.write_to( writer )
+        publishing += time.perf_counter() - t
+        if not received.acquire( timeout=5 ):
+            break
+    total = time.perf_counter() - start
+
+    mb = n_images * width * height * bpp / 1024 / 1024
+    log.i( f'{n_images} {width}x{height} images ({mb:.0f} MB) in {total:.3f} sec: {n_images/total:.0f} fps, {mb/total:.0f} MB/sec;'
+           f' {publishing*1000/n_images:.2f} ms per publish' )
+    test.check_equal( n_received, n_images )
+    test.check_equal( n_bytes, n_images * width * height * bpp )
+
+
+reader = writer = topic = None
+participant = None
+test.print_results()
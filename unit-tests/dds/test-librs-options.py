@@ -61,7 +61,7 @@ with test.remote.fork( nested_indent=None ) as remote:
         for s in dev.query_sensors():
             break
         options = test.info( "supported options", s.get_supported_options() )
-        test.check_equal( len(options), 7 )  # 'Frames Queue Size' gets added to all sensors!!?!?!
+        test.check_equal( len(options), 9 )  # 'Frames Queue Size/Policy/Memory Limit' get added to all sensors!!?!?!
 
     with test.closure( 'Play with integer option' ):
         io = next( o for o in options if str(o) == 'Integer Option' )
@@ -130,7 +130,7 @@ with test.remote.fork( nested_indent=None ) as remote:
         j = json.loads( sdev.serialize_json() )
         test.info( "serialize_json()", j )
         params = j.get( 'parameters', [] )
-        test.check_equal( len( params ), 5 )  # Without FRAMES_QUEUE_SIZE
+        test.check_equal( len( params ), 5 )  # Without FRAMES_QUEUE_SIZE/POLICY/MEMORY_LIMIT
         test.check_equal( params.get( 'sensor/Boolean Option' ), True )
 
         # Confirm previous value was set
@@ -0,0 +1,249 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+//#cmake:dependencies realdds
+//#test:donotrun:!dds
+
+#include <unit-tests/test.h>
+#include <realdds/dds-metadata-syncer.h>
+
+#include <rsutils/json.h>
+
+#include <atomic>
+#include <chrono>
+#include <random>
+#include <thread>
+#include <vector>
+
+using rsutils::json;
+using realdds::dds_metadata_syncer;
+
+
+namespace {
+
+
+// Our "frames" are just their keys on the heap; we count releases to make sure nothing leaks
+std::atomic< size_t > n_released( 0 );
+
+void release_frame( dds_metadata_syncer::frame_type * f )
+{
+    delete static_cast< dds_metadata_syncer::key_type * >( f );
+    ++n_released;
+}
+
+
+dds_metadata_syncer::frame_holder new_frame( dds_metadata_syncer const & syncer, dds_metadata_syncer::key_type key )
+{
+    return syncer.hold( new dds_metadata_syncer::key_type( key ) );
+}
+
+
+dds_metadata_syncer::metadata_type new_metadata( dds_metadata_syncer::key_type key )
+{
+    return std::make_shared< const json >( json::object( { { "key", key } } ) );
+}
+
+
+dds_metadata_syncer::key_type key_of( dds_metadata_syncer::frame_holder const & fh )
+{
+    return *static_cast< dds_metadata_syncer::key_type const * >( fh.get() );
+}
+
+
+// Keep the other thread guessing: sometimes nothing, sometimes a yield, sometimes a short sleep
+void jitter( std::mt19937 & rng )
+{
+    auto const r = rng() % 10;
+    if( r < 5 )
+        return;
+    if( r < 8 )
+        std::this_thread::yield();
+    else
+        std::this_thread::sleep_for( std::chrono::microseconds( rng() % 300 ) );
+}
+
+
+}  // namespace
+
+
+TEST_CASE( "batch delivered in order" )
+{
+    n_released = 0;
+    std::vector< dds_metadata_syncer::key_type > dropped, frames;
+    {
+        dds_metadata_syncer syncer;
+        syncer.on_frame_release( release_frame );
+        syncer.on_frame_ready(
+            [&]( dds_metadata_syncer::frame_holder && fh, dds_metadata_syncer::metadata_type const & md )
+            {
+                REQUIRE( md );
+                CHECK( md->nested( "key" ).default_value< dds_metadata_syncer::key_type >( 0 ) == key_of( fh ) );
+                frames.push_back( key_of( fh ) );
+            } );
+        syncer.on_metadata_dropped( [&]( dds_metadata_syncer::key_type key, dds_metadata_syncer::metadata_type const & )
+                                    { dropped.push_back( key ); } );
+        syncer.start();
+
+        auto const n = dds_metadata_syncer::max_md_queue_size;
+        for( dds_metadata_syncer::key_type k = 0; k < n; ++k )
+            syncer.enqueue_metadata( k, new_metadata( k ) );
+        CHECK( syncer.get_statistics().n_batches == 0 );
+
+        // All the older metadata is dropped, then the match, all in one go
+        syncer.enqueue_frame( n - 1, new_frame( syncer, n - 1 ) );
+        CHECK( frames == std::vector< dds_metadata_syncer::key_type >{ n - 1 } );
+        CHECK( dropped.size() == n - 1 );
+        for( size_t i = 0; i < dropped.size(); ++i )
+            CHECK( dropped[i] == i );
+
+        auto stats = syncer.get_statistics();
+        CHECK( stats.n_batches == 1 );
+        CHECK( stats.max_batch_size == n );
+        CHECK( stats.n_matched == 1 );
+        CHECK( stats.n_metadata_dropped == n - 1 );
+
+        // Keys must increase
+        syncer.enqueue_metadata( n, new_metadata( n ) );
+        CHECK_THROWS( syncer.enqueue_metadata( n, new_metadata( n ) ) );
+        syncer.enqueue_frame( n + 1, new_frame( syncer, n + 1 ) );  // drops n
+        CHECK_THROWS( syncer.enqueue_frame( n + 1, new_frame( syncer, n + 1 ) ) );
+        CHECK( dropped.size() == n );
+        CHECK( frames.size() == 1 );
+    }
+    CHECK( n_released == 3 );  // including the one we failed to enqueue and the one still queued
+}
+
+TEST_CASE( "enqueue from callback" )
+{
+    n_released = 0;
+    {
+        dds_metadata_syncer syncer;
+        std::vector< dds_metadata_syncer::key_type > frames;
+        syncer.on_frame_release( release_frame );
+        syncer.on_frame_ready(
+            [&]( dds_metadata_syncer::frame_holder && fh, dds_metadata_syncer::metadata_type const & md )
+            {
+                auto const key = key_of( fh );
+                frames.push_back( key );
+                // Results of this are issued once we return, before the outer enqueue does
+                if( key < 5 )
+                {
+                    syncer.enqueue_frame( key + 1, new_frame( syncer, key + 1 ) );
+                    syncer.enqueue_metadata( key + 1, new_metadata( key + 1 ) );
+                }
+            } );
+        syncer.start();
+
+        syncer.enqueue_frame( 0, new_frame( syncer, 0 ) );
+        syncer.enqueue_metadata( 0, new_metadata( 0 ) );
+        CHECK( frames == std::vector< dds_metadata_syncer::key_type >{ 0, 1, 2, 3, 4, 5 } );
+        CHECK( syncer.get_statistics().n_matched == 6 );
+    }
+    CHECK( n_released == 6 );
+}
+
+TEST_CASE( "reordered and lossy stress" )
+{
+    // Frames and metadata arrive from their own threads with random delays between them and random losses on both.
+    // Either may get ahead of the other by up to max_skew keys, so metadata arrives before or after its frame.
+    size_t const N = 20000;
+    dds_metadata_syncer::key_type const max_skew = 2;
+    std::atomic< dds_metadata_syncer::key_type > frame_progress( 0 ), md_progress( 0 );
+    n_released = 0;
+
+    std::atomic< int > in_callback( 0 );
+    std::atomic< bool > concurrent( false );
+    std::atomic< bool > out_of_order( false );
+    std::atomic< bool > bad_match( false );
+    dds_metadata_syncer::key_type last_key = 0;
+    size_t n_issued = 0, n_with_md = 0;
+    std::atomic< size_t > n_dropped( 0 );
+
+    dds_metadata_syncer::statistics stats;
+    size_t n_frames_sent = 0, n_md_sent = 0;
+    {
+        dds_metadata_syncer syncer;
+        syncer.on_frame_release( release_frame );
+        syncer.on_frame_ready(
+            [&]( dds_metadata_syncer::frame_holder && fh, dds_metadata_syncer::metadata_type const & md )
+            {
+                if( in_callback++ )
+                    concurrent = true;
+                auto const key = key_of( fh );
+                if( n_issued++ && key <= last_key )
+                    out_of_order = true;
+                last_key = key;
+                if( md )
+                {
+                    ++n_with_md;
+                    if( md->nested( "key" ).default_value< dds_metadata_syncer::key_type >( 0 ) != key )
+                        bad_match = true;
+                }
+                --in_callback;
+            } );
+        syncer.on_metadata_dropped( [&]( dds_metadata_syncer::key_type, dds_metadata_syncer::metadata_type const & )
+                                    { ++n_dropped; } );
+        syncer.start();
+
+        std::thread frame_thread(
+            [&]()
+            {
+                std::mt19937 rng( 1 );
+                for( dds_metadata_syncer::key_type k = 0; k < N; frame_progress = ++k )
+                {
+                    while( md_progress + max_skew < k )
+                        std::this_thread::yield();
+                    if( rng() % 50 == 0 )
+                        continue;  // lost
+                    syncer.enqueue_frame( k, new_frame( syncer, k ) );
+                    ++n_frames_sent;
+                    jitter( rng );
+                }
+            } );
+        std::thread md_thread(
+            [&]()
+            {
+                std::mt19937 rng( 2 );
+                for( dds_metadata_syncer::key_type k = 0; k < N; md_progress = ++k )
+                {
+                    while( frame_progress + max_skew < k )
+                        std::this_thread::yield();
+                    if( rng() % 10 == 0 )
+                        continue;  // lost
+                    syncer.enqueue_metadata( k, new_metadata( k ) );
+                    ++n_md_sent;
+                    jitter( rng );
+                }
+            } );
+        frame_thread.join();
+        md_thread.join();
+
+        // Flush the last frames out
+        syncer.enqueue_metadata( N, new_metadata( N ) );
+        ++n_md_sent;
+
+        stats = syncer.get_statistics();
+    }
+
+    CHECK_FALSE( concurrent );
+    CHECK_FALSE( out_of_order );
+    CHECK_FALSE( bad_match );
+
+    // No frame is lost in the syncer
+    CHECK( n_issued == n_frames_sent );
+    CHECK( n_released == n_frames_sent );
+    CHECK( stats.n_frames == n_frames_sent );
+    CHECK( stats.n_matched == n_with_md );
+    CHECK( stats.n_matched + stats.n_frames_without_metadata == n_frames_sent );
+    // Each metadata is either matched or dropped, except the last that's still queued
+    CHECK( stats.n_metadata == n_md_sent );
+    CHECK( stats.n_metadata_dropped == n_dropped );
+    CHECK( stats.n_matched + stats.n_metadata_dropped + 1 == n_md_sent );
+    // Most should still match, even with metadata arriving late
+    CHECK( stats.n_matched > N / 2 );
+    CHECK( stats.max_latency >= stats.total_latency / n_frames_sent );
+
+    test::log.d( n_frames_sent, "frames,", stats.n_matched, "matched,", stats.n_metadata_dropped, "metadata dropped" );
+    test::log.d( stats.n_batches, "batches, max", stats.max_batch_size, "; latency avg",
+                 stats.total_latency / n_frames_sent, "ns, max", stats.max_latency, "ns" );
+}
@@ -158,6 +158,19 @@ with test.closure( 'Enqueue 1 image after some metadata -> drops + match' ):
         test.check_equal( md_id( last_metadata() ), 2 )
     test.check_equal( len(dropped_metadata), 2 )  # 0 and 1
 
+with test.closure( 'Statistics: drops and match delivered in one batch' ):
+    syncer = new_syncer()
+    for i in range(4):
+        syncer.enqueue_metadata( i, new_metadata( i ) )
+    syncer.enqueue_frame( 2, new_image( 2 ) )
+    stats = syncer.get_statistics()
+    test.check_equal( stats.n_frames, 1 )
+    test.check_equal( stats.n_metadata, 4 )
+    test.check_equal( stats.n_matched, 1 )
+    test.check_equal( stats.n_metadata_dropped, 2 )
+    test.check_equal( stats.n_batches, 1 )
+    test.check_equal( stats.max_batch_size, 3 )
+
 with test.closure( 'Enqueue 1 image then earlier metadata -> nothing out; metadata is dropped' ):
     syncer = new_syncer()
     syncer.enqueue_frame( 1, new_image( 1 ) )
@@ -230,8 +243,9 @@ def two_threads( callback_time, time_between_frames=0.033, n=10, order='metadata
     the syncer, it does block the image-receiving thread so, if the callback takes long enough,
     we'll see additional metadata being received and cached. If we specify 'image-first' then the
     opposite happens: the MD thread will block and we'll see images arriving during the callback,
-    meaning images will build up and eventually being freed without metadata meaning the callback
-    will be called from two different threads, possibly concurrently!
+    meaning images will build up and eventually being freed without metadata. The image thread
+    does not wait for the callback but leaves these for the MD thread to deliver, so callbacks are
+    never concurrent.
     """
     have_image = threading.Event()
     have_md = threading.Event()
@@ -311,7 +325,7 @@ def two_threads( callback_time, time_between_frames=0.033, n=10, order='metadata
     m_th.join()
 
 
-with test.closure( 'Two threads, slow callback on MD thread -> parallel callbacks; MD doesn\'t arrive in time -> drops' ):
+with test.closure( 'Two threads, slow callback on MD thread -> MD thread delivers all; MD doesn\'t arrive in time -> drops' ):
 
     two_threads( callback_time=0.1,  # longer than time-between-frames, on purpose!
                  order='image-first' )
@@ -343,8 +357,9 @@ with test.closure( 'Two threads, fast callback -> no drops, no parallel callback
 
 with test.closure( 'Two threads, slow callback -> different callbacks interleaved' ):
     """
-    Test correct handling of interleaved callbacks (incorrect handling can trigger an exception)
-    Based on machine and scheduler several scenarios that test this can happen:
+    Test correct handling of interleaved enqueues (incorrect handling can trigger an exception)
+    Based on machine and scheduler several scenarios that test this can happen; in each, whichever
+    thread is already inside a callback also delivers what the other thread enqueued:
     Scenario 1:
         Thread A enqueues frame0
         Thread A enqueues frame1
@@ -367,7 +382,6 @@ with test.closure( 'Two threads, slow callback -> different callbacks interleave
         while the callback is handled thread B enqueues metadata1
             handle_match( frame1, metadata1 ) calls user callback in thread B context
             
-    There is a small chance that frame1 will be appended to received_frames before frame0 so remove checks that depend on order.
     """
 
     def frame_callback( image, metadata ):
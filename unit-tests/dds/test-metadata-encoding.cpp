@@ -0,0 +1,194 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+//#cmake:dependencies realdds
+//#test:donotrun:!dds
+
+#include <unit-tests/test.h>
+#include <realdds/topics/metadata-msg.h>
+#include <realdds/topics/dds-topic-names.h>
+
+#include <rsutils/json.h>
+
+#include <chrono>
+#include <map>
+
+using rsutils::json;
+using namespace realdds::topics;
+
+
+namespace {
+
+
+// Roughly what the adapter sends for a D435 depth frame
+std::shared_ptr< const metadata_keys > make_keys()
+{
+    std::vector< std::string > names;
+    for( int i = 0; i < 60; ++i )
+        names.push_back( "Metadata Field " + std::to_string( i ) );
+    return std::make_shared< const metadata_keys >( std::move( names ) );
+}
+
+
+metadata_msg make_msg( std::shared_ptr< const metadata_keys > const & keys, uint64_t i )
+{
+    metadata_msg md;
+    md.stream_name = "Depth";
+    md.timestamp = 1700000000000000000LL + i * 33333333;
+    md.has_frame_number = true;
+    md.frame_number = i;
+    md.has_timestamp_domain = true;
+    md.timestamp_domain = 2;
+    md.has_depth_units = true;
+    md.depth_units = 0.001f;
+    for( uint16_t k = 0; k < 30; ++k )
+        md.values.emplace_back( uint16_t( k * 2 ), int64_t( i * 1000 + k ) );
+    md.keys = keys;
+    return md;
+}
+
+
+void check_equal( metadata_msg const & a, metadata_msg const & b )
+{
+    CHECK( a.stream_name == b.stream_name );
+    CHECK( a.timestamp == b.timestamp );
+    CHECK( a.has_frame_number == b.has_frame_number );
+    CHECK( a.frame_number == b.frame_number );
+    CHECK( a.has_timestamp_domain == b.has_timestamp_domain );
+    CHECK( a.timestamp_domain == b.timestamp_domain );
+    CHECK( a.has_depth_units == b.has_depth_units );
+    CHECK( a.depth_units == b.depth_units );
+    // JSON does not preserve the order of values, so compare by name
+    std::map< std::string, int64_t > a_values, b_values;
+    for( auto & kv : a.values )
+        a_values[a.keys->name( kv.first )] = kv.second;
+    for( auto & kv : b.values )
+        b_values[b.keys->name( kv.first )] = kv.second;
+    CHECK( a.values.size() == b.values.size() );
+    CHECK( a_values == b_values );
+}
+
+
+}  // namespace
+
+
+TEST_CASE( "binary round-trip" )
+{
+    auto keys = make_keys();
+    auto md = make_msg( keys, 1234 );
+
+    std::vector< uint8_t > data;
+    md.encode( data );
+    CHECK( data.size() == 1 + 1 + 2 + 1 + 5 + 8 + 8 + 4 + 4 + 30 * 10 );
+
+    metadata_msg decoded;
+    decoded.decode( data.data(), data.size() );
+    decoded.keys = keys;
+    check_equal( md, decoded );
+
+    // Optional fields that are not there are not sent
+    md.has_frame_number = md.has_timestamp_domain = md.has_depth_units = false;
+    md.values.clear();
+    md.encode( data );
+    CHECK( data.size() == 1 + 1 + 2 + 1 + 5 + 8 );
+    decoded.decode( data.data(), data.size() );
+    CHECK_FALSE( decoded.has_frame_number );
+    CHECK_FALSE( decoded.has_depth_units );
+    CHECK( decoded.values.empty() );
+}
+
+TEST_CASE( "binary is little-endian" )
+{
+    metadata_msg md;
+    md.stream_name = "D";
+    md.timestamp = 0x0102030405060708LL;
+    md.values.emplace_back( uint16_t( 0x0a0b ), 0x1112131415161718LL );
+
+    std::vector< uint8_t > data;
+    md.encode( data );
+    std::vector< uint8_t > const expected = {
+        metadata_msg::VERSION, 0, 1, 0, 1, 'D',                   // no optional fields, one value
+        0x08, 0x07, 0x06, 0x05, 0x04, 0x03, 0x02, 0x01,           // timestamp
+        0x0b, 0x0a, 0x18, 0x17, 0x16, 0x15, 0x14, 0x13, 0x12, 0x11  // key index, value
+    };
+    CHECK( data == expected );
+}
+
+TEST_CASE( "invalid binary" )
+{
+    auto md = make_msg( make_keys(), 1 );
+    std::vector< uint8_t > data;
+    md.encode( data );
+
+    metadata_msg decoded;
+    CHECK_THROWS( decoded.decode( data.data(), data.size() - 1 ) );
+    CHECK_THROWS( decoded.decode( data.data(), 3 ) );
+    data[0] = metadata_msg::VERSION + 1;
+    CHECK_THROWS( decoded.decode( data.data(), data.size() ) );
+}
+
+TEST_CASE( "json round-trip" )
+{
+    auto keys = make_keys();
+    auto md = make_msg( keys, 5678 );
+    json j = md.to_json();
+    CHECK( j.nested( metadata::key::stream_name ).string_ref() == "Depth" );
+    CHECK( j.nested( metadata::key::metadata ).size() == 30 );
+
+    auto client_keys = keys;
+    auto decoded = metadata_msg::from_json( j, client_keys );
+    CHECK( client_keys == keys );  // no new keys
+    check_equal( md, decoded );
+
+    // Unknown names are learned, without touching the original keys
+    std::shared_ptr< const metadata_keys > learned;
+    decoded = metadata_msg::from_json( j, learned );
+    REQUIRE( learned );
+    CHECK( learned->size() == 30 );
+    check_equal( md, decoded );
+    auto first = learned;
+    metadata_msg::from_json( j, learned );
+    CHECK( learned == first );  // nothing new the second time around
+
+    // Timestamp is mandatory (the syncer needs it)
+    j[metadata::key::header].erase( metadata::header::key::timestamp );
+    CHECK_THROWS( metadata_msg::from_json( j, learned ) );
+}
+
+TEST_CASE( "encoding benchmark" )
+{
+    // Compare what the server and client each do per frame: build+dump+parse+lookup for JSON, vs encode+decode
+    auto keys = make_keys();
+    int const N = 2000;
+    typedef std::chrono::high_resolution_clock clock;
+
+    size_t json_bytes = 0;
+    auto start = clock::now();
+    for( int i = 0; i < N; ++i )
+    {
+        auto s = make_msg( keys, i ).to_json().dump();
+        json_bytes += s.size();
+        std::shared_ptr< const metadata_keys > client_keys = keys;
+        auto md = metadata_msg::from_json( json::parse( s ), client_keys );
+        REQUIRE( md.values.size() == 30 );
+    }
+    auto json_us = std::chrono::duration_cast< std::chrono::microseconds >( clock::now() - start ).count();
+
+    size_t binary_bytes = 0;
+    std::vector< uint8_t > data;
+    start = clock::now();
+    for( int i = 0; i < N; ++i )
+    {
+        make_msg( keys, i ).encode( data );
+        binary_bytes += data.size();
+        metadata_msg md;
+        md.decode( data.data(), data.size() );
+        REQUIRE( md.values.size() == 30 );
+    }
+    auto binary_us = std::chrono::duration_cast< std::chrono::microseconds >( clock::now() - start ).count();
+
+    test::log.d( "json:  ", json_us * 1000 / N, "ns/frame,", json_bytes / N, "bytes/frame" );
+    test::log.d( "binary:", binary_us * 1000 / N, "ns/frame,", binary_bytes / N, "bytes/frame" );
+    CHECK( binary_bytes < json_bytes / 2 );
+    CHECK( binary_us < json_us );
+}
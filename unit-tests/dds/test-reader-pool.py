@@ -0,0 +1,153 @@
+# License: Apache 2.0. See LICENSE file in root directory.
+# Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#test:donotrun:!dds
+
+import pyrealdds as dds
+from rspy import log, test
+import flexible
+import os
+import threading
+import time
+
+dds.debug( log.is_debug_on(), 'C  ' )
+log.nested = 'C  '
+
+
+def n_threads():
+    """ The number of threads in this process, or None if we can't tell """
+    try:
+        with open( '/proc/self/status' ) as status:
+            for line in status:
+                if line.startswith( 'Threads:' ):
+                    return int( line.split()[1] )
+    except OSError:
+        pass
+    return None
+
+
+# Loopback: the writers are on one participant, the readers on another, in the same process
+writers_participant = dds.participant()
+writers_participant.init( 123, 'test-reader-pool-writers' )
+readers_participant = dds.participant()
+readers_participant.init( 123, 'test-reader-pool-readers', { 'reader-threads': 2 } )
+
+n_topics = 20
+n_messages = 10
+
+
+with test.closure( 'pooled readers get all messages' ):
+    threads_before = n_threads()
+    received = [[] for _ in range( n_topics )]
+    all_received = threading.Event()
+    readers = []
+    for i in range( n_topics ):
+        def on_data_available( reader, i=i ):
+            while True:
+                msg = dds.message.flexible.take_next( reader )
+                if not msg:
+                    break
+                received[i].append( msg.json_data()['n'] )
+            if sum( len( r ) for r in received ) == n_topics * n_messages:
+                all_received.set()
+        topic = dds.message.flexible.create_topic( readers_participant, f'pool/{i}' )
+        reader = dds.topic_reader_thread( topic )
+        reader.on_data_available( on_data_available )
+        reader.run( dds.topic_reader.qos() )
+        test.check( reader.is_pooled() )
+        readers.append( reader )
+    threads_after = n_threads()
+    if threads_before is not None:
+        log.d( 'threads:', threads_before, '->', threads_after )
+        test.check( threads_after - threads_before < n_topics / 2 )  # not one per reader
+
+    writers = [flexible.writer( writers_participant, f'pool/{i}' ) for i in range( n_topics )]
+    for w in writers:
+        w.wait_for_readers()
+    for n in range( n_messages ):
+        for w in writers:
+            w.write( f'{{"n":{n}}}' )
+    test.check( all_received.wait( 10 ) )
+    for r in received:
+        test.check_equal( r, list( range( n_messages ) ) )
+
+    for reader in readers:
+        stats = reader.get_statistics()
+        test.check( stats.n_wakeups > 0 )
+        test.check( stats.max_delay >= 0 )
+        test.check( stats.total_duration >= stats.max_duration )
+        log.d( reader.topic().name(), stats.n_wakeups, 'wakeups; max delay', stats.max_delay / 1e6,
+               'ms; max duration', stats.max_duration / 1e6, 'ms' )
+
+
+with test.closure( 'stopping a reader from its own callback' ):
+    stopped = threading.Event()
+    topic = dds.message.flexible.create_topic( readers_participant, 'pool/stop' )
+    reader = dds.topic_reader_thread( topic )
+    def on_data_available( r ):
+        dds.message.flexible.take_next( r )
+        r.stop()
+        stopped.set()
+    reader.on_data_available( on_data_available )
+    reader.run( dds.topic_reader.qos() )
+    w = flexible.writer( writers_participant, 'pool/stop' )
+    w.wait_for_readers()
+    w.write( '{"n":0}' )
+    test.check( stopped.wait( 5 ) )
+    # The other readers are unaffected
+    writers[0].write( f'{{"n":{n_messages}}}' )
+    time.sleep( 0.5 )
+    test.check_equal( received[0][-1], n_messages )
+    w.stop()
+    reader = None
+
+
+with test.closure( 'readers on two threads stopping each other from their callbacks' ):
+    # The threads have as many readers each, so the two get one each. Each callback waits for the other to start, so
+    # both run at once, then stops the other's reader.
+    both_in_callbacks = threading.Barrier( 2, timeout=5 )
+    done = [threading.Event(), threading.Event()]
+    pair = []
+    for i in range( 2 ):
+        def on_data_available( r, i=i ):
+            dds.message.flexible.take_next( r )
+            both_in_callbacks.wait()
+            pair[1 - i].stop()
+            done[i].set()
+        reader = dds.topic_reader_thread( dds.message.flexible.create_topic( readers_participant, f'pool/pair/{i}' ) )
+        reader.on_data_available( on_data_available )
+        pair.append( reader )
+    for reader in pair:
+        reader.run( dds.topic_reader.qos() )
+    pair_writers = [flexible.writer( writers_participant, f'pool/pair/{i}' ) for i in range( 2 )]
+    for w in pair_writers:
+        w.wait_for_readers()
+    for w in pair_writers:
+        w.write( '{"n":0}' )
+    test.check( done[0].wait( 5 ) )
+    test.check( done[1].wait( 5 ) )
+    # The pool is still working
+    writers[0].write( f'{{"n":{n_messages + 1}}}' )
+    time.sleep( 0.5 )
+    test.check_equal( received[0][-1], n_messages + 1 )
+    for w in pair_writers:
+        w.stop()
+    pair = pair_writers = None
+
+
+with test.closure( 'readers without a pool have a thread each' ):
+    participant = dds.participant()
+    participant.init( 123, 'test-reader-pool-dedicated' )
+    reader = dds.topic_reader_thread( dds.message.flexible.create_topic( participant, 'pool/dedicated' ) )
+    reader.on_data_available( lambda r: dds.message.flexible.take_next( r ) )
+    reader.run( dds.topic_reader.qos() )
+    test.check( not reader.is_pooled() )
+    reader.stop()
+    reader = participant = None
+
+
+for reader in readers:
+    reader.stop()
+readers = writers = None
+readers_participant = writers_participant = None
+test.print_results()
@@ -0,0 +1,154 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+//#cmake: static!
+
+#include <unit-tests/test.h>
+#include <src/hw-monitor-queue.h>
+
+#include <atomic>
+#include <thread>
+
+using namespace librealsense;
+
+
+namespace {
+
+
+// Replies to every command with its own opcode (as the FW does on success) followed by param1;
+// opcode 0xFF is answered with an error code instead
+class mock_command_transfer : public platform::command_transfer
+{
+public:
+    std::atomic< int > n_transfers{ 0 };
+    std::atomic< int > n_malformed{ 0 };  // checked on the test thread: this runs on the queue's worker
+    std::vector< uint8_t > sent_opcodes;
+    std::chrono::milliseconds delay{ 0 };
+
+    std::vector< uint8_t > send_receive( uint8_t const * pb, size_t cb, int, bool ) override
+    {
+        ++n_transfers;
+        if( delay.count() )
+            std::this_thread::sleep_for( delay );
+        if( cb < 12 )
+        {
+            ++n_malformed;
+            return {};
+        }
+        uint32_t opcode, param1;
+        std::memcpy( &opcode, pb + 4, sizeof( opcode ) );
+        std::memcpy( &param1, pb + 8, sizeof( param1 ) );
+        sent_opcodes.push_back( uint8_t( opcode ) );
+
+        int32_t reply = opcode == 0xFF ? -1 : int32_t( opcode );
+        std::vector< uint8_t > res( 8 );
+        std::memcpy( res.data(), &reply, sizeof( reply ) );
+        std::memcpy( res.data() + 4, &param1, sizeof( param1 ) );
+        return res;
+    }
+};
+
+
+class mock_hwmon_response : public hwmon_response_interface
+{
+public:
+    std::string hwmon_error2str( int e ) const override { return "mock error"; }
+    hwmon_response_type success_value() const override { return 0; }
+};
+
+
+uint32_t to_param( std::vector< uint8_t > const & res )
+{
+    REQUIRE( res.size() == 4 );
+    uint32_t param;
+    std::memcpy( &param, res.data(), sizeof( param ) );
+    return param;
+}
+
+
+}  // namespace
+
+
+TEST_CASE( "hwm queue results" )
+{
+    auto transfer = std::make_shared< mock_command_transfer >();
+    auto hwm = std::make_shared< hw_monitor >( std::make_shared< locked_transfer >( transfer, nullptr ),
+                                               std::make_shared< mock_hwmon_response >() );
+    hw_monitor_queue queue( hwm );
+
+    std::vector< std::future< std::vector< uint8_t > > > results;
+    for( uint32_t i = 0; i < 20; ++i )
+        results.push_back( queue.send( command( uint8_t( 1 + i % 3 ), i ) ) );
+    for( uint32_t i = 0; i < 20; ++i )
+        CHECK( to_param( results[i].get() ) == i );
+
+    // Commands go out in the order they were queued
+    REQUIRE( transfer->sent_opcodes.size() == 20 );
+    for( uint32_t i = 0; i < 20; ++i )
+        CHECK( transfer->sent_opcodes[i] == 1 + i % 3 );
+
+    auto stats = queue.get_statistics();
+    REQUIRE( stats.size() == 3 );
+    CHECK( stats[1].count == 7 );
+    CHECK( stats[2].count == 7 );
+    CHECK( stats[3].count == 6 );
+    CHECK( stats[1].errors == 0 );
+    CHECK( stats[1].min_latency <= stats[1].max_latency );
+    CHECK( transfer->n_malformed == 0 );
+}
+
+TEST_CASE( "hwm queue errors go to the right future" )
+{
+    auto transfer = std::make_shared< mock_command_transfer >();
+    auto hwm = std::make_shared< hw_monitor >( std::make_shared< locked_transfer >( transfer, nullptr ),
+                                               std::make_shared< mock_hwmon_response >() );
+    hw_monitor_queue queue( hwm );
+
+    auto ok1 = queue.send( command( 1, 10 ) );
+    auto bad = queue.send( command( 0xFF, 20 ) );
+    auto ok2 = queue.send( command( 2, 30 ) );
+
+    CHECK( to_param( ok1.get() ) == 10 );
+    CHECK_THROWS( bad.get() );
+    CHECK( to_param( ok2.get() ) == 30 );
+    CHECK( queue.get_statistics()[0xFF].errors == 1 );
+    CHECK( transfer->n_malformed == 0 );
+}
+
+TEST_CASE( "hwm queue coalesces pending commands" )
+{
+    auto transfer = std::make_shared< mock_command_transfer >();
+    transfer->delay = std::chrono::milliseconds( 20 );
+    auto hwm = std::make_shared< hw_monitor >( std::make_shared< locked_transfer >( transfer, nullptr ),
+                                               std::make_shared< mock_hwmon_response >() );
+    hw_monitor_queue queue( hwm );
+
+    // The first command keeps the worker busy while the rest accumulate: they should all go out together
+    std::vector< std::future< std::vector< uint8_t > > > results;
+    for( uint32_t i = 0; i < 10; ++i )
+        results.push_back( queue.send( command( 1, i ) ) );
+    REQUIRE( queue.flush() );
+    for( auto & f : results )
+        f.get();
+
+    CHECK( transfer->n_transfers == 10 );
+    CHECK( queue.get_number_of_batches() < 10 );
+    CHECK( transfer->n_malformed == 0 );
+}
+
+TEST_CASE( "hwm queue destruction completes pending commands" )
+{
+    auto transfer = std::make_shared< mock_command_transfer >();
+    transfer->delay = std::chrono::milliseconds( 5 );
+    auto hwm = std::make_shared< hw_monitor >( std::make_shared< locked_transfer >( transfer, nullptr ),
+                                               std::make_shared< mock_hwmon_response >() );
+    std::vector< std::future< std::vector< uint8_t > > > results;
+    {
+        hw_monitor_queue queue( hwm );
+        for( uint32_t i = 0; i < 5; ++i )
+            results.push_back( queue.send( command( 1, i ) ) );
+    }
+    for( uint32_t i = 0; i < 5; ++i )
+        CHECK( to_param( results[i].get() ) == i );
+    CHECK( transfer->n_malformed == 0 );
+}
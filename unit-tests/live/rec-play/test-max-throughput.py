@@ -0,0 +1,163 @@
+# License: Apache 2.0. See LICENSE file in root directory.
+# Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+import os.path
+import tempfile
+import threading
+import time
+import pyrealsense2 as rs
+from rspy import test, log
+
+
+W = 640
+H = 480
+N_FRAMES = 60
+
+
+def record( filename ):
+    sd = rs.software_device()
+    sensor = sd.add_sensor( "Synthetic" )
+    profiles = []
+    for uid, stream, fmt, bpp in [( 0, rs.stream.depth, rs.format.z16, 2 ), ( 1, rs.stream.infrared, rs.format.y8, 1 )]:
+        vs = rs.video_stream()
+        vs.type = stream
+        vs.index = 0
+        vs.uid = uid
+        vs.width = W
+        vs.height = H
+        vs.fps = 30
+        vs.bpp = bpp
+        vs.fmt = fmt
+        vs.intrinsics = rs.intrinsics()
+        vs.intrinsics.width = W
+        vs.intrinsics.height = H
+        profiles.append(( sensor.add_video_stream( vs ).as_video_stream_profile(), bpp ))
+    recorder = rs.recorder( filename, sd, True )
+    sensor.open( [p for p, bpp in profiles] )
+    sensor.start( lambda f: None )
+
+    for i in range( N_FRAMES ):
+        for profile, bpp in profiles:
+            video_frame = rs.software_video_frame()
+            video_frame.bpp = bpp
+            video_frame.stride = W * bpp
+            video_frame.domain = rs.timestamp_domain.hardware_clock
+            video_frame.profile = profile
+            video_frame.pixels = bytearray( [i % 256] ) * ( W * H * bpp )
+            video_frame.frame_number = i
+            video_frame.timestamp = i * 1000. / 30
+            sensor.on_video_frame( video_frame )
+
+    sensor.stop()
+    sensor.close()
+    recorder.pause()
+    recorder = None
+
+
+def play( filename, queue_size, work = 0.005 ):
+    """
+    Returns the (frame-number, first-byte) of every frame played, per stream, and the reported throughput
+    """
+    ctx = rs.context()
+    player = ctx.load_device( filename )
+    playback = player.as_playback()
+    playback.set_real_time( False )
+    if queue_size:
+        playback.set_max_throughput( queue_size )
+    sensor = player.query_sensors()[0]
+
+    frames = { rs.stream.depth: [], rs.stream.infrared: [] }
+    def on_frame( f ):
+        time.sleep( work )  # so there's something to do in parallel
+        frames[f.get_profile().stream_type()].append( ( f.get_frame_number(), bytes( f.get_data() )[0] ) )
+
+    sensor.open( sensor.get_stream_profiles() )
+    sensor.start( on_frame )
+    deadline = time.time() + 30
+    while sum( len( f ) for f in frames.values() ) < 2 * N_FRAMES and time.time() < deadline:
+        time.sleep( 0.01 )
+    sensor.stop()
+    sensor.close()
+    return frames, playback.get_throughput()
+
+
+def thread_count():
+    return len( os.listdir( '/proc/self/task' ) )
+
+
+def peak_thread_count( fn ):
+    """
+    Runs fn() on a thread of its own and returns the most threads the process had meanwhile
+    """
+    peak = thread_count()
+    t = threading.Thread( target = fn )
+    t.start()
+    while t.is_alive():
+        peak = max( peak, thread_count() )
+        time.sleep( 0.001 )
+    t.join()
+    return peak
+
+
+temp_dir = tempfile.mkdtemp()
+filenames = [os.path.join( temp_dir, f"recording{i}.bag" ) for i in range( 2 )]
+for filename in filenames:
+    record( filename )
+expected = [( i, i % 256 ) for i in range( N_FRAMES )]
+
+
+################################################################################################
+test.start( "Max-throughput plays the same frames" )
+
+synchronous, fps_synchronous = play( filenames[0], 0 )
+max_throughput, fps_max_throughput = play( filenames[0], 4 )
+log.d( 'synchronous:   ', fps_synchronous, 'frames/s' )
+log.d( 'max-throughput:', fps_max_throughput, 'frames/s' )
+test.check_equal( synchronous[rs.stream.depth], expected )
+test.check_equal( synchronous[rs.stream.infrared], expected )
+test.check_equal( max_throughput, synchronous )
+test.check( fps_synchronous > 0 )
+test.check( fps_max_throughput > 0 )
+
+test.finish()
+################################################################################################
+test.start( "Playback devices share the read-ahead threads" )
+
+# Each playback brings its own threads (and one of ours to play it on); the read-ahead pool comes with the first and
+# goes with the last. Were it not shared, two playbacks at once would add twice the threads one does.
+results = [None] * len( filenames )
+def play_into( i ):
+    results[i] = play( filenames[i], 8 )[0]
+def play_both():
+    other = threading.Thread( target = play_into, args = ( 1, ) )
+    other.start()
+    play_into( 0 )
+    other.join()
+
+if os.path.isdir( '/proc/self/task' ):
+    base = thread_count()
+    added_by_one = peak_thread_count( lambda: play_into( 0 ) ) - base
+    base = thread_count()
+    added_by_two = peak_thread_count( play_both ) - base
+    log.d( 'threads added by one playback:', added_by_one, '; by two:', added_by_two )
+    test.check( added_by_two < 2 * added_by_one )
+else:
+    log.d( 'no /proc/self/task: the threads are not counted' )
+    play_both()
+for frames in results:
+    test.check_equal( frames[rs.stream.depth], expected )
+    test.check_equal( frames[rs.stream.infrared], expected )
+
+test.finish()
+################################################################################################
+test.start( "Bad arguments" )
+
+player = rs.context().load_device( filenames[0] )
+test.check_throws( lambda: player.as_playback().set_max_throughput( -1 ), RuntimeError )
+test.check_throws( lambda: player.as_playback().set_max_throughput( 17 ), RuntimeError )
+player.as_playback().set_max_throughput( 16 )
+test.check( not player.as_playback().is_real_time() )
+
+test.finish()
+################################################################################################
+test.print_results_and_exit()
@@ -0,0 +1,109 @@
+# License: Apache 2.0. See LICENSE file in root directory.
+# Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+import os.path
+import tempfile
+import time
+import pyrealsense2 as rs
+from rspy import test, log
+
+
+W = 848
+H = 480
+BPP = 2
+N_FRAMES = 120
+
+
+def record( filename ):
+    vs = rs.video_stream()
+    vs.type = rs.stream.depth
+    vs.index = 0
+    vs.uid = 0
+    vs.width = W
+    vs.height = H
+    vs.fps = 30
+    vs.bpp = BPP
+    vs.fmt = rs.format.z16
+    vs.intrinsics = rs.intrinsics()
+    vs.intrinsics.width = W
+    vs.intrinsics.height = H
+
+    sd = rs.software_device()
+    sensor = sd.add_sensor( "Synthetic" )
+    profile = sensor.add_video_stream( vs ).as_video_stream_profile()
+    recorder = rs.recorder( filename, sd, True )  # compressed, so there's something to decompress ahead
+    sensor.open( profile )
+    sensor.start( lambda f: None )
+
+    video_frame = rs.software_video_frame()
+    video_frame.bpp = BPP
+    video_frame.stride = W * BPP
+    video_frame.domain = rs.timestamp_domain.hardware_clock
+    video_frame.profile = profile
+    for i in range( N_FRAMES ):
+        video_frame.pixels = bytearray( [i % 256] ) * ( W * H * BPP )
+        video_frame.frame_number = i
+        video_frame.timestamp = i * 1000. / vs.fps
+        sensor.on_video_frame( video_frame )
+
+    sensor.stop()
+    sensor.close()
+    recorder.pause()
+    recorder = None
+
+
+def play( filename, chunks, threads ):
+    """
+    Returns the (frame-number, first-byte) of every frame played, and the time it took
+    """
+    ctx = rs.context()
+    player = ctx.load_device( filename )
+    playback = player.as_playback()
+    playback.set_real_time( False )
+    playback.set_read_ahead( chunks, threads )
+    sensor = player.query_sensors()[0]
+    profile = sensor.get_stream_profiles()[0]
+
+    frames = []
+    def on_frame( f ):
+        frames.append( ( f.get_frame_number(), bytes( f.get_data() )[0] ) )
+
+    start = time.time()
+    sensor.open( profile )
+    sensor.start( on_frame )
+    deadline = start + 30
+    while len( frames ) < N_FRAMES and time.time() < deadline:
+        time.sleep( 0.01 )
+    elapsed = time.time() - start
+    sensor.stop()
+    sensor.close()
+    return frames, elapsed
+
+
+temp_dir = tempfile.mkdtemp()
+filename = os.path.join( temp_dir, "recording.bag" )
+record( filename )
+
+
+################################################################################################
+test.start( "Read-ahead plays the same frames" )
+
+without, t_without = play( filename, 0, 1 )
+with_read_ahead, t_with = play( filename, 4, 2 )
+log.d( 'no read-ahead:', len( without ), 'frames in', t_without, 'sec' )
+log.d( 'read-ahead:   ', len( with_read_ahead ), 'frames in', t_with, 'sec' )
+test.check_equal( len( without ), N_FRAMES )
+test.check_equal( without, [( i, i % 256 ) for i in range( N_FRAMES )] )
+test.check_equal( with_read_ahead, without )
+
+test.finish()
+################################################################################################
+test.start( "Bad arguments" )
+
+player = rs.context().load_device( filename )
+test.check_throws( lambda: player.as_playback().set_read_ahead( -1, 2 ), RuntimeError )
+test.check_throws( lambda: player.as_playback().set_read_ahead( 4, 0 ), RuntimeError )
+
+test.finish()
+################################################################################################
+test.print_results_and_exit()
@@ -0,0 +1,109 @@
+# License: Apache 2.0. See LICENSE file in root directory.
+# Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+import os.path
+import tempfile
+import time
+import pyrealsense2 as rs
+from rspy import test, log
+
+
+W = 640
+H = 480
+BPP = 2
+N_FRAMES = 50
+
+
+def record( filename ):
+    depth_intrinsics = rs.intrinsics()
+    depth_intrinsics.width = W
+    depth_intrinsics.height = H
+    depth_intrinsics.ppx = W / 2
+    depth_intrinsics.ppy = H / 2
+    depth_intrinsics.fx = W
+    depth_intrinsics.fy = H
+    depth_intrinsics.model = rs.distortion.brown_conrady
+    depth_intrinsics.coeffs = [0, 0, 0, 0, 0]
+
+    vs = rs.video_stream()
+    vs.type = rs.stream.depth
+    vs.index = 0
+    vs.uid = 0
+    vs.width = W
+    vs.height = H
+    vs.fps = 30
+    vs.bpp = BPP
+    vs.fmt = rs.format.z16
+    vs.intrinsics = depth_intrinsics
+
+    sd = rs.software_device()
+    sensor = sd.add_sensor( "Synthetic" )
+    profile = sensor.add_video_stream( vs ).as_video_stream_profile()
+    recorder = rs.recorder( filename, sd )
+    sensor.open( profile )
+    sensor.start( lambda f: None )
+
+    video_frame = rs.software_video_frame()
+    video_frame.pixels = bytearray( W * H * BPP )
+    video_frame.bpp = BPP
+    video_frame.stride = W * BPP
+    video_frame.domain = rs.timestamp_domain.hardware_clock
+    video_frame.profile = profile
+    for i in range( N_FRAMES ):
+        video_frame.frame_number = i
+        video_frame.timestamp = i * 1000. / vs.fps
+        sensor.on_video_frame( video_frame )
+
+    sensor.stop()
+    sensor.close()
+    recorder.pause()
+    recorder = None
+
+
+temp_dir = tempfile.mkdtemp()
+filename = os.path.join( temp_dir, "recording.bag" )
+record( filename )
+
+ctx = rs.context()
+player = ctx.load_device( filename )
+playback = player.as_playback()
+playback.set_real_time( False )
+sensor = player.query_sensors()[0]
+profile = sensor.get_stream_profiles()[0]
+
+frame_numbers = []
+sensor.open( profile )
+sensor.start( lambda f: frame_numbers.append( f.get_frame_number() ) )
+playback.pause()
+
+
+################################################################################################
+test.start( "Frame count" )
+
+test.check_equal( playback.get_frame_count( profile ), N_FRAMES )
+
+test.finish()
+################################################################################################
+test.start( "Seek to frame" )
+
+for index in [N_FRAMES - 1, 0, N_FRAMES // 2, 1, N_FRAMES - 2]:
+    frame_numbers.clear()
+    playback.seek_to_frame( profile, index )
+    # Seeking while paused raises the frame at the seek position
+    deadline = time.time() + 2
+    while not frame_numbers and time.time() < deadline:
+        time.sleep( 0.01 )
+    log.d( 'seek to', index, '->', frame_numbers )
+    test.check_equal( frame_numbers, [index] )
+
+test.finish()
+################################################################################################
+test.start( "Seek out of range" )
+
+test.check_throws( lambda: playback.seek_to_frame( profile, N_FRAMES ), RuntimeError )
+
+test.finish()
+################################################################################################
+sensor.stop()
+sensor.close()
+test.print_results_and_exit()
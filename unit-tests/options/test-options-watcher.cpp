@@ -0,0 +1,335 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+//#cmake: static!
+
+#include <unit-tests/test.h>
+#include <src/core/options-watcher.h>
+#include <rsutils/json.h>
+
+#include <atomic>
+#include <cmath>
+#include <condition_variable>
+#include <future>
+#include <stdexcept>
+#include <thread>
+
+using namespace librealsense;
+using std::chrono::milliseconds;
+
+
+namespace {
+
+
+class counting_option : public option
+{
+public:
+    std::atomic< float > value{ 0.f };
+    mutable std::atomic< int > n_queries{ 0 };
+
+    void set( float v ) override { value = v; }
+    float query() const override
+    {
+        ++n_queries;
+        return value;
+    }
+    option_range get_range() const override { return { 0, 100, 1, 0 }; }
+    bool is_enabled() const override { return true; }
+    const char * get_description() const override { return "counting option"; }
+    void enable_recording( std::function< void( const option & ) > ) override {}
+};
+
+
+// An option whose value is any json, e.g. null when it cannot be queried
+class json_option : public counting_option
+{
+public:
+    rsutils::json json_value;
+
+    rsutils::json get_value() const noexcept override
+    {
+        ++n_queries;
+        return json_value;
+    }
+};
+
+
+// Cannot even tell whether it is enabled, e.g. when the device is gone
+class failing_option : public counting_option
+{
+public:
+    bool is_enabled() const override
+    {
+        ++n_queries;
+        throw std::runtime_error( "cannot query" );
+    }
+};
+
+
+// A query that does not return until released, like a slow HW command
+class blocking_option : public counting_option
+{
+public:
+    float query() const override
+    {
+        std::unique_lock< std::mutex > lock( _mutex );
+        _in_query = true;
+        _cv.notify_all();
+        _cv.wait( lock, [this] { return _released; } );
+        return counting_option::query();
+    }
+
+    bool wait_in_query()
+    {
+        std::unique_lock< std::mutex > lock( _mutex );
+        return _cv.wait_for( lock, std::chrono::seconds( 5 ), [this] { return _in_query; } );
+    }
+
+    void release()
+    {
+        std::lock_guard< std::mutex > lock( _mutex );
+        _released = true;
+        _cv.notify_all();
+    }
+
+private:
+    mutable std::mutex _mutex;
+    mutable std::condition_variable _cv;
+    mutable bool _in_query = false;
+    bool _released = false;
+};
+
+
+// No updater thread: the test runs each update, at a time of its choosing
+class manual_watcher : public options_watcher
+{
+public:
+    using options_watcher::options_watcher;
+
+    // Moves the clock forward and updates, as the updater thread would when woken
+    options_and_values advance( milliseconds dt )
+    {
+        _now += dt;
+        auto updated = update_options();
+        notify( updated );
+        return updated;
+    }
+
+protected:
+    void start() override {}
+    std::chrono::steady_clock::time_point now() const override { return _now; }
+
+    std::chrono::steady_clock::time_point _now = std::chrono::steady_clock::now();
+};
+
+
+template< class Predicate >
+bool wait_until( Predicate pred )
+{
+    auto const timeout = std::chrono::steady_clock::now() + std::chrono::seconds( 5 );
+    while( ! pred() )
+    {
+        if( std::chrono::steady_clock::now() > timeout )
+            return false;
+        std::this_thread::sleep_for( milliseconds( 1 ) );
+    }
+    return true;
+}
+
+
+}  // namespace
+
+
+TEST_CASE( "per-option update intervals" )
+{
+    manual_watcher watcher( milliseconds( 20 ) );
+    auto fast = std::make_shared< counting_option >();
+    auto slow = std::make_shared< counting_option >();
+    auto on_write = std::make_shared< counting_option >();
+    watcher.register_option( RS2_OPTION_GAIN, fast );
+    watcher.register_option( RS2_OPTION_EXPOSURE, slow, milliseconds( 200 ) );
+    watcher.register_option( RS2_OPTION_LASER_POWER, on_write, options_watcher::on_write_only );
+
+    int n_laser_changes = 0;
+    auto subscription = watcher.subscribe(
+        [&]( options_watcher::options_and_values const & changed )
+        {
+            if( changed.count( RS2_OPTION_LASER_POWER ) )
+                ++n_laser_changes;
+        } );
+
+    // The first update queries everything, for the initial values
+    CHECK( watcher.advance( milliseconds( 0 ) ).size() == 3 );
+    n_laser_changes = 0;
+    for( int i = 0; i < 20; ++i )
+        watcher.advance( milliseconds( 20 ) );
+    CHECK( fast->n_queries == 21 );
+    CHECK( slow->n_queries == 3 );      // at 0, 200 and 400 ms
+    CHECK( on_write->n_queries == 1 );  // only the initial value
+
+    // A change that isn't written through the API goes unnoticed...
+    on_write->value = 10;
+    watcher.advance( milliseconds( 1000 ) );
+    CHECK( on_write->n_queries == 1 );
+    CHECK( n_laser_changes == 0 );
+
+    // ... until we're told of it, and then it is queried right away
+    watcher.option_written( RS2_OPTION_LASER_POWER );
+    auto updated = watcher.advance( milliseconds( 0 ) );
+    CHECK( updated.size() == 1 );
+    CHECK( updated.count( RS2_OPTION_LASER_POWER ) == 1 );
+    CHECK( on_write->n_queries == 2 );
+    CHECK( n_laser_changes == 1 );
+
+    auto stats = watcher.get_statistics();
+    CHECK( stats.n_updates == 23 );
+    CHECK( stats.n_queries == size_t( fast->n_queries + slow->n_queries + on_write->n_queries ) );
+    CHECK( stats.n_changes == 4 );  // 3 initial values + laser power
+    CHECK( stats.to_json() == rsutils::json::parse( R"({ "updates": 23, "queries": 28, "changes": 4 })" ) );
+}
+
+TEST_CASE( "device notifications update on-write-only options" )
+{
+    manual_watcher watcher( milliseconds( 20 ) );
+    auto polled = std::make_shared< counting_option >();
+    auto notified = std::make_shared< counting_option >();
+    watcher.register_option( RS2_OPTION_GAIN, polled );
+    watcher.register_option( RS2_OPTION_EXPOSURE, notified, options_watcher::on_write_only );
+    auto subscription = watcher.subscribe( []( options_watcher::options_and_values const & ) {} );
+    watcher.advance( milliseconds( 0 ) );
+
+    notified->value = 5;
+    watcher.options_notified();
+    auto updated = watcher.advance( milliseconds( 0 ) );
+    CHECK( updated.size() == 1 );
+    CHECK( updated.count( RS2_OPTION_EXPOSURE ) == 1 );
+    CHECK( notified->n_queries == 2 );
+    CHECK( polled->n_queries == 1 );  // not due yet
+}
+
+TEST_CASE( "built-in update intervals" )
+{
+    CHECK( options_watcher::builtin_update_interval( RS2_OPTION_EXPOSURE ) == options_watcher::default_interval );
+    CHECK( options_watcher::builtin_update_interval( RS2_OPTION_FRAMES_QUEUE_SIZE ) == options_watcher::on_write_only );
+    CHECK( options_watcher::builtin_update_interval( RS2_OPTION_ASIC_TEMPERATURE ) > milliseconds( 1000 ) );
+
+    manual_watcher watcher( milliseconds( 100 ) );
+    auto exposure = std::make_shared< counting_option >();
+    auto queue_size = std::make_shared< counting_option >();
+    auto temperature = std::make_shared< counting_option >();
+    watcher.register_option( RS2_OPTION_EXPOSURE, exposure );
+    watcher.register_option( RS2_OPTION_FRAMES_QUEUE_SIZE, queue_size );
+    watcher.register_option( RS2_OPTION_ASIC_TEMPERATURE, temperature );
+    auto subscription = watcher.subscribe( []( options_watcher::options_and_values const & ) {} );
+
+    watcher.advance( milliseconds( 0 ) );
+    for( int i = 0; i < 10; ++i )
+        watcher.advance( milliseconds( 100 ) );
+    CHECK( exposure->n_queries == 11 );
+    CHECK( queue_size->n_queries == 1 );
+    CHECK( temperature->n_queries == 1 );
+}
+
+TEST_CASE( "NaN values are not changes" )
+{
+    manual_watcher watcher( milliseconds( 10 ) );
+    auto opt = std::make_shared< counting_option >();
+    opt->value = std::nanf( "" );
+    watcher.register_option( RS2_OPTION_GAIN, opt );
+
+    int n_changes = 0;
+    auto subscription = watcher.subscribe( [&]( options_watcher::options_and_values const & ) { ++n_changes; } );
+
+    watcher.advance( milliseconds( 0 ) );
+    n_changes = 0;  // the initial value is not a change
+    for( int i = 0; i < 10; ++i )
+        watcher.advance( milliseconds( 10 ) );
+    CHECK( opt->n_queries == 11 );
+    CHECK( n_changes == 0 );
+}
+
+TEST_CASE( "unchanged strings and objects are not changes" )
+{
+    manual_watcher watcher( milliseconds( 10 ) );
+    auto str = std::make_shared< json_option >();
+    auto obj = std::make_shared< json_option >();
+    str->json_value = "some value";
+    obj->json_value = rsutils::json::parse( R"({ "a": [1, 2.5, "x"], "b": { "c": null } })" );
+    watcher.register_option( RS2_OPTION_GAIN, str );
+    watcher.register_option( RS2_OPTION_EXPOSURE, obj );
+
+    int n_changes = 0;
+    auto subscription = watcher.subscribe( [&]( options_watcher::options_and_values const & ) { ++n_changes; } );
+
+    watcher.advance( milliseconds( 0 ) );
+    n_changes = 0;
+    for( int i = 0; i < 10; ++i )
+        watcher.advance( milliseconds( 10 ) );
+    CHECK( str->n_queries == 11 );
+    CHECK( n_changes == 0 );
+
+    obj->json_value["b"]["c"] = 1;
+    auto updated = watcher.advance( milliseconds( 10 ) );
+    CHECK( updated.size() == 1 );
+    CHECK( updated.count( RS2_OPTION_EXPOSURE ) == 1 );
+}
+
+TEST_CASE( "options without a value wait for their interval" )
+{
+    manual_watcher watcher( milliseconds( 100 ) );
+    auto null = std::make_shared< json_option >();  // e.g., cannot be queried when not streaming
+    auto failing = std::make_shared< failing_option >();
+    watcher.register_option( RS2_OPTION_GAIN, null );
+    watcher.register_option( RS2_OPTION_EXPOSURE, failing );
+    auto subscription = watcher.subscribe( []( options_watcher::options_and_values const & ) {} );
+
+    watcher.advance( milliseconds( 0 ) );
+    for( int i = 0; i < 9; ++i )
+        watcher.advance( milliseconds( 10 ) );
+    CHECK( null->n_queries == 1 );
+    CHECK( failing->n_queries == 1 );
+    watcher.advance( milliseconds( 10 ) );
+    CHECK( null->n_queries == 2 );
+    CHECK( failing->n_queries == 2 );
+}
+
+TEST_CASE( "update intervals from settings" )
+{
+    manual_watcher watcher( milliseconds( 1000 ) );
+    watcher.configure( rsutils::json::parse( R"({ "options-update-interval": 10,
+                                                  "options-update-intervals": { "Exposure": 0 } })" ) );
+    auto gain = std::make_shared< counting_option >();
+    auto exposure = std::make_shared< counting_option >();
+    watcher.register_option( RS2_OPTION_GAIN, gain );
+    watcher.register_option( RS2_OPTION_EXPOSURE, exposure );
+    auto subscription = watcher.subscribe( []( options_watcher::options_and_values const & ) {} );
+
+    watcher.advance( milliseconds( 0 ) );
+    for( int i = 0; i < 10; ++i )
+        watcher.advance( milliseconds( 10 ) );
+    CHECK( gain->n_queries == 11 );
+    CHECK( exposure->n_queries == 1 );
+
+    CHECK_THROWS( watcher.configure( rsutils::json::parse( R"({ "options-update-intervals": { "no such option": 0 } })" ) ) );
+}
+
+TEST_CASE( "writes are not held up by queries" )
+{
+    // A real updater thread, with a default interval long enough that only writes wake it
+    options_watcher watcher( std::chrono::hours( 1 ) );
+    auto slow = std::make_shared< blocking_option >();
+    auto written = std::make_shared< counting_option >();
+    watcher.register_option( RS2_OPTION_GAIN, slow );
+    watcher.register_option( RS2_OPTION_EXPOSURE, written );
+    auto subscription = watcher.subscribe( []( options_watcher::options_and_values const & ) {} );
+
+    // While the updater thread is stuck in a query, telling it of a write returns right away
+    REQUIRE( slow->wait_in_query() );
+    auto write = std::async( std::launch::async, [&] { watcher.option_written( RS2_OPTION_EXPOSURE ); } );
+    CHECK( write.wait_for( std::chrono::seconds( 2 ) ) == std::future_status::ready );
+
+    // ... and the written option is queried as soon as the query is done
+    slow->release();
+    CHECK( wait_until( [&] { return written->n_queries == 2; } ) );
+    CHECK( slow->n_queries == 1 );
+}
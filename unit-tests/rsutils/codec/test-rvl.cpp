@@ -0,0 +1,160 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+//#cmake:dependencies rsutils
+
+#include <unit-tests/test.h>
+#include <rsutils/codec/rvl.h>
+
+#include <cmath>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using namespace rsutils::codec;
+
+namespace {
+
+
+std::vector< uint8_t > encode( std::vector< uint16_t > const & pixels, unsigned trim_bits = 0 )
+{
+    std::vector< uint8_t > encoded( rvl_max_encoded_size( pixels.size() ) );
+    encoded.resize( rvl_encode( pixels.data(), pixels.size(), encoded.data(), trim_bits ) );
+    return encoded;
+}
+
+
+std::vector< uint16_t > decode( std::vector< uint8_t > const & encoded, size_t n_pixels )
+{
+    std::vector< uint16_t > pixels( n_pixels );
+    rvl_decode( encoded.data(), encoded.size(), pixels.data(), n_pixels );
+    return pixels;
+}
+
+
+// Smooth surfaces with noise and holes, like real depth
+std::vector< uint16_t > synthetic_depth( int w, int h )
+{
+    std::vector< uint16_t > depth( w * h );
+    std::mt19937 rng( 1 );
+    std::normal_distribution< double > noise( 0, 2 );
+    for( int y = 0; y < h; ++y )
+        for( int x = 0; x < w; ++x )
+        {
+            bool const hole = x < w / 20 || rng() % 50 == 0;
+            double const d = 1200 + 400 * std::sin( x / 90. ) + 300 * std::cos( y / 70. ) + noise( rng );
+            depth[y * w + x] = hole ? 0 : uint16_t( d );
+        }
+    return depth;
+}
+
+
+}  // namespace
+
+
+TEST_CASE( "rvl round-trip" )
+{
+    std::mt19937 rng( 2 );
+    for( size_t n : { 0, 1, 7, 8, 9, 100, 1000, 12345 } )
+    {
+        std::vector< uint16_t > random( n ), runs( n ), extremes( n );
+        for( size_t i = 0; i < n; ++i )
+        {
+            random[i] = uint16_t( rng() );
+            runs[i] = ( i / 13 ) % 3 ? uint16_t( 1000 + i % 7 ) : 0;
+            extremes[i] = i % 2 ? 65535 : ( i % 4 ? 0 : 1 );
+        }
+        for( auto const * pixels : { &random, &runs, &extremes } )
+        {
+            auto encoded = encode( *pixels );
+            CHECK( encoded.size() <= rvl_max_encoded_size( n ) );
+            CHECK( is_rvl( encoded.data(), encoded.size() ) );
+            CHECK( rvl_decoded_pixels( encoded.data(), encoded.size() ) == n );
+            CHECK( decode( encoded, n ) == *pixels );
+        }
+    }
+}
+
+TEST_CASE( "rvl compresses depth" )
+{
+    auto depth = synthetic_depth( 848, 480 );
+    auto encoded = encode( depth );
+    CHECK( decode( encoded, depth.size() ) == depth );
+    // 2 bytes per pixel vs. a little over a nibble, with noise and holes
+    CHECK( double( depth.size() * 2 ) / encoded.size() > 2.5 );
+}
+
+TEST_CASE( "rvl trimming" )
+{
+    auto depth = synthetic_depth( 320, 240 );
+    auto lossless = encode( depth );
+    for( unsigned trim_bits = 1; trim_bits <= rvl_max_trim_bits; ++trim_bits )
+    {
+        auto encoded = encode( depth, trim_bits );
+        CHECK( encoded.size() < lossless.size() );
+        auto decoded = decode( encoded, depth.size() );
+        int const max_error = 1 << ( trim_bits - 1 );
+        for( size_t i = 0; i < depth.size(); ++i )
+        {
+            if( depth[i] >> trim_bits )
+                CHECK( std::abs( int( decoded[i] ) - int( depth[i] ) ) <= max_error );
+            else
+                CHECK( decoded[i] == 0 );  // invalid stays invalid
+        }
+    }
+    CHECK_THROWS_AS( encode( depth, rvl_max_trim_bits + 1 ), std::invalid_argument );
+}
+
+TEST_CASE( "rvl into a smaller buffer" )
+{
+    std::mt19937 rng( 3 );
+    std::vector< uint16_t > noise( 1000 );
+    for( auto & p : noise )
+        p = uint16_t( rng() );
+    for( auto const & pixels : { synthetic_depth( 320, 240 ), noise } )
+    {
+        auto const expected = encode( pixels );
+        std::vector< uint8_t > encoded( expected.size() );
+        CHECK( rvl_encode( pixels.data(), pixels.size(), encoded.data(), encoded.size(), 0 ) == expected.size() );
+        CHECK( encoded == expected );
+        // One byte short, or not even room for the header
+        CHECK( rvl_encode( pixels.data(), pixels.size(), encoded.data(), encoded.size() - 1, 0 ) == 0 );
+        CHECK( rvl_encode( pixels.data(), pixels.size(), encoded.data(), 4, 0 ) == 0 );
+    }
+    // Depth fits in its own (decoded) size, but noise does not
+    auto depth = synthetic_depth( 848, 480 );
+    std::vector< uint8_t > frame( depth.size() * 2 );
+    CHECK( rvl_encode( depth.data(), depth.size(), frame.data(), frame.size(), 0 ) > 0 );
+    frame.resize( noise.size() * 2 );
+    CHECK( rvl_encode( noise.data(), noise.size(), frame.data(), frame.size(), 0 ) == 0 );
+}
+
+TEST_CASE( "rvl bad data" )
+{
+    auto depth = synthetic_depth( 64, 48 );
+    auto encoded = encode( depth );
+    std::vector< uint16_t > pixels( depth.size() );
+
+    CHECK_FALSE( is_rvl( reinterpret_cast< uint8_t const * >( depth.data() ), 2 * depth.size() ) );
+    CHECK_FALSE( is_rvl( encoded.data(), 8 ) );
+    // Wrong size
+    CHECK_THROWS_AS( rvl_decode( encoded.data(), encoded.size(), pixels.data(), pixels.size() - 1 ), std::runtime_error );
+    // Truncated
+    CHECK_THROWS_AS( rvl_decode( encoded.data(), encoded.size() / 2, pixels.data(), pixels.size() ), std::runtime_error );
+    CHECK_THROWS_AS( rvl_decode( encoded.data(), 8, pixels.data(), pixels.size() ), std::runtime_error );
+    // Corrupt data must never be read (or written) out of bounds: either it throws or it decodes to something
+    std::mt19937 rng( 3 );
+    for( int i = 0; i < 1000; ++i )
+    {
+        auto corrupt = encoded;
+        for( int j = 0; j < 4; ++j )
+            corrupt[12 + rng() % ( corrupt.size() - 12 )] = uint8_t( rng() );
+        try
+        {
+            rvl_decode( corrupt.data(), corrupt.size(), pixels.data(), pixels.size() );
+        }
+        catch( std::runtime_error const & )
+        {
+        }
+    }
+}
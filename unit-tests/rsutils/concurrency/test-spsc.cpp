@@ -0,0 +1,138 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+//#cmake:dependencies rsutils
+
+#include <unit-tests/test.h>
+#include <rsutils/concurrency/spsc-queue.h>
+
+#include <chrono>
+#include <thread>
+
+using rsutils::concurrency::spsc_queue;
+
+
+TEST_CASE( "capacity is a power of 2" )
+{
+    CHECK( spsc_queue< int >( 0 ).capacity() == 2 );
+    CHECK( spsc_queue< int >( 3 ).capacity() == 4 );
+    CHECK( spsc_queue< int >( 256 ).capacity() == 256 );
+}
+
+TEST_CASE( "push until full, pop until empty" )
+{
+    spsc_queue< int > q( 4 );
+    CHECK( q.empty() );
+    for( int i = 0; i < 4; ++i )
+        CHECK( q.try_push( i ) );
+    CHECK( q.size() == 4 );
+    CHECK_FALSE( q.try_push( 4 ) );
+    CHECK_FALSE( q.reserve() );
+
+    int x = -1;
+    for( int i = 0; i < 4; ++i )
+    {
+        REQUIRE( q.try_pop( x ) );
+        CHECK( x == i );
+    }
+    CHECK_FALSE( q.try_pop( x ) );
+    CHECK_FALSE( q.front() );
+
+    // Wraps around
+    for( int i = 0; i < 10; ++i )
+    {
+        CHECK( q.try_push( i ) );
+        REQUIRE( q.try_pop( x ) );
+        CHECK( x == i );
+    }
+}
+
+TEST_CASE( "in-place" )
+{
+    spsc_queue< int > q( 2 );
+    auto slot = q.reserve();
+    REQUIRE( slot );
+    *slot = 5;
+    CHECK( q.empty() );  // not until pushed
+    q.push();
+    REQUIRE( q.front() );
+    CHECK( *q.front() == 5 );
+    CHECK( q.size() == 1 );  // not until popped
+    q.pop();
+    CHECK( q.empty() );
+}
+
+TEST_CASE( "wait" )
+{
+    spsc_queue< int > q( 2 );
+    auto start = std::chrono::steady_clock::now();
+    CHECK_FALSE( q.wait_for( std::chrono::milliseconds( 50 ) ) );
+    CHECK( std::chrono::steady_clock::now() - start >= std::chrono::milliseconds( 50 ) );
+
+    std::thread producer(
+        [&]()
+        {
+            std::this_thread::sleep_for( std::chrono::milliseconds( 20 ) );
+            q.try_push( 1 );
+        } );
+    CHECK( q.wait_for( std::chrono::seconds( 5 ) ) );
+    producer.join();
+    CHECK( q.size() == 1 );
+
+    // Stop wakes us up, but leaves the items
+    q.pop();
+    std::thread stopper(
+        [&]()
+        {
+            std::this_thread::sleep_for( std::chrono::milliseconds( 20 ) );
+            q.stop();
+        } );
+    start = std::chrono::steady_clock::now();
+    CHECK_FALSE( q.wait_for( std::chrono::seconds( 5 ) ) );
+    CHECK( std::chrono::steady_clock::now() - start < std::chrono::seconds( 5 ) );
+    stopper.join();
+    CHECK( q.is_stopped() );
+
+    q.reset();
+    CHECK_FALSE( q.is_stopped() );
+}
+
+TEST_CASE( "producer and consumer threads" )
+{
+    // Every item arrives, in order, without the producer ever blocking: it spins if the consumer falls behind
+    size_t const N = 1000000;
+    spsc_queue< size_t > q( 64 );
+    size_t n_full = 0;
+    std::thread producer(
+        [&]()
+        {
+            for( size_t i = 0; i < N; ++i )
+            {
+                while( ! q.try_push( i ) )
+                {
+                    ++n_full;
+                    std::this_thread::yield();
+                }
+            }
+        } );
+
+    size_t expected = 0;
+    bool in_order = true;
+    while( expected < N )
+    {
+        if( ! q.wait_for( std::chrono::seconds( 5 ) ) )
+            break;
+        size_t x;
+        while( q.try_pop( x ) )
+        {
+            if( x != expected )
+                in_order = false;
+            ++expected;
+        }
+    }
+    producer.join();
+    CHECK( in_order );
+    CHECK( expected == N );
+    CHECK( q.empty() );
+    test::log.d( "producer found the queue full", n_full, "times" );
+}
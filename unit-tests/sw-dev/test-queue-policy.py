@@ -0,0 +1,86 @@
+# License: Apache 2.0. See LICENSE file in root directory.
+# Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+import pyrealsense2 as rs
+from rspy import log, test
+import sw
+import json
+from time import time, sleep
+
+
+def dropped( sensor ):
+    stats = json.loads( sensor._handle.get_statistics() )
+    log.d( stats )
+    return stats['streams']['Depth']['dropped'].get( 'archive-full', 0 )
+
+
+def try_publish( sensor, frame ):
+    """
+    Like sw.sensor.publish(), but the frame may be dropped: returns None if it was
+    """
+    sensor._handle.on_video_frame( frame )
+    f = sensor._q.poll_for_frame()
+    return f if f else None
+
+
+notifications = []
+def on_notification( n ):
+    if n.category == rs.notification_category.frames_dropped:
+        notifications.append( n.description )
+
+
+with sw.sensor( "Stereo Module" ) as sensor:
+    depth = sensor.video_stream( "Depth", rs.stream.depth, rs.format.z16 )
+    sensor._handle.set_notifications_callback( on_notification )
+
+    with test.closure( "Default policy" ):
+        test.check( sensor.supports( rs.option.frames_queue_policy ))
+        test.check( sensor.supports( rs.option.frames_queue_memory_limit ))
+        test.check_equal( rs.frames_queue_policy( int( sensor.get_option( rs.option.frames_queue_policy ))),
+                          rs.frames_queue_policy.drop_newest )
+
+    sensor.start( depth )
+    sensor.set_option( rs.option.frames_queue_size, 2 )  # a software sensor starts out unlimited
+
+    with test.closure( "DROP_NEWEST: new frames are dropped while we hold on to old ones" ):
+        frames = [sensor.publish( depth.frame() ) for i in range(2)]
+        test.check_false( try_publish( sensor, depth.frame() ))
+        test.check_equal( dropped( sensor ), 1 )
+        del frames
+        test.check( try_publish( sensor, depth.frame() ))
+
+    with test.closure( "Drops are notified" ):
+        sleep( 0.5 )  # notifications are raised asynchronously
+        test.check_equal( len( notifications ), 1 )
+        test.check( 'Depth (archive-full)' in notifications[0] )
+
+    with test.closure( "MEMORY_LIMIT: the frame data we hold is limited, not the number of frames" ):
+        colorizer = rs.colorizer()
+        colorizer.set_option( rs.option.frames_queue_policy, float( rs.frames_queue_policy.memory_limit ))
+        colorizer.set_option( rs.option.frames_queue_memory_limit, 2 )  # MB: room for 2 640x480 RGB8 frames
+        frames = [colorizer.process( sensor.publish( depth.frame() )) for i in range(2)]
+        test.check_throws( lambda: colorizer.process( sensor.publish( depth.frame() )), RuntimeError )
+        del frames
+        test.check( colorizer.process( sensor.publish( depth.frame() )))
+
+    with test.closure( "MEMORY_LIMIT: software frames, whose pixels are ours, are still limited by number" ):
+        sensor.set_option( rs.option.frames_queue_policy, float( rs.frames_queue_policy.memory_limit ))
+        frames = [sensor.publish( depth.frame() ) for i in range(2)]
+        test.check_false( try_publish( sensor, depth.frame() ))
+        test.check_equal( dropped( sensor ), 2 )
+        del frames
+
+    with test.closure( "BLOCK: wait a while before dropping" ):
+        sensor.set_option( rs.option.frames_queue_policy, float( rs.frames_queue_policy.block ))
+        frames = [sensor.publish( depth.frame() ) for i in range(2)]
+        start = time()
+        test.check_false( try_publish( sensor, depth.frame() ))
+        test.check( time() - start >= 0.09 )
+        test.check_equal( dropped( sensor ), 3 )
+        del frames
+        test.check( try_publish( sensor, depth.frame() ))
+
+
+#
+#############################################################################################
+test.print_results_and_exit()
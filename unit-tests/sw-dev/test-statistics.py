@@ -0,0 +1,48 @@
+# License: Apache 2.0. See LICENSE file in root directory.
+# Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+import pyrealsense2 as rs
+from rspy import log, test
+import sw
+import json
+
+
+def statistics( sensor ):
+    stats = json.loads( sensor._handle.get_statistics() )
+    log.d( stats )
+    return stats
+
+
+with sw.sensor( "Stereo Module" ) as sensor:
+    depth = sensor.video_stream( "Depth", rs.stream.depth, rs.format.z16 )
+
+    with test.closure( "Nothing counted before streaming" ):
+        test.check_equal( statistics( sensor ), { 'streams': {} } )
+
+    sensor.start( depth )
+
+    with test.closure( "Frames received and delivered are counted", on_fail=test.ABORT ):
+        frames = []
+        for i in range(5):
+            frames.append( sensor.publish( depth.frame() ))
+        streams = statistics( sensor )['streams']
+        test.check_equal( list( streams.keys() ), ['Depth'] )
+        depth_stats = streams['Depth']
+        test.check_equal( depth_stats['received'], 5 )
+        test.check_equal( depth_stats['delivered'], 5 )
+        test.check_equal( depth_stats['converted'], 0 )  # no conversion in a software sensor
+        test.check_equal( depth_stats['dropped'], {} )
+
+    with test.closure( "The archive tracks the frames we're holding" ):
+        archive = depth_stats['archive']
+        test.check_equal( archive['in-use'], 5 )
+        test.check( archive['high-water'] >= 5 )
+        test.check_equal( archive['capacity'], 0 )  # software sensors do not limit the frames we hold
+        del frames
+        test.check_equal( statistics( sensor )['streams']['Depth']['archive']['in-use'], 0 )
+        test.check( statistics( sensor )['streams']['Depth']['archive']['high-water'] >= 5 )
+
+
+#
+#############################################################################################
+test.print_results_and_exit()
@@ -154,6 +154,7 @@ void init_frame(py::module &m) {
         .def(BIND_DOWNCAST(frame, video_frame))
         .def(BIND_DOWNCAST(frame, depth_frame))
         .def(BIND_DOWNCAST(frame, motion_frame))
+        .def(BIND_DOWNCAST(frame, motion_block_frame))
         .def(BIND_DOWNCAST(frame, pose_frame))
         // No apply_filter?
         .def( "__repr__", []( const rs2::frame &self )
@@ -289,6 +290,17 @@ void init_frame(py::module &m) {
         .def("get_combined_motion_data", &rs2::motion_frame::get_combined_motion_data, "Retrieve motion data from a MOTION sensor")
         .def_property_readonly("motion_data", &rs2::motion_frame::get_motion_data, "Motion data from IMU sensor. Identical to calling get_motion_data.");
 
+    py::class_<rs2::motion_block_frame, rs2::frame> motion_block_frame(m, "motion_block_frame", "Extends the frame class with access to several consecutive motion samples");
+    motion_block_frame.def(py::init<rs2::frame>())
+        .def("size", &rs2::motion_block_frame::size, "The number of samples in the block")
+        .def("__len__", &rs2::motion_block_frame::size)
+        .def("get_timestamp_of", [](const rs2::motion_block_frame& self, size_t i) {
+            if (i >= self.size()) throw py::index_error();
+            return self.get_timestamps()[i]; }, "Retrieve the timestamp of a sample", "index"_a)
+        .def("get_motion_data", [](const rs2::motion_block_frame& self, size_t i) {
+            if (i >= self.size()) throw py::index_error();
+            return self.get_motion_data(i); }, "Retrieve the motion data of a sample", "index"_a);
+
     py::class_<rs2::pose_frame, rs2::frame> pose_frame(m, "pose_frame", "Extends the frame class with additional pose related attributes and functions.");
     pose_frame.def(py::init<rs2::frame>())
         .def("get_pose_data", &rs2::pose_frame::get_pose_data, "Retrieve the pose data from T2xx position tracking sensor.")
@@ -90,6 +90,12 @@ void init_processing(py::module &m) {
                                                           "get better performance. Othere implementations (GLSL, OpenCL, Neon, NCS) should follow.");
     yuy_decoder.def(py::init<>());
 
+    py::class_<rs2::resizing_color_converter, rs2::filter> resizing_color_converter(m, "resizing_color_converter", "Converts YUYV, UYVY, M420 and Y411 frames to RGB at a lower "
+                                                                                    "resolution in one pass, without a full-resolution RGB frame in between: the input divided by "
+                                                                                    "option.filter_magnitude, or option.resize_width x option.resize_height, with a box or bilinear "
+                                                                                    "option.resize_filter.");
+    resizing_color_converter.def(py::init<rs2_format, float>(), "target_format"_a = RS2_FORMAT_RGB8, "magnitude"_a = 2.f);
+
     py::class_<rs2::threshold_filter, rs2::filter> threshold(m, "threshold_filter", "Depth thresholding filter. By controlling min and "
                                                              "max options on the block, one could filter out depth values that are either too large "
                                                              "or too small, as a software post-processing step");
@@ -98,6 +104,13 @@ void init_processing(py::module &m) {
     py::class_<rs2::units_transform, rs2::filter> units_transform(m, "units_transform");
     units_transform.def(py::init<>());
 
+    py::class_<rs2::rvl_encoder, rs2::filter> rvl_encoder(m, "rvl_encoder", "Compresses Z16 depth into RVL (format.z16rvl) frames. "
+                                                          "trim_bits > 0 drops that many least-significant bits from each depth value (lossy) to compress further.");
+    rvl_encoder.def(py::init<int>(), "trim_bits"_a = 0);
+
+    py::class_<rs2::rvl_decoder, rs2::filter> rvl_decoder(m, "rvl_decoder", "Decompresses RVL (format.z16rvl) frames back into Z16 depth.");
+    rvl_decoder.def(py::init<>());
+
     // rs2::asynchronous_syncer
 
     py::class_<rs2::syncer> syncer(m, "syncer", "Sync instance to align frames from different streams");
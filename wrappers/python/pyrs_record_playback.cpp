@@ -17,11 +17,18 @@ void init_record_playback(py::module &m) {
         .def("get_position", &rs2::playback::get_position, "Retrieves the current position of the playback in the file in terms of time. Units are expressed in nanoseconds.")
         .def("get_duration", &rs2::playback::get_duration, "Retrieves the total duration of the file.")
         .def("seek", &rs2::playback::seek, "Sets the playback to a specified time point of the played data.", "time"_a)
+        .def("seek_to_frame", &rs2::playback::seek_to_frame, "Sets the playback to a specific frame (by its index in the file) of one of the recorded streams. Of several frames with the same timestamp, playback resumes from the first.", "profile"_a, "frame_index"_a)
+        .def("get_frame_count", &rs2::playback::get_frame_count, "Retrieves the number of frames recorded for one of the streams in the file.", "profile"_a)
         .def("is_real_time", &rs2::playback::is_real_time, "Indicates if playback is in real time mode or non real time.")
         .def("set_real_time", &rs2::playback::set_real_time, "Set the playback to work in real time or non real time. In real time mode, playback will "
              "play the same way the file was recorded. If the application takes too long to handle the callback, frames may be dropped. In non real time "
              "mode, playback will wait for each callback to finish handling the data before reading the next frame. In this mode no frames will be dropped, "
              "and the application controls the framerate of playback via callback duration.", "real_time"_a)
+        .def("set_read_ahead", &rs2::playback::set_read_ahead, "Set how much of the file the playback reads (and decompresses) ahead, in the background (by default, none except in max-throughput mode): "
+             "the number of chunks to keep ready ahead of playback (0 disables reading ahead), and the number of worker threads to do it on.", "chunks"_a, "threads"_a)
+        .def("set_max_throughput", &rs2::playback::set_max_throughput, "Play the file as a batch source, as fast as the frames are consumed: turns real time off, "
+             "reads ahead into a queue of up to queue_size frames per stream, and delivers the streams in parallel. 0 goes back to delivering one frame at a time.", "queue_size"_a)
+        .def("get_throughput", &rs2::playback::get_throughput, "The rate, in frames per second, at which the playback delivered frames (of all streams) since it last started.")
         // set_playback_speed?
         .def("set_status_changed_callback", [](rs2::playback& self, std::function<void(rs2_playback_status)> callback) {
             self.set_status_changed_callback(callback);
@@ -34,7 +41,10 @@ void init_record_playback(py::module &m) {
     recorder.def(py::init<const std::string&, rs2::device>())
         .def(py::init<const std::string&, rs2::device, bool>())
         .def("pause", &rs2::recorder::pause, "Pause the recording device without stopping the actual device from streaming.")
-        .def("resume", &rs2::recorder::resume, "Unpauses the recording device, making it resume recording.");
+        .def("resume", &rs2::recorder::resume, "Unpauses the recording device, making it resume recording.")
+        .def("set_depth_codec", &rs2::recorder::set_depth_codec, "Compress depth (Z16) frames with RVL as they are written; playback "
+             "decodes them back to Z16. trim_bits > 0 drops that many least-significant bits from each depth value (lossy).",
+             "enabled"_a, "trim_bits"_a = 0);
     // filename?
     /** end rs_record_playback.hpp **/
 }